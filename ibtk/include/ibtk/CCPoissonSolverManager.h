@@ -78,6 +78,7 @@ public:
      */
     static const std::string DEFAULT_LEVEL_SOLVER;
     static const std::string HYPRE_LEVEL_SOLVER;
+    static const std::string FFT_LEVEL_SOLVER;
     static const std::string PETSC_LEVEL_SOLVER;
 
     /*!
@@ -0,0 +1,121 @@
+// Filename: CounterBasedRNG.h
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_CounterBasedRNG
+#define included_IBTK_CounterBasedRNG
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ArrayData.h"
+#include "Box.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class CounterBasedRNG provides a stateless, counter-based
+ * pseudorandom number generator (Philox-4x32-10) for generating random patch
+ * data.
+ *
+ * The generated values depend only on a 128-bit counter and a 64-bit key.  The
+ * counter is built from the global index of each data point along with a
+ * stream identifier, and the key is typically built from a seed and a time step
+ * number, so that the generated fields are independent of the parallel
+ * decomposition and may be generated in any order and from any thread.
+ *
+ * REFERENCE: J. K. Salmon, M. A. Moraes, R. O. Dror, and D. E. Shaw, "Parallel
+ * Random Numbers: As Easy as 1, 2, 3", Proceedings of the International
+ * Conference for High Performance Computing, Networking, Storage and Analysis
+ * (SC11), 2011.
+ */
+class CounterBasedRNG
+{
+public:
+    /*!
+     * \brief Generate four pseudorandom real numbers uniformly distributed on
+     * the (0,1)-interval from the specified counter and key.
+     */
+    static void genrand(double rn[4], const unsigned int counter[4], const unsigned int key[2]);
+
+    /*!
+     * \brief Set all depths of the array data in the specified box to standard
+     * normal pseudorandom real numbers.
+     *
+     * The values at each index are generated in blocks of four depths from a
+     * counter built from the index and a stream identifier composed of \p
+     * level_num, \p field_num, \p component_num, and the depth block number.
+     * The stream identifier is packed into 32 bits, allowing up to 32 levels,
+     * 2048 fields, 16 components, and 16384 depths.  An unrecoverable error
+     * occurs if any of these ranges are exceeded, because doing so would
+     * silently reuse counters and correlate distinct random fields.
+     */
+    static void genrandn(SAMRAI::pdat::ArrayData<NDIM, double>& data,
+                         const SAMRAI::hier::Box<NDIM>& box,
+                         const unsigned int key[2],
+                         int level_num,
+                         int field_num,
+                         int component_num);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    CounterBasedRNG();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    CounterBasedRNG(const CounterBasedRNG& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    CounterBasedRNG& operator=(const CounterBasedRNG& that);
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_CounterBasedRNG
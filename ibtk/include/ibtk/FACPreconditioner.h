@@ -119,6 +119,17 @@ public:
      */
     void setTimeInterval(double current_time, double new_time);
 
+    /*!
+     * \brief Specify the range of levels that must be reset by the next call
+     * to initializeSolverState().
+     *
+     * When the preconditioner is already initialized and a valid range is
+     * provided, the next call to initializeSolverState() retains the operator
+     * state associated with levels outside of this range, including the state
+     * of the coarse level solver when the coarsest level is not reset.
+     */
+    void setResetLevels(int coarsest_ln, int finest_ln);
+
     /*!
      * \brief Solve the linear system of equations \f$Ax=b\f$ for \f$x\f$.
      *
@@ -195,7 +206,8 @@ public:
      *
      * \note It is safe to call initializeSolverState() when the state is
      * already initialized.  In this case, the solver state is first deallocated
-     * and then reinitialized.
+     * and then reinitialized, unless a range of levels to reset has been
+     * specified via setResetLevels().
      *
      * \see deallocateSolverState
      */
@@ -297,6 +309,7 @@ protected:
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
     int d_coarsest_ln;
     int d_finest_ln;
+    int d_coarsest_reset_ln, d_finest_reset_ln;
     MGCycleType d_cycle_type;
     int d_num_pre_sweeps, d_num_post_sweeps;
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_f, d_r;
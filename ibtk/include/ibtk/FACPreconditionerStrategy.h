@@ -220,6 +220,15 @@ public:
      */
     virtual void deallocateOperatorState();
 
+    /*!
+     * \brief Specify the range of levels to be reset the next time the
+     * operator state is initialized.
+     *
+     * The default implementation is empty, in which case the operator state is
+     * always completely reinitialized.
+     */
+    virtual void setResetLevels(int coarsest_ln, int finest_ln);
+
     /*!
      * \brief Allocate scratch data.
      */
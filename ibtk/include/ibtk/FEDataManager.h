@@ -44,6 +44,7 @@
 #include <vector>
 
 #include "BasePatchLevel.h"
+#include "BoxArray.h"
 #include "CellVariable.h"
 #include "IntVector.h"
 #include "LoadBalancer.h"
@@ -683,12 +684,18 @@ private:
     void updateQuadPointCountData(int coarsest_ln, int finest_ln);
 
     /*!
-     * Compute the bounding boxes of all active elements.
+     * Compute the bounding boxes of all active elements, grown by the specified
+     * padding.
+     *
+     * Bounding boxes are cached between calls, and the bounding box of an
+     * element is only recomputed once one of its nodes leaves the cached
+     * bounding box, i.e., once the element has moved by more than (roughly)
+     * the padding distance.
      *
      * \note For inactive elements, the lower and upper bound values will be
      * identically zero.
      */
-    std::vector<std::pair<Point, Point> >* computeActiveElementBoundingBoxes();
+    std::vector<std::pair<Point, Point> >* computeActiveElementBoundingBoxes(double padding = 0.0);
 
     /*!
      * Collect all of the active elements which are located within a local
@@ -696,6 +703,18 @@ private:
      *
      * In this method, the determination as to whether an element is local or
      * not is based on the position of the bounding box of the element.
+     * Candidate patches for each element are located using a uniform bin grid
+     * over the local patches, and elements whose bounding boxes lie well
+     * within a patch are assigned to it without evaluating the positions of
+     * their quadrature points.
+     *
+     * For elements with first-order Lagrange basis functions, the assignment
+     * for the patch level and ghost cell width managed by this object is
+     * cached.  If the patch level has the same boxes and processor mapping as
+     * when the assignment was cached, only the elements whose bounding boxes
+     * have been recomputed since then are binned again, and only the elements
+     * whose bounding boxes straddle a patch boundary have their quadrature
+     * points evaluated again.
      */
     void collectActivePatchElements(std::vector<std::vector<libMesh::Elem*> >& active_patch_elems,
                                     int level_number,
@@ -803,6 +822,20 @@ private:
     std::vector<std::vector<libMesh::Elem*> > d_active_patch_elem_map;
     std::map<std::string, std::vector<unsigned int> > d_active_patch_ghost_dofs;
     std::vector<std::pair<Point, Point> > d_active_elem_bboxes;
+    std::vector<bool> d_active_elem_bbox_valid;
+
+    /*
+     * Data used to incrementally update the mappings between mesh elements and
+     * grid patches.  For each local patch, we keep the elements whose bounding
+     * boxes lie within the patch interior and the elements whose bounding boxes
+     * straddle the patch boundary, along with the IDs of the elements whose
+     * bounding boxes have been recomputed since the assignment was cached.
+     */
+    bool d_elem_patch_cache_valid;
+    SAMRAI::hier::BoxArray<NDIM> d_elem_patch_cache_boxes;
+    std::vector<int> d_elem_patch_cache_proc_mapping;
+    std::vector<std::vector<libMesh::Elem*> > d_contained_patch_elems, d_straddling_patch_elems;
+    std::vector<unsigned int> d_moved_elem_ids;
 
     /*
      * Ghost vectors for the various equation systems.
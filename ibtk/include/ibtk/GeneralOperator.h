@@ -136,6 +136,27 @@ public:
      */
     virtual SAMRAI::tbox::Pointer<HierarchyMathOps> getHierarchyMathOps() const;
 
+    /*!
+     * \brief Specify whether scratch data required to evaluate the operator is
+     * allocated once in initializeOperatorState() and retained until
+     * deallocateOperatorState(), or is instead allocated and deallocated each
+     * time the operator is applied.
+     *
+     * \note By default, scratch data are retained between operator
+     * applications.  Transient allocation reduces the memory footprint of the
+     * operator at the expense of allocator traffic within iterative solvers.
+     *
+     * \note This setting must be specified prior to the call to
+     * initializeOperatorState().
+     */
+    virtual void setUsePersistentWorkspace(bool use_persistent_workspace);
+
+    /*!
+     * \brief Determine whether scratch data are retained between operator
+     * applications.
+     */
+    virtual bool getUsePersistentWorkspace() const;
+
     /*!
      * \brief Compute \f$y=F[x]\f$.
      *
@@ -312,6 +333,9 @@ protected:
     SAMRAI::tbox::Pointer<HierarchyMathOps> d_hier_math_ops;
     bool d_hier_math_ops_external;
 
+    // Scratch data allocation strategy.
+    bool d_use_persistent_workspace;
+
     // Logging configuration.
     bool d_enable_logging;
 
@@ -239,6 +239,22 @@ public:
      */
     virtual void deallocateSolverState();
 
+    /*!
+     * \brief Specify the range of levels that must be reset by the next call
+     * to initializeSolverState().
+     *
+     * When the solver state is already initialized, subclasses may use this
+     * range to rebuild only the hierarchy dependent data associated with the
+     * specified levels (and with their coarse-fine interfaces with the next
+     * coarser level), rather than deallocating and reinitializing the entire
+     * solver state.  The range applies only to the next initialization and is
+     * cleared afterwards.
+     *
+     * \note The default implementation is empty, in which case the solver is
+     * always completely reinitialized.
+     */
+    virtual void setResetLevels(int coarsest_ln, int finest_ln);
+
     //\}
 
     /*!
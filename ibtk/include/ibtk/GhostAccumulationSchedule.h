@@ -0,0 +1,133 @@
+// Filename: GhostAccumulationSchedule.h
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_GhostAccumulationSchedule
+#define included_IBTK_GhostAccumulationSchedule
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "Box.h"
+#include "IntVector.h"
+#include "PatchLevel.h"
+#include "tbox/Pointer.h"
+#include "tbox/Schedule.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class GhostAccumulationSchedule is used to sum ghost cell values
+ * across the patches of a patch level, i.e., to perform the reverse of a ghost
+ * cell fill.
+ *
+ * For each patch on the level, the values of the source patch data stored on
+ * the ghost box of that patch (interior and ghost cells) are added to the
+ * destination patch data on the ghost box of every patch, including the patch
+ * itself and periodic images, that overlaps it.  After communication, the
+ * destination data on each patch hold the sum of the source data from all
+ * patches, as if the source values had been generated directly on the ghost box
+ * of that patch.  Source and destination patch data indices must refer to
+ * distinct data with the same centering and ghost cell width.
+ *
+ * \note This class is designed to be used with data on a single patch level
+ * and does not account for coarse-fine interfaces.
+ */
+class GhostAccumulationSchedule
+{
+public:
+    /*!
+     * \brief Constructor
+     */
+    GhostAccumulationSchedule(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                              int src_patch_data_idx,
+                              int dst_patch_data_idx);
+
+    /*!
+     * \brief Destructor
+     */
+    ~GhostAccumulationSchedule();
+
+    /*!
+     * \brief Communicate and accumulate data.
+     */
+    void communicate();
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    GhostAccumulationSchedule();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    GhostAccumulationSchedule(const GhostAccumulationSchedule& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    GhostAccumulationSchedule& operator=(const GhostAccumulationSchedule& that);
+
+    /*!
+     * Return the box of periodic image offsets (in units of the periodic
+     * shift) that must be considered in each coordinate direction.
+     */
+    static SAMRAI::hier::Box<NDIM> getPeriodicShiftBox(const SAMRAI::hier::IntVector<NDIM>& periodic_shift);
+
+    /*!
+     * Append transactions for all nonempty overlaps between the ghost boxes of
+     * the specified source and destination patches.
+     */
+    void appendTransactions(int src_patch_num, int dst_patch_num);
+
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_patch_level;
+    const int d_src_patch_data_idx, d_dst_patch_data_idx;
+    SAMRAI::tbox::Schedule d_schedule;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_GhostAccumulationSchedule
@@ -0,0 +1,210 @@
+// Filename: GhostAccumulationTransaction.h
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_GhostAccumulationTransaction
+#define included_IBTK_GhostAccumulationTransaction
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <iosfwd>
+
+#include "ArrayData.h"
+#include "BoxList.h"
+#include "BoxOverlap.h"
+#include "PatchData.h"
+#include "PatchLevel.h"
+#include "tbox/Pointer.h"
+#include "tbox/Transaction.h"
+
+namespace SAMRAI
+{
+namespace tbox
+{
+class AbstractStream;
+} // namespace tbox
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class GhostAccumulationTransaction is a concrete implementation of the
+ * abstract base class SAMRAI::tbox::Transaction.  It is used to add the values
+ * stored on the ghost box of one patch to the corresponding values on the ghost
+ * box of another patch on the same level of the patch hierarchy.
+ *
+ * Unlike the copy transactions used by SAMRAI communication schedules, the
+ * values communicated by this transaction are summed into the destination
+ * patch data.
+ *
+ * \note Only double-precision cell-, node-, side-, and edge-centered data are
+ * supported.
+ */
+class GhostAccumulationTransaction : public SAMRAI::tbox::Transaction
+{
+public:
+    /*!
+     * \brief Constructor
+     *
+     * \param src_proc Rank of the process that owns the source patch.
+     * \param dst_proc Rank of the process that owns the destination patch.
+     * \param patch_level Patch level containing both patches.
+     * \param src_patch_num Patch number of the source patch.
+     * \param dst_patch_num Patch number of the destination patch.
+     * \param src_patch_data_idx Patch data index of the accumulated values.
+     * \param dst_patch_data_idx Patch data index into which values are summed.
+     * \param overlap Overlap between the ghost boxes of the source and
+     * destination patches.
+     */
+    GhostAccumulationTransaction(int src_proc,
+                                 int dst_proc,
+                                 SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > patch_level,
+                                 int src_patch_num,
+                                 int dst_patch_num,
+                                 int src_patch_data_idx,
+                                 int dst_patch_data_idx,
+                                 SAMRAI::tbox::Pointer<SAMRAI::hier::BoxOverlap<NDIM> > overlap);
+
+    /*!
+     * \brief Destructor
+     */
+    ~GhostAccumulationTransaction();
+
+    /*!
+     * Return a boolean indicating whether this transaction can estimate the
+     * size of an incoming message.
+     */
+    bool canEstimateIncomingMessageSize();
+
+    /*!
+     * Return the amount of buffer space needed for the incoming message.
+     * This routine is only called if the transaction can estimate the
+     * size of the incoming message.
+     */
+    int computeIncomingMessageSize();
+
+    /*!
+     * Return the buffer space needed for the outgoing message.
+     */
+    int computeOutgoingMessageSize();
+
+    /*!
+     * Return the sending processor for the communications transaction.
+     */
+    int getSourceProcessor();
+
+    /*!
+     * Return the receiving processor for the communications transaction.
+     */
+    int getDestinationProcessor();
+
+    /*!
+     * Pack the transaction data into the message stream.
+     */
+    void packStream(SAMRAI::tbox::AbstractStream& stream);
+
+    /*!
+     * Unpack the transaction data from the message stream and add it to the
+     * destination patch data.
+     */
+    void unpackStream(SAMRAI::tbox::AbstractStream& stream);
+
+    /*!
+     * Perform the local data accumulation for the transaction.
+     */
+    void copyLocalData();
+
+    /*!
+     * Print out transaction information.
+     */
+    void printClassData(std::ostream& stream) const;
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    GhostAccumulationTransaction();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    GhostAccumulationTransaction(const GhostAccumulationTransaction& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    GhostAccumulationTransaction& operator=(const GhostAccumulationTransaction& that);
+
+    /*!
+     * Allocate a zero-initialized buffer that covers the destination region of
+     * the overlap.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> > allocateBuffer() const;
+
+    /*!
+     * Add the buffered values to the destination patch data on the
+     * destination region of the overlap.
+     */
+    void accumulateBuffer(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> > buffer);
+
+    /*!
+     * Add the buffered values to the destination array data on the specified
+     * boxes.
+     */
+    static void addBoxes(SAMRAI::pdat::ArrayData<NDIM, double>& dst_arr,
+                         const SAMRAI::pdat::ArrayData<NDIM, double>& buf_arr,
+                         const SAMRAI::hier::BoxList<NDIM>& dst_boxes);
+
+    const int d_src_proc, d_dst_proc;
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_patch_level;
+    const int d_src_patch_num, d_dst_patch_num;
+    const int d_src_patch_data_idx, d_dst_patch_data_idx;
+    SAMRAI::tbox::Pointer<SAMRAI::hier::BoxOverlap<NDIM> > d_overlap;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_GhostAccumulationTransaction
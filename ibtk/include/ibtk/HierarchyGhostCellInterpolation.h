@@ -36,6 +36,8 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <deque>
+#include <map>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -89,6 +91,15 @@ namespace IBTK
  * \note In cases where physical boundary conditions are set via extrapolation
  * from interior values, setting ghost cell values may require both coarsening
  * and refining.
+ *
+ * \note Communication schedules are cached and keyed by the data indices,
+ * patch data types, ghost cell widths, refine and coarsen operators, and fill
+ * patterns of the transaction components.  Resetting the transaction
+ * components to a previously used configuration selects the cached schedules
+ * without rebuilding them.  When a new configuration evicts a cached schedule
+ * set with the same structure, that set is reset to communicate the new patch
+ * data instead of generating new schedules.  The cache is cleared whenever the
+ * operator state is (re)initialized.
  */
 class HierarchyGhostCellInterpolation : public SAMRAI::tbox::DescribedClass
 {
@@ -291,6 +302,33 @@ public:
      */
     void setHomogeneousBc(bool homogeneous_bc);
 
+    /*!
+     * \brief Set the maximum number of communication schedule sets retained by
+     * the operator.  When the cache is full, the least recently used entry is
+     * discarded.
+     *
+     * \note The default cache size is 40, which retains one schedule set for
+     * each basis vector of a restarted GMRES(30) or FGMRES(30) solve along with
+     * the work vectors of the operator.  Each schedule set holds communication
+     * schedules for every level, so smaller caches may be preferable for large
+     * hierarchies.  A cache size of 1 retains only the most recently used
+     * schedules.
+     */
+    void setScheduleCacheSize(unsigned int cache_size);
+
+    /*!
+     * \brief Return the number of calls to resetTransactionComponents() that
+     * were satisfied by cached communication schedules without rebuilding
+     * them.
+     */
+    unsigned int getScheduleCacheHits() const;
+
+    /*!
+     * \brief Return the number of calls to resetTransactionComponents() that
+     * required communication schedules to be generated or reset.
+     */
+    unsigned int getScheduleCacheMisses() const;
+
     /*!
      * \brief Setup the hierarchy ghost cell interpolation operator to perform
      * the specified interpolation transactions on the specified patch
@@ -359,6 +397,21 @@ private:
      */
     HierarchyGhostCellInterpolation& operator=(const HierarchyGhostCellInterpolation& that);
 
+    /*!
+     * \brief Return the key used to look up the cached communication schedules
+     * for the specified transaction components.  Without the data indices, the
+     * key identifies schedules that may be reset to communicate one another's
+     * patch data.
+     */
+    static std::string getScheduleCacheKey(const std::vector<InterpolationTransactionComponent>& transaction_comps,
+                                           bool include_data_idxs);
+
+    /*!
+     * \brief Store the current communication algorithms and schedules in the
+     * schedule cache under the specified key.
+     */
+    void cacheSchedules(const std::string& key, const std::string& config_key);
+
     // Boolean indicating whether the operator is initialized.
     bool d_is_initialized;
 
@@ -383,6 +436,21 @@ private:
     SAMRAI::xfer::RefinePatchStrategy<NDIM>* d_refine_strategy;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > d_refine_scheds;
 
+    // Communications algorithms and schedules for previously used transaction
+    // components, along with cache statistics.
+    struct ScheduleCacheEntry
+    {
+        std::string config_key;
+        SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenAlgorithm<NDIM> > coarsen_alg;
+        std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > > coarsen_scheds;
+        SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineAlgorithm<NDIM> > refine_alg;
+        std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > > refine_scheds;
+    };
+    std::map<std::string, ScheduleCacheEntry> d_sched_cache;
+    std::deque<std::string> d_sched_cache_keys;
+    unsigned int d_sched_cache_size;
+    unsigned int d_sched_cache_hits, d_sched_cache_misses;
+
     // Cached coarse-fine boundary and physical boundary condition handlers.
     std::vector<SAMRAI::tbox::Pointer<CoarseFineBoundaryRefinePatchStrategy> > d_cf_bdry_ops;
     std::vector<SAMRAI::tbox::Pointer<CartExtrapPhysBdryOp> > d_extrap_bc_ops;
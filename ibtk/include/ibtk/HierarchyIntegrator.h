@@ -53,6 +53,7 @@
 #include "GriddingAlgorithm.h"
 #include "IntVector.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "RefineAlgorithm.h"
 #include "RefineSchedule.h"
 #include "StandardTagAndInitStrategy.h"
@@ -578,6 +579,45 @@ public:
                           SAMRAI::tbox::Pointer<SAMRAI::hier::VariableContext> ctx =
                               SAMRAI::tbox::Pointer<SAMRAI::hier::VariableContext>(NULL));
 
+    /*!
+     * Output a report of the patch data memory associated with the variables
+     * registered with this integrator and with any child integrators.
+     *
+     * For each registered patch data descriptor index, the report lists the
+     * variable and context names, the ghost cell width, and the local, total,
+     * and maximum per-process number of bytes required to store the data on
+     * the patch hierarchy.  Sizes are computed from the patch data factories,
+     * and so are reported regardless of whether the data are currently
+     * allocated.
+     *
+     * The report also compares the peak per-process memory required during a
+     * time step with and without deferred allocation.  The peak with deferral
+     * uses the largest amount of deferred data allocated at one time since the
+     * most recent regrid.
+     *
+     * \note This is a collective operation.
+     */
+    void printPatchDataMemoryReport(std::ostream& os) const;
+
+    /*!
+     * Write the events recorded by the TraceRecorder to the output files
+     * specified in the input database.
+     *
+     * If the input key <tt>trace_file_name</tt> is set, each process writes
+     * its timeline as a Chrome trace-event JSON file.  If the input key
+     * <tt>trace_summary_file_name</tt> is set, a CSV summary of the time spent
+     * in each phase of each time step is written.  The top-level integrator
+     * writes these files every <tt>trace_write_interval</tt> time steps (if
+     * positive) and after the final time step.  Setting either file name also
+     * enables event recording.
+     *
+     * \note Events are only recorded when IBTK and IBAMR are compiled with
+     * IBTK_ENABLE_TRACING defined.
+     *
+     * \note This is a collective operation.
+     */
+    void writeTraceData() const;
+
     ///
     ///  Implementations of functions declared in the SAMRAI::tbox::Serializable
     ///  abstract base class.
@@ -850,6 +890,77 @@ protected:
         return d_at_regrid_time_step;
     }
 
+    /*!
+     * Regrid all finer levels of the patch hierarchy according to the regrid
+     * mode, and determine which levels were left unchanged by the regridding
+     * operation.
+     *
+     * A level is considered to be unchanged when its new boxes and their
+     * processor assignments match those of the level that it replaces.
+     * Array-based data on such levels are copied directly from the old level
+     * rather than being refilled from coarser levels.  Other data, such as
+     * index data that may have been moved to coarser levels before regridding,
+     * are always refilled from coarser levels.
+     */
+    void regridPatchLevels();
+
+    /*!
+     * Returns true when the specified level was unchanged by the most recent
+     * regridding operation.
+     */
+    bool levelUnchangedByRegrid(int level_number) const;
+
+    /*!
+     * Returns true when every level of the patch hierarchy was unchanged by the
+     * most recent regridding operation.
+     */
+    bool hierarchyUnchangedByRegrid() const;
+
+    /*!
+     * Returns true when the two patch levels have the same refinement ratio,
+     * the same boxes, and the same processor mapping.
+     */
+    static bool levelsHaveSameConfiguration(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > level,
+                                            SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > old_level);
+
+    /*!
+     * Record the time saved by skipping work for levels that were unchanged by
+     * regridding.
+     */
+    void accumulateRegridTimeSaved(double time_saved);
+
+    /*!
+     * Output a summary of the most recent regridding operation to the log
+     * file.
+     */
+    void logRegridSummary();
+
+    /*!
+     * Exclude the patch data associated with the specified patch data
+     * descriptor index from the collections of scratch and new data that are
+     * allocated by the integrator at the beginning of each time step and when
+     * initializing level data.
+     *
+     * This is intended for scratch data that are only required during part of
+     * a time step or by specialized operations, such as regridding.  Such data
+     * are allocated and deallocated by allocateDeferredPatchData() and
+     * deallocateDeferredPatchData() around their use.  Deferred scratch data of
+     * state variables are still allocated when filling data after regridding.
+     */
+    void deferPatchDataAllocation(int data_idx);
+
+    /*!
+     * Allocate deferred patch data on all levels of the patch hierarchy,
+     * recording the amount of deferred data allocated at one time for the
+     * patch data memory report.
+     */
+    void allocateDeferredPatchData(int data_idx, double data_time);
+
+    /*!
+     * Deallocate deferred patch data on all levels of the patch hierarchy.
+     */
+    void deallocateDeferredPatchData(int data_idx);
+
     /*
      * The object name is used as a handle to databases stored in restart files
      * and for error reporting purposes.
@@ -928,6 +1039,19 @@ protected:
      */
     bool d_enable_logging;
 
+    /*
+     * Indicates whether the integrator should output a report of patch data
+     * memory usage after initializing and regridding the patch hierarchy.
+     */
+    bool d_enable_memory_report;
+
+    /*
+     * Output files for the events recorded by the TraceRecorder and the
+     * interval (in time steps) at which they are written.
+     */
+    std::string d_trace_file_name, d_trace_summary_file_name;
+    int d_trace_write_interval;
+
     /*
      * The type of extrapolation to use at physical boundaries when prolonging
      * data during regridding.
@@ -959,6 +1083,13 @@ protected:
     std::list<SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > > d_copy_scratch_to_current_slow;
 
     SAMRAI::hier::ComponentSelector d_current_data, d_new_data, d_scratch_data;
+    SAMRAI::hier::ComponentSelector d_deferred_data, d_deferred_data_allocated;
+
+    /*
+     * The largest number of bytes of deferred data allocated at one time on
+     * this process since the most recent regrid.
+     */
+    double d_deferred_data_peak_local_bytes;
 
     std::map<SAMRAI::hier::Variable<NDIM>*, SAMRAI::tbox::Pointer<CartGridFunction> > d_state_var_init_fcns;
 
@@ -978,6 +1109,9 @@ protected:
     SAMRAI::hier::ComponentSelector d_fill_after_regrid_bc_idxs;
     SAMRAI::xfer::RefineAlgorithm<NDIM> d_fill_after_regrid_prolong_alg;
     SAMRAI::xfer::RefinePatchStrategy<NDIM>* d_fill_after_regrid_phys_bdry_bc_op;
+    SAMRAI::hier::ComponentSelector d_copy_after_regrid_idxs;
+    SAMRAI::xfer::RefineAlgorithm<NDIM> d_fill_unchanged_level_after_regrid_prolong_alg;
+    bool d_fill_unchanged_level_after_regrid;
 
     /*!
      * Callback functions and callback function contexts.
@@ -1030,6 +1164,12 @@ private:
      */
     void getFromRestart();
 
+    /*!
+     * Reset the record of the deferred data allocated at one time by this
+     * integrator and any child integrators.
+     */
+    void resetDeferredPatchDataPeak();
+
     /*
      * Indicates whether we are currently regridding the hierarchy, or whether
      * the time step began by regridding the hierarchy.
@@ -1038,6 +1178,20 @@ private:
     bool d_at_regrid_time_step;  // true for the duration of a time step that included a regrid
                                  // operation
 
+    /*
+     * Per-level change tracking for regridding operations, along with
+     * estimates of the cost of the work that regridding changed levels incurs
+     * and of the time saved by skipping that work for unchanged levels.
+     *
+     * The domain volume is cached between regrids so that the volume check
+     * only needs to be computed once per regridding operation.
+     */
+    std::vector<bool> d_level_unchanged_by_regrid;
+    bool d_hierarchy_unchanged_by_regrid;
+    double d_regrid_fill_time_per_cell;
+    double d_regrid_time_saved, d_total_regrid_time_saved;
+    double d_hierarchy_volume;
+
     /*
      * Cached communications algorithms, strategies, and schedules.
      */
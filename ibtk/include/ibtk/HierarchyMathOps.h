@@ -1193,6 +1193,21 @@ public:
                      SAMRAI::tbox::Pointer<HierarchyGhostCellInterpolation> src_ghost_fill,
                      double src_ghost_fill_time);
 
+    /*!
+     * \brief Synchronize side-centered data along the coarse-fine interface.
+     *
+     * Sets the values of dst on the coarse side of each coarse-fine interface
+     * to the restriction of the values of dst on the next finer level.  This is
+     * the same synchronization that is performed by the side-centered
+     * operators, and it allows patch-level kernels that compute several
+     * quantities in a single pass to produce composite-grid results that are
+     * consistent with those operators.
+     *
+     * \see setPatchHierarchy
+     * \see resetLevels
+     */
+    void synchronizeCoarseFineBoundary(int dst_idx);
+
 private:
     /*!
      * \brief Default constructor.
@@ -95,6 +95,14 @@ public:
      */
     void setTimeInterval(double current_time, double new_time);
 
+    /*!
+     * \brief Specify the range of levels that must be reset by the next call
+     * to initializeSolverState().
+     *
+     * The range is forwarded to the preconditioner, if any.
+     */
+    void setResetLevels(int coarsest_ln, int finest_ln);
+
     //\}
 
     /*!
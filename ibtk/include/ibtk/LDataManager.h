@@ -69,7 +69,9 @@
 
 namespace IBTK
 {
+class GhostAccumulationSchedule;
 class LData;
+class LEOperatorCache;
 class LMesh;
 class LNode;
 class RobinPhysBdryPatchStrategy;
@@ -81,6 +83,11 @@ namespace hier
 template <int DIM>
 class BasePatchHierarchy;
 } // namespace hier
+namespace math
+{
+template <int DIM, class TYPE>
+class HierarchyDataOpsReal;
+} // namespace math
 namespace tbox
 {
 class Database;
@@ -205,6 +212,31 @@ public:
      */
     const std::string& getDefaultSpreadKernelFunction() const;
 
+    /*!
+     * \brief Specify whether spreading operations use the "owner-computes"
+     * strategy.
+     *
+     * By default, each patch spreads all of the Lagrangian nodes that lie
+     * within its ghost cell region, so that a node near a patch boundary is
+     * spread once for every local patch that sees it.  With the owner-computes
+     * strategy, each node is spread exactly once, by the patch that owns it,
+     * onto the ghost box of that patch.  The overlapping ghost box values are
+     * then summed across patches by a reverse (accumulating) communication
+     * schedule before physical boundary conditions are applied.
+     *
+     * \note The owner-computes strategy does not use operator caches passed to
+     * spread().  It requires the Eulerian data to have at least the minimum
+     * ghost cell width of the spreading kernel; an unrecoverable error occurs
+     * otherwise.
+     */
+    void setUseOwnerComputesSpreading(bool use_owner_computes_spreading);
+
+    /*!
+     * \brief Return whether spreading operations use the "owner-computes"
+     * strategy.
+     */
+    bool getUseOwnerComputesSpreading() const;
+
     /*!
      * \brief Spread a quantity from the Lagrangian mesh to the Eulerian grid
      * using the default spreading kernel function.
@@ -473,6 +505,48 @@ public:
                 int coarsest_ln = -1,
                 int finest_ln = -1);
 
+    /*!
+     * \brief Spread a quantity from the Lagrangian mesh to the Eulerian grid
+     * using the assembled operators stored in the provided cache.
+     *
+     * Patch operators are assembled the first time they are used and are
+     * reused until the cache is cleared.  Eulerian data that are neither cell
+     * centered nor side centered, or kernel functions that are not supported by
+     * LEOperatorCache, are handled by the standard spreading routines.
+     *
+     * \see LEOperatorCache
+     */
+    void spread(int f_data_idx,
+                std::vector<SAMRAI::tbox::Pointer<LData> >& F_data,
+                std::vector<SAMRAI::tbox::Pointer<LData> >& X_data,
+                LEOperatorCache& op_cache,
+                RobinPhysBdryPatchStrategy* f_phys_bdry_op,
+                const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_prolongation_scheds =
+                    std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >(),
+                double fill_data_time = 0.0,
+                bool F_data_ghost_node_update = true,
+                bool X_data_ghost_node_update = true,
+                int coarsest_ln = -1,
+                int finest_ln = -1);
+
+    /*!
+     * \brief Interpolate a quantity from the Eulerian grid to the Lagrangian
+     * mesh using the assembled operators stored in the provided cache.
+     *
+     * \see LEOperatorCache
+     */
+    void interp(int f_data_idx,
+                std::vector<SAMRAI::tbox::Pointer<LData> >& F_data,
+                std::vector<SAMRAI::tbox::Pointer<LData> >& X_data,
+                LEOperatorCache& op_cache,
+                const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > >& f_synch_scheds =
+                    std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > >(),
+                const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_ghost_fill_scheds =
+                    std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >(),
+                double fill_data_time = 0.0,
+                int coarsest_ln = -1,
+                int finest_ln = -1);
+
     /*!
      * Register a concrete strategy object with the integrator that specifies
      * the initial configuration of the curvilinear mesh nodes.
@@ -545,6 +619,15 @@ public:
      */
     unsigned int getGlobalNodeOffset(int level_number) const;
 
+    /*!
+     * \return A const reference to the Lagrangian indices of the local nodes
+     * on the specified level of the patch hierarchy, ordered by local PETSc
+     * index.
+     *
+     * \see getNumberOfLocalNodes
+     */
+    const std::vector<int>& getLocalLagrangianIndices(int level_number) const;
+
     /*!
      * \brief Get the Lagrangian mesh associated with the given patch hierarchy
      * level.
@@ -947,6 +1030,58 @@ private:
      */
     void scatterData(Vec& lagrangian_vec, Vec& petsc_vec, int level_number, ScatterMode mode) const;
 
+    /*!
+     * \brief Common implementation of the spread() functions.  When op_cache
+     * is non-NULL and supports the data centering, the cached operators are
+     * used in place of the specified kernel function.
+     */
+    void spreadData(int f_data_idx,
+                    std::vector<SAMRAI::tbox::Pointer<LData> >& F_data,
+                    std::vector<SAMRAI::tbox::Pointer<LData> >& X_data,
+                    const std::string& spread_kernel_fcn,
+                    LEOperatorCache* op_cache,
+                    RobinPhysBdryPatchStrategy* f_phys_bdry_op,
+                    const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_prolongation_scheds,
+                    double fill_data_time,
+                    bool F_data_ghost_node_update,
+                    bool X_data_ghost_node_update,
+                    int coarsest_ln,
+                    int finest_ln);
+
+    /*!
+     * \brief Owner-computes variant of the level spreading performed by
+     * spreadData().  Nodes are spread from the patch interiors into the
+     * scratch data f_spread_data_idx, the values are summed across patch
+     * boundaries into f_accum_data_idx, and the result is added to the
+     * interior values of f_data_idx.
+     */
+    void spreadDataOwnerComputes(int f_data_idx,
+                                 int f_spread_data_idx,
+                                 int f_accum_data_idx,
+                                 SAMRAI::tbox::Pointer<LData> F_data,
+                                 SAMRAI::tbox::Pointer<LData> X_data,
+                                 const std::string& spread_kernel_fcn,
+                                 RobinPhysBdryPatchStrategy* f_phys_bdry_op,
+                                 SAMRAI::tbox::Pointer<SAMRAI::math::HierarchyDataOpsReal<NDIM, double> > f_level_ops,
+                                 double fill_data_time,
+                                 int ln);
+
+    /*!
+     * \brief Common implementation of the interp() functions.  When op_cache
+     * is non-NULL and supports the data centering, the cached operators are
+     * used in place of the specified kernel function.
+     */
+    void interpData(int f_data_idx,
+                    std::vector<SAMRAI::tbox::Pointer<LData> >& F_data,
+                    std::vector<SAMRAI::tbox::Pointer<LData> >& X_data,
+                    const std::string& interp_kernel_fcn,
+                    LEOperatorCache* op_cache,
+                    const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > >& f_synch_scheds,
+                    const std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::RefineSchedule<NDIM> > >& f_ghost_fill_scheds,
+                    double fill_data_time,
+                    int coarsest_ln,
+                    int finest_ln);
+
     /*!
      * \brief Begin the process of refilling nonlocal Lagrangian quantities over
      * the specified range of levels in the patch hierarchy.
@@ -1113,6 +1248,17 @@ private:
     SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenAlgorithm<NDIM> > d_node_count_coarsen_alg;
     std::vector<SAMRAI::tbox::Pointer<SAMRAI::xfer::CoarsenSchedule<NDIM> > > d_node_count_coarsen_scheds;
 
+    /*
+     * Data used by the owner-computes spreading strategy: the spreading and
+     * accumulation scratch data indices associated with each Eulerian data
+     * index, and the ghost accumulation schedules on each level, keyed by the
+     * Eulerian data index.  The schedules are discarded whenever the hierarchy
+     * configuration changes.
+     */
+    bool d_use_owner_computes_spreading;
+    std::map<int, std::pair<int, int> > d_owner_spread_data_idxs;
+    std::map<int, std::vector<SAMRAI::tbox::Pointer<GhostAccumulationSchedule> > > d_ghost_accumulation_scheds;
+
     /*
      * SAMRAI::hier::VariableContext objects are used for data management.
      */
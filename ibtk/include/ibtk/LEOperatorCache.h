@@ -0,0 +1,249 @@
+// Filename: LEOperatorCache.h
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_LEOperatorCache
+#define included_IBTK_LEOperatorCache
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "Box.h"
+#include "ibtk/LNodeSetData.h"
+#include "tbox/DescribedClass.h"
+#include "tbox/Pointer.h"
+
+namespace IBTK
+{
+class LData;
+} // namespace IBTK
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class Patch;
+template <int DIM>
+class PatchData;
+} // namespace hier
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LEOperatorCache stores assembled, patch-local representations
+ * of the Lagrangian-Eulerian interpolation and spreading operators for a fixed
+ * configuration of the Lagrangian mesh.
+ *
+ * The first time that an operator is applied on a patch, the kernel weights and
+ * the corresponding offsets into the Eulerian patch data arrays are computed and
+ * stored in compressed sparse row format.  Subsequent applications reuse the
+ * stored weights and reduce to sparse matrix-vector products.  This is intended
+ * for implicit IB formulations in which the same (linearized) coupling
+ * operators are applied many times per time step, e.g., within Krylov
+ * iterations.
+ *
+ * The cache does \em not track changes to the positions of the Lagrangian mesh
+ * nodes or to the patch hierarchy.  Callers must call clear() whenever the
+ * structure positions used to define the operators change, and whenever the
+ * Lagrangian data are redistributed.  Operators are stored separately for each
+ * position vector and each Eulerian patch data layout to which they are
+ * applied, and are assembled automatically when a new combination is
+ * encountered.
+ *
+ * Only cell-centered and side-centered Eulerian data are supported, and only
+ * kernel functions that are defined in terms of a one-dimensional weight
+ * function (see isSupportedKernel()).
+ *
+ * \see LDataManager
+ */
+class LEOperatorCache : public SAMRAI::tbox::DescribedClass
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    LEOperatorCache(const std::string& object_name,
+                    const std::string& interp_kernel_fcn,
+                    const std::string& spread_kernel_fcn);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~LEOperatorCache();
+
+    /*!
+     * \brief Returns true if the specified kernel function can be represented
+     * by this class.
+     */
+    static bool isSupportedKernel(const std::string& kernel_fcn);
+
+    /*!
+     * \brief Returns true if the interpolation and spreading kernel functions
+     * can both be represented by this class.
+     */
+    bool isSupported() const;
+
+    /*!
+     * \brief Discard all assembled operators.
+     */
+    void clear();
+
+    /*!
+     * \brief Interpolate data from an Eulerian grid patch to the Lagrangian
+     * mesh nodes located in the interior of the patch, assembling the patch
+     * operator if necessary.
+     */
+    void interpolate(SAMRAI::tbox::Pointer<LData> Q_data,
+                     SAMRAI::tbox::Pointer<LData> X_data,
+                     SAMRAI::tbox::Pointer<LNodeSetData> idx_data,
+                     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> > q_data,
+                     SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                     int level_number);
+
+    /*!
+     * \brief Spread data from the Lagrangian mesh nodes located in the ghost
+     * box of an Eulerian grid patch to that patch, assembling the patch
+     * operator if necessary.
+     *
+     * \note As in LEInteractor::spread(), values are accumulated into q_data.
+     */
+    void spread(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> > q_data,
+                SAMRAI::tbox::Pointer<LData> Q_data,
+                SAMRAI::tbox::Pointer<LData> X_data,
+                SAMRAI::tbox::Pointer<LNodeSetData> idx_data,
+                SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                int level_number);
+
+    /*!
+     * \brief Returns the number of patch operators that have been assembled
+     * since the object was constructed.
+     */
+    int getNumberOfAssemblies() const;
+
+    /*!
+     * \brief Returns the number of patch operator applications that reused
+     * previously assembled weights since the object was constructed.
+     */
+    int getNumberOfReuses() const;
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    LEOperatorCache();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    LEOperatorCache(const LEOperatorCache& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    LEOperatorCache& operator=(const LEOperatorCache& that);
+
+    /*!
+     * \brief Assembled operator for a single patch.
+     *
+     * Row r = k*num_stencils+a of the operator corresponds to the local
+     * Lagrangian node local_indices[k] and to data component a.  Column
+     * entries are offsets into the patch data array for that component.
+     */
+    struct PatchOperator
+    {
+        PatchOperator();
+
+        const LData* X_data;
+        SAMRAI::hier::Box<NDIM> q_ghost_box;
+        int num_stencils;
+        std::vector<int> local_indices;
+        std::vector<int> row_ptr;
+        std::vector<int> col_offsets;
+        std::vector<double> weights;
+    };
+
+    /*!
+     * \brief Return the (possibly newly assembled) patch operator.
+     */
+    const PatchOperator& getPatchOperator(std::vector<std::vector<std::vector<PatchOperator> > >& ops,
+                                          const std::string& kernel_fcn,
+                                          bool use_ghost_nodes,
+                                          SAMRAI::tbox::Pointer<LData> X_data,
+                                          SAMRAI::tbox::Pointer<LNodeSetData> idx_data,
+                                          SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> > q_data,
+                                          SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                                          int level_number);
+
+    /*!
+     * \brief Compute the kernel weights for a patch.
+     */
+    void assemblePatchOperator(PatchOperator& op,
+                               const std::string& kernel_fcn,
+                               bool use_ghost_nodes,
+                               SAMRAI::tbox::Pointer<LData> X_data,
+                               SAMRAI::tbox::Pointer<LNodeSetData> idx_data,
+                               SAMRAI::tbox::Pointer<SAMRAI::hier::PatchData<NDIM> > q_data,
+                               SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch);
+
+    std::string d_object_name;
+    std::string d_interp_kernel_fcn, d_spread_kernel_fcn;
+
+    /*!
+     * Assembled operators, indexed by level number and patch number.  Each
+     * patch may store operators for several position vectors (e.g., the
+     * current and midpoint configurations) and Eulerian data layouts.
+     */
+    std::vector<std::vector<std::vector<PatchOperator> > > d_interp_ops, d_spread_ops;
+
+    int d_num_assemblies, d_num_reuses;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LEOperatorCache
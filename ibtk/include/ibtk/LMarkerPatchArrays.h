@@ -0,0 +1,224 @@
+// Filename: LMarkerPatchArrays.h
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_LMarkerPatchArrays
+#define included_IBTK_LMarkerPatchArrays
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <vector>
+
+#include "Index.h"
+#include "ibtk/LMarker.h"
+#include "ibtk/LMarkerSet.h"
+#include "ibtk/LMarkerSetData.h"
+#include "tbox/Pointer.h"
+
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class Patch;
+} // namespace hier
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LMarkerPatchArrays provides a contiguous, cell-binned view of
+ * the marker particles that are assigned to the interior cells of a single
+ * patch.
+ *
+ * The marker indices, positions, and (optionally) velocities are gathered from
+ * an LMarkerSetData object in a single pass into flat arrays that are ordered
+ * by cell, with one bucket per nonempty cell.  The arrays may be passed
+ * directly to the array-based interpolation routines provided by class
+ * LEInteractor, and updated values may be scattered back to the markers
+ * without re-traversing the cell-based marker sets.
+ *
+ * After the marker positions have been updated, rebin() uses the buckets of
+ * the gathered data to move only those markers that have crossed into another
+ * cell of the patch, so that the marker sets remain binned by cell between
+ * regridding operations without being rebuilt.
+ *
+ * \note The arrays refer to the markers held by the LMarkerSetData object from
+ * which they were gathered, and they are invalidated by any modification of
+ * that object other than calls to rebin().
+ */
+class LMarkerPatchArrays
+{
+public:
+    /*!
+     * \brief Default constructor.
+     */
+    LMarkerPatchArrays();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~LMarkerPatchArrays();
+
+    /*!
+     * \brief Gather the markers assigned to the interior cells of the patch
+     * into contiguous arrays.
+     *
+     * Marker velocities are gathered only when \a gather_velocities is true.
+     */
+    void gather(SAMRAI::tbox::Pointer<LMarkerSetData> mark_data, bool gather_velocities = false);
+
+    /*!
+     * \brief Clear the gathered data.
+     */
+    void clear();
+
+    /*!
+     * \return The number of gathered markers.
+     */
+    unsigned int getNumberOfMarkers() const;
+
+    /*!
+     * \return The number of nonempty cells (i.e., buckets) of the gathered
+     * data.
+     */
+    unsigned int getNumberOfBuckets() const;
+
+    /*!
+     * \return The cell index associated with the specified bucket.
+     */
+    const SAMRAI::hier::Index<NDIM>& getBucketCellIndex(unsigned int bucket) const;
+
+    /*!
+     * \return The offsets of the buckets into the marker arrays.  The markers
+     * of bucket \em b are stored at positions \em k with bucket_offsets[b] <=
+     * \em k < bucket_offsets[b+1].
+     */
+    const std::vector<unsigned int>& getBucketOffsets() const;
+
+    /*!
+     * \return A const reference to the gathered marker indices.
+     */
+    const std::vector<int>& getMarkerIndices() const;
+
+    /*!
+     * \return A reference to the gathered marker positions, stored in
+     * consecutive blocks of NDIM values.
+     */
+    std::vector<double>& getPositions();
+
+    /*!
+     * \return A const reference to the gathered marker positions.
+     */
+    const std::vector<double>& getPositions() const;
+
+    /*!
+     * \return A reference to the gathered marker velocities, stored in
+     * consecutive blocks of NDIM values.
+     */
+    std::vector<double>& getVelocities();
+
+    /*!
+     * \return A const reference to the gathered marker velocities.
+     */
+    const std::vector<double>& getVelocities() const;
+
+    /*!
+     * \brief Write the positions stored in \a X_mark back to the gathered
+     * markers.
+     */
+    void scatterPositions(const std::vector<double>& X_mark) const;
+
+    /*!
+     * \brief Write the velocities stored in \a U_mark back to the gathered
+     * markers.
+     */
+    void scatterVelocities(const std::vector<double>& U_mark) const;
+
+    /*!
+     * \brief Reassign the gathered markers whose current positions lie in a
+     * different interior cell of the patch than the one to which they are
+     * presently assigned.
+     *
+     * Only the cells that gain or lose markers are modified.  Markers that
+     * have left the interior of the patch are not moved; such markers are
+     * reassigned by LMarkerUtilities::collectMarkersOnPatchHierarchy().
+     *
+     * \note The gathered data are cleared by this method.
+     *
+     * \return The number of markers that were reassigned.
+     */
+    unsigned int rebin(SAMRAI::tbox::Pointer<LMarkerSetData> mark_data,
+                       SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch);
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    LMarkerPatchArrays(const LMarkerPatchArrays& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    LMarkerPatchArrays& operator=(const LMarkerPatchArrays& that);
+
+    /*
+     * The gathered markers and their indices, positions, and velocities.
+     */
+    std::vector<LMarker*> d_marks;
+    std::vector<int> d_idx;
+    std::vector<double> d_X, d_U;
+
+    /*
+     * The cell indices and marker sets of the nonempty cells and the offsets
+     * of the corresponding buckets into the marker arrays.
+     */
+    std::vector<SAMRAI::hier::Index<NDIM> > d_bucket_cell_idx;
+    std::vector<LMarkerSet*> d_bucket_sets;
+    std::vector<unsigned int> d_bucket_offsets;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LMarkerPatchArrays
@@ -81,6 +81,12 @@ public:
     /*!
      * Advect all markers by the specified advection velocity using forward
      * Euler.
+     *
+     * When \a rebin_new_markers is true, the new markers are reassigned to the
+     * cells that contain their updated positions, as in rebinMarkers(), using
+     * the marker arrays that were gathered to advect them.  This should be
+     * requested only when the forward Euler step is a complete time step, and
+     * not when it is the predictor for midpointStep() or trapezoidalStep().
      */
     static void eulerStep(int mark_current_idx,
                           int mark_new_idx,
@@ -89,12 +95,17 @@ public:
                           const std::string& weighting_fcn,
                           SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                           int coarsest_ln = -1,
-                          int finest_ln = -1);
+                          int finest_ln = -1,
+                          bool rebin_new_markers = false);
 
     /*!
      * Advect all markers by the specified advection velocity using the explicit
      * midpoint rule.
      *
+     * The new markers are reassigned to the cells that contain their updated
+     * positions, as in rebinMarkers(), using the marker arrays that were
+     * gathered to advect them.
+     *
      * \note This function requires an initial call to eulerStep to compute the
      * predicted marker positions.
      */
@@ -111,6 +122,10 @@ public:
      * Advect all markers by the specified advection velocity using the explicit
      * trapezoidal rule.
      *
+     * The new markers are reassigned to the cells that contain their updated
+     * positions, as in rebinMarkers(), using the marker arrays that were
+     * gathered to advect them.
+     *
      * \note This function requires an initial call to eulerStep to compute the
      * current marker velocities and the predicted marker positions.
      */
@@ -123,6 +138,28 @@ public:
                                 int coarsest_ln = -1,
                                 int finest_ln = -1);
 
+    /*!
+     * Reassign markers to the Cartesian grid cells of their current patches
+     * that contain their updated positions.
+     *
+     * Only markers that have moved to a different cell of the patch interior
+     * are reassigned.  Markers that have left the interiors of their patches
+     * are reassigned when marker data are collected on the patch hierarchy.
+     *
+     * The marker time stepping functions rebin the new marker data as part of
+     * the final stage of each time step, and so this function is only needed
+     * when marker positions are modified by other means.
+     *
+     * \note Rebinning changes the order in which markers are traversed, and so
+     * this function must not be called on the current or new marker data
+     * between the calls to eulerStep() and midpointStep() or trapezoidalStep()
+     * that make up a single time step.
+     */
+    static void rebinMarkers(int mark_idx,
+                             SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                             int coarsest_ln = -1,
+                             int finest_ln = -1);
+
     /*!
      * Collect all marker data onto the coarsest level of the patch hierarchy
      * (to prepare for regridding the patch hierarchy).
@@ -199,30 +236,6 @@ private:
      */
     static unsigned int countMarkersOnPatch(SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
 
-    /*!
-     * Collect marker positions into a single vector.
-     */
-    static void collectMarkerPositionsOnPatch(std::vector<double>& X_mark,
-                                              SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
-
-    /*!
-     * Reset marker positions from a single vector.
-     */
-    static void resetMarkerPositionsOnPatch(const std::vector<double>& X_mark,
-                                            SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
-
-    /*!
-     * Collect marker velocities into a single vector.
-     */
-    static void collectMarkerVelocitiesOnPatch(std::vector<double>& U_mark,
-                                               SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
-
-    /*!
-     * Reset marker velocities from a single vector.
-     */
-    static void resetMarkerVelocitiesOnPatch(const std::vector<double>& U_mark,
-                                             SAMRAI::tbox::Pointer<LMarkerSetData> mark_data);
-
     /*!
      * Prevent markers from leaving the computational domain through physical
      * boundaries.
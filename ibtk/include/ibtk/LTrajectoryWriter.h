@@ -0,0 +1,262 @@
+// Filename: LTrajectoryWriter.h
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_LTrajectoryWriter
+#define included_IBTK_LTrajectoryWriter
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "PatchHierarchy.h"
+#include "boost/unordered_map.hpp"
+#include "ibtk/LMarkerPatchArrays.h"
+#include "tbox/Pointer.h"
+
+namespace IBTK
+{
+class LData;
+class LDataManager;
+} // namespace IBTK
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LTrajectoryWriter provides functionality to stream the
+ * trajectories of Lagrangian marker particles or Lagrangian mesh nodes to disk
+ * at every time step.
+ *
+ * Each call to recordMarkerData() or recordLagrangianData() appends one record,
+ * consisting of the data time and the indices, positions, and (optionally)
+ * velocities of the locally owned points, to an in-memory buffer of fixed
+ * capacity.  Recording a step only copies the data into the buffer.  When the
+ * buffer is full, its contents are compressed and appended as a single chunk to
+ * a per-process file in the dump directory.
+ *
+ * Values are compressed by quantization followed by delta encoding.  Each value
+ * is rounded to the nearest integer multiple of twice the error bound, so that
+ * the reconstructed values differ from the recorded values by at most the error
+ * bound.  The quantized values of each point are encoded as differences from
+ * the values recorded for that point in the previous record of the same chunk,
+ * and indices are encoded as differences from the preceding index within the
+ * record.  All differences are stored as variable-length integers.  Each chunk
+ * may be decoded independently of the others.
+ *
+ * The per-process files are merged into a single time-ordered text file by the
+ * static function mergeTrajectoryFiles(), which is intended to be called during
+ * post-processing.
+ *
+ * \note The per-process files are written in the native byte order of the
+ * machine on which they are written.  If a per-process file already exists, new
+ * chunks are appended to it, provided that it was written with the same error
+ * bound and velocity setting.
+ *
+ * \note A single LTrajectoryWriter object should be used for only one data
+ * source (e.g., one marker variable or one level of Lagrangian data), and
+ * should be called at the same sequence of times on all MPI processes.
+ */
+class LTrajectoryWriter
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param object_name          String used for error reporting.
+     * \param dump_directory_name  String indicating the directory where trajectory data is to be written.
+     * \param error_bound          The maximum absolute error of the compressed data.
+     * \param write_velocities     Boolean indicating whether velocities are to be written along with positions.
+     * \param buffer_size          The capacity of the record buffer, in number of double precision values.
+     */
+    LTrajectoryWriter(const std::string& object_name,
+                      const std::string& dump_directory_name,
+                      double error_bound,
+                      bool write_velocities = true,
+                      unsigned int buffer_size = 1048576);
+
+    /*!
+     * \brief Destructor.
+     *
+     * Any buffered records are written to disk.
+     */
+    ~LTrajectoryWriter();
+
+    /*!
+     * \brief Record the positions and (optionally) velocities of the marker
+     * particles stored in the interiors of the local patches.
+     */
+    void recordMarkerData(int mark_idx,
+                          SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                          double data_time,
+                          int coarsest_ln = -1,
+                          int finest_ln = -1);
+
+    /*!
+     * \brief Record the positions and (optionally) velocities of the local
+     * nodes of the Lagrangian data on the specified level of the patch
+     * hierarchy.
+     *
+     * \note U_data is required when velocities are to be written and is
+     * otherwise ignored.
+     */
+    void recordLagrangianData(SAMRAI::tbox::Pointer<LData> X_data,
+                              SAMRAI::tbox::Pointer<LData> U_data,
+                              const LDataManager* l_data_manager,
+                              int level_number,
+                              double data_time);
+
+    /*!
+     * \brief Record the positions and (optionally) velocities of an arbitrary
+     * collection of locally owned points.
+     *
+     * \note Point indices must be nonnegative and may appear at most once per
+     * record.  U is required when velocities are to be written and is otherwise
+     * ignored.
+     */
+    void recordPointData(const int* idx, const double* X, const double* U, unsigned int num_points, double data_time);
+
+    /*!
+     * \brief Compress any buffered records and write them to disk.
+     */
+    void flush();
+
+    /*!
+     * \brief Merge the per-process trajectory files written to the specified
+     * dump directory into a single text file.
+     *
+     * Each line of the output file contains the data time, the point index,
+     * the position, and the velocity (when written) of one point.  Lines are
+     * ordered by time and then by index.
+     *
+     * \note This function is not collective and should be called on only one
+     * MPI process.
+     */
+    static void mergeTrajectoryFiles(const std::string& dump_directory_name,
+                                     int num_files,
+                                     const std::string& output_file_name);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    LTrajectoryWriter();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    LTrajectoryWriter(const LTrajectoryWriter& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    LTrajectoryWriter& operator=(const LTrajectoryWriter& that);
+
+    /*!
+     * \brief Begin a new record at the specified time.
+     */
+    void beginRecord(double data_time);
+
+    /*!
+     * \brief Append the indices, positions, and velocities of a collection of
+     * points to the current record.
+     */
+    void appendToRecord(const int* idx, const double* X, const double* U, unsigned int num_points);
+
+    /*!
+     * \brief Complete the current record, writing the buffered records to disk
+     * if the capacity of the buffer has been reached.
+     */
+    void endRecord();
+
+    /*!
+     * \brief Compress the buffered records and append them to the
+     * per-process file.
+     */
+    void writeChunk();
+
+    /*
+     * The object name is used for error reporting purposes.
+     */
+    std::string d_object_name;
+
+    /*
+     * Configuration options.
+     */
+    std::string d_dump_directory_name, d_file_name;
+    double d_error_bound;
+    bool d_write_velocities;
+    unsigned int d_buffer_size;
+
+    /*
+     * The buffered records.  The points of record r are stored beginning at
+     * position d_record_offset[r] of d_idx_buffer, and their positions and
+     * velocities are stored beginning at position NDIM*d_record_offset[r] of
+     * d_X_buffer and d_U_buffer.
+     */
+    std::vector<double> d_record_time;
+    std::vector<size_t> d_record_offset;
+    std::vector<int> d_idx_buffer;
+    std::vector<double> d_X_buffer, d_U_buffer;
+
+    /*
+     * The per-process output file and the workspace used to encode chunks.
+     */
+    std::ofstream d_file_stream;
+    boost::unordered_map<int, size_t> d_prev_offset;
+    std::vector<long long> d_prev_q;
+    std::vector<unsigned char> d_chunk_bytes;
+
+    /*
+     * Workspace used to gather marker data.
+     */
+    LMarkerPatchArrays d_mark_arrays;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LTrajectoryWriter
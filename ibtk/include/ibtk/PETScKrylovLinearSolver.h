@@ -99,7 +99,10 @@ namespace IBTK
  *   is provided to the class constructor, memory management of that object is
  *   \em NOT handled by the PETScKrylovLinearSolver.  In particular, it is the
  *   caller's responsibility to ensure that the supplied KSP object is properly
- *   destroyed via KSPDestroy().
+ *   destroyed via KSPDestroy().  \par
+ * - Pipelined KSP types (e.g., "pipecg", "pgmres", and "pipefgmres") are
+ *   supported by PETScSAMRAIVectorReal and can be used to overlap global
+ *   reductions with operator and preconditioner application.
  *
  * Sample parameters for initialization from database (and their default
  * values): \verbatim
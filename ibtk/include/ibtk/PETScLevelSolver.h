@@ -80,6 +80,8 @@ namespace IBTK
  abs_residual_tol = 1.0e-50    // see setAbsoluteTolerance()
  max_iterations = 10000        // see setMaxIterations()
  enable_logging = FALSE        // see setLoggingEnabled()
+ use_agglomeration = FALSE     // see setUseAgglomeration()
+ agglomeration_min_dofs_per_rank = 4096
  \endverbatim
  *
  * PETSc is developed at the Argonne National Laboratory Mathematics and
@@ -114,6 +116,24 @@ public:
      */
     const KSP& getPETScKSP() const;
 
+    /*!
+     * \brief Specify whether the level solve is agglomerated onto a subset of
+     * the MPI ranks.
+     *
+     * When agglomeration is enabled, the preconditioner is wrapped in a PETSc
+     * PCTELESCOPE preconditioner that gathers the level system onto a
+     * subcommunicator, applies the requested preconditioner there, and
+     * scatters the result back.  The number of ranks retained is chosen so
+     * that each one holds at least agglomeration_min_dofs_per_rank degrees of
+     * freedom; when every rank already holds at least that many, the level is
+     * solved on the full communicator.
+     *
+     * \note Agglomeration is not used with the "asm", "fieldsplit", or "shell"
+     * preconditioners, which rely on subdomains defined on the full
+     * communicator.
+     */
+    void setUseAgglomeration(bool use_agglomeration, int min_dofs_per_rank = 4096);
+
     /*!
      * \brief Get ASM subdomains.
      */
@@ -287,6 +307,13 @@ protected:
      */
     virtual void setupNullspace();
 
+    /*!
+     * \brief Compute the factor by which the number of MPI ranks is reduced
+     * when agglomerating the level solve, or 1 if the level solve is not to be
+     * agglomerated.
+     */
+    int computeAgglomerationReductionFactor() const;
+
     /*!
      * \brief Associated hierarchy.
      */
@@ -333,6 +360,15 @@ protected:
     std::vector<IS> d_field_is;
     //\}
 
+    /*!
+     * \name Coarse level agglomeration.
+     */
+    //\{
+    bool d_use_agglomeration;
+    int d_agglomeration_min_dofs_per_rank;
+    int d_agglomeration_reduction_factor;
+    //\}
+
 private:
     /*!
      * \brief Copy constructor.
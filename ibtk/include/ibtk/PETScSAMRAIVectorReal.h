@@ -66,6 +66,15 @@ namespace IBTK
  * through the static member functions that create and destroy PETSc vector
  * objects.
  *
+ * The wrapped vector implements the local (i.e., unreduced) dot product and
+ * norm operations used by PETSc's split-phase reductions (VecDotBegin() /
+ * VecDotEnd(), VecMDotBegin() / VecMDotEnd(), and VecNormBegin() /
+ * VecNormEnd()).  Consequently, pipelined Krylov methods such as "pipecg",
+ * "pgmres", and "pipefgmres" may be used with these vectors, and the global
+ * reductions may overlap with operator and preconditioner application.
+ * Multiple dot products involving the same vector are computed in a single
+ * pass over its data.
+ *
  * Finally, we remark that PETSc allows vectors with complex-valued entries.
  * This class and the class SAMRAI::solv::SAMRAIVectorReal assume real-values
  * vectors, i.e., data of type \p double or \p float.  The (currently
@@ -0,0 +1,156 @@
+// Filename: PatchScratchArena.h
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_PatchScratchArena
+#define included_IBTK_PatchScratchArena
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <vector>
+
+#include "tbox/Arena.h"
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class PatchScratchArena is a SAMRAI::tbox::Arena that provides
+ * reusable storage for short-lived, patch-local temporary data.
+ *
+ * Memory is handed out from a single contiguous buffer by advancing an offset,
+ * and individual calls to free() do nothing.  The buffer is recycled by calling
+ * reset(), which is typically done once per patch before allocating the patch
+ * temporaries, e.g.,
+ *
+ * \code
+ * arena->reset();
+ * Pointer<SideData<NDIM,double> > tmp_data = factory->allocate(patch_box, arena);
+ * \endcode
+ *
+ * All objects allocated from the arena must be destroyed before reset() is
+ * called.  Requests that do not fit in the buffer are satisfied from the heap;
+ * such overflow allocations are released by the next call to reset(), at which
+ * point the buffer is enlarged so that subsequent patches of the same size do
+ * not overflow.
+ */
+class PatchScratchArena : public SAMRAI::tbox::Arena
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    PatchScratchArena();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~PatchScratchArena();
+
+    /*!
+     * \brief Ensure that the buffer can hold at least the specified number of
+     * bytes.
+     *
+     * \note This must only be called when no objects allocated from the arena
+     * are in use.
+     */
+    void reserve(size_t bytes);
+
+    /*!
+     * \brief Make the entire buffer available for reuse and release any
+     * overflow allocations.
+     */
+    void reset();
+
+    /*!
+     * \brief Release the buffer.
+     */
+    void clear();
+
+    /*!
+     * \brief Return the size of the buffer, in bytes.
+     */
+    size_t getCapacity() const;
+
+    /*!
+     * \brief Return the largest number of bytes that have been in use between
+     * any two calls to reset().
+     */
+    size_t getHighWaterMark() const;
+
+    /*!
+     * \brief Allocate memory from the arena.
+     */
+    void* alloc(const size_t bytes);
+
+    /*!
+     * \brief Return memory to the arena.  This is a no-op; memory is recycled
+     * by reset().
+     */
+    void free(void* p);
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    PatchScratchArena(const PatchScratchArena& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    PatchScratchArena& operator=(const PatchScratchArena& that);
+
+    /*
+     * The buffer is stored as an array of doubles to ensure that it is suitably
+     * aligned for floating point patch data.
+     */
+    std::vector<double> d_buffer;
+    size_t d_offset;
+    size_t d_high_water_mark;
+    std::vector<void*> d_overflow;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_PatchScratchArena
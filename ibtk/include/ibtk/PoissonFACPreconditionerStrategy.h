@@ -190,6 +190,37 @@ public:
      */
     virtual void setSmootherType(const std::string& smoother_type) = 0;
 
+    /*!
+     * \brief Specify whether the level smoothers read the residual from a
+     * single-precision copy.
+     *
+     * The residual on a level is fixed between the pre- and post-smoothing
+     * sweeps of an FAC cycle, so when this option is enabled it is converted to
+     * single precision only when it changes (i.e., once per FAC cycle on each
+     * level) and all smoother sweeps read the converted values.  The error is
+     * still stored and updated in double precision, as are all inter-level
+     * transfer operations, so that the preconditioner remains compatible with
+     * double-precision outer Krylov solvers.
+     *
+     * The error and residual scratch data are deliberately not stored in single
+     * precision: the ghost cell filling, physical boundary, and coarse-fine
+     * interpolation operators used by the smoothers all act on double-precision
+     * cell and side data.  Moreover, the Gauss-Seidel sweeps are limited by the
+     * loop-carried dependence on the freshly updated neighbor value rather than
+     * by memory bandwidth.  On a single core with 128^3 and 64^3 patches and an
+     * out-of-cache working set (~280 MB), a 3D lexicographic Gauss-Seidel sweep
+     * cost 7.1 ns/cell with a double residual, 7.1 ns/cell with a float
+     * residual, and 6.8 ns/cell with both the error and the residual in float,
+     * and converting the residual cost 0.9--1.4 ns/cell per FAC cycle.  This
+     * option is therefore off by default.
+     *
+     * \note Only the Poisson point-relaxation FAC operators provide
+     * single-precision smoothers; other implementations ignore this setting.
+     * The staggered-grid Stokes FAC preconditioners do not use this class and
+     * always smooth in double precision.
+     */
+    void setUseSinglePrecisionSmoother(bool use_single_precision_smoother);
+
     /*!
      * \brief Specify the coarse level solver.
      */
@@ -260,6 +291,14 @@ public:
                           SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& dst,
                           int dst_ln);
 
+    /*!
+     * \brief Allocate scratch data.
+     *
+     * This marks all single-precision copies of the residual as out of date,
+     * since each FAC preconditioner application uses a new right-hand side.
+     */
+    void allocateScratchData();
+
     /*!
      * \brief Prolong the error quantity to the specified level from the next
      * coarser level.
@@ -355,6 +394,26 @@ protected:
 
     //\}
 
+    /*!
+     * \brief Return a pointer to the single-precision copy of the residual
+     * values stored in the specified buffer on the specified level.
+     *
+     * The double-precision values are only copied when the single-precision
+     * residual on the level is out of date, i.e., when the residual on that
+     * level has been modified by restrictResidual() or a new FAC cycle has
+     * begun.  Buffers are reused between calls and are resized as needed.
+     * Implementations must call setSinglePrecisionResidualCurrent() once all
+     * buffers on the level have been obtained.
+     */
+    const float*
+    getSinglePrecisionBuffer(const double* data, int size, int level_num, unsigned int buffer_num);
+
+    /*!
+     * \brief Indicate that the single-precision copy of the residual on the
+     * specified level is up to date.
+     */
+    void setSinglePrecisionResidualCurrent(int level_num);
+
     /*
      * Problem specification.
      */
@@ -418,6 +477,11 @@ protected:
      */
     std::string d_smoother_type;
 
+    /*
+     * Whether the smoothers read the residual from a single-precision copy.
+     */
+    bool d_use_single_precision_smoother;
+
     /*
      * The names of the refinement operators used to prolong the coarse grid
      * correction.
@@ -455,6 +519,14 @@ protected:
      */
     int d_scratch_idx;
 
+    /*
+     * Single-precision copies of the residual used by the level smoothers,
+     * along with flags indicating whether the copies on each level are
+     * current.
+     */
+    std::vector<std::vector<std::vector<float> > > d_single_precision_buffers;
+    std::vector<bool> d_single_precision_residual_current;
+
     //\}
 
     /*!
@@ -39,6 +39,7 @@
 
 #include "PoissonSpecifications.h"
 #include "BoundaryBox.h"
+#include "IntVector.h"
 #include "tbox/Pointer.h"
 
 namespace SAMRAI
@@ -75,6 +76,17 @@ namespace IBTK
 class PoissonUtilities
 {
 public:
+    /*!
+     * \brief Enumerated type for the boundary conditions supported by
+     * solveUniformGridSpectral().
+     */
+    enum SpectralBoundaryType
+    {
+        SPECTRAL_PERIODIC,
+        SPECTRAL_DIRICHLET,
+        SPECTRAL_NEUMANN
+    };
+
     /*!
      * Compute the matrix coefficients corresponding to a cell-centered
      * discretization of the Laplacian.
@@ -174,6 +186,29 @@ public:
                                   const SAMRAI::solv::PoissonSpecifications& poisson_spec,
                                   const SAMRAI::tbox::Array<SAMRAI::hier::BoundaryBox<NDIM> >& type1_cf_bdry);
 
+    /*!
+     * Solve \f$ (C I + D L) u = f \f$ on a uniform, logically rectangular grid
+     * using fast Fourier transforms, in which \f$ C \f$ and \f$ D \f$ are
+     * scalars and \f$ L \f$ is the standard (2*NDIM+1)-point discrete
+     * Laplacian.
+     *
+     * Data are stored in column-major order.  Boundary condition types are
+     * specified for the lower and upper sides along each coordinate direction,
+     * in the same order as boundary location indices.  Homogeneous Dirichlet
+     * and Neumann boundary conditions are imposed at the faces of the grid
+     * cells by extending the data antisymmetrically or symmetrically to a
+     * periodic grid of up to four times the number of cells in that direction.
+     * When the operator is singular, the component of the solution in its
+     * nullspace is set to zero.
+     */
+    static void solveUniformGridSpectral(std::vector<double>& u,
+                                         const std::vector<double>& f,
+                                         const SAMRAI::hier::IntVector<NDIM>& num_cells,
+                                         const double* dx,
+                                         double C,
+                                         double D,
+                                         const std::vector<SpectralBoundaryType>& bdry_types);
+
 protected:
 private:
     /*!
@@ -0,0 +1,238 @@
+// Filename: SCPoissonFFTLevelSolver.h
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_SCPoissonFFTLevelSolver
+#define included_IBTK_SCPoissonFFTLevelSolver
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <string>
+
+#include "Box.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "ibtk/LinearSolver.h"
+#include "ibtk/PoissonSolver.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+
+namespace SAMRAI
+{
+namespace solv
+{
+template <int DIM, class TYPE>
+class SAMRAIVectorReal;
+} // namespace solv
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class SCPoissonFFTLevelSolver is a concrete LinearSolver for solving
+ * elliptic equations of the form \f$ \mbox{$L u$} = \mbox{$(C I + \nabla \cdot
+ * D \nabla) u$} = f \f$ on a \em single SAMRAI::hier::PatchLevel using fast
+ * Fourier transforms.
+ *
+ * This solver class directly solves linear equations of the form \f$ (C I +
+ * \nabla \cdot D \nabla ) u = f \f$, where \f$C\f$ and \f$D\f$ are scalars, and
+ * \f$u\f$ and \f$f\f$ are side-centered arrays, using the same second-order
+ * accurate discretization as class SCPoissonHypreLevelSolver.  The solver
+ * requires that the patch level covers the entire computational domain, which
+ * must consist of a single box and must be periodic in all directions.  Each
+ * component of the side-centered data is solved for independently.
+ *
+ * \note The data on the level are gathered onto each process, and the
+ * transforms are performed redundantly by all processes.  This is appropriate
+ * for coarse levels and for moderately sized uniform grids, but it is not a
+ * distributed-memory FFT.
+ *
+ * The user must perform the following steps to use class
+ * SCPoissonFFTLevelSolver:
+ *
+ * -# Create a SCPoissonFFTLevelSolver object.
+ * -# Set the problem specification via setPoissonSpecifications(),
+ *    setPhysicalBcCoef(), and setHomogeneousBc().
+ * -# Initialize SCPoissonFFTLevelSolver object using the function
+ *    initializeSolverState().
+ * -# Solve the linear system using the member function solveSystem(), passing
+ *    in SAMRAI::solv::SAMRAIVectorReal objects corresponding to \f$u\f$ and
+ *    \f$f\f$.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+
+ enable_logging = FALSE         // see setLoggingEnabled()
+ \endverbatim
+ */
+class SCPoissonFFTLevelSolver : public LinearSolver, public PoissonSolver
+{
+public:
+    /*!
+     * \brief Constructor.
+     */
+    SCPoissonFFTLevelSolver(const std::string& object_name,
+                            SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                            const std::string& default_options_prefix);
+
+    /*!
+     * \brief Destructor.
+     */
+    ~SCPoissonFFTLevelSolver();
+
+    /*!
+     * \brief Static function to construct a SCPoissonFFTLevelSolver.
+     */
+    static SAMRAI::tbox::Pointer<PoissonSolver> allocate_solver(const std::string& object_name,
+                                                                SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
+                                                                const std::string& default_options_prefix)
+    {
+        return new SCPoissonFFTLevelSolver(object_name, input_db, default_options_prefix);
+    } // allocate_solver
+
+    /*!
+     * \name Linear solver functionality.
+     */
+    //\{
+
+    /*!
+     * \brief Solve the linear system of equations \f$Ax=b\f$ for \f$x\f$.
+     *
+     * Because the system is solved directly, the solver always reports one
+     * iteration and converges regardless of the specified tolerances.
+     *
+     * \param x solution vector
+     * \param b right-hand-side vector
+     *
+     * <b>Conditions on Parameters:</b>
+     * - vectors \a x and \a b must have same patch hierarchy
+     * - vectors \a x and \a b must have same structure, depth, etc.
+     *
+     * \note The solver need not be initialized prior to calling solveSystem();
+     * however, see initializeSolverState() and deallocateSolverState() for
+     * opportunities to save overhead when performing multiple consecutive
+     * solves.
+     *
+     * \see initializeSolverState
+     * \see deallocateSolverState
+     *
+     * \return \p true
+     */
+    bool solveSystem(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x, SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    /*!
+     * \brief Compute hierarchy dependent data required for solving \f$Ax=b\f$.
+     *
+     * This method checks that the patch level and problem specification are
+     * supported by the solver.
+     *
+     * \param x solution vector
+     * \param b right-hand-side vector
+     *
+     * <b>Conditions on Parameters:</b>
+     * - vectors \a x and \a b must have same patch hierarchy
+     * - vectors \a x and \a b must have same structure, depth, etc.
+     *
+     * \note It is safe to call initializeSolverState() when the state is
+     * already initialized.  In this case, the solver state is first deallocated
+     * and then reinitialized.
+     *
+     * \see deallocateSolverState
+     */
+    void initializeSolverState(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& x,
+                               const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& b);
+
+    /*!
+     * \brief Remove all hierarchy dependent data allocated by
+     * initializeSolverState().
+     *
+     * \note It is safe to call deallocateSolverState() when the solver state is
+     * already deallocated.
+     *
+     * \see initializeSolverState
+     */
+    void deallocateSolverState();
+
+    //\}
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    SCPoissonFFTLevelSolver();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    SCPoissonFFTLevelSolver(const SCPoissonFFTLevelSolver& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    SCPoissonFFTLevelSolver& operator=(const SCPoissonFFTLevelSolver& that);
+
+    /*!
+     * \brief Associated hierarchy.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
+
+    /*!
+     * \brief Associated patch level and the index space of the computational
+     * domain on that level.
+     */
+    int d_level_num;
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchLevel<NDIM> > d_level;
+    SAMRAI::hier::Box<NDIM> d_domain_box;
+
+    /*!
+     * \brief Data depth.
+     */
+    unsigned int d_depth;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_SCPoissonFFTLevelSolver
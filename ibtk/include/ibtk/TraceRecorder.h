@@ -0,0 +1,296 @@
+// Filename: TraceRecorder.h
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBTK_TraceRecorder
+#define included_IBTK_TraceRecorder
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tbox/Pointer.h"
+
+namespace SAMRAI
+{
+namespace tbox
+{
+class Database;
+class Timer;
+} // namespace tbox
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class TraceRecorder is a singleton class that records a per-process
+ * timeline of the timed regions of the code.
+ *
+ * When IBTK and IBAMR are compiled with the preprocessor flag
+ * IBTK_ENABLE_TRACING defined (e.g., by adding -DIBTK_ENABLE_TRACING to
+ * CPPFLAGS), the IBTK_TIMER_START/IBTK_TIMER_STOP and
+ * IBAMR_TIMER_START/IBAMR_TIMER_STOP macros also record begin and end events
+ * for the corresponding SAMRAI::tbox::Timer objects.  When the flag is not
+ * defined, the macros are unchanged and tracing has no cost.  Even when
+ * tracing is compiled in, events are recorded only once tracing has been
+ * enabled at runtime.
+ *
+ * Events are stored in a fixed-size ring buffer, so that when the buffer is
+ * full, the oldest events are overwritten.  Each event is tagged with the
+ * current time step number, which is set by the top-level
+ * HierarchyIntegrator at the beginning of each time step.
+ *
+ * Recorded events may be exported at any time either as a Chrome trace-event
+ * JSON file for each process (which may be viewed, e.g., in chrome://tracing
+ * or Perfetto) or as a CSV file summarizing the time spent in each phase of
+ * each time step across all processes.  Timers are assigned to phases by
+ * matching substrings of their names.  The default phases are "ghost_fill",
+ * "spread", "interp", "stokes_solve", "regrid", and "io".  Timers that are
+ * not assigned to any phase appear in the timeline but are omitted from the
+ * summary.  Nested timers that are assigned to the same phase are counted
+ * only once.
+ *
+ * Sample parameters for initialization from database (and their default
+ * values): \verbatim
+
+ enable_tracing = FALSE        // whether to record events
+ buffer_size = 262144          // maximum number of events retained per process
+ phase_rules = "", ""          // additional (timer name substring, phase name) pairs
+ \endverbatim
+ */
+class TraceRecorder
+{
+public:
+    /*!
+     * Return a pointer to the instance of the trace recorder.  All access to
+     * the singleton TraceRecorder object is through the getManager() function.
+     *
+     * Note that when the manager is accessed for the first time, the
+     * freeManager static method is registered with the ShutdownRegistry class.
+     * Consequently, an allocated manager is freed at program completion.  Thus,
+     * users of this class do not explicitly allocate or deallocate the manager
+     * instance.
+     *
+     * \return A pointer to the trace recorder instance.
+     */
+    static TraceRecorder* getManager();
+
+    /*!
+     * Deallocate the TraceRecorder instance.
+     *
+     * It is not necessary to call this function at program termination, since
+     * it is automatically called by the ShutdownRegistry class.
+     */
+    static void freeManager();
+
+    /*!
+     * \brief Record the beginning of a timed region.
+     */
+    static inline void beginEvent(const SAMRAI::tbox::Timer* timer)
+    {
+        if (s_enabled) s_trace_recorder_instance->recordEvent(timer, /*is_begin*/ true);
+        return;
+    } // beginEvent
+
+    /*!
+     * \brief Record the end of a timed region.
+     */
+    static inline void endEvent(const SAMRAI::tbox::Timer* timer)
+    {
+        if (s_enabled) s_trace_recorder_instance->recordEvent(timer, /*is_begin*/ false);
+        return;
+    } // endEvent
+
+    /*!
+     * \brief Initialize the recorder from the provided input database.
+     */
+    void getFromInput(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db);
+
+    /*!
+     * \brief Enable or disable recording of events.
+     */
+    void setEnabled(bool enabled);
+
+    /*!
+     * \brief Return whether events are being recorded.
+     */
+    bool getEnabled() const;
+
+    /*!
+     * \brief Set the maximum number of events retained by the ring buffer.
+     *
+     * \note Resizing the buffer discards all recorded events.
+     */
+    void setBufferSize(unsigned int buffer_size);
+
+    /*!
+     * \brief Set the time step number used to tag subsequently recorded events.
+     */
+    void setTimeStepNumber(int time_step_num);
+
+    /*!
+     * \brief Assign all timers whose names contain the specified substring to
+     * the specified phase.
+     *
+     * Rules are checked in the order in which they are registered, and rules
+     * registered by this method take precedence over the default rules.
+     */
+    void registerPhase(const std::string& timer_name_substring, const std::string& phase_name);
+
+    /*!
+     * \brief Discard all recorded events.
+     */
+    void clear();
+
+    /*!
+     * \brief Write the recorded events to a Chrome trace-event JSON file.
+     *
+     * Each process writes its events to a separate file named
+     * "file_name.NNNNN", where NNNNN is the process rank.  Event timestamps
+     * are measured from the construction of the recorder, and the process
+     * rank is used as the process ID, so that the timelines of different
+     * processes may be compared.
+     */
+    void writeChromeTrace(const std::string& file_name) const;
+
+    /*!
+     * \brief Write a CSV file summarizing the time spent in each phase of each
+     * time step.
+     *
+     * For each time step that is retained in the buffers of all processes,
+     * the minimum, maximum, and average time spent in each phase across all
+     * processes are reported, along with the ratio of the maximum time to the
+     * average time as a measure of load imbalance.
+     *
+     * \note This method is collective over all processes, and only the root
+     * process writes the file.
+     */
+    void writeStepSummary(const std::string& file_name) const;
+
+protected:
+    /*!
+     * \brief Constructor.
+     */
+    TraceRecorder();
+
+    /*!
+     * \brief Destructor.
+     */
+    ~TraceRecorder();
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    TraceRecorder(const TraceRecorder& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    TraceRecorder& operator=(const TraceRecorder& that);
+
+    /*!
+     * \brief An entry in the ring buffer.
+     */
+    struct TraceEvent
+    {
+        const SAMRAI::tbox::Timer* timer;
+        double time;
+        int time_step_num;
+        bool is_begin;
+    };
+
+    /*!
+     * \brief Record an event in the ring buffer.
+     */
+    void recordEvent(const SAMRAI::tbox::Timer* timer, bool is_begin);
+
+    /*!
+     * \brief Return the index of the phase associated with the timer, or -1
+     * if the timer is not assigned to any phase.
+     */
+    int getPhaseIndex(const SAMRAI::tbox::Timer* timer) const;
+
+    /*!
+     * \brief Return the recorded event with the specified age, in which
+     * events are numbered from oldest to newest.
+     */
+    const TraceEvent& getEvent(size_t k) const;
+
+    /*!
+     * Static data members used to control access to and destruction of
+     * singleton trace recorder instance.
+     */
+    static TraceRecorder* s_trace_recorder_instance;
+    static bool s_registered_callback;
+    static unsigned char s_shutdown_priority;
+    static bool s_enabled;
+
+    /*!
+     * \brief The ring buffer of events, the position of the next event to be
+     * recorded, and the number of valid events.
+     */
+    std::vector<TraceEvent> d_events;
+    size_t d_next_event, d_num_events;
+
+    /*!
+     * \brief The reference time and the current time step number.
+     */
+    double d_start_time;
+    int d_time_step_num;
+
+    /*!
+     * \brief The registered (timer name substring, phase name) rules and the
+     * names of all phases, including the default phases.
+     */
+    std::vector<std::pair<std::string, std::string> > d_phase_rules;
+    std::vector<std::string> d_phase_names;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_TraceRecorder
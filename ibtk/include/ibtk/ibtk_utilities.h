@@ -42,6 +42,10 @@
 #include "tbox/PIO.h"
 #include "tbox/Utilities.h"
 
+#if defined(IBTK_ENABLE_TRACING)
+#include "ibtk/TraceRecorder.h"
+#endif
+
 /////////////////////////////// MACRO DEFINITIONS ////////////////////////////
 
 #define IBTK_BIT_SET(bitfield, b) ((bitfield) |= (1 << (b)))
@@ -117,6 +121,27 @@ namespace IBTK
 static const bool ENABLE_TIMERS = true;
 }
 
+#if defined(IBTK_ENABLE_TRACING)
+#define IBTK_TIMER_START(timer)                                                                                        \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (IBTK::ENABLE_TIMERS)                                                                                       \
+        {                                                                                                              \
+            timer->start();                                                                                            \
+            IBTK::TraceRecorder::beginEvent(timer);                                                                    \
+        }                                                                                                              \
+    } while (0);
+
+#define IBTK_TIMER_STOP(timer)                                                                                         \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (IBTK::ENABLE_TIMERS)                                                                                       \
+        {                                                                                                              \
+            IBTK::TraceRecorder::endEvent(timer);                                                                      \
+            timer->stop();                                                                                             \
+        }                                                                                                              \
+    } while (0);
+#else
 #define IBTK_TIMER_START(timer)                                                                                        \
     do                                                                                                                 \
     {                                                                                                                  \
@@ -128,6 +153,7 @@ static const bool ENABLE_TIMERS = true;
     {                                                                                                                  \
         if (IBTK::ENABLE_TIMERS) timer->stop();                                                                        \
     } while (0);
+#endif
 
 /////////////////////////////// FUNCTION DEFINITIONS /////////////////////////
 
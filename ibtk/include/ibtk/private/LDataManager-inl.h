@@ -118,6 +118,16 @@ LDataManager::getGlobalNodeOffset(const int level_number) const
     return d_node_offset[level_number];
 } // getGlobalNodeOffset
 
+inline const std::vector<int>&
+LDataManager::getLocalLagrangianIndices(const int level_number) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(level_number >= 0);
+    TBOX_ASSERT(d_coarsest_ln <= level_number && d_finest_ln >= level_number);
+#endif
+    return d_local_lag_indices[level_number];
+} // getLocalLagrangianIndices
+
 inline SAMRAI::tbox::Pointer<LMesh>
 LDataManager::getLMesh(const int level_number) const
 {
@@ -34,8 +34,12 @@
 
 #include <stddef.h>
 #include <algorithm>
+#include <deque>
+#include <map>
 #include <ostream>
+#include <sstream>
 #include <string>
+#include <typeinfo>
 #include <vector>
 
 #include "CartesianGridGeometry.h"
@@ -48,6 +52,8 @@
 #include "NodeVariable.h"
 #include "Patch.h"
 #include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
 #include "PatchGeometry.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
@@ -100,12 +106,17 @@ namespace
 static Timer* t_initialize_operator_state;
 static Timer* t_reset_transaction_component;
 static Timer* t_reset_transaction_components;
+static Timer* t_reset_transaction_components_cache_hit;
+static Timer* t_reset_transaction_components_cache_miss;
 static Timer* t_reinitialize_operator_state;
 static Timer* t_deallocate_operator_state;
 static Timer* t_fill_data;
 static Timer* t_fill_data_coarsen;
 static Timer* t_fill_data_refine;
 static Timer* t_fill_data_set_physical_bcs;
+
+// Default number of cached communication schedule sets.
+static const unsigned int DEFAULT_SCHED_CACHE_SIZE = 40;
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -124,6 +135,11 @@ HierarchyGhostCellInterpolation::HierarchyGhostCellInterpolation()
       d_refine_alg(NULL),
       d_refine_strategy(NULL),
       d_refine_scheds(),
+      d_sched_cache(),
+      d_sched_cache_keys(),
+      d_sched_cache_size(DEFAULT_SCHED_CACHE_SIZE),
+      d_sched_cache_hits(0),
+      d_sched_cache_misses(0),
       d_cf_bdry_ops(),
       d_extrap_bc_ops(),
       d_cc_robin_bc_ops(),
@@ -137,6 +153,10 @@ HierarchyGhostCellInterpolation::HierarchyGhostCellInterpolation()
             TimerManager::getManager()->getTimer("IBTK::HierarchyGhostCellInterpolation::resetTransactionComponent()");
         t_reset_transaction_components =
             TimerManager::getManager()->getTimer("IBTK::HierarchyGhostCellInterpolation::resetTransactionComponents()");
+        t_reset_transaction_components_cache_hit = TimerManager::getManager()->getTimer(
+            "IBTK::HierarchyGhostCellInterpolation::resetTransactionComponents()[cache_hit]");
+        t_reset_transaction_components_cache_miss = TimerManager::getManager()->getTimer(
+            "IBTK::HierarchyGhostCellInterpolation::resetTransactionComponents()[cache_miss]");
         t_reinitialize_operator_state =
             TimerManager::getManager()->getTimer("IBTK::HierarchyGhostCellInterpolation::reinitializeOperatorState()");
         t_deallocate_operator_state =
@@ -164,6 +184,35 @@ HierarchyGhostCellInterpolation::setHomogeneousBc(const bool homogeneous_bc)
     return;
 } // setHomogeneousBc
 
+void
+HierarchyGhostCellInterpolation::setScheduleCacheSize(const unsigned int cache_size)
+{
+    if (cache_size == 0)
+    {
+        TBOX_ERROR("HierarchyGhostCellInterpolation::setScheduleCacheSize():\n"
+                   << "  schedule cache size must be positive." << std::endl);
+    }
+    d_sched_cache_size = cache_size;
+    while (d_sched_cache_keys.size() > d_sched_cache_size)
+    {
+        d_sched_cache.erase(d_sched_cache_keys.front());
+        d_sched_cache_keys.pop_front();
+    }
+    return;
+} // setScheduleCacheSize
+
+unsigned int
+HierarchyGhostCellInterpolation::getScheduleCacheHits() const
+{
+    return d_sched_cache_hits;
+} // getScheduleCacheHits
+
+unsigned int
+HierarchyGhostCellInterpolation::getScheduleCacheMisses() const
+{
+    return d_sched_cache_misses;
+} // getScheduleCacheMisses
+
 void
 HierarchyGhostCellInterpolation::initializeOperatorState(const InterpolationTransactionComponent transaction_comp,
                                                          const Pointer<PatchHierarchy<NDIM> > hierarchy,
@@ -351,6 +400,10 @@ HierarchyGhostCellInterpolation::initializeOperatorState(
         d_refine_scheds[dst_ln] = d_refine_alg->createSchedule(level, dst_ln - 1, d_hierarchy, d_refine_strategy);
     }
 
+    // Seed the schedule cache with the initial transaction components.
+    cacheSchedules(getScheduleCacheKey(d_transaction_comps, /*include_data_idxs*/ true),
+                   getScheduleCacheKey(d_transaction_comps, /*include_data_idxs*/ false));
+
     // Setup physical BC type.
     setHomogeneousBc(d_homogeneous_bc);
 
@@ -400,40 +453,32 @@ HierarchyGhostCellInterpolation::resetTransactionComponents(
     // Reset the transaction components.
     d_transaction_comps = transaction_comps;
 
-    // Reset cached coarsen algorithms and schedules.
-    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
-    bool registered_coarsen_op = false;
-    d_coarsen_alg = new CoarsenAlgorithm<NDIM>();
-    for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
+    // Look up cached coarsen and refine algorithms and schedules.  The cache is
+    // keyed on the data indices along with the settings that determine the
+    // structure of the communication schedules, so that switching between
+    // previously used patch data selects a ready-to-run schedule set.
+    const std::string key = getScheduleCacheKey(d_transaction_comps, /*include_data_idxs*/ true);
+    std::map<std::string, ScheduleCacheEntry>::iterator it = d_sched_cache.find(key);
+    const bool cache_hit = it != d_sched_cache.end();
+    if (cache_hit)
     {
-        const std::string& coarsen_op_name = d_transaction_comps[comp_idx].d_coarsen_op_name;
-        if (coarsen_op_name != "NONE")
-        {
-            const int src_data_idx = d_transaction_comps[comp_idx].d_src_data_idx;
-            Pointer<Variable<NDIM> > var;
-            var_db->mapIndexToVariable(src_data_idx, var);
-#if !defined(NDEBUG)
-            TBOX_ASSERT(var);
-#endif
-            Pointer<CoarsenOperator<NDIM> > coarsen_op = d_grid_geom->lookupCoarsenOperator(var, coarsen_op_name);
-#if !defined(NDEBUG)
-            TBOX_ASSERT(coarsen_op);
-#endif
-            d_coarsen_alg->registerCoarsen(src_data_idx, src_data_idx, coarsen_op);
-            registered_coarsen_op = true;
-        }
+        IBTK_TIMER_START(t_reset_transaction_components_cache_hit);
+        ++d_sched_cache_hits;
+        d_coarsen_alg = it->second.coarsen_alg;
+        d_coarsen_scheds = it->second.coarsen_scheds;
+        d_refine_alg = it->second.refine_alg;
+        d_refine_scheds = it->second.refine_scheds;
+        d_sched_cache_keys.erase(std::find(d_sched_cache_keys.begin(), d_sched_cache_keys.end(), key));
+        d_sched_cache_keys.push_back(key);
     }
-
-    if (registered_coarsen_op)
+    else
     {
-        for (int src_ln = std::max(1, d_coarsest_ln); src_ln <= d_finest_ln; ++src_ln)
-        {
-            d_coarsen_alg->resetSchedule(d_coarsen_scheds[src_ln]);
-        }
+        IBTK_TIMER_START(t_reset_transaction_components_cache_miss);
+        ++d_sched_cache_misses;
     }
 
-    // Reset cached refine algorithms and schedules.
-    d_refine_alg = new RefineAlgorithm<NDIM>();
+    // Reset the boundary condition handlers to act on the new patch data.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
     {
         const int dst_data_idx = d_transaction_comps[comp_idx].d_dst_data_idx;
@@ -443,39 +488,14 @@ HierarchyGhostCellInterpolation::resetTransactionComponents(
         Pointer<CellVariable<NDIM, double> > cc_var = var;
         Pointer<NodeVariable<NDIM, double> > nc_var = var;
         Pointer<SideVariable<NDIM, double> > sc_var = var;
-        Pointer<RefineOperator<NDIM> > refine_op = NULL;
-        Pointer<VariableFillPattern<NDIM> > fill_pattern = d_transaction_comps[comp_idx].d_fill_pattern;
-        if (d_cf_bdry_ops[comp_idx]) d_cf_bdry_ops[comp_idx]->setPatchDataIndex(dst_data_idx);
-        if (cc_var)
-        {
-            if (d_transaction_comps[comp_idx].d_refine_op_name != "NONE")
-            {
-                refine_op = d_grid_geom->lookupRefineOperator(var, d_transaction_comps[comp_idx].d_refine_op_name);
-            }
-        }
-        else if (nc_var)
-        {
-            if (d_transaction_comps[comp_idx].d_refine_op_name != "NONE")
-            {
-                refine_op = d_grid_geom->lookupRefineOperator(var, d_transaction_comps[comp_idx].d_refine_op_name);
-            }
-        }
-        else if (sc_var)
-        {
-            if (d_transaction_comps[comp_idx].d_refine_op_name != "NONE")
-            {
-                refine_op = d_grid_geom->lookupRefineOperator(var, d_transaction_comps[comp_idx].d_refine_op_name);
-            }
-        }
-        else
+        if (!cc_var && !nc_var && !sc_var)
         {
             TBOX_ERROR("HierarchyGhostCellInterpolation::resetTransactionComponents():\n"
                        << "  only double-precision cell-, node-, or side-centered data is "
                           "presently supported."
                        << std::endl);
         }
-
-        d_refine_alg->registerRefine(dst_data_idx, src_data_idx, dst_data_idx, refine_op, fill_pattern);
+        if (d_cf_bdry_ops[comp_idx]) d_cf_bdry_ops[comp_idx]->setPatchDataIndex(dst_data_idx);
 
         const std::string& phys_bdry_extrap_type = d_transaction_comps[comp_idx].d_phys_bdry_extrap_type;
         if (d_extrap_bc_ops[comp_idx])
@@ -524,11 +544,100 @@ HierarchyGhostCellInterpolation::resetTransactionComponents(
         }
     }
 
-    for (int dst_ln = d_coarsest_ln; dst_ln <= d_finest_ln; ++dst_ln)
+    if (cache_hit)
+    {
+        IBTK_TIMER_STOP(t_reset_transaction_components_cache_hit);
+        IBTK_TIMER_STOP(t_reset_transaction_components);
+        return;
+    }
+
+    // Setup new coarsen and refine algorithms for the new patch data.
+    bool registered_coarsen_op = false;
+    d_coarsen_alg = new CoarsenAlgorithm<NDIM>();
+    d_refine_alg = new RefineAlgorithm<NDIM>();
+    for (unsigned int comp_idx = 0; comp_idx < d_transaction_comps.size(); ++comp_idx)
     {
-        d_refine_alg->resetSchedule(d_refine_scheds[dst_ln]);
+        const int dst_data_idx = d_transaction_comps[comp_idx].d_dst_data_idx;
+        const int src_data_idx = d_transaction_comps[comp_idx].d_src_data_idx;
+        Pointer<Variable<NDIM> > var;
+        var_db->mapIndexToVariable(src_data_idx, var);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(var);
+#endif
+        const std::string& coarsen_op_name = d_transaction_comps[comp_idx].d_coarsen_op_name;
+        if (coarsen_op_name != "NONE")
+        {
+            Pointer<CoarsenOperator<NDIM> > coarsen_op = d_grid_geom->lookupCoarsenOperator(var, coarsen_op_name);
+#if !defined(NDEBUG)
+            TBOX_ASSERT(coarsen_op);
+#endif
+            d_coarsen_alg->registerCoarsen(src_data_idx, src_data_idx, coarsen_op);
+            registered_coarsen_op = true;
+        }
+
+        Pointer<RefineOperator<NDIM> > refine_op = NULL;
+        if (d_transaction_comps[comp_idx].d_refine_op_name != "NONE")
+        {
+            refine_op = d_grid_geom->lookupRefineOperator(var, d_transaction_comps[comp_idx].d_refine_op_name);
+        }
+        Pointer<VariableFillPattern<NDIM> > fill_pattern = d_transaction_comps[comp_idx].d_fill_pattern;
+        d_refine_alg->registerRefine(dst_data_idx, src_data_idx, dst_data_idx, refine_op, fill_pattern);
     }
 
+    // Make room in the cache.  When the evicted schedule set has the same
+    // structure as the new one, it is reset to communicate the new patch data,
+    // which is less expensive than generating new schedules.
+    const std::string config_key = getScheduleCacheKey(d_transaction_comps, /*include_data_idxs*/ false);
+    bool recycled_scheds = false;
+    if (d_sched_cache_keys.size() >= d_sched_cache_size)
+    {
+        const std::string& evict_key = d_sched_cache_keys.front();
+        std::map<std::string, ScheduleCacheEntry>::iterator evict_it = d_sched_cache.find(evict_key);
+        if (evict_it->second.config_key == config_key)
+        {
+            d_coarsen_scheds = evict_it->second.coarsen_scheds;
+            d_refine_scheds = evict_it->second.refine_scheds;
+            recycled_scheds = true;
+        }
+        d_sched_cache.erase(evict_it);
+        d_sched_cache_keys.pop_front();
+    }
+
+    if (recycled_scheds)
+    {
+        for (int src_ln = std::max(1, d_coarsest_ln); src_ln <= d_finest_ln; ++src_ln)
+        {
+            if (d_coarsen_scheds[src_ln]) d_coarsen_alg->resetSchedule(d_coarsen_scheds[src_ln]);
+        }
+        for (int dst_ln = d_coarsest_ln; dst_ln <= d_finest_ln; ++dst_ln)
+        {
+            d_refine_alg->resetSchedule(d_refine_scheds[dst_ln]);
+        }
+    }
+    else
+    {
+        d_coarsen_scheds.clear();
+        d_coarsen_scheds.resize(d_finest_ln + 1);
+        if (registered_coarsen_op)
+        {
+            for (int src_ln = std::max(1, d_coarsest_ln); src_ln <= d_finest_ln; ++src_ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(src_ln);
+                Pointer<PatchLevel<NDIM> > coarser_level = d_hierarchy->getPatchLevel(src_ln - 1);
+                d_coarsen_scheds[src_ln] = d_coarsen_alg->createSchedule(coarser_level, level, d_coarsen_strategy);
+            }
+        }
+        d_refine_scheds.clear();
+        d_refine_scheds.resize(d_finest_ln + 1);
+        for (int dst_ln = d_coarsest_ln; dst_ln <= d_finest_ln; ++dst_ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(dst_ln);
+            d_refine_scheds[dst_ln] = d_refine_alg->createSchedule(level, dst_ln - 1, d_hierarchy, d_refine_strategy);
+        }
+    }
+    cacheSchedules(key, config_key);
+
+    IBTK_TIMER_STOP(t_reset_transaction_components_cache_miss);
     IBTK_TIMER_STOP(t_reset_transaction_components);
     return;
 } // resetTransactionComponents
@@ -570,6 +679,9 @@ HierarchyGhostCellInterpolation::deallocateOperatorState()
     d_refine_strategy = NULL;
     d_refine_scheds.clear();
 
+    d_sched_cache.clear();
+    d_sched_cache_keys.clear();
+
     // Indicate that the operator is NOT initialized.
     d_is_initialized = false;
 
@@ -667,6 +779,52 @@ HierarchyGhostCellInterpolation::fillData(double fill_time)
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+std::string
+HierarchyGhostCellInterpolation::getScheduleCacheKey(
+    const std::vector<InterpolationTransactionComponent>& transaction_comps,
+    const bool include_data_idxs)
+{
+    // NOTE: Without the data indices, the key identifies the settings that
+    // determine the structure of the communication schedules: schedules with
+    // the same patch data types, ghost cell widths, operators, and fill
+    // patterns may be reset to communicate different patch data.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<PatchDescriptor<NDIM> > patch_descriptor = var_db->getPatchDescriptor();
+    std::ostringstream key;
+    for (unsigned int comp_idx = 0; comp_idx < transaction_comps.size(); ++comp_idx)
+    {
+        const InterpolationTransactionComponent& comp = transaction_comps[comp_idx];
+        if (include_data_idxs) key << comp.d_dst_data_idx << ',' << comp.d_src_data_idx << ':';
+        Pointer<PatchDataFactory<NDIM> > dst_factory = patch_descriptor->getPatchDataFactory(comp.d_dst_data_idx);
+        Pointer<PatchDataFactory<NDIM> > src_factory = patch_descriptor->getPatchDataFactory(comp.d_src_data_idx);
+        key << typeid(*dst_factory).name() << dst_factory->getGhostCellWidth() << ':' << typeid(*src_factory).name()
+            << src_factory->getGhostCellWidth() << ':' << comp.d_refine_op_name << ':' << comp.d_coarsen_op_name
+            << ':' << comp.d_fill_pattern.getPointer() << ';';
+    }
+    return key.str();
+} // getScheduleCacheKey
+
+void
+HierarchyGhostCellInterpolation::cacheSchedules(const std::string& key, const std::string& config_key)
+{
+    if (d_sched_cache.find(key) == d_sched_cache.end())
+    {
+        if (d_sched_cache_keys.size() >= d_sched_cache_size)
+        {
+            d_sched_cache.erase(d_sched_cache_keys.front());
+            d_sched_cache_keys.pop_front();
+        }
+        d_sched_cache_keys.push_back(key);
+    }
+    ScheduleCacheEntry& entry = d_sched_cache[key];
+    entry.config_key = config_key;
+    entry.coarsen_alg = d_coarsen_alg;
+    entry.coarsen_scheds = d_coarsen_scheds;
+    entry.refine_alg = d_refine_alg;
+    entry.refine_scheds = d_refine_scheds;
+    return;
+} // cacheSchedules
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
@@ -48,6 +48,7 @@
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
 #include "Box.h"
+#include "BoxArray.h"
 #include "CartesianCellDoubleWeightedAverage.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
@@ -173,6 +174,79 @@ static Timer* t_put_to_database;
 // Version of FEDataManager restart file data.
 static const int FE_DATA_MANAGER_VERSION = 1;
 
+// Padding, in units of the grid spacing of the level to which elements are
+// assigned, by which element bounding boxes are grown.  Cached bounding boxes
+// are reused until an element node leaves its padded bounding box.
+static const double ELEM_BBOX_PADDING = 0.5;
+
+// Determine whether an element bounding box intersects a patch bounding box.
+inline bool
+elem_bbox_intersects_patch(const std::pair<Point, Point>& elem_bbox, const std::pair<Point, Point>& patch_bbox)
+{
+    bool in_patch = true;
+    for (unsigned int d = 0; d < NDIM && in_patch; ++d)
+    {
+        in_patch = elem_bbox.second[d] >= patch_bbox.first[d] && elem_bbox.first[d] <= patch_bbox.second[d];
+    }
+    return in_patch;
+}
+
+// Collect the indices of the bins of a uniform bin grid that overlap the
+// specified bounding box.  Bounding boxes that extend outside of the bin grid
+// are clipped to the bins along its boundary.
+inline void
+get_overlapping_bins(std::vector<int>& bins,
+                     const std::pair<Point, Point>& bbox,
+                     const Point& bin_lower,
+                     const Point& bin_width,
+                     const boost::array<int, NDIM>& num_bins)
+{
+    boost::array<int, NDIM> lo, hi, i;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const double max_bin = static_cast<double>(num_bins[d] - 1);
+        lo[d] = static_cast<int>(
+            std::min(max_bin, std::max(0.0, std::floor((bbox.first[d] - bin_lower[d]) / bin_width[d]))));
+        hi[d] = static_cast<int>(
+            std::min(max_bin, std::max(0.0, std::floor((bbox.second[d] - bin_lower[d]) / bin_width[d]))));
+    }
+    bins.clear();
+    i = lo;
+    while (true)
+    {
+        int bin = 0;
+        for (int d = NDIM - 1; d >= 0; --d) bin = bin * num_bins[d] + i[d];
+        bins.push_back(bin);
+        unsigned int d = 0;
+        for (; d < NDIM; ++d)
+        {
+            if (++i[d] <= hi[d]) break;
+            i[d] = lo[d];
+        }
+        if (d == NDIM) break;
+    }
+    return;
+}
+
+// Determine whether a patch level has the specified boxes and processor
+// mapping.
+inline bool
+level_matches_configuration(const Pointer<PatchLevel<NDIM> > level,
+                            const BoxArray<NDIM>& boxes,
+                            const std::vector<int>& proc_mapping)
+{
+    const BoxArray<NDIM>& level_boxes = level->getBoxes();
+    if (level_boxes.getNumberOfBoxes() != boxes.getNumberOfBoxes()) return false;
+    if (static_cast<int>(proc_mapping.size()) != boxes.getNumberOfBoxes()) return false;
+    const ProcessorMapping& level_proc_mapping = level->getProcessorMapping();
+    for (int i = 0; i < boxes.getNumberOfBoxes(); ++i)
+    {
+        if (!(level_boxes[i] == boxes[i])) return false;
+        if (level_proc_mapping.getProcessorAssignment(i) != proc_mapping[i]) return false;
+    }
+    return true;
+}
+
 // Local helper functions.
 struct ElemComp : std::binary_function<Elem*, Elem*, bool>
 {
@@ -2072,6 +2146,7 @@ FEDataManager::FEDataManager(const std::string& object_name,
       d_es(NULL),
       d_level_number(-1),
       d_active_patch_ghost_dofs(),
+      d_elem_patch_cache_valid(false),
       d_L2_proj_solver(),
       d_L2_proj_matrix(),
       d_L2_proj_matrix_diag()
@@ -2249,7 +2324,7 @@ FEDataManager::updateQuadPointCountData(const int coarsest_ln, const int finest_
 } // updateQuadPointCountData
 
 std::vector<std::pair<Point, Point> >*
-FEDataManager::computeActiveElementBoundingBoxes()
+FEDataManager::computeActiveElementBoundingBoxes(const double padding)
 {
     // Get the necessary FE data.
     const MeshBase& mesh = d_es->get_mesh();
@@ -2260,22 +2335,32 @@ FEDataManager::computeActiveElementBoundingBoxes()
     NumericVector<double>& X_ghost_vec = *X_system.current_local_solution;
     X_vec.localize(X_ghost_vec);
 
+    // Bounding boxes computed by previous calls are retained as long as the
+    // number of elements in the mesh does not change.
+    if (d_active_elem_bboxes.size() != n_elem)
+    {
+        d_active_elem_bboxes.assign(n_elem, std::make_pair(Point::Zero(), Point::Zero()));
+        d_active_elem_bbox_valid.assign(n_elem, false);
+        d_elem_patch_cache_valid = false;
+        d_moved_elem_ids.clear();
+    }
+
     // Compute the lower and upper bounds of all active local elements in the
-    // mesh.  Assumes nodal basis functions.
-    d_active_elem_bboxes.resize(n_elem);
-    std::fill(d_active_elem_bboxes.begin(), d_active_elem_bboxes.end(), std::make_pair(Point::Zero(), Point::Zero()));
+    // mesh, grown by the specified padding.  Assumes nodal basis functions.
+    //
+    // A cached bounding box remains a valid (if somewhat loose) bounding box as
+    // long as all of the nodes of the element remain within it, so that we only
+    // need to recompute the bounding boxes of elements that have moved by more
+    // than the padding distance since their bounding boxes were computed.
+    std::vector<double> changed_bbox_data;
     std::vector<unsigned int> dof_indices;
+    std::vector<double> X_node;
     MeshBase::const_element_iterator el_it = mesh.active_local_elements_begin();
     const MeshBase::const_element_iterator el_end = mesh.active_local_elements_end();
     for (; el_it != el_end; ++el_it)
     {
         const Elem* const elem = *el_it;
         const unsigned int elem_id = elem->id();
-        Point& elem_lower_bound = d_active_elem_bboxes[elem_id].first;
-        Point& elem_upper_bound = d_active_elem_bboxes[elem_id].second;
-        elem_lower_bound = Point::Constant(std::numeric_limits<double>::max());
-        elem_upper_bound = Point::Constant(-std::numeric_limits<double>::max());
-
         const unsigned int n_nodes = elem->n_nodes();
         dof_indices.clear();
         for (unsigned int k = 0; k < n_nodes; ++k)
@@ -2287,8 +2372,27 @@ FEDataManager::computeActiveElementBoundingBoxes()
                 dof_indices.push_back(node->dof_number(X_sys_num, d, 0));
             }
         }
-        std::vector<double> X_node;
+        X_node.clear();
         X_ghost_vec.get(dof_indices, X_node);
+
+        Point& elem_lower_bound = d_active_elem_bboxes[elem_id].first;
+        Point& elem_upper_bound = d_active_elem_bboxes[elem_id].second;
+        if (d_active_elem_bbox_valid[elem_id])
+        {
+            bool in_bbox = true;
+            for (unsigned int k = 0; k < n_nodes && in_bbox; ++k)
+            {
+                for (unsigned int d = 0; d < NDIM && in_bbox; ++d)
+                {
+                    const double& X = X_node[k * NDIM + d];
+                    in_bbox = elem_lower_bound[d] <= X && X <= elem_upper_bound[d];
+                }
+            }
+            if (in_bbox) continue;
+        }
+
+        elem_lower_bound = Point::Constant(std::numeric_limits<double>::max());
+        elem_upper_bound = Point::Constant(-std::numeric_limits<double>::max());
         for (unsigned int k = 0; k < n_nodes; ++k)
         {
             for (unsigned int d = 0; d < NDIM; ++d)
@@ -2298,27 +2402,40 @@ FEDataManager::computeActiveElementBoundingBoxes()
                 elem_upper_bound[d] = std::max(elem_upper_bound[d], X);
             }
         }
-    }
-
-    // Parallel sum elem_lower_bound and elem_upper_bound so that each process
-    // has access to the bounding box data for each active element in the mesh.
-    std::vector<double> d_active_elem_bboxes_flattened(2 * NDIM * n_elem);
-    for (unsigned int e = 0; e < n_elem; ++e)
-    {
+        changed_bbox_data.push_back(static_cast<double>(elem_id));
         for (unsigned int d = 0; d < NDIM; ++d)
         {
-            d_active_elem_bboxes_flattened[2 * e * NDIM + d] = d_active_elem_bboxes[e].first[d];
-            d_active_elem_bboxes_flattened[(2 * e + 1) * NDIM + d] = d_active_elem_bboxes[e].second[d];
+            elem_lower_bound[d] -= padding;
+            changed_bbox_data.push_back(elem_lower_bound[d]);
+        }
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            elem_upper_bound[d] += padding;
+            changed_bbox_data.push_back(elem_upper_bound[d]);
         }
     }
-    SAMRAI_MPI::sumReduction(&d_active_elem_bboxes_flattened[0],
-                             static_cast<int>(d_active_elem_bboxes_flattened.size()));
-    for (unsigned int e = 0; e < n_elem; ++e)
+
+    // Communicate the bounding boxes that have changed so that each process
+    // has access to the bounding box data for each active element in the mesh.
+    static const int BBOX_DATA_SIZE = 2 * NDIM + 1;
+    const int changed_bbox_data_size = SAMRAI_MPI::sumReduction(static_cast<int>(changed_bbox_data.size()));
+    if (changed_bbox_data_size > 0)
     {
-        for (unsigned int d = 0; d < NDIM; ++d)
+        std::vector<double> all_changed_bbox_data(changed_bbox_data_size);
+        SAMRAI_MPI::allGather(changed_bbox_data.empty() ? NULL : &changed_bbox_data[0],
+                              static_cast<int>(changed_bbox_data.size()),
+                              &all_changed_bbox_data[0],
+                              changed_bbox_data_size);
+        for (int k = 0; k < changed_bbox_data_size; k += BBOX_DATA_SIZE)
         {
-            d_active_elem_bboxes[e].first[d] = d_active_elem_bboxes_flattened[2 * e * NDIM + d];
-            d_active_elem_bboxes[e].second[d] = d_active_elem_bboxes_flattened[(2 * e + 1) * NDIM + d];
+            const unsigned int elem_id = static_cast<unsigned int>(all_changed_bbox_data[k]);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                d_active_elem_bboxes[elem_id].first[d] = all_changed_bbox_data[k + 1 + d];
+                d_active_elem_bboxes[elem_id].second[d] = all_changed_bbox_data[k + 1 + NDIM + d];
+            }
+            d_active_elem_bbox_valid[elem_id] = true;
+            if (d_elem_patch_cache_valid) d_moved_elem_ids.push_back(elem_id);
         }
     }
     return &d_active_elem_bboxes;
@@ -2353,6 +2470,7 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
     std::vector<std::set<Elem*> > local_patch_elems(num_local_patches);
     std::vector<std::set<Elem*> > nonlocal_patch_elems(num_local_patches);
     std::vector<std::set<Elem*> > frontier_patch_elems(num_local_patches);
+    std::vector<std::set<Elem*> > contained_patch_elems(num_local_patches);
 
     // We provisionally associate an element with a Cartesian grid patch if the
     // element's bounding box intersects the patch interior grown by the
@@ -2362,41 +2480,136 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
     // processor will have access to all of the element bounding boxes.  This is
     // not a scalable approach, but we won't worry about this until it becomes
     // an actual issue.
-    computeActiveElementBoundingBoxes();
+    std::vector<std::pair<Point, Point> > patch_bboxes(num_local_patches);
+    Point bin_lower = Point::Constant(std::numeric_limits<double>::max());
+    Point bin_upper = Point::Constant(-std::numeric_limits<double>::max());
+    Point bin_width = Point::Zero();
     int local_patch_num = 0;
     for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
     {
-        std::set<Elem*>& frontier_elems = frontier_patch_elems[local_patch_num];
         Pointer<Patch<NDIM> > patch = level->getPatch(p());
         const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-        Point x_lower;
+        Point& x_lower = patch_bboxes[local_patch_num].first;
         for (unsigned int d = 0; d < NDIM; ++d) x_lower[d] = pgeom->getXLower()[d];
-        Point x_upper;
+        Point& x_upper = patch_bboxes[local_patch_num].second;
         for (unsigned int d = 0; d < NDIM; ++d) x_upper[d] = pgeom->getXUpper()[d];
         const double* const dx = pgeom->getDx();
         for (unsigned int d = 0; d < NDIM; ++d)
         {
             x_lower[d] -= dx[d] * ghost_width[d];
             x_upper[d] += dx[d] * ghost_width[d];
+            bin_lower[d] = std::min(bin_lower[d], x_lower[d]);
+            bin_upper[d] = std::max(bin_upper[d], x_upper[d]);
+            bin_width[d] += (x_upper[d] - x_lower[d]) / static_cast<double>(num_local_patches);
         }
-
+    }
+    const double* const dx_coarsest = grid_geom->getDx();
+    double dx_min = std::numeric_limits<double>::max();
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        dx_min = std::min(dx_min, dx_coarsest[d] / static_cast<double>(ratio(d)));
+    }
+    computeActiveElementBoundingBoxes(ELEM_BBOX_PADDING * dx_min);
+
+    // Elements with first-order Lagrange basis functions are contained within
+    // the convex hull of their nodes.  Any such element whose bounding box lies
+    // within the grown patch interior, shrunk by one grid cell to guard against
+    // roundoff, therefore has all of its quadrature points in the grown patch,
+    // and is accepted without evaluating the positions of its quadrature
+    // points.  Likewise, any such element whose bounding box does not intersect
+    // the grown patch has no quadrature points in the grown patch.
+    const bool use_bbox_containment = fe_type.family == LAGRANGE && fe_type.order == FIRST;
+
+    // The assignment of elements to the patches of the level managed by this
+    // object is cached.  If the level is unchanged since the assignment was
+    // cached, elements whose bounding boxes have not changed remain assigned to
+    // the patches whose interiors contain their bounding boxes, and only need
+    // to be checked again against the patches whose boundaries they straddle.
+    const bool cache_assignment =
+        use_bbox_containment && level_number == d_level_number && ghost_width == d_ghost_width;
+    const bool use_cached_assignment =
+        cache_assignment && d_elem_patch_cache_valid &&
+        static_cast<int>(d_contained_patch_elems.size()) == num_local_patches &&
+        level_matches_configuration(level, d_elem_patch_cache_boxes, d_elem_patch_cache_proc_mapping);
+    std::vector<Elem*> bin_elems;
+    if (use_cached_assignment)
+    {
+        std::sort(d_moved_elem_ids.begin(), d_moved_elem_ids.end());
+        d_moved_elem_ids.erase(std::unique(d_moved_elem_ids.begin(), d_moved_elem_ids.end()), d_moved_elem_ids.end());
+        for (std::vector<unsigned int>::const_iterator cit = d_moved_elem_ids.begin(); cit != d_moved_elem_ids.end();
+             ++cit)
+        {
+            Elem* const elem = d_es->get_mesh().query_elem(*cit);
+            if (elem && elem->active()) bin_elems.push_back(elem);
+        }
+        for (local_patch_num = 0; local_patch_num < num_local_patches; ++local_patch_num)
+        {
+            const std::vector<Elem*>& contained_elems = d_contained_patch_elems[local_patch_num];
+            for (std::vector<Elem*>::const_iterator cit = contained_elems.begin(); cit != contained_elems.end(); ++cit)
+            {
+                if (std::binary_search(d_moved_elem_ids.begin(), d_moved_elem_ids.end(), (*cit)->id())) continue;
+                local_patch_elems[local_patch_num].insert(*cit);
+                contained_patch_elems[local_patch_num].insert(*cit);
+            }
+            const std::vector<Elem*>& straddling_elems = d_straddling_patch_elems[local_patch_num];
+            for (std::vector<Elem*>::const_iterator cit = straddling_elems.begin(); cit != straddling_elems.end();
+                 ++cit)
+            {
+                if (std::binary_search(d_moved_elem_ids.begin(), d_moved_elem_ids.end(), (*cit)->id())) continue;
+                frontier_patch_elems[local_patch_num].insert(*cit);
+            }
+        }
+    }
+    else
+    {
         MeshBase::const_element_iterator el_it = mesh.active_elements_begin();
         const MeshBase::const_element_iterator el_end = mesh.active_elements_end();
-        for (; el_it != el_end; ++el_it)
+        for (; el_it != el_end; ++el_it) bin_elems.push_back(*el_it);
+    }
+
+    // Sort the local patches into a uniform grid of bins whose spacing is the
+    // average extent of the grown patches, so that each element bounding box
+    // only needs to be tested against the patches that share a bin with it.
+    if (num_local_patches > 0)
+    {
+        boost::array<int, NDIM> num_bins;
+        int total_num_bins = 1;
+        for (unsigned int d = 0; d < NDIM; ++d)
         {
-            Elem* const elem = *el_it;
-            const unsigned int elem_id = elem->id();
-            const Point& elem_lower_bound = d_active_elem_bboxes[elem_id].first;
-            const Point& elem_upper_bound = d_active_elem_bboxes[elem_id].second;
-            bool in_patch = true;
-            for (unsigned int d = 0; d < NDIM && in_patch; ++d)
+            num_bins[d] = std::max(1, static_cast<int>(std::ceil((bin_upper[d] - bin_lower[d]) / bin_width[d])));
+            total_num_bins *= num_bins[d];
+        }
+        std::vector<std::vector<int> > bin_patches(total_num_bins);
+        std::vector<int> bins;
+        for (local_patch_num = 0; local_patch_num < num_local_patches; ++local_patch_num)
+        {
+            get_overlapping_bins(bins, patch_bboxes[local_patch_num], bin_lower, bin_width, num_bins);
+            for (std::vector<int>::const_iterator cit = bins.begin(); cit != bins.end(); ++cit)
             {
-                in_patch = in_patch && ((elem_upper_bound[d] >= x_lower[d] && elem_upper_bound[d] <= x_upper[d]) ||
-                                        (elem_lower_bound[d] >= x_lower[d] && elem_lower_bound[d] <= x_upper[d]));
+                bin_patches[*cit].push_back(local_patch_num);
             }
-            if (in_patch)
+        }
+
+        std::vector<int> patch_elem_stamp(num_local_patches, -1);
+        const int num_bin_elems = static_cast<int>(bin_elems.size());
+        for (int elem_counter = 0; elem_counter < num_bin_elems; ++elem_counter)
+        {
+            Elem* const elem = bin_elems[elem_counter];
+            const std::pair<Point, Point>& elem_bbox = d_active_elem_bboxes[elem->id()];
+            get_overlapping_bins(bins, elem_bbox, bin_lower, bin_width, num_bins);
+            for (std::vector<int>::const_iterator b = bins.begin(); b != bins.end(); ++b)
             {
-                frontier_elems.insert(elem);
+                const std::vector<int>& patch_nums = bin_patches[*b];
+                for (std::vector<int>::const_iterator cit = patch_nums.begin(); cit != patch_nums.end(); ++cit)
+                {
+                    const int patch_num = *cit;
+                    if (patch_elem_stamp[patch_num] == elem_counter) continue;
+                    patch_elem_stamp[patch_num] = elem_counter;
+                    if (elem_bbox_intersects_patch(elem_bbox, patch_bboxes[patch_num]))
+                    {
+                        frontier_patch_elems[patch_num].insert(elem);
+                    }
+                }
             }
         }
     }
@@ -2438,12 +2651,34 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
             const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
             const double* const patch_dx = patch_geom->getDx();
             const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
+            Point interior_lower = patch_bboxes[local_patch_num].first;
+            Point interior_upper = patch_bboxes[local_patch_num].second;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                interior_lower[d] += patch_dx[d];
+                interior_upper[d] -= patch_dx[d];
+            }
 
             std::set<Elem*>::const_iterator el_it = frontier_elems.begin();
             const std::set<Elem*>::const_iterator el_end = frontier_elems.end();
             for (; el_it != el_end; ++el_it)
             {
                 Elem* const elem = *el_it;
+                if (use_bbox_containment)
+                {
+                    const std::pair<Point, Point>& elem_bbox = d_active_elem_bboxes[elem->id()];
+                    bool contained = true;
+                    for (unsigned int d = 0; d < NDIM && contained; ++d)
+                    {
+                        contained = elem_bbox.first[d] >= interior_lower[d] && elem_bbox.second[d] <= interior_upper[d];
+                    }
+                    if (contained)
+                    {
+                        local_elems.insert(elem);
+                        contained_patch_elems[local_patch_num].insert(elem);
+                        continue;
+                    }
+                }
                 for (unsigned int d = 0; d < NDIM; ++d)
                 {
                     X_dof_map_cache.dof_indices(elem, X_dof_indices[d], d);
@@ -2479,6 +2714,12 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
         VecRestoreArray(X_local_vec, &X_local_soln);
         VecGhostRestoreLocalForm(X_global_vec, &X_local_vec);
 
+        // Elements with first-order Lagrange basis functions whose bounding
+        // boxes do not intersect a grown patch cannot have any quadrature
+        // points in it, so there is no need to search the neighbors of the
+        // local elements.
+        if (use_bbox_containment) break;
+
         // Rebuild the set of frontier elements, which are any neighbors of a
         // local element that has not already been determined to be either a
         // local or a nonlocal element.
@@ -2516,6 +2757,38 @@ FEDataManager::collectActivePatchElements(std::vector<std::vector<Elem*> >& acti
         done = SAMRAI_MPI::sumReduction(new_frontier ? 1 : 0) == 0;
     }
 
+    // Cache the assignment for use by subsequent calls.  Elements that were
+    // checked by evaluating the positions of their quadrature points straddle
+    // the boundary of the grown patch.
+    if (cache_assignment)
+    {
+        d_contained_patch_elems.resize(num_local_patches);
+        d_straddling_patch_elems.resize(num_local_patches);
+        for (local_patch_num = 0; local_patch_num < num_local_patches; ++local_patch_num)
+        {
+            const std::set<Elem*>& contained_elems = contained_patch_elems[local_patch_num];
+            d_contained_patch_elems[local_patch_num].assign(contained_elems.begin(), contained_elems.end());
+            std::vector<Elem*>& straddling_elems = d_straddling_patch_elems[local_patch_num];
+            straddling_elems.clear();
+            const std::set<Elem*>& local_elems = local_patch_elems[local_patch_num];
+            for (std::set<Elem*>::const_iterator cit = local_elems.begin(); cit != local_elems.end(); ++cit)
+            {
+                if (!contained_elems.count(*cit)) straddling_elems.push_back(*cit);
+            }
+            const std::set<Elem*>& nonlocal_elems = nonlocal_patch_elems[local_patch_num];
+            straddling_elems.insert(straddling_elems.end(), nonlocal_elems.begin(), nonlocal_elems.end());
+        }
+        d_elem_patch_cache_boxes = level->getBoxes();
+        const ProcessorMapping& proc_mapping = level->getProcessorMapping();
+        d_elem_patch_cache_proc_mapping.resize(d_elem_patch_cache_boxes.getNumberOfBoxes());
+        for (int i = 0; i < d_elem_patch_cache_boxes.getNumberOfBoxes(); ++i)
+        {
+            d_elem_patch_cache_proc_mapping[i] = proc_mapping.getProcessorAssignment(i);
+        }
+        d_moved_elem_ids.clear();
+        d_elem_patch_cache_valid = true;
+    }
+
     // Set the active patch element data.
     active_patch_elems.resize(num_local_patches);
     local_patch_num = 0;
@@ -73,6 +73,8 @@
 #include "NodeVariable.h"
 #include "Patch.h"
 #include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "ProcessorMapping.h"
@@ -88,11 +90,13 @@
 #include "boost/array.hpp"
 #include "boost/math/special_functions/round.hpp"
 #include "boost/multi_array.hpp"
+#include "ibtk/GhostAccumulationSchedule.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/IndexUtilities.h"
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
 #include "ibtk/LEInteractor.h"
+#include "ibtk/LEOperatorCache.h"
 #include "ibtk/LIndexSetData.h"
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LMesh.h"
@@ -148,6 +152,7 @@ namespace
 {
 // Timers.
 static Timer* t_spread;
+static Timer* t_spread_ghost_accumulation;
 static Timer* t_interp;
 static Timer* t_map_lagrangian_to_petsc;
 static Timer* t_map_petsc_to_lagrangian;
@@ -172,6 +177,41 @@ static const double TOL = sqrt(std::numeric_limits<double>::epsilon());
 
 // Version of LDataManager restart file data.
 static const int LDATA_MANAGER_VERSION = 1;
+
+// Spread Lagrangian data onto the specified box of a patch, dispatching on the
+// centering of the Eulerian data.
+inline void
+spread_patch_data(Pointer<PatchData<NDIM> > f_data,
+                  Pointer<LData> F_data,
+                  Pointer<LData> X_data,
+                  Pointer<LNodeSetData> idx_data,
+                  Pointer<Patch<NDIM> > patch,
+                  const Box<NDIM>& box,
+                  const IntVector<NDIM>& periodic_shift,
+                  const std::string& spread_kernel_fcn)
+{
+    Pointer<CellData<NDIM, double> > f_cc_data = f_data;
+    Pointer<EdgeData<NDIM, double> > f_ec_data = f_data;
+    Pointer<NodeData<NDIM, double> > f_nc_data = f_data;
+    Pointer<SideData<NDIM, double> > f_sc_data = f_data;
+    if (f_cc_data)
+    {
+        LEInteractor::spread(f_cc_data, F_data, X_data, idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+    }
+    else if (f_ec_data)
+    {
+        LEInteractor::spread(f_ec_data, F_data, X_data, idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+    }
+    else if (f_nc_data)
+    {
+        LEInteractor::spread(f_nc_data, F_data, X_data, idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+    }
+    else if (f_sc_data)
+    {
+        LEInteractor::spread(f_sc_data, F_data, X_data, idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+    }
+    return;
+} // spread_patch_data
 }
 
 const std::string LDataManager::POSN_DATA_NAME = "X";
@@ -309,6 +349,19 @@ LDataManager::getPatchLevels() const
     return std::make_pair(d_coarsest_ln, d_finest_ln + 1);
 } // getPatchLevels
 
+void
+LDataManager::setUseOwnerComputesSpreading(const bool use_owner_computes_spreading)
+{
+    d_use_owner_computes_spreading = use_owner_computes_spreading;
+    return;
+} // setUseOwnerComputesSpreading
+
+bool
+LDataManager::getUseOwnerComputesSpreading() const
+{
+    return d_use_owner_computes_spreading;
+} // getUseOwnerComputesSpreading
+
 void
 LDataManager::spread(const int f_data_idx,
                      Pointer<LData> F_data,
@@ -579,116 +632,49 @@ LDataManager::spread(const int f_data_idx,
                      const double fill_data_time,
                      const bool F_data_ghost_node_update,
                      const bool X_data_ghost_node_update,
-                     const int coarsest_ln_in,
-                     const int finest_ln_in)
+                     const int coarsest_ln,
+                     const int finest_ln)
 {
-    IBTK_TIMER_START(t_spread);
-
-    const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
-    const int finest_ln = (finest_ln_in == -1 ? d_hierarchy->getFinestLevelNumber() : finest_ln_in);
-    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
-
-    // Determine the type of data centering.
-    Pointer<Variable<NDIM> > f_var;
-    var_db->mapIndexToVariable(f_data_idx, f_var);
-    Pointer<CellVariable<NDIM, double> > f_cc_var = f_var;
-    Pointer<EdgeVariable<NDIM, double> > f_ec_var = f_var;
-    Pointer<NodeVariable<NDIM, double> > f_nc_var = f_var;
-    Pointer<SideVariable<NDIM, double> > f_sc_var = f_var;
-    const bool cc_data = f_cc_var;
-    const bool ec_data = f_ec_var;
-    const bool nc_data = f_nc_var;
-    const bool sc_data = f_sc_var;
-    TBOX_ASSERT(cc_data || ec_data || nc_data || sc_data);
-
-    // Make a copy of the Eulerian data.
-    const int f_copy_data_idx = var_db->registerClonedPatchDataIndex(f_var, f_data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(f_copy_data_idx);
-    }
-    Pointer<HierarchyDataOpsReal<NDIM, double> > f_data_ops =
-        HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->setToScalar(f_data_idx, 0.0, /*interior_only*/ false);
-
-    // Start filling Lagrangian ghost node values.
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        if (!levelContainsLagrangianData(ln)) continue;
-
-        if (F_data_ghost_node_update) F_data[ln]->beginGhostUpdate();
-        if (X_data_ghost_node_update) X_data[ln]->beginGhostUpdate();
-    }
-
-    // Spread data from the Lagrangian mesh to the Eulerian grid.
-    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        // If there are coarser levels in the patch hierarchy, prolong data from
-        // the coarser levels before spreading data on this level.
-        if (ln > coarsest_ln && ln < static_cast<int>(f_prolongation_scheds.size()) && f_prolongation_scheds[ln])
-        {
-            f_prolongation_scheds[ln]->fillData(fill_data_time);
-        }
-
-        if (!levelContainsLagrangianData(ln)) continue;
-
-        // Spread data onto the grid.
-        if (F_data_ghost_node_update) F_data[ln]->endGhostUpdate();
-        if (X_data_ghost_node_update) X_data[ln]->endGhostUpdate();
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
-            Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-            const Box<NDIM>& box = idx_data->getGhostBox();
-            if (cc_data)
-            {
-                Pointer<CellData<NDIM, double> > f_cc_data = f_data;
-                LEInteractor::spread(
-                    f_cc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
-            }
-            if (ec_data)
-            {
-                Pointer<EdgeData<NDIM, double> > f_ec_data = f_data;
-                LEInteractor::spread(
-                    f_ec_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
-            }
-            if (nc_data)
-            {
-                Pointer<NodeData<NDIM, double> > f_nc_data = f_data;
-                LEInteractor::spread(
-                    f_nc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
-            }
-            if (sc_data)
-            {
-                Pointer<SideData<NDIM, double> > f_sc_data = f_data;
-                LEInteractor::spread(
-                    f_sc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
-            }
-            if (f_phys_bdry_op)
-            {
-                f_phys_bdry_op->setPatchDataIndex(f_data_idx);
-                f_phys_bdry_op->accumulateFromPhysicalBoundaryData(*patch, fill_data_time, f_data->getGhostCellWidth());
-            }
-        }
-    }
-
-    // Accumulate data.
-    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
-    f_data_ops->add(f_data_idx, f_data_idx, f_copy_data_idx);
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(f_copy_data_idx);
-    }
-    var_db->removePatchDataIndex(f_copy_data_idx);
+    spreadData(f_data_idx,
+               F_data,
+               X_data,
+               spread_kernel_fcn,
+               /*op_cache*/ NULL,
+               f_phys_bdry_op,
+               f_prolongation_scheds,
+               fill_data_time,
+               F_data_ghost_node_update,
+               X_data_ghost_node_update,
+               coarsest_ln,
+               finest_ln);
+    return;
+} // spread
 
-    IBTK_TIMER_STOP(t_spread);
+void
+LDataManager::spread(const int f_data_idx,
+                     std::vector<Pointer<LData> >& F_data,
+                     std::vector<Pointer<LData> >& X_data,
+                     LEOperatorCache& op_cache,
+                     RobinPhysBdryPatchStrategy* f_phys_bdry_op,
+                     const std::vector<Pointer<RefineSchedule<NDIM> > >& f_prolongation_scheds,
+                     const double fill_data_time,
+                     const bool F_data_ghost_node_update,
+                     const bool X_data_ghost_node_update,
+                     const int coarsest_ln,
+                     const int finest_ln)
+{
+    spreadData(f_data_idx,
+               F_data,
+               X_data,
+               d_default_spread_kernel_fcn,
+               &op_cache,
+               f_phys_bdry_op,
+               f_prolongation_scheds,
+               fill_data_time,
+               F_data_ghost_node_update,
+               X_data_ghost_node_update,
+               coarsest_ln,
+               finest_ln);
     return;
 } // spread
 
@@ -728,113 +714,43 @@ LDataManager::interp(const int f_data_idx,
                      const std::vector<Pointer<CoarsenSchedule<NDIM> > >& f_synch_scheds,
                      const std::vector<Pointer<RefineSchedule<NDIM> > >& f_ghost_fill_scheds,
                      const double fill_data_time,
-                     const int coarsest_ln_in,
-                     const int finest_ln_in)
+                     const int coarsest_ln,
+                     const int finest_ln)
 {
-    IBTK_TIMER_START(t_interp);
-
-    const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
-    const int finest_ln = (finest_ln_in == -1 ? d_hierarchy->getFinestLevelNumber() : finest_ln_in);
-    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
-
-    // Determine the type of data centering.
-    Pointer<Variable<NDIM> > f_var;
-    var_db->mapIndexToVariable(f_data_idx, f_var);
-    Pointer<CellVariable<NDIM, double> > f_cc_var = f_var;
-    Pointer<EdgeVariable<NDIM, double> > f_ec_var = f_var;
-    Pointer<NodeVariable<NDIM, double> > f_nc_var = f_var;
-    Pointer<SideVariable<NDIM, double> > f_sc_var = f_var;
-    const bool cc_data = f_cc_var;
-    const bool ec_data = f_ec_var;
-    const bool nc_data = f_nc_var;
-    const bool sc_data = f_sc_var;
-    TBOX_ASSERT(cc_data || ec_data || nc_data || sc_data);
-
-    // Synchronize Eulerian values.
-    for (int ln = finest_ln; ln > coarsest_ln; --ln)
-    {
-        if (ln < static_cast<int>(f_synch_scheds.size()) && f_synch_scheds[ln])
-        {
-            f_synch_scheds[ln]->coarsenData();
-        }
-    }
-
-    // Interpolate data from the Eulerian grid to the Lagrangian mesh.
-    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
-    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
-    {
-        if (!levelContainsLagrangianData(ln)) continue;
-
-        if (ln < static_cast<int>(f_ghost_fill_scheds.size()) && f_ghost_fill_scheds[ln])
-        {
-            f_ghost_fill_scheds[ln]->fillData(fill_data_time);
-        }
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
-        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
-        {
-            Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
-            Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
-            const Box<NDIM>& box = idx_data->getBox();
-            if (cc_data)
-            {
-                Pointer<CellData<NDIM, double> > f_cc_data = f_data;
-                LEInteractor::interpolate(F_data[ln],
-                                          X_data[ln],
-                                          idx_data,
-                                          f_cc_data,
-                                          patch,
-                                          box,
-                                          periodic_shift,
-                                          d_default_interp_kernel_fcn);
-            }
-            if (ec_data)
-            {
-                Pointer<EdgeData<NDIM, double> > f_ec_data = f_data;
-                LEInteractor::interpolate(F_data[ln],
-                                          X_data[ln],
-                                          idx_data,
-                                          f_ec_data,
-                                          patch,
-                                          box,
-                                          periodic_shift,
-                                          d_default_interp_kernel_fcn);
-            }
-            if (nc_data)
-            {
-                Pointer<NodeData<NDIM, double> > f_nc_data = f_data;
-                LEInteractor::interpolate(F_data[ln],
-                                          X_data[ln],
-                                          idx_data,
-                                          f_nc_data,
-                                          patch,
-                                          box,
-                                          periodic_shift,
-                                          d_default_interp_kernel_fcn);
-            }
-            if (sc_data)
-            {
-                Pointer<SideData<NDIM, double> > f_sc_data = f_data;
-                LEInteractor::interpolate(F_data[ln],
-                                          X_data[ln],
-                                          idx_data,
-                                          f_sc_data,
-                                          patch,
-                                          box,
-                                          periodic_shift,
-                                          d_default_interp_kernel_fcn);
-            }
-        }
-    }
-
-    // Zero inactivated components.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        zeroInactivatedComponents(F_data[ln], ln);
-    }
+    interpData(f_data_idx,
+               F_data,
+               X_data,
+               d_default_interp_kernel_fcn,
+               /*op_cache*/ NULL,
+               f_synch_scheds,
+               f_ghost_fill_scheds,
+               fill_data_time,
+               coarsest_ln,
+               finest_ln);
+    return;
+} // interp
 
-    IBTK_TIMER_STOP(t_interp);
+void
+LDataManager::interp(const int f_data_idx,
+                     std::vector<Pointer<LData> >& F_data,
+                     std::vector<Pointer<LData> >& X_data,
+                     LEOperatorCache& op_cache,
+                     const std::vector<Pointer<CoarsenSchedule<NDIM> > >& f_synch_scheds,
+                     const std::vector<Pointer<RefineSchedule<NDIM> > >& f_ghost_fill_scheds,
+                     const double fill_data_time,
+                     const int coarsest_ln,
+                     const int finest_ln)
+{
+    interpData(f_data_idx,
+               F_data,
+               X_data,
+               d_default_interp_kernel_fcn,
+               &op_cache,
+               f_synch_scheds,
+               f_ghost_fill_scheds,
+               fill_data_time,
+               coarsest_ln,
+               finest_ln);
     return;
 } // interp
 
@@ -2406,6 +2322,9 @@ LDataManager::resetHierarchyConfiguration(const Pointer<BasePatchHierarchy<NDIM>
     d_lag_node_index_bdry_fill_scheds.resize(finest_hier_level + 1);
     d_node_count_coarsen_scheds.resize(finest_hier_level + 1);
 
+    // Discard the ghost accumulation schedules; these are rebuilt on demand.
+    d_ghost_accumulation_scheds.clear();
+
     // (Re)build refine communication schedules.  These are created for only the
     // specified levels in the hierarchy.
     //
@@ -2680,6 +2599,9 @@ LDataManager::LDataManager(const std::string& object_name,
       d_lag_node_index_bdry_fill_scheds(),
       d_node_count_coarsen_alg(NULL),
       d_node_count_coarsen_scheds(),
+      d_use_owner_computes_spreading(false),
+      d_owner_spread_data_idxs(),
+      d_ghost_accumulation_scheds(),
       d_current_context(NULL),
       d_scratch_context(NULL),
       d_current_data(),
@@ -2760,6 +2682,8 @@ LDataManager::LDataManager(const std::string& object_name,
     // Setup Timers.
     IBTK_DO_ONCE(
         t_spread = TimerManager::getManager()->getTimer("IBTK::LDataManager::spread()");
+        t_spread_ghost_accumulation =
+            TimerManager::getManager()->getTimer("IBTK::LDataManager::spread()[ghost_accumulation]");
         t_interp = TimerManager::getManager()->getTimer("IBTK::LDataManager::interp()");
         t_map_lagrangian_to_petsc = TimerManager::getManager()->getTimer("IBTK::LDataManager::mapLagrangianToPETSc()");
         t_map_petsc_to_lagrangian = TimerManager::getManager()->getTimer("IBTK::LDataManager::mapPETScToLagrangian()");
@@ -2795,6 +2719,16 @@ LDataManager::~LDataManager()
             IBTK_CHKERRQ(ierr);
         }
     }
+
+    // Free the scratch data used for owner-computes spreading.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    for (std::map<int, std::pair<int, int> >::const_iterator it = d_owner_spread_data_idxs.begin();
+         it != d_owner_spread_data_idxs.end();
+         ++it)
+    {
+        var_db->removePatchDataIndex(it->second.first);
+        var_db->removePatchDataIndex(it->second.second);
+    }
     return;
 } // ~LDataManager
 
@@ -2872,6 +2806,355 @@ LDataManager::scatterData(Vec& lagrangian_vec, Vec& petsc_vec, const int level_n
     return;
 } // scatterData
 
+void
+LDataManager::spreadData(const int f_data_idx,
+                         std::vector<Pointer<LData> >& F_data,
+                         std::vector<Pointer<LData> >& X_data,
+                         const std::string& spread_kernel_fcn,
+                         LEOperatorCache* const op_cache,
+                         RobinPhysBdryPatchStrategy* f_phys_bdry_op,
+                         const std::vector<Pointer<RefineSchedule<NDIM> > >& f_prolongation_scheds,
+                         const double fill_data_time,
+                         const bool F_data_ghost_node_update,
+                         const bool X_data_ghost_node_update,
+                         const int coarsest_ln_in,
+                         const int finest_ln_in)
+{
+    IBTK_TIMER_START(t_spread);
+
+    const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
+    const int finest_ln = (finest_ln_in == -1 ? d_hierarchy->getFinestLevelNumber() : finest_ln_in);
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+
+    // Determine the type of data centering.
+    Pointer<Variable<NDIM> > f_var;
+    var_db->mapIndexToVariable(f_data_idx, f_var);
+    Pointer<CellVariable<NDIM, double> > f_cc_var = f_var;
+    Pointer<EdgeVariable<NDIM, double> > f_ec_var = f_var;
+    Pointer<NodeVariable<NDIM, double> > f_nc_var = f_var;
+    Pointer<SideVariable<NDIM, double> > f_sc_var = f_var;
+    const bool cc_data = f_cc_var;
+    const bool ec_data = f_ec_var;
+    const bool nc_data = f_nc_var;
+    const bool sc_data = f_sc_var;
+    TBOX_ASSERT(cc_data || ec_data || nc_data || sc_data);
+    const bool use_op_cache = op_cache && op_cache->isSupported() && (cc_data || sc_data);
+
+    // When owner-computes spreading is enabled, each patch only spreads the
+    // nodes located in its interior into a scratch copy of the Eulerian data,
+    // and the contributions that land in patch ghost regions are then summed
+    // onto the patches that own them.
+    int f_spread_data_idx = -1, f_accum_data_idx = -1;
+    Pointer<HierarchyDataOpsReal<NDIM, double> > f_level_ops;
+    if (d_use_owner_computes_spreading)
+    {
+        std::map<int, std::pair<int, int> >::const_iterator it = d_owner_spread_data_idxs.find(f_data_idx);
+        if (it == d_owner_spread_data_idxs.end())
+        {
+            const std::pair<int, int> idxs(var_db->registerClonedPatchDataIndex(f_var, f_data_idx),
+                                           var_db->registerClonedPatchDataIndex(f_var, f_data_idx));
+            it = d_owner_spread_data_idxs.insert(std::make_pair(f_data_idx, idxs)).first;
+        }
+        f_spread_data_idx = it->second.first;
+        f_accum_data_idx = it->second.second;
+        f_level_ops = HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(
+            f_var, d_hierarchy, /*get_unique*/ true);
+    }
+
+    // Make a copy of the Eulerian data.
+    const int f_copy_data_idx = var_db->registerClonedPatchDataIndex(f_var, f_data_idx);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        level->allocatePatchData(f_copy_data_idx);
+    }
+    Pointer<HierarchyDataOpsReal<NDIM, double> > f_data_ops =
+        HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, d_hierarchy, true);
+    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
+    f_data_ops->setToScalar(f_data_idx, 0.0, /*interior_only*/ false);
+
+    // Start filling Lagrangian ghost node values.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!levelContainsLagrangianData(ln)) continue;
+
+        if (F_data_ghost_node_update) F_data[ln]->beginGhostUpdate();
+        if (X_data_ghost_node_update) X_data[ln]->beginGhostUpdate();
+    }
+
+    // Spread data from the Lagrangian mesh to the Eulerian grid.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        // If there are coarser levels in the patch hierarchy, prolong data from
+        // the coarser levels before spreading data on this level.
+        if (ln > coarsest_ln && ln < static_cast<int>(f_prolongation_scheds.size()) && f_prolongation_scheds[ln])
+        {
+            f_prolongation_scheds[ln]->fillData(fill_data_time);
+        }
+
+        if (!levelContainsLagrangianData(ln)) continue;
+
+        // Spread data onto the grid.
+        if (F_data_ghost_node_update) F_data[ln]->endGhostUpdate();
+        if (X_data_ghost_node_update) X_data[ln]->endGhostUpdate();
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+        if (d_use_owner_computes_spreading)
+        {
+            spreadDataOwnerComputes(f_data_idx,
+                                    f_spread_data_idx,
+                                    f_accum_data_idx,
+                                    F_data[ln],
+                                    X_data[ln],
+                                    spread_kernel_fcn,
+                                    f_phys_bdry_op,
+                                    f_level_ops,
+                                    fill_data_time,
+                                    ln);
+            continue;
+        }
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
+            Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+            const Box<NDIM>& box = idx_data->getGhostBox();
+            if (use_op_cache)
+            {
+                op_cache->spread(f_data, F_data[ln], X_data[ln], idx_data, patch, ln);
+            }
+            else
+            {
+                spread_patch_data(
+                    f_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
+            }
+            if (f_phys_bdry_op)
+            {
+                f_phys_bdry_op->setPatchDataIndex(f_data_idx);
+                f_phys_bdry_op->accumulateFromPhysicalBoundaryData(*patch, fill_data_time, f_data->getGhostCellWidth());
+            }
+        }
+    }
+
+    // Accumulate data.
+    f_data_ops->swapData(f_copy_data_idx, f_data_idx);
+    f_data_ops->add(f_data_idx, f_data_idx, f_copy_data_idx);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        level->deallocatePatchData(f_copy_data_idx);
+    }
+    var_db->removePatchDataIndex(f_copy_data_idx);
+
+    IBTK_TIMER_STOP(t_spread);
+    return;
+} // spreadData
+
+void
+LDataManager::spreadDataOwnerComputes(const int f_data_idx,
+                                      const int f_spread_data_idx,
+                                      const int f_accum_data_idx,
+                                      Pointer<LData> F_data,
+                                      Pointer<LData> X_data,
+                                      const std::string& spread_kernel_fcn,
+                                      RobinPhysBdryPatchStrategy* f_phys_bdry_op,
+                                      Pointer<HierarchyDataOpsReal<NDIM, double> > f_level_ops,
+                                      const double fill_data_time,
+                                      const int ln)
+{
+    // Nodes in patch interiors are only spread onto the ghost box of the patch
+    // that owns them, so the Eulerian data must have enough ghost cells to
+    // hold the full kernel support of every interior node.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int f_gcw_min =
+        var_db->getPatchDescriptor()->getPatchDataFactory(f_data_idx)->getGhostCellWidth().min();
+    const int min_ghosts = LEInteractor::getMinimumGhostWidth(spread_kernel_fcn);
+    if (f_gcw_min < min_ghosts)
+    {
+        TBOX_ERROR("LDataManager::spreadDataOwnerComputes(): insufficient ghost cells for Eulerian field data:\n"
+                   << "  kernel function          = "
+                   << spread_kernel_fcn
+                   << "\n"
+                   << "  minimum ghost cell width = "
+                   << min_ghosts
+                   << "\n"
+                   << "  ghost cell width         = "
+                   << f_gcw_min
+                   << "\n");
+    }
+
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+    level->allocatePatchData(f_spread_data_idx, fill_data_time);
+    level->allocatePatchData(f_accum_data_idx, fill_data_time);
+    f_level_ops->resetLevels(ln, ln);
+    f_level_ops->setToScalar(f_spread_data_idx, 0.0, /*interior_only*/ false);
+    f_level_ops->setToScalar(f_accum_data_idx, 0.0, /*interior_only*/ false);
+
+    // Spread only those nodes that are located in the patch interiors.
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_spread_data_idx);
+        Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+        spread_patch_data(f_data, F_data, X_data, idx_data, patch, patch->getBox(), periodic_shift, spread_kernel_fcn);
+    }
+
+    // Sum the spread values over the ghost boxes of all patches that overlap
+    // each patch.
+    IBTK_TIMER_START(t_spread_ghost_accumulation);
+    std::vector<Pointer<GhostAccumulationSchedule> >& scheds = d_ghost_accumulation_scheds[f_data_idx];
+    if (static_cast<int>(scheds.size()) <= ln) scheds.resize(ln + 1);
+    if (!scheds[ln]) scheds[ln] = new GhostAccumulationSchedule(level, f_spread_data_idx, f_accum_data_idx);
+    scheds[ln]->communicate();
+    IBTK_TIMER_STOP(t_spread_ghost_accumulation);
+
+    // Fold values spread outside of the physical domain back into the interior
+    // and add the accumulated values to the Eulerian data.
+    if (f_phys_bdry_op)
+    {
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<PatchData<NDIM> > f_accum_data = patch->getPatchData(f_accum_data_idx);
+            f_phys_bdry_op->setPatchDataIndex(f_accum_data_idx);
+            f_phys_bdry_op->accumulateFromPhysicalBoundaryData(
+                *patch, fill_data_time, f_accum_data->getGhostCellWidth());
+        }
+        f_phys_bdry_op->setPatchDataIndex(f_data_idx);
+    }
+    f_level_ops->add(f_data_idx, f_data_idx, f_accum_data_idx, /*interior_only*/ true);
+    level->deallocatePatchData(f_spread_data_idx);
+    level->deallocatePatchData(f_accum_data_idx);
+    return;
+} // spreadDataOwnerComputes
+
+void
+LDataManager::interpData(const int f_data_idx,
+                         std::vector<Pointer<LData> >& F_data,
+                         std::vector<Pointer<LData> >& X_data,
+                         const std::string& interp_kernel_fcn,
+                         LEOperatorCache* const op_cache,
+                         const std::vector<Pointer<CoarsenSchedule<NDIM> > >& f_synch_scheds,
+                         const std::vector<Pointer<RefineSchedule<NDIM> > >& f_ghost_fill_scheds,
+                         const double fill_data_time,
+                         const int coarsest_ln_in,
+                         const int finest_ln_in)
+{
+    IBTK_TIMER_START(t_interp);
+
+    const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
+    const int finest_ln = (finest_ln_in == -1 ? d_hierarchy->getFinestLevelNumber() : finest_ln_in);
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+
+    // Determine the type of data centering.
+    Pointer<Variable<NDIM> > f_var;
+    var_db->mapIndexToVariable(f_data_idx, f_var);
+    Pointer<CellVariable<NDIM, double> > f_cc_var = f_var;
+    Pointer<EdgeVariable<NDIM, double> > f_ec_var = f_var;
+    Pointer<NodeVariable<NDIM, double> > f_nc_var = f_var;
+    Pointer<SideVariable<NDIM, double> > f_sc_var = f_var;
+    const bool cc_data = f_cc_var;
+    const bool ec_data = f_ec_var;
+    const bool nc_data = f_nc_var;
+    const bool sc_data = f_sc_var;
+    TBOX_ASSERT(cc_data || ec_data || nc_data || sc_data);
+    const bool use_op_cache = op_cache && op_cache->isSupported() && (cc_data || sc_data);
+
+    // Synchronize Eulerian values.
+    for (int ln = finest_ln; ln > coarsest_ln; --ln)
+    {
+        if (ln < static_cast<int>(f_synch_scheds.size()) && f_synch_scheds[ln])
+        {
+            f_synch_scheds[ln]->coarsenData();
+        }
+    }
+
+    // Interpolate data from the Eulerian grid to the Lagrangian mesh.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!levelContainsLagrangianData(ln)) continue;
+
+        if (ln < static_cast<int>(f_ghost_fill_scheds.size()) && f_ghost_fill_scheds[ln])
+        {
+            f_ghost_fill_scheds[ln]->fillData(fill_data_time);
+        }
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(level->getRatio());
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
+            Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
+            const Box<NDIM>& box = idx_data->getBox();
+            if (use_op_cache)
+            {
+                op_cache->interpolate(F_data[ln], X_data[ln], idx_data, f_data, patch, ln);
+            }
+            else if (cc_data)
+            {
+                Pointer<CellData<NDIM, double> > f_cc_data = f_data;
+                LEInteractor::interpolate(F_data[ln],
+                                          X_data[ln],
+                                          idx_data,
+                                          f_cc_data,
+                                          patch,
+                                          box,
+                                          periodic_shift,
+                                          interp_kernel_fcn);
+            }
+            else if (ec_data)
+            {
+                Pointer<EdgeData<NDIM, double> > f_ec_data = f_data;
+                LEInteractor::interpolate(F_data[ln],
+                                          X_data[ln],
+                                          idx_data,
+                                          f_ec_data,
+                                          patch,
+                                          box,
+                                          periodic_shift,
+                                          interp_kernel_fcn);
+            }
+            else if (nc_data)
+            {
+                Pointer<NodeData<NDIM, double> > f_nc_data = f_data;
+                LEInteractor::interpolate(F_data[ln],
+                                          X_data[ln],
+                                          idx_data,
+                                          f_nc_data,
+                                          patch,
+                                          box,
+                                          periodic_shift,
+                                          interp_kernel_fcn);
+            }
+            else if (sc_data)
+            {
+                Pointer<SideData<NDIM, double> > f_sc_data = f_data;
+                LEInteractor::interpolate(F_data[ln],
+                                          X_data[ln],
+                                          idx_data,
+                                          f_sc_data,
+                                          patch,
+                                          box,
+                                          periodic_shift,
+                                          interp_kernel_fcn);
+            }
+        }
+    }
+
+    // Zero inactivated components.
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        zeroInactivatedComponents(F_data[ln], ln);
+    }
+
+    IBTK_TIMER_STOP(t_interp);
+    return;
+} // interpData
+
 void
 LDataManager::beginNonlocalDataFill(const int coarsest_ln_in, const int finest_ln_in)
 {
@@ -0,0 +1,535 @@
+// Filename: LEOperatorCache.cpp
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "ArrayData.h"
+#include "Box.h"
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
+#include "IBTK_config.h"
+#include "Index.h"
+#include "Patch.h"
+#include "PatchData.h"
+#include "SideData.h"
+#include "boost/array.hpp"
+#include "ibtk/LData.h"
+#include "ibtk/LEInteractor.h"
+#include "ibtk/LEOperatorCache.h"
+#include "ibtk/LNodeSetData.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+// FORTRAN ROUTINES
+#define LAGRANGIAN_PIECEWISE_LINEAR_DELTA_FC                                                                           \
+    IBTK_FC_FUNC_(lagrangian_piecewise_linear_delta, LAGRANGIAN_PIECEWISE_LINEAR_DELTA)
+#define LAGRANGIAN_PIECEWISE_CUBIC_DELTA_FC                                                                            \
+    IBTK_FC_FUNC_(lagrangian_piecewise_cubic_delta, LAGRANGIAN_PIECEWISE_CUBIC_DELTA)
+#define LAGRANGIAN_IB_3_DELTA_FC IBTK_FC_FUNC_(lagrangian_ib_3_delta, LAGRANGIAN_IB_3_DELTA)
+#define LAGRANGIAN_IB_4_DELTA_FC IBTK_FC_FUNC_(lagrangian_ib_4_delta, LAGRANGIAN_IB_4_DELTA)
+#define LAGRANGIAN_IB_5_DELTA_FC IBTK_FC_FUNC_(lagrangian_ib_5_delta, LAGRANGIAN_IB_5_DELTA)
+#define LAGRANGIAN_IB_6_DELTA_FC IBTK_FC_FUNC_(lagrangian_ib_6_delta, LAGRANGIAN_IB_6_DELTA)
+#define LAGRANGIAN_BSPLINE_3_DELTA_FC IBTK_FC_FUNC_(lagrangian_bspline_3_delta, LAGRANGIAN_BSPLINE_3_DELTA)
+#define LAGRANGIAN_BSPLINE_4_DELTA_FC IBTK_FC_FUNC_(lagrangian_bspline_4_delta, LAGRANGIAN_BSPLINE_4_DELTA)
+#define LAGRANGIAN_BSPLINE_5_DELTA_FC IBTK_FC_FUNC_(lagrangian_bspline_5_delta, LAGRANGIAN_BSPLINE_5_DELTA)
+#define LAGRANGIAN_BSPLINE_6_DELTA_FC IBTK_FC_FUNC_(lagrangian_bspline_6_delta, LAGRANGIAN_BSPLINE_6_DELTA)
+
+extern "C" {
+double LAGRANGIAN_PIECEWISE_LINEAR_DELTA_FC(double&);
+double LAGRANGIAN_PIECEWISE_CUBIC_DELTA_FC(double&);
+double LAGRANGIAN_IB_3_DELTA_FC(double&);
+double LAGRANGIAN_IB_4_DELTA_FC(double&);
+double LAGRANGIAN_IB_5_DELTA_FC(double&);
+double LAGRANGIAN_IB_6_DELTA_FC(double&);
+double LAGRANGIAN_BSPLINE_3_DELTA_FC(double&);
+double LAGRANGIAN_BSPLINE_4_DELTA_FC(double&);
+double LAGRANGIAN_BSPLINE_5_DELTA_FC(double&);
+double LAGRANGIAN_BSPLINE_6_DELTA_FC(double&);
+}
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// NOTE: Several of the Fortran kernel functions modify their argument, so the
+// argument is always passed by value to these wrappers.
+double
+piecewise_linear_kernel_fcn(double r)
+{
+    return LAGRANGIAN_PIECEWISE_LINEAR_DELTA_FC(r);
+}
+
+double
+piecewise_cubic_kernel_fcn(double r)
+{
+    return LAGRANGIAN_PIECEWISE_CUBIC_DELTA_FC(r);
+}
+
+double
+ib_3_kernel_fcn(double r)
+{
+    return LAGRANGIAN_IB_3_DELTA_FC(r);
+}
+
+double
+ib_4_kernel_fcn(double r)
+{
+    return LAGRANGIAN_IB_4_DELTA_FC(r);
+}
+
+double
+ib_5_kernel_fcn(double r)
+{
+    return LAGRANGIAN_IB_5_DELTA_FC(r);
+}
+
+double
+ib_6_kernel_fcn(double r)
+{
+    return LAGRANGIAN_IB_6_DELTA_FC(r);
+}
+
+double
+bspline_3_kernel_fcn(double r)
+{
+    return LAGRANGIAN_BSPLINE_3_DELTA_FC(r);
+}
+
+double
+bspline_4_kernel_fcn(double r)
+{
+    return LAGRANGIAN_BSPLINE_4_DELTA_FC(r);
+}
+
+double
+bspline_5_kernel_fcn(double r)
+{
+    return LAGRANGIAN_BSPLINE_5_DELTA_FC(r);
+}
+
+double
+bspline_6_kernel_fcn(double r)
+{
+    return LAGRANGIAN_BSPLINE_6_DELTA_FC(r);
+}
+
+typedef double (*KernelFcnPtr)(double r);
+
+KernelFcnPtr
+get_kernel_fcn(const std::string& kernel_fcn)
+{
+    if (kernel_fcn == "PIECEWISE_LINEAR") return &piecewise_linear_kernel_fcn;
+    if (kernel_fcn == "PIECEWISE_CUBIC") return &piecewise_cubic_kernel_fcn;
+    if (kernel_fcn == "IB_3") return &ib_3_kernel_fcn;
+    if (kernel_fcn == "IB_4") return &ib_4_kernel_fcn;
+    if (kernel_fcn == "IB_5") return &ib_5_kernel_fcn;
+    if (kernel_fcn == "IB_6") return &ib_6_kernel_fcn;
+    if (kernel_fcn == "BSPLINE_3") return &bspline_3_kernel_fcn;
+    if (kernel_fcn == "BSPLINE_4") return &bspline_4_kernel_fcn;
+    if (kernel_fcn == "BSPLINE_5") return &bspline_5_kernel_fcn;
+    if (kernel_fcn == "BSPLINE_6") return &bspline_6_kernel_fcn;
+    if (kernel_fcn == "USER_DEFINED") return LEInteractor::s_kernel_fcn;
+    return NULL;
+} // get_kernel_fcn
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+LEOperatorCache::LEOperatorCache(const std::string& object_name,
+                                 const std::string& interp_kernel_fcn,
+                                 const std::string& spread_kernel_fcn)
+    : d_object_name(object_name),
+      d_interp_kernel_fcn(interp_kernel_fcn),
+      d_spread_kernel_fcn(spread_kernel_fcn),
+      d_interp_ops(),
+      d_spread_ops(),
+      d_num_assemblies(0),
+      d_num_reuses(0)
+{
+    // intentionally blank
+    return;
+} // LEOperatorCache
+
+LEOperatorCache::~LEOperatorCache()
+{
+    // intentionally blank
+    return;
+} // ~LEOperatorCache
+
+bool
+LEOperatorCache::isSupportedKernel(const std::string& kernel_fcn)
+{
+    return get_kernel_fcn(kernel_fcn) != NULL;
+} // isSupportedKernel
+
+bool
+LEOperatorCache::isSupported() const
+{
+    return isSupportedKernel(d_interp_kernel_fcn) && isSupportedKernel(d_spread_kernel_fcn);
+} // isSupported
+
+void
+LEOperatorCache::clear()
+{
+    d_interp_ops.clear();
+    d_spread_ops.clear();
+    return;
+} // clear
+
+void
+LEOperatorCache::interpolate(Pointer<LData> Q_data,
+                             Pointer<LData> X_data,
+                             Pointer<LNodeSetData> idx_data,
+                             Pointer<PatchData<NDIM> > q_data,
+                             Pointer<Patch<NDIM> > patch,
+                             const int level_number)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(Q_data);
+    TBOX_ASSERT(X_data);
+    TBOX_ASSERT(idx_data);
+    TBOX_ASSERT(q_data);
+    TBOX_ASSERT(patch);
+#endif
+    const PatchOperator& op = getPatchOperator(d_interp_ops,
+                                               d_interp_kernel_fcn,
+                                               /*is_spread_op*/ false,
+                                               X_data,
+                                               idx_data,
+                                               q_data,
+                                               patch,
+                                               level_number);
+    if (op.local_indices.empty()) return;
+
+    Pointer<CellData<NDIM, double> > q_cc_data = q_data;
+    Pointer<SideData<NDIM, double> > q_sc_data = q_data;
+    const int Q_depth = Q_data->getDepth();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(q_sc_data ? Q_depth == NDIM : Q_depth == q_cc_data->getDepth());
+#endif
+    double* const Q = Q_data->getGhostedLocalFormVecArray()->data();
+    const int num_nodes = static_cast<int>(op.local_indices.size());
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        const int s = op.local_indices[k];
+        if (q_sc_data)
+        {
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                const double* const q = q_sc_data->getPointer(axis);
+                const int r = k * NDIM + axis;
+                double Q_val = 0.0;
+                for (int j = op.row_ptr[r]; j < op.row_ptr[r + 1]; ++j)
+                {
+                    Q_val += op.weights[j] * q[op.col_offsets[j]];
+                }
+                Q[s * NDIM + axis] = Q_val;
+            }
+        }
+        else
+        {
+            for (int d = 0; d < Q_depth; ++d)
+            {
+                const double* const q = q_cc_data->getPointer(d);
+                double Q_val = 0.0;
+                for (int j = op.row_ptr[k]; j < op.row_ptr[k + 1]; ++j)
+                {
+                    Q_val += op.weights[j] * q[op.col_offsets[j]];
+                }
+                Q[s * Q_depth + d] = Q_val;
+            }
+        }
+    }
+    Q_data->restoreArrays();
+    return;
+} // interpolate
+
+void
+LEOperatorCache::spread(Pointer<PatchData<NDIM> > q_data,
+                        Pointer<LData> Q_data,
+                        Pointer<LData> X_data,
+                        Pointer<LNodeSetData> idx_data,
+                        Pointer<Patch<NDIM> > patch,
+                        const int level_number)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(Q_data);
+    TBOX_ASSERT(X_data);
+    TBOX_ASSERT(idx_data);
+    TBOX_ASSERT(q_data);
+    TBOX_ASSERT(patch);
+#endif
+    const PatchOperator& op = getPatchOperator(d_spread_ops,
+                                               d_spread_kernel_fcn,
+                                               /*is_spread_op*/ true,
+                                               X_data,
+                                               idx_data,
+                                               q_data,
+                                               patch,
+                                               level_number);
+    if (op.local_indices.empty()) return;
+
+    Pointer<CellData<NDIM, double> > q_cc_data = q_data;
+    Pointer<SideData<NDIM, double> > q_sc_data = q_data;
+    const int Q_depth = Q_data->getDepth();
+#if !defined(NDEBUG)
+    TBOX_ASSERT(q_sc_data ? Q_depth == NDIM : Q_depth == q_cc_data->getDepth());
+#endif
+    const double* const Q = Q_data->getGhostedLocalFormVecArray()->data();
+    const int num_nodes = static_cast<int>(op.local_indices.size());
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        const int s = op.local_indices[k];
+        if (q_sc_data)
+        {
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                double* const q = q_sc_data->getPointer(axis);
+                const int r = k * NDIM + axis;
+                const double Q_val = Q[s * NDIM + axis];
+                for (int j = op.row_ptr[r]; j < op.row_ptr[r + 1]; ++j)
+                {
+                    q[op.col_offsets[j]] += op.weights[j] * Q_val;
+                }
+            }
+        }
+        else
+        {
+            for (int d = 0; d < Q_depth; ++d)
+            {
+                double* const q = q_cc_data->getPointer(d);
+                const double Q_val = Q[s * Q_depth + d];
+                for (int j = op.row_ptr[k]; j < op.row_ptr[k + 1]; ++j)
+                {
+                    q[op.col_offsets[j]] += op.weights[j] * Q_val;
+                }
+            }
+        }
+    }
+    Q_data->restoreArrays();
+    return;
+} // spread
+
+int
+LEOperatorCache::getNumberOfAssemblies() const
+{
+    return d_num_assemblies;
+} // getNumberOfAssemblies
+
+int
+LEOperatorCache::getNumberOfReuses() const
+{
+    return d_num_reuses;
+} // getNumberOfReuses
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+LEOperatorCache::PatchOperator::PatchOperator()
+    : X_data(NULL), q_ghost_box(), num_stencils(0), local_indices(), row_ptr(), col_offsets(), weights()
+{
+    // intentionally blank
+    return;
+} // PatchOperator
+
+const LEOperatorCache::PatchOperator&
+LEOperatorCache::getPatchOperator(std::vector<std::vector<std::vector<PatchOperator> > >& ops,
+                                  const std::string& kernel_fcn,
+                                  const bool is_spread_op,
+                                  Pointer<LData> X_data,
+                                  Pointer<LNodeSetData> idx_data,
+                                  Pointer<PatchData<NDIM> > q_data,
+                                  Pointer<Patch<NDIM> > patch,
+                                  const int level_number)
+{
+    if (static_cast<int>(ops.size()) <= level_number) ops.resize(level_number + 1);
+    std::vector<std::vector<PatchOperator> >& level_ops = ops[level_number];
+    const int patch_num = patch->getPatchNumber();
+    if (static_cast<int>(level_ops.size()) <= patch_num) level_ops.resize(patch_num + 1);
+
+    // Look for an operator that was assembled for the same position data and
+    // the same Eulerian data layout.
+    std::vector<PatchOperator>& patch_ops = level_ops[patch_num];
+    const Box<NDIM>& q_ghost_box = q_data->getGhostBox();
+    for (std::vector<PatchOperator>::const_iterator it = patch_ops.begin(); it != patch_ops.end(); ++it)
+    {
+        if (it->X_data == X_data.getPointer() && it->q_ghost_box == q_ghost_box)
+        {
+            ++d_num_reuses;
+            return *it;
+        }
+    }
+    patch_ops.push_back(PatchOperator());
+    assemblePatchOperator(patch_ops.back(), kernel_fcn, is_spread_op, X_data, idx_data, q_data, patch);
+    ++d_num_assemblies;
+    return patch_ops.back();
+} // getPatchOperator
+
+void
+LEOperatorCache::assemblePatchOperator(PatchOperator& op,
+                                       const std::string& kernel_fcn,
+                                       const bool is_spread_op,
+                                       Pointer<LData> X_data,
+                                       Pointer<LNodeSetData> idx_data,
+                                       Pointer<PatchData<NDIM> > q_data,
+                                       Pointer<Patch<NDIM> > patch)
+{
+    const KernelFcnPtr kernel = get_kernel_fcn(kernel_fcn);
+    if (!kernel)
+    {
+        TBOX_ERROR(d_object_name << "::assemblePatchOperator():\n"
+                                 << "  unsupported kernel function: "
+                                 << kernel_fcn
+                                 << std::endl);
+    }
+    Pointer<CellData<NDIM, double> > q_cc_data = q_data;
+    Pointer<SideData<NDIM, double> > q_sc_data = q_data;
+    if (!q_cc_data && !q_sc_data)
+    {
+        TBOX_ERROR(d_object_name << "::assemblePatchOperator():\n"
+                                 << "  only cell-centered and side-centered data are supported"
+                                 << std::endl);
+    }
+    const int stencil_size = LEInteractor::getStencilSize(kernel_fcn);
+    const int min_ghosts = LEInteractor::getMinimumGhostWidth(kernel_fcn);
+    if (q_data->getGhostCellWidth().min() < min_ghosts)
+    {
+        TBOX_ERROR(d_object_name << "::assemblePatchOperator():\n"
+                                 << "  insufficient ghost cells for kernel function "
+                                 << kernel_fcn
+                                 << std::endl);
+    }
+
+    // Determine the patch geometry.
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const x_lower = pgeom->getXLower();
+    const double* const dx = pgeom->getDx();
+    const Index<NDIM>& ilower = patch->getBox().lower();
+    double vol = 1.0;
+    for (unsigned int d = 0; d < NDIM; ++d) vol *= dx[d];
+    const double weight_fac = is_spread_op ? 1.0 / vol : 1.0;
+
+    // Interpolation is restricted to the nodes in the patch interior, whereas
+    // spreading uses all nodes in the ghost box (see LDataManager).
+    const std::vector<int>& local_indices =
+        is_spread_op ? idx_data->getLocalPETScIndices() : idx_data->getInteriorLocalPETScIndices();
+    const std::vector<double>& periodic_shifts =
+        is_spread_op ? idx_data->getPeriodicShifts() : idx_data->getInteriorPeriodicShifts();
+    const int num_nodes = static_cast<int>(local_indices.size());
+    const int num_stencils = q_sc_data ? NDIM : 1;
+
+    op.X_data = X_data.getPointer();
+    op.q_ghost_box = q_data->getGhostBox();
+    op.num_stencils = num_stencils;
+    op.local_indices = local_indices;
+    op.row_ptr.clear();
+    op.col_offsets.clear();
+    op.weights.clear();
+    int max_stencil_pts = 1;
+    for (unsigned int d = 0; d < NDIM; ++d) max_stencil_pts *= stencil_size;
+    op.row_ptr.reserve(num_nodes * num_stencils + 1);
+    op.col_offsets.reserve(num_nodes * num_stencils * max_stencil_pts);
+    op.weights.reserve(num_nodes * num_stencils * max_stencil_pts);
+    op.row_ptr.push_back(0);
+    if (num_nodes == 0) return;
+
+    // Compute the tensor-product kernel weights.  The Eulerian index i along
+    // direction d is located at the continuous index coordinate t = i(d),
+    // where cell centers are offset by one half from cell sides.
+    const double* const X = X_data->getGhostedLocalFormVecArray()->data();
+    boost::array<std::vector<double>, NDIM> w;
+    Index<NDIM> ic_lower, ic_upper, ic;
+    for (int k = 0; k < num_nodes; ++k)
+    {
+        const int s = local_indices[k];
+        for (int axis = 0; axis < num_stencils; ++axis)
+        {
+            const Box<NDIM>& q_array_box =
+                q_sc_data ? q_sc_data->getArrayData(axis).getBox() : q_cc_data->getArrayData().getBox();
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const double offset = (q_sc_data && static_cast<int>(d) == axis) ? 0.0 : 0.5;
+                const double t =
+                    (X[s * NDIM + d] + periodic_shifts[k * NDIM + d] - x_lower[d]) / dx[d] + ilower(d) - offset;
+                ic_lower(d) =
+                    std::max(static_cast<int>(std::ceil(t - 0.5 * stencil_size)), q_array_box.lower()(d));
+                ic_upper(d) =
+                    std::min(static_cast<int>(std::floor(t + 0.5 * stencil_size)), q_array_box.upper()(d));
+                w[d].resize(std::max(ic_upper(d) - ic_lower(d) + 1, 0));
+                for (int i = ic_lower(d); i <= ic_upper(d); ++i)
+                {
+                    w[d][i - ic_lower(d)] = kernel(t - static_cast<double>(i));
+                }
+            }
+#if (NDIM == 3)
+            for (ic(2) = ic_lower(2); ic(2) <= ic_upper(2); ++ic(2))
+            {
+#endif
+                for (ic(1) = ic_lower(1); ic(1) <= ic_upper(1); ++ic(1))
+                {
+                    for (ic(0) = ic_lower(0); ic(0) <= ic_upper(0); ++ic(0))
+                    {
+                        double wgt = weight_fac * w[0][ic(0) - ic_lower(0)] * w[1][ic(1) - ic_lower(1)];
+#if (NDIM == 3)
+                        wgt *= w[2][ic(2) - ic_lower(2)];
+#endif
+                        if (wgt == 0.0) continue;
+                        op.col_offsets.push_back(q_array_box.offset(ic));
+                        op.weights.push_back(wgt);
+                    }
+                }
+#if (NDIM == 3)
+            }
+#endif
+            op.row_ptr.push_back(static_cast<int>(op.col_offsets.size()));
+        }
+    }
+    X_data->restoreArrays();
+    return;
+} // assemblePatchOperator
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,278 @@
+// Filename: LMarkerPatchArrays.cpp
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <vector>
+
+#include "Box.h"
+#include "CartesianPatchGeometry.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "ibtk/IndexUtilities.h"
+#include "ibtk/LMarker.h"
+#include "ibtk/LMarkerPatchArrays.h"
+#include "ibtk/LMarkerSet.h"
+#include "ibtk/LMarkerSetData.h"
+#include "ibtk/LSet.h"
+#include "ibtk/LSetData.h"
+#include "ibtk/LSetDataIterator.h"
+#include "ibtk/ibtk_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+LMarkerPatchArrays::LMarkerPatchArrays()
+    : d_marks(), d_idx(), d_X(), d_U(), d_bucket_cell_idx(), d_bucket_sets(), d_bucket_offsets(1, 0)
+{
+    // intentionally blank
+    return;
+} // LMarkerPatchArrays
+
+LMarkerPatchArrays::~LMarkerPatchArrays()
+{
+    // intentionally blank
+    return;
+} // ~LMarkerPatchArrays
+
+void
+LMarkerPatchArrays::gather(Pointer<LMarkerSetData> mark_data, const bool gather_velocities)
+{
+    clear();
+    for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getBox()); it != mark_data->data_end();
+         ++it)
+    {
+        const Index<NDIM>& i = it.getCellIndex();
+        if (d_bucket_cell_idx.empty() || d_bucket_cell_idx.back() != i)
+        {
+            if (!d_bucket_cell_idx.empty()) d_bucket_offsets.push_back(static_cast<unsigned int>(d_marks.size()));
+            d_bucket_cell_idx.push_back(i);
+            d_bucket_sets.push_back(mark_data->getItem(i));
+        }
+        LMarker* const mark = (*it).getPointer();
+        d_marks.push_back(mark);
+        d_idx.push_back(mark->getIndex());
+        const Point& X = mark->getPosition();
+        d_X.insert(d_X.end(), X.data(), X.data() + NDIM);
+        if (gather_velocities)
+        {
+            const Vector& U = mark->getVelocity();
+            d_U.insert(d_U.end(), U.data(), U.data() + NDIM);
+        }
+    }
+    if (!d_bucket_cell_idx.empty()) d_bucket_offsets.push_back(static_cast<unsigned int>(d_marks.size()));
+    return;
+} // gather
+
+void
+LMarkerPatchArrays::clear()
+{
+    d_marks.clear();
+    d_idx.clear();
+    d_X.clear();
+    d_U.clear();
+    d_bucket_cell_idx.clear();
+    d_bucket_sets.clear();
+    d_bucket_offsets.assign(1, 0);
+    return;
+} // clear
+
+unsigned int
+LMarkerPatchArrays::getNumberOfMarkers() const
+{
+    return static_cast<unsigned int>(d_marks.size());
+} // getNumberOfMarkers
+
+unsigned int
+LMarkerPatchArrays::getNumberOfBuckets() const
+{
+    return static_cast<unsigned int>(d_bucket_cell_idx.size());
+} // getNumberOfBuckets
+
+const Index<NDIM>&
+LMarkerPatchArrays::getBucketCellIndex(const unsigned int bucket) const
+{
+    return d_bucket_cell_idx[bucket];
+} // getBucketCellIndex
+
+const std::vector<unsigned int>&
+LMarkerPatchArrays::getBucketOffsets() const
+{
+    return d_bucket_offsets;
+} // getBucketOffsets
+
+const std::vector<int>&
+LMarkerPatchArrays::getMarkerIndices() const
+{
+    return d_idx;
+} // getMarkerIndices
+
+std::vector<double>&
+LMarkerPatchArrays::getPositions()
+{
+    return d_X;
+} // getPositions
+
+const std::vector<double>&
+LMarkerPatchArrays::getPositions() const
+{
+    return d_X;
+} // getPositions
+
+std::vector<double>&
+LMarkerPatchArrays::getVelocities()
+{
+    return d_U;
+} // getVelocities
+
+const std::vector<double>&
+LMarkerPatchArrays::getVelocities() const
+{
+    return d_U;
+} // getVelocities
+
+void
+LMarkerPatchArrays::scatterPositions(const std::vector<double>& X_mark) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(X_mark.size() == NDIM * d_marks.size());
+#endif
+    for (unsigned int k = 0; k < d_marks.size(); ++k)
+    {
+        Point& X = d_marks[k]->getPosition();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X[d] = X_mark[NDIM * k + d];
+        }
+    }
+    return;
+} // scatterPositions
+
+void
+LMarkerPatchArrays::scatterVelocities(const std::vector<double>& U_mark) const
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(U_mark.size() == NDIM * d_marks.size());
+#endif
+    for (unsigned int k = 0; k < d_marks.size(); ++k)
+    {
+        Vector& U = d_marks[k]->getVelocity();
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            U[d] = U_mark[NDIM * k + d];
+        }
+    }
+    return;
+} // scatterVelocities
+
+unsigned int
+LMarkerPatchArrays::rebin(Pointer<LMarkerSetData> mark_data, Pointer<Patch<NDIM> > patch)
+{
+    const Box<NDIM>& patch_box = patch->getBox();
+    const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+    const double* const patchXLower = patch_geom->getXLower();
+    const double* const patchXUpper = patch_geom->getXUpper();
+    const double* const patchDx = patch_geom->getDx();
+
+    // Move each marker whose position lies within a different interior cell of
+    // the patch.  Because markers are only appended to the destination sets,
+    // the positions of the gathered markers within the sets of buckets that
+    // have not yet been processed remain valid.
+    unsigned int num_moved = 0;
+    LMarkerSet::DataSet kept_marks;
+    for (unsigned int b = 0; b < d_bucket_cell_idx.size(); ++b)
+    {
+        const Index<NDIM>& i = d_bucket_cell_idx[b];
+        LMarkerSet& src_mark_set = *d_bucket_sets[b];
+        const unsigned int bucket_begin = d_bucket_offsets[b];
+        const unsigned int bucket_end = d_bucket_offsets[b + 1];
+        kept_marks.clear();
+        bool bucket_changed = false;
+        for (unsigned int k = bucket_begin; k < bucket_end; ++k)
+        {
+            const LMarkerSet::value_type& mark = src_mark_set[k - bucket_begin];
+            const Point& X = mark->getPosition();
+            const IntVector<NDIM>& offset = mark->getPeriodicOffset();
+            Point X_shifted;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                X_shifted[d] = X[d] + static_cast<double>(offset(d)) * patchDx[d];
+            }
+            const Index<NDIM> j = IndexUtilities::getCellIndex(
+                X_shifted, patchXLower, patchXUpper, patchDx, patch_box.lower(), patch_box.upper());
+            if (j == i || !patch_box.contains(j))
+            {
+                kept_marks.push_back(mark);
+                continue;
+            }
+            if (!mark_data->isElement(j))
+            {
+                mark_data->appendItemPointer(j, new LMarkerSet());
+            }
+            mark_data->getItem(j)->push_back(mark);
+            bucket_changed = true;
+            ++num_moved;
+        }
+        if (!bucket_changed) continue;
+
+        // Retain any markers that were appended to this cell by previously
+        // processed buckets.
+        kept_marks.insert(kept_marks.end(), src_mark_set.begin() + (bucket_end - bucket_begin), src_mark_set.end());
+        if (kept_marks.empty())
+        {
+            mark_data->removeItem(i);
+        }
+        else
+        {
+            src_mark_set.setDataSet(kept_marks);
+        }
+    }
+    clear();
+    return num_moved;
+} // rebin
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -51,6 +51,7 @@
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/LData.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "mpi.h"
 #include "petscao.h"
@@ -62,6 +63,8 @@
 #include "tbox/Pointer.h"
 #include "tbox/RestartManager.h"
 #include "tbox/SAMRAI_MPI.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 // IWYU pragma: no_include "petsc-private/vecimpl.h"
 
@@ -81,6 +84,9 @@ namespace
 static const int SILO_MPI_ROOT = 0;
 static const int SILO_MPI_TAG = 0;
 
+// Timers.
+static Timer* t_write_plot_data;
+
 // The name of the Silo dumps and database filenames.
 static const int SILO_NAME_BUFSIZE = 128;
 static const std::string VISIT_DUMPS_FILENAME = "lag_data.visit";
@@ -697,6 +703,9 @@ LSiloDataWriter::LSiloDataWriter(const std::string& object_name,
     {
         getFromRestart();
     }
+
+    // Setup Timers.
+    IBTK_DO_ONCE(t_write_plot_data = TimerManager::getManager()->getTimer("IBTK::LSiloDataWriter::writePlotData()"););
     return;
 } // LSiloDataWriter
 
@@ -1240,6 +1249,8 @@ LSiloDataWriter::registerLagrangianAO(std::vector<AO>& ao, const int coarsest_ln
 void
 LSiloDataWriter::writePlotData(const int time_step_number, const double simulation_time)
 {
+    IBTK_TIMER_START(t_write_plot_data);
+
 #if defined(IBTK_HAVE_SILO)
 #if !defined(NDEBUG)
     TBOX_ASSERT(time_step_number >= 0);
@@ -2101,6 +2112,8 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 #else
     TBOX_WARNING("LSiloDataWriter::writePlotData(): SILO is not installed; cannot write data." << std::endl);
 #endif // if defined(IBTK_HAVE_SILO)
+
+    IBTK_TIMER_STOP(t_write_plot_data);
     return;
 } // writePlotData
 
@@ -0,0 +1,618 @@
+// Filename: LTrajectoryWriter.cpp
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <ios>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Patch.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "boost/multi_array.hpp"
+#include "boost/unordered_map.hpp"
+#include "ibtk/LData.h"
+#include "ibtk/LDataManager.h"
+#include "ibtk/LMarkerPatchArrays.h"
+#include "ibtk/LMarkerSetData.h"
+#include "ibtk/LTrajectoryWriter.h"
+#include "ibtk/ibtk_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/MathUtilities.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Trajectory file and chunk identifiers.
+static const char TRAJECTORY_FILE_MAGIC[8] = "IBTKTRJ";
+static const int TRAJECTORY_FILE_VERSION = 1;
+static const unsigned int TRAJECTORY_CHUNK_MAGIC = 0x4b4e4843;
+
+// Trajectory file names.
+static const std::string TRAJECTORY_FILE_PREFIX = "trajectory.";
+static const std::string TRAJECTORY_FILE_POSTFIX = ".dat";
+
+inline std::string
+trajectory_file_name(const std::string& dump_directory_name, const int rank)
+{
+    char temp_buf[16];
+    sprintf(temp_buf, "%05d", rank);
+    return dump_directory_name + "/" + TRAJECTORY_FILE_PREFIX + temp_buf + TRAJECTORY_FILE_POSTFIX;
+} // trajectory_file_name
+
+inline unsigned long long
+zigzag_encode(const long long v)
+{
+    return (static_cast<unsigned long long>(v) << 1) ^ static_cast<unsigned long long>(v >> 63);
+} // zigzag_encode
+
+inline long long
+zigzag_decode(const unsigned long long u)
+{
+    return static_cast<long long>(u >> 1) ^ -static_cast<long long>(u & 1);
+} // zigzag_decode
+
+inline void
+put_varint(std::vector<unsigned char>& bytes, unsigned long long u)
+{
+    while (u >= 0x80)
+    {
+        bytes.push_back(static_cast<unsigned char>(u | 0x80));
+        u >>= 7;
+    }
+    bytes.push_back(static_cast<unsigned char>(u));
+    return;
+} // put_varint
+
+inline unsigned long long
+get_varint(const unsigned char*& p)
+{
+    unsigned long long u = 0;
+    for (unsigned int shift = 0;; shift += 7)
+    {
+        const unsigned char byte = *p++;
+        u |= static_cast<unsigned long long>(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) break;
+    }
+    return u;
+} // get_varint
+
+// Read and check the header of a trajectory file.  Returns false if the header
+// is invalid or was written for a different spatial dimension.
+inline bool
+read_file_header(std::istream& is, bool& write_velocities, double& error_bound)
+{
+    char magic[8];
+    int version, dim, velocity_flag;
+    is.read(magic, sizeof(magic));
+    is.read(reinterpret_cast<char*>(&version), sizeof(int));
+    is.read(reinterpret_cast<char*>(&dim), sizeof(int));
+    is.read(reinterpret_cast<char*>(&velocity_flag), sizeof(int));
+    is.read(reinterpret_cast<char*>(&error_bound), sizeof(double));
+    write_velocities = velocity_flag != 0;
+    return is && memcmp(magic, TRAJECTORY_FILE_MAGIC, sizeof(magic)) == 0 && version == TRAJECTORY_FILE_VERSION &&
+           dim == NDIM;
+} // read_file_header
+
+// Return the quantized values stored for point i in the previous record of the
+// current chunk, allocating zero-initialized storage if the point has not yet
+// appeared in the chunk.  The storage is keyed by the points that actually
+// appear in the chunk, so that its size is independent of the range of the
+// point indices.
+inline long long*
+get_prev_values(boost::unordered_map<int, size_t>& prev_offset,
+                std::vector<long long>& prev_q,
+                const int i,
+                const unsigned int depth,
+                bool& has_prev)
+{
+    std::pair<boost::unordered_map<int, size_t>::iterator, bool> it =
+        prev_offset.insert(std::make_pair(i, prev_q.size()));
+    has_prev = !it.second;
+    if (!has_prev) prev_q.resize(prev_q.size() + depth, 0);
+    return &prev_q[it.first->second];
+} // get_prev_values
+
+// Sequential reader for a single per-process trajectory file.
+class TrajectoryFileReader
+{
+public:
+    TrajectoryFileReader(const std::string& file_name)
+        : d_file_name(file_name),
+          d_stream(file_name.c_str(), std::ios::in | std::ios::binary),
+          d_depth(0),
+          d_quantum(0.0),
+          d_payload(),
+          d_p(NULL),
+          d_num_records_left(0)
+    {
+        if (!d_stream)
+        {
+            TBOX_ERROR("LTrajectoryWriter::mergeTrajectoryFiles():\n"
+                       << "  could not open trajectory file "
+                       << d_file_name
+                       << std::endl);
+        }
+        bool write_velocities;
+        double error_bound;
+        if (!read_file_header(d_stream, write_velocities, error_bound))
+        {
+            TBOX_ERROR("LTrajectoryWriter::mergeTrajectoryFiles():\n"
+                       << "  invalid or incompatible trajectory file "
+                       << d_file_name
+                       << std::endl);
+        }
+        d_depth = (write_velocities ? 2 : 1) * NDIM;
+        d_quantum = 2.0 * error_bound;
+        return;
+    } // TrajectoryFileReader
+
+    unsigned int getDepth() const
+    {
+        return d_depth;
+    } // getDepth
+
+    bool readRecord(double& data_time, std::vector<int>& idx, std::vector<double>& vals)
+    {
+        if (d_num_records_left == 0 && !readChunk()) return false;
+        memcpy(&data_time, d_p, sizeof(double));
+        d_p += sizeof(double);
+        const unsigned int num_points = static_cast<unsigned int>(get_varint(d_p));
+        idx.resize(num_points);
+        vals.resize(d_depth * num_points);
+        int i = 0;
+        for (unsigned int k = 0; k < num_points; ++k)
+        {
+            i += static_cast<int>(zigzag_decode(get_varint(d_p)));
+            idx[k] = i;
+            bool has_prev;
+            long long* const q_prev = get_prev_values(d_prev_offset, d_prev_q, i, d_depth, has_prev);
+            for (unsigned int d = 0; d < d_depth; ++d)
+            {
+                const long long q = (has_prev ? q_prev[d] : 0) + zigzag_decode(get_varint(d_p));
+                q_prev[d] = q;
+                vals[d_depth * k + d] = d_quantum * static_cast<double>(q);
+            }
+        }
+        --d_num_records_left;
+        return true;
+    } // readRecord
+
+private:
+    bool readChunk()
+    {
+        unsigned int chunk_magic, num_records;
+        unsigned long long num_bytes;
+        d_stream.read(reinterpret_cast<char*>(&chunk_magic), sizeof(unsigned int));
+        if (d_stream.eof()) return false;
+        d_stream.read(reinterpret_cast<char*>(&num_records), sizeof(unsigned int));
+        d_stream.read(reinterpret_cast<char*>(&num_bytes), sizeof(unsigned long long));
+        if (!d_stream || chunk_magic != TRAJECTORY_CHUNK_MAGIC)
+        {
+            TBOX_ERROR("LTrajectoryWriter::mergeTrajectoryFiles():\n"
+                       << "  corrupt chunk encountered in trajectory file "
+                       << d_file_name
+                       << std::endl);
+        }
+        d_payload.resize(static_cast<size_t>(num_bytes));
+        if (num_bytes > 0)
+        {
+            d_stream.read(reinterpret_cast<char*>(&d_payload[0]), static_cast<std::streamsize>(num_bytes));
+        }
+        d_p = d_payload.empty() ? NULL : &d_payload[0];
+        d_num_records_left = num_records;
+        d_prev_offset.clear();
+        d_prev_q.clear();
+        return num_records > 0 || readChunk();
+    } // readChunk
+
+    std::string d_file_name;
+    std::ifstream d_stream;
+    unsigned int d_depth;
+    double d_quantum;
+    std::vector<unsigned char> d_payload;
+    const unsigned char* d_p;
+    unsigned int d_num_records_left;
+    boost::unordered_map<int, size_t> d_prev_offset;
+    std::vector<long long> d_prev_q;
+};
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+LTrajectoryWriter::LTrajectoryWriter(const std::string& object_name,
+                                     const std::string& dump_directory_name,
+                                     const double error_bound,
+                                     const bool write_velocities,
+                                     const unsigned int buffer_size)
+    : d_object_name(object_name),
+      d_dump_directory_name(dump_directory_name),
+      d_file_name(trajectory_file_name(dump_directory_name, SAMRAI_MPI::getRank())),
+      d_error_bound(error_bound),
+      d_write_velocities(write_velocities),
+      d_buffer_size(buffer_size)
+{
+    if (d_dump_directory_name.empty())
+    {
+        TBOX_ERROR(d_object_name << "::LTrajectoryWriter()\n"
+                                 << "  dump directory name is empty"
+                                 << std::endl);
+    }
+    if (d_error_bound <= 0.0)
+    {
+        TBOX_ERROR(d_object_name << "::LTrajectoryWriter()\n"
+                                 << "  error bound must be positive"
+                                 << std::endl);
+    }
+    Utilities::recursiveMkdir(d_dump_directory_name);
+    d_X_buffer.reserve(d_write_velocities ? d_buffer_size / 2 : d_buffer_size);
+    if (d_write_velocities) d_U_buffer.reserve(d_buffer_size / 2);
+    d_idx_buffer.reserve(d_buffer_size / ((d_write_velocities ? 2 : 1) * NDIM));
+    return;
+} // LTrajectoryWriter
+
+LTrajectoryWriter::~LTrajectoryWriter()
+{
+    flush();
+    if (d_file_stream.is_open()) d_file_stream.close();
+    return;
+} // ~LTrajectoryWriter
+
+void
+LTrajectoryWriter::recordMarkerData(const int mark_idx,
+                                    Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                    const double data_time,
+                                    const int coarsest_ln_in,
+                                    const int finest_ln_in)
+{
+    const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
+    const int finest_ln = (finest_ln_in == -1 ? hierarchy->getFinestLevelNumber() : finest_ln_in);
+    beginRecord(data_time);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<LMarkerSetData> mark_data = patch->getPatchData(mark_idx);
+            d_mark_arrays.gather(mark_data, d_write_velocities);
+            const unsigned int num_patch_marks = d_mark_arrays.getNumberOfMarkers();
+            if (num_patch_marks == 0) continue;
+            appendToRecord(&d_mark_arrays.getMarkerIndices()[0],
+                           &d_mark_arrays.getPositions()[0],
+                           d_write_velocities ? &d_mark_arrays.getVelocities()[0] : NULL,
+                           num_patch_marks);
+        }
+    }
+    d_mark_arrays.clear();
+    endRecord();
+    return;
+} // recordMarkerData
+
+void
+LTrajectoryWriter::recordLagrangianData(Pointer<LData> X_data,
+                                        Pointer<LData> U_data,
+                                        const LDataManager* const l_data_manager,
+                                        const int level_number,
+                                        const double data_time)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(X_data && X_data->getDepth() == NDIM);
+    TBOX_ASSERT(!d_write_velocities || (U_data && U_data->getDepth() == NDIM));
+#endif
+    const std::vector<int>& lag_idx = l_data_manager->getLocalLagrangianIndices(level_number);
+    const unsigned int num_local_nodes = l_data_manager->getNumberOfLocalNodes(level_number);
+    beginRecord(data_time);
+    if (num_local_nodes > 0)
+    {
+        const double* const X = X_data->getLocalFormVecArray()->data();
+        const double* const U = d_write_velocities ? U_data->getLocalFormVecArray()->data() : NULL;
+        appendToRecord(&lag_idx[0], X, U, num_local_nodes);
+        X_data->restoreArrays();
+        if (d_write_velocities) U_data->restoreArrays();
+    }
+    endRecord();
+    return;
+} // recordLagrangianData
+
+void
+LTrajectoryWriter::recordPointData(const int* const idx,
+                                   const double* const X,
+                                   const double* const U,
+                                   const unsigned int num_points,
+                                   const double data_time)
+{
+    beginRecord(data_time);
+    if (num_points > 0) appendToRecord(idx, X, U, num_points);
+    endRecord();
+    return;
+} // recordPointData
+
+void
+LTrajectoryWriter::flush()
+{
+    writeChunk();
+    if (d_file_stream.is_open()) d_file_stream.flush();
+    return;
+} // flush
+
+void
+LTrajectoryWriter::mergeTrajectoryFiles(const std::string& dump_directory_name,
+                                        const int num_files,
+                                        const std::string& output_file_name)
+{
+    std::vector<TrajectoryFileReader*> readers(num_files);
+    for (int f = 0; f < num_files; ++f)
+    {
+        readers[f] = new TrajectoryFileReader(trajectory_file_name(dump_directory_name, f));
+        if (readers[f]->getDepth() != readers[0]->getDepth())
+        {
+            TBOX_ERROR("LTrajectoryWriter::mergeTrajectoryFiles():\n"
+                       << "  trajectory files contain inconsistent data"
+                       << std::endl);
+        }
+    }
+    const unsigned int depth = num_files > 0 ? readers[0]->getDepth() : 0;
+
+    std::ofstream os(output_file_name.c_str(), std::ios::out);
+    if (!os)
+    {
+        TBOX_ERROR("LTrajectoryWriter::mergeTrajectoryFiles():\n"
+                   << "  could not open output file "
+                   << output_file_name
+                   << std::endl);
+    }
+    os.precision(std::numeric_limits<double>::digits10);
+
+    // Merge the records from all files, one time at a time.  Each file stores
+    // its records in order of increasing time.
+    std::vector<bool> has_record(num_files);
+    std::vector<double> record_time(num_files);
+    std::vector<std::vector<int> > record_idx(num_files);
+    std::vector<std::vector<double> > record_vals(num_files);
+    for (int f = 0; f < num_files; ++f)
+    {
+        has_record[f] = readers[f]->readRecord(record_time[f], record_idx[f], record_vals[f]);
+    }
+    std::vector<std::pair<int, std::pair<int, unsigned int> > > points;
+    while (true)
+    {
+        int f_min = -1;
+        for (int f = 0; f < num_files; ++f)
+        {
+            if (has_record[f] && (f_min == -1 || record_time[f] < record_time[f_min])) f_min = f;
+        }
+        if (f_min == -1) break;
+        const double data_time = record_time[f_min];
+
+        points.clear();
+        for (int f = 0; f < num_files; ++f)
+        {
+            if (!has_record[f] || !MathUtilities<double>::equalEps(record_time[f], data_time)) continue;
+            for (unsigned int k = 0; k < record_idx[f].size(); ++k)
+            {
+                points.push_back(std::make_pair(record_idx[f][k], std::make_pair(f, k)));
+            }
+        }
+        std::sort(points.begin(), points.end());
+        for (unsigned int j = 0; j < points.size(); ++j)
+        {
+            const int f = points[j].second.first;
+            const unsigned int k = points[j].second.second;
+            os << data_time << " " << points[j].first;
+            for (unsigned int d = 0; d < depth; ++d)
+            {
+                os << " " << record_vals[f][depth * k + d];
+            }
+            os << "\n";
+        }
+
+        for (int f = 0; f < num_files; ++f)
+        {
+            if (!has_record[f] || !MathUtilities<double>::equalEps(record_time[f], data_time)) continue;
+            has_record[f] = readers[f]->readRecord(record_time[f], record_idx[f], record_vals[f]);
+        }
+    }
+
+    for (int f = 0; f < num_files; ++f)
+    {
+        delete readers[f];
+    }
+    return;
+} // mergeTrajectoryFiles
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+LTrajectoryWriter::beginRecord(const double data_time)
+{
+    d_record_time.push_back(data_time);
+    d_record_offset.push_back(d_idx_buffer.size());
+    return;
+} // beginRecord
+
+void
+LTrajectoryWriter::appendToRecord(const int* const idx,
+                                  const double* const X,
+                                  const double* const U,
+                                  const unsigned int num_points)
+{
+    d_idx_buffer.insert(d_idx_buffer.end(), idx, idx + num_points);
+    d_X_buffer.insert(d_X_buffer.end(), X, X + NDIM * num_points);
+    if (d_write_velocities) d_U_buffer.insert(d_U_buffer.end(), U, U + NDIM * num_points);
+    return;
+} // appendToRecord
+
+void
+LTrajectoryWriter::endRecord()
+{
+    if (d_X_buffer.size() + d_U_buffer.size() >= d_buffer_size) writeChunk();
+    return;
+} // endRecord
+
+void
+LTrajectoryWriter::writeChunk()
+{
+    if (d_record_time.empty()) return;
+
+    // Open the per-process file, writing the file header if the file is new.
+    // Records are only appended to an existing file if it was written with the
+    // same configuration.
+    if (!d_file_stream.is_open())
+    {
+        std::ifstream is(d_file_name.c_str(), std::ios::in | std::ios::binary);
+        const bool file_is_new = !is || is.peek() == std::ifstream::traits_type::eof();
+        if (!file_is_new)
+        {
+            bool write_velocities;
+            double error_bound;
+            if (!read_file_header(is, write_velocities, error_bound) || write_velocities != d_write_velocities ||
+                !MathUtilities<double>::equalEps(error_bound, d_error_bound))
+            {
+                TBOX_ERROR(d_object_name << "::writeChunk()\n"
+                                         << "  existing trajectory file "
+                                         << d_file_name
+                                         << " is invalid or was written with a different error bound or velocity "
+                                            "setting"
+                                         << std::endl);
+            }
+        }
+        is.close();
+        d_file_stream.open(d_file_name.c_str(), std::ios::out | std::ios::binary | std::ios::app);
+        if (!d_file_stream)
+        {
+            TBOX_ERROR(d_object_name << "::writeChunk()\n"
+                                     << "  could not open trajectory file "
+                                     << d_file_name
+                                     << std::endl);
+        }
+        if (file_is_new)
+        {
+            const int version = TRAJECTORY_FILE_VERSION;
+            const int dim = NDIM;
+            const int write_velocities = d_write_velocities ? 1 : 0;
+            d_file_stream.write(TRAJECTORY_FILE_MAGIC, sizeof(TRAJECTORY_FILE_MAGIC));
+            d_file_stream.write(reinterpret_cast<const char*>(&version), sizeof(int));
+            d_file_stream.write(reinterpret_cast<const char*>(&dim), sizeof(int));
+            d_file_stream.write(reinterpret_cast<const char*>(&write_velocities), sizeof(int));
+            d_file_stream.write(reinterpret_cast<const char*>(&d_error_bound), sizeof(double));
+        }
+    }
+
+    // Encode the buffered records.  Values are quantized to integer multiples
+    // of twice the error bound and are delta encoded against the values of the
+    // same point in the previous record of this chunk.
+    const unsigned int depth = (d_write_velocities ? 2 : 1) * NDIM;
+    const double inv_quantum = 1.0 / (2.0 * d_error_bound);
+    const unsigned int num_records = static_cast<unsigned int>(d_record_time.size());
+    d_record_offset.push_back(d_idx_buffer.size());
+    d_chunk_bytes.clear();
+    d_prev_offset.clear();
+    d_prev_q.clear();
+    for (unsigned int r = 0; r < num_records; ++r)
+    {
+        const unsigned char* const time_bytes = reinterpret_cast<const unsigned char*>(&d_record_time[r]);
+        d_chunk_bytes.insert(d_chunk_bytes.end(), time_bytes, time_bytes + sizeof(double));
+        const size_t record_begin = d_record_offset[r];
+        const size_t record_end = d_record_offset[r + 1];
+        put_varint(d_chunk_bytes, record_end - record_begin);
+        int prev_i = 0;
+        for (size_t k = record_begin; k < record_end; ++k)
+        {
+            const int i = d_idx_buffer[k];
+#if !defined(NDEBUG)
+            TBOX_ASSERT(i >= 0);
+#endif
+            put_varint(d_chunk_bytes, zigzag_encode(static_cast<long long>(i) - prev_i));
+            prev_i = i;
+            bool has_prev;
+            long long* const q_prev = get_prev_values(d_prev_offset, d_prev_q, i, depth, has_prev);
+            for (unsigned int d = 0; d < depth; ++d)
+            {
+                const double v = d < NDIM ? d_X_buffer[NDIM * k + d] : d_U_buffer[NDIM * k + d - NDIM];
+                const long long q = static_cast<long long>(floor(v * inv_quantum + 0.5));
+                put_varint(d_chunk_bytes, zigzag_encode(q - (has_prev ? q_prev[d] : 0)));
+                q_prev[d] = q;
+            }
+        }
+    }
+
+    // Write the chunk.
+    const unsigned int chunk_magic = TRAJECTORY_CHUNK_MAGIC;
+    const unsigned long long num_bytes = d_chunk_bytes.size();
+    d_file_stream.write(reinterpret_cast<const char*>(&chunk_magic), sizeof(unsigned int));
+    d_file_stream.write(reinterpret_cast<const char*>(&num_records), sizeof(unsigned int));
+    d_file_stream.write(reinterpret_cast<const char*>(&num_bytes), sizeof(unsigned long long));
+    if (num_bytes > 0)
+    {
+        d_file_stream.write(reinterpret_cast<const char*>(&d_chunk_bytes[0]),
+                            static_cast<std::streamsize>(num_bytes));
+    }
+    if (!d_file_stream)
+    {
+        TBOX_ERROR(d_object_name << "::writeChunk()\n"
+                                 << "  error writing trajectory file "
+                                 << d_file_name
+                                 << std::endl);
+    }
+
+    // Reset the buffers, retaining their capacity.
+    d_record_time.clear();
+    d_record_offset.clear();
+    d_idx_buffer.clear();
+    d_X_buffer.clear();
+    d_U_buffer.clear();
+    return;
+} // writeChunk
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
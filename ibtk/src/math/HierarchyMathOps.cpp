@@ -3068,6 +3068,32 @@ HierarchyMathOps::strain_rate(const int dst_idx,
     return;
 } // strain
 
+void
+HierarchyMathOps::synchronizeCoarseFineBoundary(const int dst_idx)
+{
+    for (int ln = d_finest_ln; ln > d_coarsest_ln; --ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+
+        // Extract data on the coarse-fine interface.
+        level->allocatePatchData(d_os_idx);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+
+            Pointer<SideData<NDIM, double> > dst_data = patch->getPatchData(dst_idx);
+            Pointer<OutersideData<NDIM, double> > os_data = patch->getPatchData(d_os_idx);
+            os_data->copy(*dst_data);
+        }
+
+        // Synchronize the coarse-fine interface of dst and deallocate
+        // temporary data.
+        xeqScheduleOutersideRestriction(dst_idx, d_os_idx, ln - 1);
+        level->deallocatePatchData(d_os_idx);
+    }
+    return;
+} // synchronizeCoarseFineBoundary
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 void
@@ -33,6 +33,8 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <cmath>
+#include <complex>
 #include <functional>
 #include <map>
 #include <ostream>
@@ -66,6 +68,7 @@
 #include "tbox/MathUtilities.h"
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
+#include "unsupported/Eigen/FFT"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -99,6 +102,37 @@ compute_tangential_extension(const Box<NDIM>& box, const int data_axis)
     extended_box.upper()(data_axis) += 1;
     return extended_box;
 }
+
+// Apply one-dimensional FFTs along all grid lines in the specified direction of
+// a column-major array.
+void
+transform_lines(std::vector<std::complex<double> >& data,
+                const IntVector<NDIM>& num_cells,
+                const unsigned int axis,
+                const bool forward,
+                Eigen::FFT<double>& fft)
+{
+    const int len = num_cells(axis);
+    int stride = 1;
+    for (unsigned int d = 0; d < axis; ++d) stride *= num_cells(d);
+    const int num_lines = static_cast<int>(data.size()) / len;
+    std::vector<std::complex<double> > line_in(len), line_out(len);
+    for (int l = 0; l < num_lines; ++l)
+    {
+        const int base = (l % stride) + (l / stride) * stride * len;
+        for (int k = 0; k < len; ++k) line_in[k] = data[base + k * stride];
+        if (forward)
+        {
+            fft.fwd(line_out, line_in);
+        }
+        else
+        {
+            fft.inv(line_out, line_in);
+        }
+        for (int k = 0; k < len; ++k) data[base + k * stride] = line_out[k];
+    }
+    return;
+}
 }
 
 void
@@ -1083,6 +1117,142 @@ PoissonUtilities::adjustRHSAtCoarseFineBoundary(SideData<NDIM, double>& rhs_data
     return;
 } // adjustRHSAtCoarseFineBoundary
 
+void
+PoissonUtilities::solveUniformGridSpectral(std::vector<double>& u,
+                                           const std::vector<double>& f,
+                                           const IntVector<NDIM>& num_cells,
+                                           const double* const dx,
+                                           const double C,
+                                           const double D,
+                                           const std::vector<SpectralBoundaryType>& bdry_types)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(bdry_types.size() == 2 * NDIM);
+#endif
+    // Setup the mappings from the extended periodic grid to the original grid.
+    //
+    // Along a direction with homogeneous Dirichlet (resp. Neumann) boundary
+    // conditions at both ends, the data are extended antisymmetrically (resp.
+    // symmetrically) to a periodic grid with twice as many cells.  With mixed
+    // boundary conditions, the data are extended to a periodic grid with four
+    // times as many cells by alternately reflecting the data about the upper
+    // and lower boundaries.
+    IntVector<NDIM> num_ext_cells;
+    boost::array<std::vector<int>, NDIM> ext_idx;
+    boost::array<std::vector<double>, NDIM> ext_sgn;
+    int num_total_cells = 1, num_total_ext_cells = 1;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        const int n = num_cells(axis);
+        const SpectralBoundaryType lower_type = bdry_types[2 * axis];
+        const SpectralBoundaryType upper_type = bdry_types[2 * axis + 1];
+#if !defined(NDEBUG)
+        TBOX_ASSERT((lower_type == SPECTRAL_PERIODIC) == (upper_type == SPECTRAL_PERIODIC));
+#endif
+        int num_blocks = 1;
+        boost::array<double, 4> block_sgn = { { 1.0, 1.0, 1.0, 1.0 } };
+        if (lower_type != SPECTRAL_PERIODIC)
+        {
+            const double lower_sgn = lower_type == SPECTRAL_DIRICHLET ? -1.0 : 1.0;
+            const double upper_sgn = upper_type == SPECTRAL_DIRICHLET ? -1.0 : 1.0;
+            num_blocks = lower_sgn == upper_sgn ? 2 : 4;
+            block_sgn[1] = upper_sgn;
+            block_sgn[2] = lower_sgn * upper_sgn;
+            block_sgn[3] = lower_sgn;
+        }
+        num_ext_cells(axis) = num_blocks * n;
+        ext_idx[axis].resize(num_ext_cells(axis));
+        ext_sgn[axis].resize(num_ext_cells(axis));
+        for (int j = 0; j < num_ext_cells(axis); ++j)
+        {
+            const int block = j / n;
+            const int r = j % n;
+            ext_idx[axis][j] = block % 2 == 0 ? r : n - 1 - r;
+            ext_sgn[axis][j] = block_sgn[block];
+        }
+        num_total_cells *= n;
+        num_total_ext_cells *= num_ext_cells(axis);
+    }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(static_cast<int>(f.size()) == num_total_cells);
+#endif
+
+    // Extend the right-hand side data.
+    std::vector<std::complex<double> > data(num_total_ext_cells);
+    for (int j = 0; j < num_total_ext_cells; ++j)
+    {
+        int rem = j, i = 0, stride = 1;
+        double sgn = 1.0;
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            const int j_axis = rem % num_ext_cells(axis);
+            rem /= num_ext_cells(axis);
+            i += ext_idx[axis][j_axis] * stride;
+            sgn *= ext_sgn[axis][j_axis];
+            stride *= num_cells(axis);
+        }
+        data[j] = sgn * f[i];
+    }
+
+    // Transform the data, scale each mode by the inverse of the corresponding
+    // eigenvalue of the operator, and transform back.
+    Eigen::FFT<double> fft;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        transform_lines(data, num_ext_cells, axis, /*forward*/ true, fft);
+    }
+    boost::array<std::vector<double>, NDIM> eigenvalues;
+    double op_scale = std::abs(C);
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        const int m = num_ext_cells(axis);
+        eigenvalues[axis].resize(m);
+        for (int k = 0; k < m; ++k)
+        {
+            const double s = std::sin(M_PI * static_cast<double>(k) / static_cast<double>(m));
+            eigenvalues[axis][k] = -4.0 * s * s / (dx[axis] * dx[axis]);
+        }
+        op_scale += 4.0 * std::abs(D) / (dx[axis] * dx[axis]);
+    }
+    for (int j = 0; j < num_total_ext_cells; ++j)
+    {
+        int rem = j;
+        double mu = C;
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            mu += D * eigenvalues[axis][rem % num_ext_cells(axis)];
+            rem /= num_ext_cells(axis);
+        }
+        if (std::abs(mu) <= 1.0e-12 * op_scale)
+        {
+            data[j] = 0.0;
+        }
+        else
+        {
+            data[j] /= mu;
+        }
+    }
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        transform_lines(data, num_ext_cells, axis, /*forward*/ false, fft);
+    }
+
+    // Extract the solution from the leading block of the extended grid.
+    u.resize(num_total_cells);
+    for (int i = 0; i < num_total_cells; ++i)
+    {
+        int rem = i, j = 0, stride = 1;
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            j += (rem % num_cells(axis)) * stride;
+            rem /= num_cells(axis);
+            stride *= num_ext_cells(axis);
+        }
+        u[i] = data[j].real();
+    }
+    return;
+} // solveUniformGridSpectral
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 /////////////////////////////// PROTECTED ////////////////////////////////////
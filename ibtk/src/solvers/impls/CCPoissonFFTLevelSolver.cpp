@@ -0,0 +1,474 @@
+// Filename: CCPoissonFFTLevelSolver.cpp
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ArrayData.h"
+#include "BoundaryBox.h"
+#include "Box.h"
+#include "BoxArray.h"
+#include "CartesianGridGeometry.h"
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
+#include "CellDataFactory.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchDescriptor.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "PoissonSpecifications.h"
+#include "RobinBcCoefStrategy.h"
+#include "SAMRAIVectorReal.h"
+#include "VariableDatabase.h"
+#include "ibtk/CCPoissonFFTLevelSolver.h"
+#include "ibtk/ExtendedRobinBcCoefStrategy.h"
+#include "ibtk/GeneralSolver.h"
+#include "ibtk/PhysicalBoundaryUtilities.h"
+#include "ibtk/PoissonUtilities.h"
+#include "ibtk/ibtk_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Array.h"
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Timers.
+static Timer* t_solve_system;
+static Timer* t_solve_system_fft;
+static Timer* t_initialize_solver_state;
+static Timer* t_deallocate_solver_state;
+
+// Classification of the homogeneous boundary conditions along a side of the
+// computational domain.
+enum BoundaryClass
+{
+    BDRY_DIRICHLET = 0,
+    BDRY_NEUMANN = 1,
+    BDRY_OTHER = 2,
+    NUM_BDRY_CLASSES = 3
+};
+
+// Tolerance used to classify Robin boundary conditions.
+static const double BDRY_CLASS_TOL = 1.0e-12;
+
+// Offset of a cell index in a column-major array spanning the given box.
+inline int
+global_offset(const Index<NDIM>& i, const Box<NDIM>& box)
+{
+    int offset = 0, stride = 1;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        offset += (i(axis) - box.lower()(axis)) * stride;
+        stride *= box.numberCells(axis);
+    }
+    return offset;
+} // global_offset
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+CCPoissonFFTLevelSolver::CCPoissonFFTLevelSolver(const std::string& object_name,
+                                                 Pointer<Database> input_db,
+                                                 const std::string& /*default_options_prefix*/)
+    : d_hierarchy(), d_level_num(-1), d_level(), d_domain_box(), d_depth(0), d_bdry_types()
+{
+    // Setup default options.
+    GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
+    d_initial_guess_nonzero = false;
+    d_rel_residual_tol = 1.0e-5;
+    d_abs_residual_tol = 1.0e-50;
+    d_max_iterations = 1;
+
+    // Get values from the input database.
+    if (input_db)
+    {
+        if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+    }
+
+    // Setup Timers.
+    IBTK_DO_ONCE(t_solve_system = TimerManager::getManager()->getTimer("IBTK::CCPoissonFFTLevelSolver::solveSystem()");
+                 t_solve_system_fft =
+                     TimerManager::getManager()->getTimer("IBTK::CCPoissonFFTLevelSolver::solveSystem()[fft]");
+                 t_initialize_solver_state =
+                     TimerManager::getManager()->getTimer("IBTK::CCPoissonFFTLevelSolver::initializeSolverState()");
+                 t_deallocate_solver_state =
+                     TimerManager::getManager()->getTimer("IBTK::CCPoissonFFTLevelSolver::deallocateSolverState()"););
+    return;
+} // CCPoissonFFTLevelSolver
+
+CCPoissonFFTLevelSolver::~CCPoissonFFTLevelSolver()
+{
+    if (d_is_initialized) deallocateSolverState();
+    return;
+} // ~CCPoissonFFTLevelSolver
+
+bool
+CCPoissonFFTLevelSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBTK_TIMER_START(t_solve_system);
+
+    // Initialize the solver, when necessary.
+    const bool deallocate_after_solve = !d_is_initialized;
+    if (deallocate_after_solve) initializeSolverState(x, b);
+
+    static const int comp = 0;
+    const int x_idx = x.getComponentDescriptorIndex(comp);
+    const int b_idx = b.getComponentDescriptorIndex(comp);
+
+    // Gather the right-hand-side data, modified to account for any
+    // inhomogeneous boundary conditions, into a global array.
+    const int num_cells = d_domain_box.size();
+    std::vector<double> f(d_depth * num_cells, 0.0);
+    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+        Pointer<CellData<NDIM, double> > b_data = patch->getPatchData(b_idx);
+        CellData<NDIM, double> b_adj_data(patch_box, d_depth, IntVector<NDIM>(0));
+        b_adj_data.copy(*b_data);
+        if (pgeom->intersectsPhysicalBoundary())
+        {
+            PoissonUtilities::adjustRHSAtPhysicalBoundary(
+                b_adj_data, patch, d_poisson_spec, d_bc_coefs, d_solution_time, d_homogeneous_bc);
+        }
+        for (Box<NDIM>::Iterator b(patch_box); b; b++)
+        {
+            const Index<NDIM>& i = b();
+            const int offset = global_offset(i, d_domain_box);
+            for (unsigned int d = 0; d < d_depth; ++d)
+            {
+                f[d * num_cells + offset] = b_adj_data(i, d);
+            }
+        }
+    }
+    SAMRAI_MPI::sumReduction(&f[0], static_cast<int>(f.size()));
+
+    // Solve the system redundantly on each process.
+    IBTK_TIMER_START(t_solve_system_fft);
+    const IntVector<NDIM> num_domain_cells = d_domain_box.numberCells();
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const double* const dx_coarsest = grid_geom->getDx();
+    const IntVector<NDIM>& ratio = d_level->getRatio();
+    double dx[NDIM];
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        dx[axis] = dx_coarsest[axis] / static_cast<double>(ratio(axis));
+    }
+    const double C = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+    const double D = d_poisson_spec.getDConstant();
+    std::vector<double> u(d_depth * num_cells, 0.0);
+    for (unsigned int d = 0; d < d_depth; ++d)
+    {
+        std::vector<double> u_d, f_d(f.begin() + d * num_cells, f.begin() + (d + 1) * num_cells);
+        PoissonUtilities::solveUniformGridSpectral(u_d, f_d, num_domain_cells, dx, C, D, d_bdry_types[d]);
+        std::copy(u_d.begin(), u_d.end(), u.begin() + d * num_cells);
+    }
+    IBTK_TIMER_STOP(t_solve_system_fft);
+
+    // Scatter the solution to the local patches.
+    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
+        const Box<NDIM>& patch_box = patch->getBox();
+        Pointer<CellData<NDIM, double> > x_data = patch->getPatchData(x_idx);
+        for (Box<NDIM>::Iterator b(patch_box); b; b++)
+        {
+            const Index<NDIM>& i = b();
+            const int offset = global_offset(i, d_domain_box);
+            for (unsigned int d = 0; d < d_depth; ++d)
+            {
+                (*x_data)(i, d) = u[d * num_cells + offset];
+            }
+        }
+    }
+
+    // The system is solved directly.
+    d_current_iterations = 1;
+    d_current_residual_norm = 0.0;
+    static const bool converged = true;
+
+    // Log solver info.
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::solveSystem(): solver " << (converged ? "converged" : "diverged") << "\n"
+             << "iterations = " << d_current_iterations << "\n"
+             << "residual norm = " << d_current_residual_norm << std::endl;
+    }
+
+    // Deallocate the solver, when necessary.
+    if (deallocate_after_solve) deallocateSolverState();
+
+    IBTK_TIMER_STOP(t_solve_system);
+    return converged;
+} // solveSystem
+
+void
+CCPoissonFFTLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
+                                               const SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBTK_TIMER_START(t_initialize_solver_state);
+
+#if !defined(NDEBUG)
+    // Rudimentary error checking.
+    if (x.getNumberOfComponents() != b.getNumberOfComponents())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same number of components"
+                                 << std::endl);
+    }
+    if (x.getPatchHierarchy() != b.getPatchHierarchy())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same hierarchy"
+                                 << std::endl);
+    }
+    if (x.getCoarsestLevelNumber() != b.getCoarsestLevelNumber() ||
+        x.getFinestLevelNumber() != b.getFinestLevelNumber())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same level numbers"
+                                 << std::endl);
+    }
+#else
+    NULL_USE(b);
+#endif
+    // Deallocate the solver state if the solver is already initialized.
+    if (d_is_initialized) deallocateSolverState();
+
+    // Get the hierarchy information.
+    d_hierarchy = x.getPatchHierarchy();
+    d_level_num = x.getCoarsestLevelNumber();
+    if (d_level_num != x.getFinestLevelNumber())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  coarsest_ln != finest_ln in CCPoissonFFTLevelSolver"
+                                 << std::endl);
+    }
+    d_level = d_hierarchy->getPatchLevel(d_level_num);
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int x_idx = x.getComponentDescriptorIndex(0);
+    Pointer<CellDataFactory<NDIM, double> > x_fac = var_db->getPatchDescriptor()->getPatchDataFactory(x_idx);
+    d_depth = x_fac->getDefaultDepth();
+    if (d_bc_coefs.size() != d_depth)
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  the number of boundary condition objects must equal the data depth"
+                                 << std::endl);
+    }
+
+    // Check that the problem is supported by the solver.
+    if (!(d_poisson_spec.cIsZero() || d_poisson_spec.cIsConstant()) || !d_poisson_spec.dIsConstant())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  FFT solver requires constant C and D coefficients"
+                                 << std::endl);
+    }
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const BoxArray<NDIM>& physical_domain = grid_geom->getPhysicalDomain();
+    if (physical_domain.getNumberOfBoxes() != 1)
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  FFT solver requires a computational domain consisting of a single box"
+                                 << std::endl);
+    }
+    d_domain_box = Box<NDIM>::refine(physical_domain[0], d_level->getRatio());
+    const BoxArray<NDIM>& level_boxes = d_level->getBoxes();
+    int num_level_cells = 0;
+    for (int k = 0; k < level_boxes.getNumberOfBoxes(); ++k)
+    {
+        num_level_cells += level_boxes[k].size();
+    }
+    if (num_level_cells != d_domain_box.size())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  FFT solver requires a patch level that covers the computational domain"
+                                 << std::endl);
+    }
+
+    // Determine the boundary condition types.
+    setupBoundaryTypes();
+
+    // Indicate that the solver is initialized.
+    d_is_initialized = true;
+
+    IBTK_TIMER_STOP(t_initialize_solver_state);
+    return;
+} // initializeSolverState
+
+void
+CCPoissonFFTLevelSolver::deallocateSolverState()
+{
+    if (!d_is_initialized) return;
+
+    IBTK_TIMER_START(t_deallocate_solver_state);
+
+    // Clear the hierarchy-dependent data.
+    d_bdry_types.clear();
+    d_level.setNull();
+    d_hierarchy.setNull();
+    d_level_num = -1;
+
+    // Indicate that the solver is NOT initialized.
+    d_is_initialized = false;
+
+    IBTK_TIMER_STOP(t_deallocate_solver_state);
+    return;
+} // deallocateSolverState
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+CCPoissonFFTLevelSolver::setupBoundaryTypes()
+{
+    // Classify the homogeneous part of the boundary conditions at each point
+    // along the physical boundary.  With u_i denoting the interior cell value
+    // and u_o denoting the ghost cell value, the homogeneous Robin condition
+    // a*u_b + b*u_n = 0 implies that
+    //
+    //     u_o = (2*b - a*h)/(2*b + a*h) u_i
+    //
+    // so that the condition acts as a Dirichlet condition when the ratio is
+    // -1 and as a Neumann condition when the ratio is +1.
+    const int num_locs = 2 * NDIM;
+    std::vector<int> counts(d_depth * num_locs * NUM_BDRY_CLASSES, 0);
+    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
+        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+        if (!pgeom->intersectsPhysicalBoundary()) continue;
+        const double* const dx = pgeom->getDx();
+        const Array<BoundaryBox<NDIM> > codim1_boxes =
+            PhysicalBoundaryUtilities::getPhysicalBoundaryCodim1Boxes(*patch);
+        const int n_bdry_boxes = codim1_boxes.size();
+        for (int n = 0; n < n_bdry_boxes; ++n)
+        {
+            const BoundaryBox<NDIM>& bdry_box = codim1_boxes[n];
+            const BoundaryBox<NDIM> trimmed_bdry_box =
+                PhysicalBoundaryUtilities::trimBoundaryCodim1Box(bdry_box, *patch);
+            const Box<NDIM> bc_coef_box = PhysicalBoundaryUtilities::makeSideBoundaryCodim1Box(trimmed_bdry_box);
+            const unsigned int location_index = bdry_box.getLocationIndex();
+            const double h = dx[location_index / 2];
+
+            Pointer<ArrayData<NDIM, double> > acoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+            Pointer<ArrayData<NDIM, double> > bcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+            Pointer<ArrayData<NDIM, double> > gcoef_data = new ArrayData<NDIM, double>(bc_coef_box, 1);
+            for (unsigned int d = 0; d < d_depth; ++d)
+            {
+                ExtendedRobinBcCoefStrategy* extended_bc_coef =
+                    dynamic_cast<ExtendedRobinBcCoefStrategy*>(d_bc_coefs[d]);
+                if (extended_bc_coef)
+                {
+                    extended_bc_coef->clearTargetPatchDataIndex();
+                    extended_bc_coef->setHomogeneousBc(true);
+                }
+                d_bc_coefs[d]->setBcCoefs(
+                    acoef_data, bcoef_data, gcoef_data, NULL, *patch, trimmed_bdry_box, d_solution_time);
+                if (extended_bc_coef) extended_bc_coef->setHomogeneousBc(d_homogeneous_bc);
+                for (Box<NDIM>::Iterator bc(bc_coef_box); bc; bc++)
+                {
+                    const Index<NDIM>& i_s_bdry = bc();
+                    const double& a = (*acoef_data)(i_s_bdry, 0);
+                    const double& b = (*bcoef_data)(i_s_bdry, 0);
+                    const double r = (2.0 * b - a * h) / (2.0 * b + a * h);
+                    BoundaryClass bdry_class = BDRY_OTHER;
+                    if (std::abs(r + 1.0) <= BDRY_CLASS_TOL)
+                        bdry_class = BDRY_DIRICHLET;
+                    else if (std::abs(r - 1.0) <= BDRY_CLASS_TOL)
+                        bdry_class = BDRY_NEUMANN;
+                    ++counts[(d * num_locs + location_index) * NUM_BDRY_CLASSES + bdry_class];
+                }
+            }
+        }
+    }
+    SAMRAI_MPI::sumReduction(&counts[0], static_cast<int>(counts.size()));
+
+    // Determine the boundary condition type along each side of the domain.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(d_level->getRatio());
+    d_bdry_types.resize(d_depth, std::vector<PoissonUtilities::SpectralBoundaryType>(num_locs));
+    for (unsigned int d = 0; d < d_depth; ++d)
+    {
+        for (int location_index = 0; location_index < num_locs; ++location_index)
+        {
+            if (periodic_shift(location_index / 2) != 0)
+            {
+                d_bdry_types[d][location_index] = PoissonUtilities::SPECTRAL_PERIODIC;
+                continue;
+            }
+            const int* const loc_counts = &counts[(d * num_locs + location_index) * NUM_BDRY_CLASSES];
+            if (loc_counts[BDRY_OTHER] == 0 && loc_counts[BDRY_NEUMANN] == 0)
+            {
+                d_bdry_types[d][location_index] = PoissonUtilities::SPECTRAL_DIRICHLET;
+            }
+            else if (loc_counts[BDRY_OTHER] == 0 && loc_counts[BDRY_DIRICHLET] == 0)
+            {
+                d_bdry_types[d][location_index] = PoissonUtilities::SPECTRAL_NEUMANN;
+            }
+            else
+            {
+                TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                         << "  FFT solver requires uniform Dirichlet or Neumann boundary conditions\n"
+                                         << "  along each nonperiodic side of the computational domain"
+                                         << std::endl);
+            }
+        }
+    }
+    return;
+} // setupBoundaryTypes
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
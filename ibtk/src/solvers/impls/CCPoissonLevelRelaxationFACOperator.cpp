@@ -545,12 +545,22 @@ CCPoissonLevelRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
     Pointer<CartesianGridGeometry<NDIM> > geometry = d_hierarchy->getGridGeometry();
     IBTK_DO_ONCE(geometry->addSpatialCoarsenOperator(new CartCellDoubleCubicCoarsen()););
 
-    // Setup coarse-fine interface and physical boundary operators.
-    d_cf_bdry_op = new CartCellDoubleQuadraticCFInterpolation();
+    // Setup coarse-fine interface and physical boundary operators.  These
+    // objects are referenced by the communication schedules of levels that are
+    // not reset, so they are only recreated when all levels are reset.
+    if (coarsest_reset_ln == d_coarsest_ln || !d_cf_bdry_op || !d_bc_op)
+    {
+        d_cf_bdry_op = new CartCellDoubleQuadraticCFInterpolation();
+        d_bc_op = new CartCellRobinPhysBdryOp(d_scratch_idx, d_bc_coefs, false);
+    }
+    else
+    {
+        d_bc_op->setPhysicalBcCoefs(d_bc_coefs);
+        d_bc_op->setHomogeneousBc(false);
+    }
     d_cf_bdry_op->setConsistentInterpolationScheme(false);
     d_cf_bdry_op->setPatchDataIndex(d_scratch_idx);
     d_cf_bdry_op->setPatchHierarchy(d_hierarchy);
-    d_bc_op = new CartCellRobinPhysBdryOp(d_scratch_idx, d_bc_coefs, false);
 
     // Setup fill pattern spec objects.
     if (d_poisson_spec.dIsConstant())
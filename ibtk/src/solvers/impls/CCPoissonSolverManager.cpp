@@ -39,6 +39,7 @@
 #include <utility>
 
 #include "ibtk/CCLaplaceOperator.h"
+#include "ibtk/CCPoissonFFTLevelSolver.h"
 #include "ibtk/CCPoissonHypreLevelSolver.h"
 #include "ibtk/CCPoissonPETScLevelSolver.h"
 #include "ibtk/CCPoissonBoxRelaxationFACOperator.h"
@@ -72,6 +73,7 @@ const std::string CCPoissonSolverManager::LEVEL_RELAXATION_FAC_PRECONDITIONER =
 const std::string CCPoissonSolverManager::POINT_RELAXATION_FAC_PRECONDITIONER = "POINT_RELAXATION_FAC_PRECONDITIONER";
 const std::string CCPoissonSolverManager::DEFAULT_LEVEL_SOLVER = "DEFAULT_LEVEL_SOLVER";
 const std::string CCPoissonSolverManager::HYPRE_LEVEL_SOLVER = "HYPRE_LEVEL_SOLVER";
+const std::string CCPoissonSolverManager::FFT_LEVEL_SOLVER = "FFT_LEVEL_SOLVER";
 const std::string CCPoissonSolverManager::PETSC_LEVEL_SOLVER = "PETSC_LEVEL_SOLVER";
 
 CCPoissonSolverManager* CCPoissonSolverManager::s_solver_manager_instance = NULL;
@@ -193,6 +195,7 @@ CCPoissonSolverManager::CCPoissonSolverManager() : d_solver_maker_map()
                                   CCPoissonPointRelaxationFACOperator::allocate_solver);
     registerSolverFactoryFunction(DEFAULT_LEVEL_SOLVER, CCPoissonHypreLevelSolver::allocate_solver);
     registerSolverFactoryFunction(HYPRE_LEVEL_SOLVER, CCPoissonHypreLevelSolver::allocate_solver);
+    registerSolverFactoryFunction(FFT_LEVEL_SOLVER, CCPoissonFFTLevelSolver::allocate_solver);
     registerSolverFactoryFunction(PETSC_LEVEL_SOLVER, CCPoissonPETScLevelSolver::allocate_solver);
     return;
 } // CCPoissonSolverManager
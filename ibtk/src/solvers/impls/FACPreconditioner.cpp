@@ -32,6 +32,7 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
 #include <stddef.h>
 #include <ostream>
 #include <string>
@@ -66,6 +67,8 @@ FACPreconditioner::FACPreconditioner(const std::string& object_name,
       d_hierarchy(NULL),
       d_coarsest_ln(0),
       d_finest_ln(0),
+      d_coarsest_reset_ln(-1),
+      d_finest_reset_ln(-1),
       d_cycle_type(V_CYCLE),
       d_num_pre_sweeps(0),
       d_num_post_sweeps(2),
@@ -188,15 +191,51 @@ FACPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorRe
     return true;
 } // solveSystem
 
+void
+FACPreconditioner::setResetLevels(const int coarsest_ln, const int finest_ln)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT((coarsest_ln == -1 && finest_ln == -1) || (coarsest_ln >= 0 && finest_ln >= coarsest_ln));
+#endif
+    d_coarsest_reset_ln = coarsest_ln;
+    d_finest_reset_ln = finest_ln;
+    return;
+} // setResetLevels
+
 void
 FACPreconditioner::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& solution,
                                          const SAMRAIVectorReal<NDIM, double>& rhs)
 {
-    // Deallocate the solver state if the solver is already initialized.
-    if (d_is_initialized)
+    // Deallocate the solver state if the solver is already initialized.  When
+    // only a range of levels must be reset, the temporary vectors are freed but
+    // the operator state is retained so that the FAC strategy can rebuild only
+    // the data associated with the reset levels.
+    const bool reset_levels = d_is_initialized && d_coarsest_reset_ln != -1 && d_finest_reset_ln != -1 &&
+                              d_hierarchy == solution.getPatchHierarchy() &&
+                              d_coarsest_ln == solution.getCoarsestLevelNumber() &&
+                              d_coarsest_reset_ln <= solution.getFinestLevelNumber();
+    if (reset_levels)
+    {
+        if (d_f)
+        {
+            d_f->freeVectorComponents();
+            d_f.setNull();
+        }
+        if (d_r)
+        {
+            d_r->freeVectorComponents();
+            d_r.setNull();
+        }
+        d_fac_strategy->setResetLevels(std::max(d_coarsest_reset_ln, solution.getCoarsestLevelNumber()),
+                                       solution.getFinestLevelNumber());
+        d_is_initialized = false;
+    }
+    else if (d_is_initialized)
     {
         deallocateSolverState();
     }
+    d_coarsest_reset_ln = -1;
+    d_finest_reset_ln = -1;
 
     // Setup operator state.
     d_hierarchy = solution.getPatchHierarchy();
@@ -242,6 +281,8 @@ FACPreconditioner::deallocateSolverState()
 
     // Deallocate operator state.
     d_fac_strategy->deallocateOperatorState();
+    d_coarsest_reset_ln = -1;
+    d_finest_reset_ln = -1;
 
     // Indicate that the operator is NOT initialized.
     d_is_initialized = false;
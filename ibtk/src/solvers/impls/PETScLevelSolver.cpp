@@ -34,6 +34,7 @@
 
 #include <math.h>
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -137,7 +138,10 @@ PETScLevelSolver::PETScLevelSolver()
       d_petsc_mat(NULL),
       d_petsc_pc(NULL),
       d_petsc_x(NULL),
-      d_petsc_b(NULL)
+      d_petsc_b(NULL),
+      d_use_agglomeration(false),
+      d_agglomeration_min_dofs_per_rank(4096),
+      d_agglomeration_reduction_factor(1)
 {
     // Setup default options.
     d_max_iterations = 10000;
@@ -202,6 +206,17 @@ PETScLevelSolver::getPETScKSP() const
     return d_petsc_ksp;
 } // getPETScKSP
 
+void
+PETScLevelSolver::setUseAgglomeration(const bool use_agglomeration, const int min_dofs_per_rank)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(min_dofs_per_rank > 0);
+#endif
+    d_use_agglomeration = use_agglomeration;
+    d_agglomeration_min_dofs_per_rank = min_dofs_per_rank;
+    return;
+} // setUseAgglomeration
+
 void
 PETScLevelSolver::getASMSubdomains(std::vector<IS>** nonoverlapping_subdomains,
                                    std::vector<IS>** overlapping_subdomains)
@@ -374,8 +389,24 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
     ierr = KSPGetPC(d_petsc_ksp, &ksp_pc);
     IBTK_CHKERRQ(ierr);
     PCType pc_type = d_pc_type.c_str();
-    ierr = PCSetType(ksp_pc, pc_type);
-    IBTK_CHKERRQ(ierr);
+    d_agglomeration_reduction_factor = computeAgglomerationReductionFactor();
+    if (d_agglomeration_reduction_factor > 1)
+    {
+#if PETSC_VERSION_GE(3, 7, 0)
+        // Agglomerate the level solve onto a subcommunicator.  The requested
+        // preconditioner is applied by the inner solver, which is configured
+        // once the telescoping preconditioner has been set up.
+        ierr = PCSetType(ksp_pc, PCTELESCOPE);
+        IBTK_CHKERRQ(ierr);
+        ierr = PCTelescopeSetReductionFactor(ksp_pc, d_agglomeration_reduction_factor);
+        IBTK_CHKERRQ(ierr);
+#endif
+    }
+    else
+    {
+        ierr = PCSetType(ksp_pc, pc_type);
+        IBTK_CHKERRQ(ierr);
+    }
     if (d_options_prefix != "")
     {
         ierr = KSPSetOptionsPrefix(d_petsc_ksp, d_options_prefix.c_str());
@@ -387,13 +418,51 @@ PETScLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
     // Reset class data structure to correspond to command-line options.
     ierr = KSPGetTolerances(d_petsc_ksp, &d_rel_residual_tol, &d_abs_residual_tol, NULL, &d_max_iterations);
     IBTK_CHKERRQ(ierr);
-    ierr = PCGetType(ksp_pc, &pc_type);
-    IBTK_CHKERRQ(ierr);
-    d_pc_type = pc_type;
+    if (d_agglomeration_reduction_factor == 1)
+    {
+        ierr = PCGetType(ksp_pc, &pc_type);
+        IBTK_CHKERRQ(ierr);
+        d_pc_type = pc_type;
+    }
+    if (d_enable_logging && d_agglomeration_reduction_factor > 1)
+    {
+        plog << d_object_name << "::initializeSolverState(): agglomerating level " << d_level_num
+             << " onto one of every " << d_agglomeration_reduction_factor << " ranks" << std::endl;
+    }
 
     // Set the nullspace.
     if (d_nullspace_contains_constant_vec || !d_nullspace_basis_vecs.empty()) setupNullspace();
 
+    // Setup the inner solver of the telescoping preconditioner.  By default, the
+    // inner solver performs a single application of the requested
+    // preconditioner.  These defaults are set directly on the inner solver (and
+    // not in the global options database), so that command-line options under
+    // the "<prefix>telescope_" prefix still take precedence.
+    if (d_agglomeration_reduction_factor > 1)
+    {
+#if PETSC_VERSION_GE(3, 7, 0)
+        ierr = PCSetUp(ksp_pc);
+        IBTK_CHKERRQ(ierr);
+        KSP inner_ksp = NULL;
+        ierr = PCTelescopeGetKSP(ksp_pc, &inner_ksp);
+        IBTK_CHKERRQ(ierr);
+        if (inner_ksp)
+        {
+            // NOTE: The inner solver only exists on the ranks retained by the
+            // telescoping preconditioner.
+            ierr = KSPSetType(inner_ksp, KSPPREONLY);
+            IBTK_CHKERRQ(ierr);
+            PC inner_pc;
+            ierr = KSPGetPC(inner_ksp, &inner_pc);
+            IBTK_CHKERRQ(ierr);
+            ierr = PCSetType(inner_pc, d_pc_type.c_str());
+            IBTK_CHKERRQ(ierr);
+            ierr = KSPSetFromOptions(inner_ksp);
+            IBTK_CHKERRQ(ierr);
+        }
+#endif
+    }
+
     // Setup the preconditioner.
     if (d_pc_type == "asm")
     {
@@ -783,6 +852,9 @@ PETScLevelSolver::init(Pointer<Database> input_db, const std::string& default_op
             input_db->getIntegerArray("subdomain_box_size", d_box_size, NDIM);
         if (input_db->keyExists("subdomain_overlap_size"))
             input_db->getIntegerArray("subdomain_overlap_size", d_overlap_size, NDIM);
+        if (input_db->keyExists("use_agglomeration")) d_use_agglomeration = input_db->getBool("use_agglomeration");
+        if (input_db->keyExists("agglomeration_min_dofs_per_rank"))
+            d_agglomeration_min_dofs_per_rank = input_db->getInteger("agglomeration_min_dofs_per_rank");
     }
     return;
 } // init
@@ -839,6 +911,27 @@ PETScLevelSolver::setupNullspace()
     return;
 } // setupNullspace
 
+int
+PETScLevelSolver::computeAgglomerationReductionFactor() const
+{
+#if PETSC_VERSION_GE(3, 7, 0)
+    if (!d_use_agglomeration) return 1;
+    if (d_pc_type == "asm" || d_pc_type == "fieldsplit" || d_pc_type == "shell") return 1;
+    const int nodes = SAMRAI_MPI::getNodes();
+    if (nodes == 1) return 1;
+
+    // Determine the number of ranks required to give each one at least the
+    // minimum number of degrees of freedom.
+    PetscInt n_dofs;
+    int ierr = MatGetSize(d_petsc_mat, &n_dofs, NULL);
+    IBTK_CHKERRQ(ierr);
+    const int n_ranks = std::max(1, std::min(nodes, static_cast<int>(n_dofs / d_agglomeration_min_dofs_per_rank)));
+    return nodes / n_ranks;
+#else
+    return 1;
+#endif
+} // computeAgglomerationReductionFactor
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
 PetscErrorCode
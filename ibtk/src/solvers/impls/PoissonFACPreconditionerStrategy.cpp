@@ -117,6 +117,7 @@ PoissonFACPreconditionerStrategy::PoissonFACPreconditionerStrategy(const std::st
       d_coarsest_reset_ln(-1),
       d_finest_reset_ln(-1),
       d_smoother_type("DEFAULT"),
+      d_use_single_precision_smoother(false),
       d_prolongation_method("DEFAULT"),
       d_restriction_method("DEFAULT"),
       d_coarse_solver_type("DEFAULT"),
@@ -125,6 +126,8 @@ PoissonFACPreconditionerStrategy::PoissonFACPreconditionerStrategy(const std::st
       d_coarse_solver_abs_residual_tol(1.0e-50),
       d_coarse_solver_max_iterations(10),
       d_context(NULL),
+      d_single_precision_buffers(),
+      d_single_precision_residual_current(),
       d_bc_op(NULL),
       d_cf_bdry_op(),
       d_op_stencil_fill_pattern(),
@@ -163,6 +166,8 @@ PoissonFACPreconditionerStrategy::PoissonFACPreconditionerStrategy(const std::st
             for (int d = 0; d < NDIM; ++d) d_gcw(d) = gcw;
         }
         if (input_db->keyExists("smoother_type")) d_smoother_type = input_db->getString("smoother_type");
+        if (input_db->keyExists("use_single_precision_smoother"))
+            d_use_single_precision_smoother = input_db->getBool("use_single_precision_smoother");
         if (input_db->keyExists("prolongation_method"))
             d_prolongation_method = input_db->getString("prolongation_method");
         if (input_db->keyExists("restriction_method")) d_restriction_method = input_db->getString("restriction_method");
@@ -261,6 +266,13 @@ PoissonFACPreconditionerStrategy::setResetLevels(const int coarsest_ln, const in
     return;
 } // setResetLevels
 
+void
+PoissonFACPreconditionerStrategy::setUseSinglePrecisionSmoother(const bool use_single_precision_smoother)
+{
+    d_use_single_precision_smoother = use_single_precision_smoother;
+    return;
+} // setUseSinglePrecisionSmoother
+
 void
 PoissonFACPreconditionerStrategy::setCoarseSolverMaxIterations(int coarse_solver_max_iterations)
 {
@@ -331,11 +343,22 @@ PoissonFACPreconditionerStrategy::restrictResidual(const SAMRAIVectorReal<NDIM,
         d_level_data_ops[dst_ln]->copyData(dst_idx, src_idx, /*interior_only*/ false);
     }
     xeqScheduleRestriction(dst_idx, src_idx, dst_ln);
+    if (dst_ln < static_cast<int>(d_single_precision_residual_current.size()))
+    {
+        d_single_precision_residual_current[dst_ln] = false;
+    }
 
     IBTK_TIMER_STOP(t_restrict_residual);
     return;
 } // restrictResidual
 
+void
+PoissonFACPreconditionerStrategy::allocateScratchData()
+{
+    std::fill(d_single_precision_residual_current.begin(), d_single_precision_residual_current.end(), false);
+    return;
+} // allocateScratchData
+
 void
 PoissonFACPreconditionerStrategy::prolongError(const SAMRAIVectorReal<NDIM, double>& src,
                                                SAMRAIVectorReal<NDIM, double>& dst,
@@ -451,11 +474,17 @@ PoissonFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVectorReal
     // Make space for saving communication schedules.  There is no need to
     // delete the old schedules first because we have deallocated the solver
     // state above.
-    std::vector<RefinePatchStrategy<NDIM>*> prolongation_refine_patch_strategies;
-    prolongation_refine_patch_strategies.push_back(d_cf_bdry_op);
-    prolongation_refine_patch_strategies.push_back(d_bc_op);
-    d_prolongation_refine_patch_strategy = new RefinePatchStrategySet(
-        prolongation_refine_patch_strategies.begin(), prolongation_refine_patch_strategies.end(), false);
+    //
+    // The patch strategy object is referenced by the schedules of levels that
+    // are not reset, so it is only recreated when all levels are reset.
+    if (coarsest_reset_ln == d_coarsest_ln || !d_prolongation_refine_patch_strategy)
+    {
+        std::vector<RefinePatchStrategy<NDIM>*> prolongation_refine_patch_strategies;
+        prolongation_refine_patch_strategies.push_back(d_cf_bdry_op);
+        prolongation_refine_patch_strategies.push_back(d_bc_op);
+        d_prolongation_refine_patch_strategy = new RefinePatchStrategySet(
+            prolongation_refine_patch_strategies.begin(), prolongation_refine_patch_strategies.end(), false);
+    }
 
     d_prolongation_refine_schedules.resize(d_finest_ln + 1);
     d_restriction_coarsen_schedules.resize(d_finest_ln);
@@ -487,7 +516,10 @@ PoissonFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVectorReal
                                                             d_prolongation_refine_patch_strategy.getPointer());
     }
 
-    for (int dst_ln = coarsest_reset_ln; dst_ln < std::min(finest_reset_ln + 1, d_finest_ln); ++dst_ln)
+    // The restriction schedule from the coarsest reset level to the next coarser
+    // level must also be recreated.
+    for (int dst_ln = std::max(d_coarsest_ln, coarsest_reset_ln - 1); dst_ln < std::min(finest_reset_ln + 1, d_finest_ln);
+         ++dst_ln)
     {
         d_restriction_coarsen_schedules[dst_ln] = d_restriction_coarsen_algorithm->createSchedule(
             d_hierarchy->getPatchLevel(dst_ln), d_hierarchy->getPatchLevel(dst_ln + 1));
@@ -564,6 +596,9 @@ PoissonFACPreconditionerStrategy::deallocateOperatorState()
 
         d_synch_refine_algorithm.setNull();
         d_synch_refine_schedules.resize(0);
+
+        d_single_precision_buffers.clear();
+        d_single_precision_residual_current.clear();
     }
 
     // Clear the "reset level" range.
@@ -619,6 +654,45 @@ PoissonFACPreconditionerStrategy::xeqScheduleRestriction(const int dst_idx, cons
     return;
 } // xeqScheduleRestriction
 
+const float*
+PoissonFACPreconditionerStrategy::getSinglePrecisionBuffer(const double* const data,
+                                                           const int size,
+                                                           const int level_num,
+                                                           const unsigned int buffer_num)
+{
+    if (static_cast<int>(d_single_precision_buffers.size()) <= level_num)
+    {
+        d_single_precision_buffers.resize(level_num + 1);
+    }
+    if (static_cast<int>(d_single_precision_residual_current.size()) <= level_num)
+    {
+        d_single_precision_residual_current.resize(level_num + 1, false);
+    }
+    std::vector<std::vector<float> >& level_buffers = d_single_precision_buffers[level_num];
+    if (level_buffers.size() <= buffer_num) level_buffers.resize(buffer_num + 1);
+    std::vector<float>& buffer = level_buffers[buffer_num];
+    if (!d_single_precision_residual_current[level_num] || static_cast<int>(buffer.size()) != size)
+    {
+        buffer.resize(size);
+        for (int k = 0; k < size; ++k)
+        {
+            buffer[k] = static_cast<float>(data[k]);
+        }
+    }
+    return size > 0 ? &buffer[0] : NULL;
+} // getSinglePrecisionBuffer
+
+void
+PoissonFACPreconditionerStrategy::setSinglePrecisionResidualCurrent(const int level_num)
+{
+    if (static_cast<int>(d_single_precision_residual_current.size()) <= level_num)
+    {
+        d_single_precision_residual_current.resize(level_num + 1, false);
+    }
+    d_single_precision_residual_current[level_num] = true;
+    return;
+} // setSinglePrecisionResidualCurrent
+
 void
 PoissonFACPreconditionerStrategy::xeqScheduleGhostFillNoCoarse(const int dst_idx, const int dst_ln)
 {
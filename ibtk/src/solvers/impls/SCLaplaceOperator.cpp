@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -164,8 +165,8 @@ SCLaplaceOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDI
     }
 #endif
 
-    // Allocate scratch data.
-    d_x->allocateVectorData();
+    // Allocate scratch data (if necessary).
+    if (!d_use_persistent_workspace) d_x->allocateVectorData();
 
     // Simultaneously fill ghost cell values for all components.
     typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
@@ -200,8 +201,8 @@ SCLaplaceOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDI
         d_bc_helpers[comp]->copyDataAtDirichletBoundaries(y_idx, x_idx);
     }
 
-    // Deallocate scratch data.
-    d_x->deallocateVectorData();
+    // Deallocate scratch data (if necessary).
+    if (!d_use_persistent_workspace) d_x->deallocateVectorData();
 
     IBTK_TIMER_STOP(t_apply);
     return;
@@ -220,6 +221,9 @@ SCLaplaceOperator::initializeOperatorState(const SAMRAIVectorReal<NDIM, double>&
     d_x = in.cloneVector(in.getName());
     d_b = out.cloneVector(out.getName());
 
+    // Allocate scratch data that is retained between operator applications.
+    if (d_use_persistent_workspace) d_x->allocateVectorData();
+
     // Setup operator state.
     d_hierarchy = in.getPatchHierarchy();
     d_coarsest_ln = in.getCoarsestLevelNumber();
@@ -304,6 +308,12 @@ SCLaplaceOperator::deallocateOperatorState()
     if (!d_hier_math_ops_external) d_hier_math_ops.setNull();
 
     // Delete the solution and rhs vectors.
+    if (d_use_persistent_workspace)
+    {
+        d_x->resetLevels(d_x->getCoarsestLevelNumber(),
+                         std::min(d_x->getFinestLevelNumber(), d_x->getPatchHierarchy()->getFinestLevelNumber()));
+        d_x->deallocateVectorData();
+    }
     d_x->freeVectorComponents();
     d_x.setNull();
 
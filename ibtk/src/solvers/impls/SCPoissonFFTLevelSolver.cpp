@@ -0,0 +1,368 @@
+// Filename: SCPoissonFFTLevelSolver.cpp
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <algorithm>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Box.h"
+#include "BoxArray.h"
+#include "CartesianGridGeometry.h"
+#include "CartesianPatchGeometry.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchDescriptor.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "PoissonSpecifications.h"
+#include "SAMRAIVectorReal.h"
+#include "SideData.h"
+#include "SideDataFactory.h"
+#include "SideGeometry.h"
+#include "SideIndex.h"
+#include "VariableDatabase.h"
+#include "ibtk/SCPoissonFFTLevelSolver.h"
+#include "ibtk/GeneralSolver.h"
+#include "ibtk/PoissonUtilities.h"
+#include "ibtk/ibtk_utilities.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Database.h"
+#include "tbox/PIO.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Timers.
+static Timer* t_solve_system;
+static Timer* t_solve_system_fft;
+static Timer* t_initialize_solver_state;
+static Timer* t_deallocate_solver_state;
+
+// Offset of a cell index in a column-major array spanning the given box.
+inline int
+global_offset(const Index<NDIM>& i, const Box<NDIM>& box)
+{
+    int offset = 0, stride = 1;
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        offset += (i(axis) - box.lower()(axis)) * stride;
+        stride *= box.numberCells(axis);
+    }
+    return offset;
+} // global_offset
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+SCPoissonFFTLevelSolver::SCPoissonFFTLevelSolver(const std::string& object_name,
+                                                 Pointer<Database> input_db,
+                                                 const std::string& /*default_options_prefix*/)
+    : d_hierarchy(), d_level_num(-1), d_level(), d_domain_box(), d_depth(0)
+{
+    // Setup default options.
+    GeneralSolver::init(object_name, /*homogeneous_bc*/ false);
+    d_initial_guess_nonzero = false;
+    d_rel_residual_tol = 1.0e-5;
+    d_abs_residual_tol = 1.0e-50;
+    d_max_iterations = 1;
+
+    // Get values from the input database.
+    if (input_db)
+    {
+        if (input_db->keyExists("enable_logging")) d_enable_logging = input_db->getBool("enable_logging");
+    }
+
+    // Setup Timers.
+    IBTK_DO_ONCE(t_solve_system = TimerManager::getManager()->getTimer("IBTK::SCPoissonFFTLevelSolver::solveSystem()");
+                 t_solve_system_fft =
+                     TimerManager::getManager()->getTimer("IBTK::SCPoissonFFTLevelSolver::solveSystem()[fft]");
+                 t_initialize_solver_state =
+                     TimerManager::getManager()->getTimer("IBTK::SCPoissonFFTLevelSolver::initializeSolverState()");
+                 t_deallocate_solver_state =
+                     TimerManager::getManager()->getTimer("IBTK::SCPoissonFFTLevelSolver::deallocateSolverState()"););
+    return;
+} // SCPoissonFFTLevelSolver
+
+SCPoissonFFTLevelSolver::~SCPoissonFFTLevelSolver()
+{
+    if (d_is_initialized) deallocateSolverState();
+    return;
+} // ~SCPoissonFFTLevelSolver
+
+bool
+SCPoissonFFTLevelSolver::solveSystem(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBTK_TIMER_START(t_solve_system);
+
+    // Initialize the solver, when necessary.
+    const bool deallocate_after_solve = !d_is_initialized;
+    if (deallocate_after_solve) initializeSolverState(x, b);
+
+    static const int comp = 0;
+    const int x_idx = x.getComponentDescriptorIndex(comp);
+    const int b_idx = b.getComponentDescriptorIndex(comp);
+
+    // Setup the grid spacing and the problem coefficients.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const double* const dx_coarsest = grid_geom->getDx();
+    const IntVector<NDIM>& ratio = d_level->getRatio();
+    double dx[NDIM];
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        dx[axis] = dx_coarsest[axis] / static_cast<double>(ratio(axis));
+    }
+    const double C = d_poisson_spec.cIsZero() ? 0.0 : d_poisson_spec.getCConstant();
+    const double D = d_poisson_spec.getDConstant();
+    const std::vector<PoissonUtilities::SpectralBoundaryType> bdry_types(2 * NDIM,
+                                                                         PoissonUtilities::SPECTRAL_PERIODIC);
+    const IntVector<NDIM> num_domain_cells = d_domain_box.numberCells();
+    const int num_cells = d_domain_box.size();
+
+    // Solve for each component of the side-centered data independently.  On a
+    // periodic domain, the side indices along each direction are in
+    // one-to-one correspondence with the cell indices, with side index i
+    // located at the lower side of cell i.
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        // Gather the right-hand-side data into a global array.  Each side is
+        // gathered exactly once by considering only the lower sides of the
+        // cells of each patch.
+        std::vector<double> f(d_depth * num_cells, 0.0);
+        for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<SideData<NDIM, double> > b_data = patch->getPatchData(b_idx);
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                const Index<NDIM>& i = b();
+                const SideIndex<NDIM> i_s(i, axis, SideIndex<NDIM>::Lower);
+                const int offset = global_offset(i, d_domain_box);
+                for (unsigned int d = 0; d < d_depth; ++d)
+                {
+                    f[d * num_cells + offset] = (*b_data)(i_s, d);
+                }
+            }
+        }
+        SAMRAI_MPI::sumReduction(&f[0], static_cast<int>(f.size()));
+
+        // Solve the system redundantly on each process.
+        IBTK_TIMER_START(t_solve_system_fft);
+        std::vector<double> u(d_depth * num_cells, 0.0);
+        for (unsigned int d = 0; d < d_depth; ++d)
+        {
+            std::vector<double> u_d, f_d(f.begin() + d * num_cells, f.begin() + (d + 1) * num_cells);
+            PoissonUtilities::solveUniformGridSpectral(u_d, f_d, num_domain_cells, dx, C, D, bdry_types);
+            std::copy(u_d.begin(), u_d.end(), u.begin() + d * num_cells);
+        }
+        IBTK_TIMER_STOP(t_solve_system_fft);
+
+        // Scatter the solution to all of the sides of the local patches,
+        // including those sides that are shared with neighboring patches or
+        // that are periodic images of one another.
+        for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<SideData<NDIM, double> > x_data = patch->getPatchData(x_idx);
+            for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(patch_box, axis)); b; b++)
+            {
+                const Index<NDIM>& i = b();
+                Index<NDIM> i_periodic = i;
+                const int n = num_domain_cells(axis);
+                i_periodic(axis) = d_domain_box.lower()(axis) + (i(axis) - d_domain_box.lower()(axis) + n) % n;
+                const SideIndex<NDIM> i_s(i, axis, SideIndex<NDIM>::Lower);
+                const int offset = global_offset(i_periodic, d_domain_box);
+                for (unsigned int d = 0; d < d_depth; ++d)
+                {
+                    (*x_data)(i_s, d) = u[d * num_cells + offset];
+                }
+            }
+        }
+    }
+
+    // The system is solved directly.
+    d_current_iterations = 1;
+    d_current_residual_norm = 0.0;
+    static const bool converged = true;
+
+    // Log solver info.
+    if (d_enable_logging)
+    {
+        plog << d_object_name << "::solveSystem(): solver " << (converged ? "converged" : "diverged") << "\n"
+             << "iterations = " << d_current_iterations << "\n"
+             << "residual norm = " << d_current_residual_norm << std::endl;
+    }
+
+    // Deallocate the solver, when necessary.
+    if (deallocate_after_solve) deallocateSolverState();
+
+    IBTK_TIMER_STOP(t_solve_system);
+    return converged;
+} // solveSystem
+
+void
+SCPoissonFFTLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& x,
+                                               const SAMRAIVectorReal<NDIM, double>& b)
+{
+    IBTK_TIMER_START(t_initialize_solver_state);
+
+#if !defined(NDEBUG)
+    // Rudimentary error checking.
+    if (x.getNumberOfComponents() != b.getNumberOfComponents())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same number of components"
+                                 << std::endl);
+    }
+    if (x.getPatchHierarchy() != b.getPatchHierarchy())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same hierarchy"
+                                 << std::endl);
+    }
+    if (x.getCoarsestLevelNumber() != b.getCoarsestLevelNumber() ||
+        x.getFinestLevelNumber() != b.getFinestLevelNumber())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  vectors must have the same level numbers"
+                                 << std::endl);
+    }
+#else
+    NULL_USE(b);
+#endif
+    // Deallocate the solver state if the solver is already initialized.
+    if (d_is_initialized) deallocateSolverState();
+
+    // Get the hierarchy information.
+    d_hierarchy = x.getPatchHierarchy();
+    d_level_num = x.getCoarsestLevelNumber();
+    if (d_level_num != x.getFinestLevelNumber())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  coarsest_ln != finest_ln in SCPoissonFFTLevelSolver"
+                                 << std::endl);
+    }
+    d_level = d_hierarchy->getPatchLevel(d_level_num);
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int x_idx = x.getComponentDescriptorIndex(0);
+    Pointer<SideDataFactory<NDIM, double> > x_fac = var_db->getPatchDescriptor()->getPatchDataFactory(x_idx);
+    d_depth = x_fac->getDefaultDepth();
+    // Check that the problem is supported by the solver.
+    if (!(d_poisson_spec.cIsZero() || d_poisson_spec.cIsConstant()) || !d_poisson_spec.dIsConstant())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  FFT solver requires constant C and D coefficients"
+                                 << std::endl);
+    }
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const BoxArray<NDIM>& physical_domain = grid_geom->getPhysicalDomain();
+    if (physical_domain.getNumberOfBoxes() != 1)
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  FFT solver requires a computational domain consisting of a single box"
+                                 << std::endl);
+    }
+    d_domain_box = Box<NDIM>::refine(physical_domain[0], d_level->getRatio());
+    const BoxArray<NDIM>& level_boxes = d_level->getBoxes();
+    int num_level_cells = 0;
+    for (int k = 0; k < level_boxes.getNumberOfBoxes(); ++k)
+    {
+        num_level_cells += level_boxes[k].size();
+    }
+    if (num_level_cells != d_domain_box.size())
+    {
+        TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                 << "  FFT solver requires a patch level that covers the computational domain"
+                                 << std::endl);
+    }
+
+    const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift(d_level->getRatio());
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        if (periodic_shift(axis) == 0)
+        {
+            TBOX_ERROR(d_object_name << "::initializeSolverState()\n"
+                                     << "  FFT solver requires a periodic computational domain"
+                                     << std::endl);
+        }
+    }
+
+    // Indicate that the solver is initialized.
+    d_is_initialized = true;
+
+    IBTK_TIMER_STOP(t_initialize_solver_state);
+    return;
+} // initializeSolverState
+
+void
+SCPoissonFFTLevelSolver::deallocateSolverState()
+{
+    if (!d_is_initialized) return;
+
+    IBTK_TIMER_START(t_deallocate_solver_state);
+
+    // Clear the hierarchy-dependent data.
+    d_level.setNull();
+    d_hierarchy.setNull();
+    d_level_num = -1;
+
+    // Indicate that the solver is NOT initialized.
+    d_is_initialized = false;
+
+    IBTK_TIMER_STOP(t_deallocate_solver_state);
+    return;
+} // deallocateSolverState
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
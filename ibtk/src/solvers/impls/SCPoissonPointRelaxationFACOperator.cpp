@@ -95,15 +95,23 @@
 // FORTRAN ROUTINES
 #if (NDIM == 2)
 #define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth2d, GSSMOOTH2D)
+#define GS_SMOOTH_SP_FC IBTK_FC_FUNC(gssmoothsp2d, GSSMOOTHSP2D)
 #define GS_SMOOTH_MASK_FC IBTK_FC_FUNC(gssmoothmask2d, GSSMOOTHMASK2D)
+#define GS_SMOOTH_MASK_SP_FC IBTK_FC_FUNC(gssmoothmasksp2d, GSSMOOTHMASKSP2D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth2d, RBGSSMOOTH2D)
+#define RB_GS_SMOOTH_SP_FC IBTK_FC_FUNC(rbgssmoothsp2d, RBGSSMOOTHSP2D)
 #define RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(rbgssmoothmask2d, RBGSSMOOTHMASK2D)
+#define RB_GS_SMOOTH_MASK_SP_FC IBTK_FC_FUNC(rbgssmoothmasksp2d, RBGSSMOOTHMASKSP2D)
 #endif
 #if (NDIM == 3)
 #define GS_SMOOTH_FC IBTK_FC_FUNC(gssmooth3d, GSSMOOTH3D)
+#define GS_SMOOTH_SP_FC IBTK_FC_FUNC(gssmoothsp3d, GSSMOOTHSP3D)
 #define GS_SMOOTH_MASK_FC IBTK_FC_FUNC(gssmoothmask3d, GSSMOOTHMASK3D)
+#define GS_SMOOTH_MASK_SP_FC IBTK_FC_FUNC(gssmoothmasksp3d, GSSMOOTHMASKSP3D)
 #define RB_GS_SMOOTH_FC IBTK_FC_FUNC(rbgssmooth3d, RBGSSMOOTH3D)
+#define RB_GS_SMOOTH_SP_FC IBTK_FC_FUNC(rbgssmoothsp3d, RBGSSMOOTHSP3D)
 #define RB_GS_SMOOTH_MASK_FC IBTK_FC_FUNC(rbgssmoothmask3d, RBGSSMOOTHMASK3D)
+#define RB_GS_SMOOTH_MASK_SP_FC IBTK_FC_FUNC(rbgssmoothmasksp3d, RBGSSMOOTHMASKSP3D)
 #endif
 
 // Function interfaces
@@ -124,6 +132,22 @@ void GS_SMOOTH_FC(double* U,
 #endif
                   const double* dx);
 
+void GS_SMOOTH_SP_FC(double* U,
+                     const int& U_gcw,
+                     const double& alpha,
+                     const double& beta,
+                     const float* F,
+                     const int& F_gcw,
+                     const int& ilower0,
+                     const int& iupper0,
+                     const int& ilower1,
+                     const int& iupper1,
+#if (NDIM == 3)
+                     const int& ilower2,
+                     const int& iupper2,
+#endif
+                     const double* dx);
+
 void GS_SMOOTH_MASK_FC(double* U,
                        const int& U_gcw,
                        const double& alpha,
@@ -142,6 +166,24 @@ void GS_SMOOTH_MASK_FC(double* U,
 #endif
                        const double* dx);
 
+void GS_SMOOTH_MASK_SP_FC(double* U,
+                          const int& U_gcw,
+                          const double& alpha,
+                          const double& beta,
+                          const float* F,
+                          const int& F_gcw,
+                          const int* mask,
+                          const int& mask_gcw,
+                          const int& ilower0,
+                          const int& iupper0,
+                          const int& ilower1,
+                          const int& iupper1,
+#if (NDIM == 3)
+                          const int& ilower2,
+                          const int& iupper2,
+#endif
+                          const double* dx);
+
 void RB_GS_SMOOTH_FC(double* U,
                      const int& U_gcw,
                      const double& alpha,
@@ -159,6 +201,23 @@ void RB_GS_SMOOTH_FC(double* U,
                      const double* dx,
                      const int& red_or_black);
 
+void RB_GS_SMOOTH_SP_FC(double* U,
+                        const int& U_gcw,
+                        const double& alpha,
+                        const double& beta,
+                        const float* F,
+                        const int& F_gcw,
+                        const int& ilower0,
+                        const int& iupper0,
+                        const int& ilower1,
+                        const int& iupper1,
+#if (NDIM == 3)
+                        const int& ilower2,
+                        const int& iupper2,
+#endif
+                        const double* dx,
+                        const int& red_or_black);
+
 void RB_GS_SMOOTH_MASK_FC(double* U,
                           const int& U_gcw,
                           const double& alpha,
@@ -177,6 +236,25 @@ void RB_GS_SMOOTH_MASK_FC(double* U,
 #endif
                           const double* dx,
                           const int& red_or_black);
+
+void RB_GS_SMOOTH_MASK_SP_FC(double* U,
+                             const int& U_gcw,
+                             const double& alpha,
+                             const double& beta,
+                             const float* F,
+                             const int& F_gcw,
+                             const int* mask,
+                             const int& mask_gcw,
+                             const int& ilower0,
+                             const int& iupper0,
+                             const int& ilower1,
+                             const int& iupper1,
+#if (NDIM == 3)
+                             const int& ilower2,
+                             const int& iupper2,
+#endif
+                             const double* dx,
+                             const int& red_or_black);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -432,6 +510,29 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
         }
     }
 
+    // Obtain the single-precision residual when requested.  The residual is
+    // only converted when it has changed since the last call on this level.
+    std::vector<const float*> F_sp;
+    if (d_use_single_precision_smoother)
+    {
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<SideData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                const int size = residual_data->getArrayData(axis).getBox().size();
+                for (int depth = 0; depth < residual_data->getDepth(); ++depth)
+                {
+                    const unsigned int buffer_num = static_cast<unsigned int>(F_sp.size());
+                    F_sp.push_back(getSinglePrecisionBuffer(
+                        residual_data->getPointer(axis, depth), size, level_num, buffer_num));
+                }
+            }
+        }
+        setSinglePrecisionResidualCurrent(level_num);
+    }
+
     // Smooth the error by the specified number of sweeps.
     if (red_black_ordering) num_sweeps *= 2;
     for (int isweep = 0; isweep < num_sweeps; ++isweep)
@@ -485,6 +586,7 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
 
         // Smooth the error on the patches.
         int patch_counter = 0;
+        unsigned int F_sp_counter = 0;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
@@ -542,6 +644,8 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                     const int U_ghosts = (error_data->getGhostCellWidth()).max();
                     const double* const F = residual_data->getPointer(axis, depth);
                     const int F_ghosts = (residual_data->getGhostCellWidth()).max();
+                    const float* const F_single =
+                        d_use_single_precision_smoother ? F_sp[F_sp_counter++] : static_cast<const float*>(NULL);
                     const int* const mask = mask_data->getPointer(axis, depth);
                     const int mask_ghosts = (mask_data->getGhostCellWidth()).max();
                     if (patch_has_dirichlet_bdry && d_bc_helper->patchTouchesDirichletBoundaryAxis(patch, axis))
@@ -549,44 +653,91 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                         if (red_black_ordering)
                         {
                             int red_or_black = isweep % 2; // "red" = 0, "black" = 1
-                            RB_GS_SMOOTH_MASK_FC(U,
-                                                 U_ghosts,
-                                                 alpha,
-                                                 beta,
-                                                 F,
-                                                 F_ghosts,
-                                                 mask,
-                                                 mask_ghosts,
-                                                 side_patch_box.lower(0),
-                                                 side_patch_box.upper(0),
-                                                 side_patch_box.lower(1),
-                                                 side_patch_box.upper(1),
+                            if (F_single)
+                            {
+                                RB_GS_SMOOTH_MASK_SP_FC(U,
+                                                        U_ghosts,
+                                                        alpha,
+                                                        beta,
+                                                        F_single,
+                                                        F_ghosts,
+                                                        mask,
+                                                        mask_ghosts,
+                                                        side_patch_box.lower(0),
+                                                        side_patch_box.upper(0),
+                                                        side_patch_box.lower(1),
+                                                        side_patch_box.upper(1),
+#if (NDIM == 3)
+                                                        side_patch_box.lower(2),
+                                                        side_patch_box.upper(2),
+#endif
+                                                        dx,
+                                                        red_or_black);
+                            }
+                            else
+                            {
+                                RB_GS_SMOOTH_MASK_FC(U,
+                                                     U_ghosts,
+                                                     alpha,
+                                                     beta,
+                                                     F,
+                                                     F_ghosts,
+                                                     mask,
+                                                     mask_ghosts,
+                                                     side_patch_box.lower(0),
+                                                     side_patch_box.upper(0),
+                                                     side_patch_box.lower(1),
+                                                     side_patch_box.upper(1),
 #if (NDIM == 3)
-                                                 side_patch_box.lower(2),
-                                                 side_patch_box.upper(2),
+                                                     side_patch_box.lower(2),
+                                                     side_patch_box.upper(2),
 #endif
-                                                 dx,
-                                                 red_or_black);
+                                                     dx,
+                                                     red_or_black);
+                            }
                         }
                         else
                         {
-                            GS_SMOOTH_MASK_FC(U,
-                                              U_ghosts,
-                                              alpha,
-                                              beta,
-                                              F,
-                                              F_ghosts,
-                                              mask,
-                                              mask_ghosts,
-                                              side_patch_box.lower(0),
-                                              side_patch_box.upper(0),
-                                              side_patch_box.lower(1),
-                                              side_patch_box.upper(1),
+                            if (F_single)
+                            {
+                                GS_SMOOTH_MASK_SP_FC(U,
+                                                     U_ghosts,
+                                                     alpha,
+                                                     beta,
+                                                     F_single,
+                                                     F_ghosts,
+                                                     mask,
+                                                     mask_ghosts,
+                                                     side_patch_box.lower(0),
+                                                     side_patch_box.upper(0),
+                                                     side_patch_box.lower(1),
+                                                     side_patch_box.upper(1),
 #if (NDIM == 3)
-                                              side_patch_box.lower(2),
-                                              side_patch_box.upper(2),
+                                                     side_patch_box.lower(2),
+                                                     side_patch_box.upper(2),
 #endif
-                                              dx);
+                                                     dx);
+                            }
+                            else
+                            {
+                                GS_SMOOTH_MASK_FC(U,
+                                                  U_ghosts,
+                                                  alpha,
+                                                  beta,
+                                                  F,
+                                                  F_ghosts,
+                                                  mask,
+                                                  mask_ghosts,
+                                                  side_patch_box.lower(0),
+                                                  side_patch_box.upper(0),
+                                                  side_patch_box.lower(1),
+                                                  side_patch_box.upper(1),
+#if (NDIM == 3)
+                                                  side_patch_box.lower(2),
+                                                  side_patch_box.upper(2),
+#endif
+                                                  dx);
+                            }
                         }
                     }
                     else
@@ -594,40 +745,83 @@ SCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                         if (red_black_ordering)
                         {
                             int red_or_black = isweep % 2; // "red" = 0, "black" = 1
-                            RB_GS_SMOOTH_FC(U,
-                                            U_ghosts,
-                                            alpha,
-                                            beta,
-                                            F,
-                                            F_ghosts,
-                                            side_patch_box.lower(0),
-                                            side_patch_box.upper(0),
-                                            side_patch_box.lower(1),
-                                            side_patch_box.upper(1),
+                            if (F_single)
+                            {
+                                RB_GS_SMOOTH_SP_FC(U,
+                                                   U_ghosts,
+                                                   alpha,
+                                                   beta,
+                                                   F_single,
+                                                   F_ghosts,
+                                                   side_patch_box.lower(0),
+                                                   side_patch_box.upper(0),
+                                                   side_patch_box.lower(1),
+                                                   side_patch_box.upper(1),
+#if (NDIM == 3)
+                                                   side_patch_box.lower(2),
+                                                   side_patch_box.upper(2),
+#endif
+                                                   dx,
+                                                   red_or_black);
+                            }
+                            else
+                            {
+                                RB_GS_SMOOTH_FC(U,
+                                                U_ghosts,
+                                                alpha,
+                                                beta,
+                                                F,
+                                                F_ghosts,
+                                                side_patch_box.lower(0),
+                                                side_patch_box.upper(0),
+                                                side_patch_box.lower(1),
+                                                side_patch_box.upper(1),
 #if (NDIM == 3)
-                                            side_patch_box.lower(2),
-                                            side_patch_box.upper(2),
+                                                side_patch_box.lower(2),
+                                                side_patch_box.upper(2),
 #endif
-                                            dx,
-                                            red_or_black);
+                                                dx,
+                                                red_or_black);
+                            }
                         }
                         else
                         {
-                            GS_SMOOTH_FC(U,
-                                         U_ghosts,
-                                         alpha,
-                                         beta,
-                                         F,
-                                         F_ghosts,
-                                         side_patch_box.lower(0),
-                                         side_patch_box.upper(0),
-                                         side_patch_box.lower(1),
-                                         side_patch_box.upper(1),
+                            if (F_single)
+                            {
+                                GS_SMOOTH_SP_FC(U,
+                                                U_ghosts,
+                                                alpha,
+                                                beta,
+                                                F_single,
+                                                F_ghosts,
+                                                side_patch_box.lower(0),
+                                                side_patch_box.upper(0),
+                                                side_patch_box.lower(1),
+                                                side_patch_box.upper(1),
 #if (NDIM == 3)
-                                         side_patch_box.lower(2),
-                                         side_patch_box.upper(2),
+                                                side_patch_box.lower(2),
+                                                side_patch_box.upper(2),
 #endif
-                                         dx);
+                                                dx);
+                            }
+                            else
+                            {
+                                GS_SMOOTH_FC(U,
+                                             U_ghosts,
+                                             alpha,
+                                             beta,
+                                             F,
+                                             F_ghosts,
+                                             side_patch_box.lower(0),
+                                             side_patch_box.upper(0),
+                                             side_patch_box.lower(1),
+                                             side_patch_box.upper(1),
+#if (NDIM == 3)
+                                             side_patch_box.lower(2),
+                                             side_patch_box.upper(2),
+#endif
+                                             dx);
+                            }
                         }
                     }
                 }
@@ -809,12 +1003,22 @@ SCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
     Pointer<CartesianGridGeometry<NDIM> > geometry = d_hierarchy->getGridGeometry();
     IBTK_DO_ONCE(geometry->addSpatialCoarsenOperator(new CartSideDoubleCubicCoarsen()););
 
-    // Setup coarse-fine interface and physical boundary operators.
-    d_cf_bdry_op = new CartSideDoubleQuadraticCFInterpolation();
+    // Setup coarse-fine interface and physical boundary operators.  These
+    // objects are referenced by the communication schedules of levels that are
+    // not reset, so they are only recreated when all levels are reset.
+    if (coarsest_reset_ln == d_coarsest_ln || !d_cf_bdry_op || !d_bc_op)
+    {
+        d_cf_bdry_op = new CartSideDoubleQuadraticCFInterpolation();
+        d_bc_op = new CartSideRobinPhysBdryOp(d_scratch_idx, d_bc_coefs, false);
+    }
+    else
+    {
+        d_bc_op->setPhysicalBcCoefs(d_bc_coefs);
+        d_bc_op->setHomogeneousBc(false);
+    }
     d_cf_bdry_op->setConsistentInterpolationScheme(false);
     d_cf_bdry_op->setPatchDataIndex(d_scratch_idx);
     d_cf_bdry_op->setPatchHierarchy(d_hierarchy);
-    d_bc_op = new CartSideRobinPhysBdryOp(d_scratch_idx, d_bc_coefs, false);
 
     // Setup fill pattern spec objects.
     if (d_poisson_spec.dIsConstant())
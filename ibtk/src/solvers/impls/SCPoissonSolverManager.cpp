@@ -44,6 +44,7 @@
 #include "ibtk/PETScKrylovPoissonSolver.h"
 #include "ibtk/PoissonSolver.h"
 #include "ibtk/SCLaplaceOperator.h"
+#include "ibtk/SCPoissonFFTLevelSolver.h"
 #include "ibtk/SCPoissonHypreLevelSolver.h"
 #include "ibtk/SCPoissonPETScLevelSolver.h"
 #include "ibtk/SCPoissonPointRelaxationFACOperator.h"
@@ -68,6 +69,7 @@ const std::string SCPoissonSolverManager::DEFAULT_FAC_PRECONDITIONER = "DEFAULT_
 const std::string SCPoissonSolverManager::POINT_RELAXATION_FAC_PRECONDITIONER = "POINT_RELAXATION_FAC_PRECONDITIONER";
 const std::string SCPoissonSolverManager::DEFAULT_LEVEL_SOLVER = "DEFAULT_LEVEL_SOLVER";
 const std::string SCPoissonSolverManager::HYPRE_LEVEL_SOLVER = "HYPRE_LEVEL_SOLVER";
+const std::string SCPoissonSolverManager::FFT_LEVEL_SOLVER = "FFT_LEVEL_SOLVER";
 const std::string SCPoissonSolverManager::PETSC_LEVEL_SOLVER = "PETSC_LEVEL_SOLVER";
 
 SCPoissonSolverManager* SCPoissonSolverManager::s_solver_manager_instance = NULL;
@@ -106,7 +108,12 @@ allocate_petsc_krylov_solver(const std::string& object_name,
 {
     Pointer<PETScKrylovPoissonSolver> krylov_solver =
         new PETScKrylovPoissonSolver(object_name, input_db, default_options_prefix);
-    krylov_solver->setOperator(new SCLaplaceOperator(object_name + "::laplace_operator"));
+    Pointer<SCLaplaceOperator> laplace_op = new SCLaplaceOperator(object_name + "::laplace_operator");
+    if (input_db && input_db->keyExists("use_persistent_workspace"))
+    {
+        laplace_op->setUsePersistentWorkspace(input_db->getBool("use_persistent_workspace"));
+    }
+    krylov_solver->setOperator(laplace_op);
     return krylov_solver;
 } // allocate_petsc_krylov_solver
 }
@@ -185,6 +192,7 @@ SCPoissonSolverManager::SCPoissonSolverManager() : d_solver_maker_map()
                                   SCPoissonPointRelaxationFACOperator::allocate_solver);
     registerSolverFactoryFunction(DEFAULT_LEVEL_SOLVER, SCPoissonHypreLevelSolver::allocate_solver);
     registerSolverFactoryFunction(HYPRE_LEVEL_SOLVER, SCPoissonHypreLevelSolver::allocate_solver);
+    registerSolverFactoryFunction(FFT_LEVEL_SOLVER, SCPoissonFFTLevelSolver::allocate_solver);
     registerSolverFactoryFunction(PETSC_LEVEL_SOLVER, SCPoissonPETScLevelSolver::allocate_solver);
     return;
 } // SCPoissonSolverManager
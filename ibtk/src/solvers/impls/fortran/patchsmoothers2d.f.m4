@@ -41,6 +41,7 @@ c
 define(NDIM,2)dnl
 define(REAL,`double precision')dnl
 define(INTEGER,`integer')dnl
+define(FLOAT,`real')dnl
 include(SAMRAI_FORTDIR/pdat_m4arrdim2d.i)dnl
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
@@ -304,3 +305,270 @@ c
       end
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Perform a single Gauss-Seidel sweep for F = alpha div grad U +
+c     beta U.
+c
+c     The right-hand side F is stored in single precision.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine gssmoothsp2d(
+     &     U,U_gcw,
+     &     alpha,beta,
+     &     F,F_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER U_gcw,F_gcw
+
+      REAL alpha,beta
+
+      FLOAT F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    fac0,fac1,fac
+c
+c     Perform a single Gauss-Seidel sweep.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac = 0.5d0/(fac0+fac1-0.5d0*beta)
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            U(i0,i1) = fac*(
+     &           fac0*(U(i0-1,i1)+U(i0+1,i1)) +
+     &           fac1*(U(i0,i1-1)+U(i0,i1+1)) -
+     &           F(i0,i1))
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Perform a single "red" or "black" Gauss-Seidel sweep for F = alpha
+c     div grad U + beta U.
+c
+c     The right-hand side F is stored in single precision.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine rbgssmoothsp2d(
+     &     U,U_gcw,
+     &     alpha,beta,
+     &     F,F_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx,
+     &     red_or_black)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER U_gcw,F_gcw
+      INTEGER red_or_black
+
+      REAL alpha,beta
+
+      FLOAT F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    fac0,fac1,fac
+c
+c     Perform a single "red" or "black" Gauss-Seidel sweep.
+c
+      red_or_black = mod(red_or_black,2) ! "red" = 0, "black" = 1
+
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac = 0.5d0/(fac0+fac1-0.5d0*beta)
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            if ( mod(i0+i1,2) .eq. red_or_black ) then
+               U(i0,i1) = fac*(
+     &              fac0*(U(i0-1,i1)+U(i0+1,i1)) +
+     &              fac1*(U(i0,i1-1)+U(i0,i1+1)) -
+     &              F(i0,i1))
+            endif
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Perform a single Gauss-Seidel sweep for F = alpha div grad U +
+c     beta U with masking of certain degrees of freedom.
+c
+c     NOTE: The solution U is unmodified at masked degrees of freedom.
+c
+c     The right-hand side F is stored in single precision.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine gssmoothmasksp2d(
+     &     U,U_gcw,
+     &     alpha,beta,
+     &     F,F_gcw,
+     &     mask,mask_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER U_gcw,F_gcw,mask_gcw
+
+      REAL alpha,beta
+
+      FLOAT F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+
+      INTEGER mask(ilower0-mask_gcw:iupper0+mask_gcw,
+     &             ilower1-mask_gcw:iupper1+mask_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    fac0,fac1,fac
+c
+c     Perform a single Gauss-Seidel sweep.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac = 0.5d0/(fac0+fac1-0.5d0*beta)
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            if (mask(i0,i1) .eq. 0) then
+               U(i0,i1) = fac*(
+     &              fac0*(U(i0-1,i1)+U(i0+1,i1)) +
+     &              fac1*(U(i0,i1-1)+U(i0,i1+1)) -
+     &              F(i0,i1))
+            endif
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Perform a single "red" or "black" Gauss-Seidel sweep for F = alpha
+c     div grad U + beta U with masking of certain degrees of freedom.
+c
+c     NOTE: The solution U is unmodified at masked degrees of freedom.
+c
+c     The right-hand side F is stored in single precision.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine rbgssmoothmasksp2d(
+     &     U,U_gcw,
+     &     alpha,beta,
+     &     F,F_gcw,
+     &     mask,mask_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx,
+     &     red_or_black)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER U_gcw,F_gcw,mask_gcw
+      INTEGER red_or_black
+
+      REAL alpha,beta
+
+      FLOAT F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+
+      INTEGER mask(ilower0-mask_gcw:iupper0+mask_gcw,
+     &             ilower1-mask_gcw:iupper1+mask_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    fac0,fac1,fac
+c
+c     Perform a single "red" or "black" Gauss-Seidel sweep.
+c
+      red_or_black = mod(red_or_black,2) ! "red" = 0, "black" = 1
+
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac = 0.5d0/(fac0+fac1-0.5d0*beta)
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            if ( (mod(i0+i1,2) .eq. red_or_black) .and.
+     &           (mask(i0,i1) .eq. 0) ) then
+               U(i0,i1) = fac*(
+     &              fac0*(U(i0-1,i1)+U(i0+1,i1)) +
+     &              fac1*(U(i0,i1-1)+U(i0,i1+1)) -
+     &              F(i0,i1))
+            endif
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
@@ -152,6 +152,13 @@ FACPreconditionerStrategy::deallocateOperatorState()
     return;
 } // deallocateOperatorState
 
+void
+FACPreconditionerStrategy::setResetLevels(const int /*coarsest_ln*/, const int /*finest_ln*/)
+{
+    // intentionally blank
+    return;
+} // setResetLevels
+
 void
 FACPreconditionerStrategy::allocateScratchData()
 {
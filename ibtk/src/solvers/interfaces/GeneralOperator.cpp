@@ -44,6 +44,7 @@
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
@@ -62,6 +63,7 @@ GeneralOperator::GeneralOperator(const std::string& object_name, bool homogeneou
       d_new_time(std::numeric_limits<double>::quiet_NaN()),
       d_hier_math_ops(NULL),
       d_hier_math_ops_external(false),
+      d_use_persistent_workspace(true),
       d_enable_logging(false)
 {
     // intentionally blank
@@ -146,6 +148,22 @@ GeneralOperator::getHierarchyMathOps() const
     return d_hier_math_ops;
 } // getHierarchyMathOps
 
+void
+GeneralOperator::setUsePersistentWorkspace(bool use_persistent_workspace)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!d_is_initialized);
+#endif
+    d_use_persistent_workspace = use_persistent_workspace;
+    return;
+} // setUsePersistentWorkspace
+
+bool
+GeneralOperator::getUsePersistentWorkspace() const
+{
+    return d_use_persistent_workspace;
+} // getUsePersistentWorkspace
+
 void
 GeneralOperator::applyAdd(SAMRAIVectorReal<NDIM, double>& x,
                           SAMRAIVectorReal<NDIM, double>& y,
@@ -215,6 +233,7 @@ GeneralOperator::printClassData(std::ostream& stream)
            << "new_time = " << d_new_time << "\n"
            << "hier_math_ops = " << d_hier_math_ops.getPointer() << "\n"
            << "hier_math_ops_external = " << d_hier_math_ops_external << "\n"
+           << "use_persistent_workspace = " << d_use_persistent_workspace << "\n"
            << "enable_logging = " << d_enable_logging << "\n";
     return;
 } // printClassData
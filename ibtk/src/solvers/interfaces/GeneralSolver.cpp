@@ -173,6 +173,13 @@ GeneralSolver::deallocateSolverState()
     return;
 } // deallocateSolverState
 
+void
+GeneralSolver::setResetLevels(const int /*coarsest_ln*/, const int /*finest_ln*/)
+{
+    // intentionally blank
+    return;
+} // setResetLevels
+
 void
 GeneralSolver::setMaxIterations(int max_iterations)
 {
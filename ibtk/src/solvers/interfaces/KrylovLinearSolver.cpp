@@ -91,6 +91,14 @@ KrylovLinearSolver::setTimeInterval(const double current_time, const double new_
     return;
 } // setTimeInterval
 
+void
+KrylovLinearSolver::setResetLevels(const int coarsest_ln, const int finest_ln)
+{
+    LinearSolver::setResetLevels(coarsest_ln, finest_ln);
+    if (d_pc_solver) d_pc_solver->setResetLevels(coarsest_ln, finest_ln);
+    return;
+} // setResetLevels
+
 void
 KrylovLinearSolver::setOperator(Pointer<LinearOperator> A)
 {
@@ -35,10 +35,21 @@
 #include <math.h>
 #include <algorithm>
 #include <ostream>
+#include <vector>
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "CellData.h"
+#include "CellVariable.h"
+#include "Index.h"
 #include "IntVector.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
 #include "SAMRAIVectorReal.h"
+#include "SideData.h"
+#include "SideGeometry.h"
+#include "SideVariable.h"
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/NormOps.h"
 #include "ibtk/PETScSAMRAIVectorReal.h"
@@ -123,6 +134,124 @@ static Timer* t_vec_dot_norm2;
 #define PSVR_CHECK3(v1, v2, v3)
 #define PSVR_CHECKN(v, N)
 #endif
+
+// Accumulate the (optionally control volume weighted) dot products of x with
+// each of the arrays in y over the specified box.
+inline void
+accumulate_dot_products(const ArrayData<NDIM, double>& x_data,
+                        const std::vector<const ArrayData<NDIM, double>*>& y_data,
+                        const ArrayData<NDIM, double>* const cvol_data,
+                        const Box<NDIM>& box,
+                        double* const val)
+{
+    const int nv = static_cast<int>(y_data.size());
+    const int depth = x_data.getDepth();
+    for (int d = 0; d < depth; ++d)
+    {
+        const int cvol_d = (cvol_data && cvol_data->getDepth() > 1 ? d : 0);
+        for (Box<NDIM>::Iterator b(box); b; b++)
+        {
+            const Index<NDIM>& i = b();
+            const double x_wgt = (cvol_data ? (*cvol_data)(i, cvol_d) : 1.0) * x_data(i, d);
+            if (x_wgt == 0.0) continue;
+            for (int k = 0; k < nv; ++k)
+            {
+                val[k] += x_wgt * (*y_data[k])(i, d);
+            }
+        }
+    }
+    return;
+} // accumulate_dot_products
+
+// Compute the local parts of the dot products of x with y[0], ..., y[nv-1] in
+// a single pass over the data of x.  Components that are not cell- or
+// side-centered are handled by separate calls to SAMRAIVectorReal::dot().
+void
+mdot_local(Pointer<SAMRAIVectorReal<NDIM, double> > x,
+           const int nv,
+           const std::vector<Pointer<SAMRAIVectorReal<NDIM, double> > >& y,
+           double* const val)
+{
+    std::fill(val, val + nv, 0.0);
+    const int ncomp = x->getNumberOfComponents();
+    for (int comp = 0; comp < ncomp; ++comp)
+    {
+        const Pointer<Variable<NDIM> >& comp_var = x->getComponentVariable(comp);
+        Pointer<CellVariable<NDIM, double> > comp_cc_var = comp_var;
+        Pointer<SideVariable<NDIM, double> > comp_sc_var = comp_var;
+        if (!comp_cc_var && !comp_sc_var)
+        {
+            static const bool local_only = true;
+            for (int k = 0; k < nv; ++k)
+            {
+                val[k] = x->dot(y[k], local_only);
+            }
+            return;
+        }
+    }
+
+    Pointer<PatchHierarchy<NDIM> > hierarchy = x->getPatchHierarchy();
+    const int coarsest_ln = x->getCoarsestLevelNumber();
+    const int finest_ln = x->getFinestLevelNumber();
+    std::vector<const ArrayData<NDIM, double>*> y_data(nv);
+    for (int comp = 0; comp < ncomp; ++comp)
+    {
+        const Pointer<Variable<NDIM> >& comp_var = x->getComponentVariable(comp);
+        const int x_idx = x->getComponentDescriptorIndex(comp);
+        const int cvol_idx = x->getControlVolumeIndex(comp);
+        const bool has_cvol = cvol_idx >= 0;
+        Pointer<CellVariable<NDIM, double> > comp_cc_var = comp_var;
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                if (comp_cc_var)
+                {
+                    Pointer<CellData<NDIM, double> > x_data = patch->getPatchData(x_idx);
+                    Pointer<CellData<NDIM, double> > cvol_data =
+                        (has_cvol ? patch->getPatchData(cvol_idx) : Pointer<PatchData<NDIM> >(NULL));
+                    for (int k = 0; k < nv; ++k)
+                    {
+                        Pointer<CellData<NDIM, double> > y_k_data =
+                            patch->getPatchData(y[k]->getComponentDescriptorIndex(comp));
+                        y_data[k] = &y_k_data->getArrayData();
+                    }
+                    accumulate_dot_products(x_data->getArrayData(),
+                                            y_data,
+                                            cvol_data ? &cvol_data->getArrayData() : NULL,
+                                            patch_box,
+                                            val);
+                }
+                else
+                {
+                    Pointer<SideData<NDIM, double> > x_data = patch->getPatchData(x_idx);
+                    Pointer<SideData<NDIM, double> > cvol_data =
+                        (has_cvol ? patch->getPatchData(cvol_idx) : Pointer<PatchData<NDIM> >(NULL));
+                    const IntVector<NDIM>& directions = x_data->getDirectionVector();
+                    for (unsigned int axis = 0; axis < NDIM; ++axis)
+                    {
+                        if (!directions(axis)) continue;
+                        for (int k = 0; k < nv; ++k)
+                        {
+                            Pointer<SideData<NDIM, double> > y_k_data =
+                                patch->getPatchData(y[k]->getComponentDescriptorIndex(comp));
+                            y_data[k] = &y_k_data->getArrayData(axis);
+                        }
+                        accumulate_dot_products(x_data->getArrayData(axis),
+                                                y_data,
+                                                cvol_data ? &cvol_data->getArrayData(axis) : NULL,
+                                                SideGeometry<NDIM>::toSideBox(patch_box, axis),
+                                                val);
+                    }
+                }
+            }
+        }
+    }
+    return;
+} // mdot_local
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -329,11 +458,12 @@ PETScSAMRAIVectorReal::VecMDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscSca
     IBTK_TIMER_START(t_vec_m_dot);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
+    std::vector<Pointer<SAMRAIVectorReal<NDIM, PetscScalar> > > y_vecs(nv);
     for (PetscInt i = 0; i < nv; ++i)
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        y_vecs[i] = PSVR_CAST2(y[i]);
     }
+    mdot_local(PSVR_CAST2(x), nv, y_vecs, val);
     SAMRAI_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_dot);
     PetscFunctionReturn(0);
@@ -393,11 +523,12 @@ PETScSAMRAIVectorReal::VecMTDot_SAMRAI(Vec x, PetscInt nv, const Vec* y, PetscSc
     IBTK_TIMER_START(t_vec_m_t_dot);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
+    std::vector<Pointer<SAMRAIVectorReal<NDIM, PetscScalar> > > y_vecs(nv);
     for (PetscInt i = 0; i < nv; ++i)
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        y_vecs[i] = PSVR_CAST2(y[i]);
     }
+    mdot_local(PSVR_CAST2(x), nv, y_vecs, val);
     SAMRAI_MPI::sumReduction(val, nv);
     IBTK_TIMER_STOP(t_vec_m_t_dot);
     PetscFunctionReturn(0);
@@ -746,11 +877,12 @@ PETScSAMRAIVectorReal::VecMDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, Pe
     IBTK_TIMER_START(t_vec_m_dot_local);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
+    std::vector<Pointer<SAMRAIVectorReal<NDIM, PetscScalar> > > y_vecs(nv);
     for (PetscInt i = 0; i < nv; ++i)
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        y_vecs[i] = PSVR_CAST2(y[i]);
     }
+    mdot_local(PSVR_CAST2(x), nv, y_vecs, val);
     IBTK_TIMER_STOP(t_vec_m_dot_local);
     PetscFunctionReturn(0);
 }
@@ -761,11 +893,12 @@ PETScSAMRAIVectorReal::VecMTDot_local_SAMRAI(Vec x, PetscInt nv, const Vec* y, P
     IBTK_TIMER_START(t_vec_m_t_dot_local);
     PSVR_CHECK1(x);
     PSVR_CHECKN(y, nv);
-    static const bool local_only = true;
+    std::vector<Pointer<SAMRAIVectorReal<NDIM, PetscScalar> > > y_vecs(nv);
     for (PetscInt i = 0; i < nv; ++i)
     {
-        val[i] = PSVR_CAST2(x)->dot(PSVR_CAST2(y[i]), local_only);
+        y_vecs[i] = PSVR_CAST2(y[i]);
     }
+    mdot_local(PSVR_CAST2(x), nv, y_vecs, val);
     IBTK_TIMER_STOP(t_vec_m_t_dot_local);
     PetscFunctionReturn(0);
 }
@@ -785,8 +918,16 @@ PETScSAMRAIVectorReal::VecDotNorm2_SAMRAI(Vec s, Vec t, PetscScalar* dp, PetscSc
 {
     IBTK_TIMER_START(t_vec_dot_norm2);
     PSVR_CHECK2(s, t);
-    *dp = PSVR_CAST2(s)->dot(PSVR_CAST2(t));
-    *nm = PSVR_CAST2(t)->dot(PSVR_CAST2(t));
+    // NOTE: Both quantities are computed in a single pass over the data of t
+    // and are reduced in a single collective.
+    std::vector<Pointer<SAMRAIVectorReal<NDIM, PetscScalar> > > y_vecs(2);
+    y_vecs[0] = PSVR_CAST2(s);
+    y_vecs[1] = PSVR_CAST2(t);
+    PetscScalar val[2];
+    mdot_local(PSVR_CAST2(t), 2, y_vecs, val);
+    SAMRAI_MPI::sumReduction(val, 2);
+    *dp = val[0];
+    *nm = val[1];
     IBTK_TIMER_STOP(t_vec_dot_norm2);
     PetscFunctionReturn(0);
 }
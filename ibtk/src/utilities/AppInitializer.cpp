@@ -42,6 +42,7 @@
 #include "VisItDataWriter.h"
 #include "ibtk/AppInitializer.h"
 #include "ibtk/LSiloDataWriter.h"
+#include "ibtk/TraceRecorder.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
@@ -393,6 +394,12 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         }
         TimerManager::createManager(timer_manager_db);
     }
+
+    // Configure event tracing.
+    if (d_input_db->isDatabase("TraceRecorder"))
+    {
+        TraceRecorder::getManager()->getFromInput(d_input_db->getDatabase("TraceRecorder"));
+    }
     return;
 } // AppInitializer
 
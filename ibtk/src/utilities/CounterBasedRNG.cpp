@@ -0,0 +1,192 @@
+// Filename: CounterBasedRNG.cpp
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <math.h>
+#include <stdint.h>
+#include <algorithm>
+#include <ostream>
+#include <vector>
+
+#include "ArrayData.h"
+#include "Box.h"
+#include "Index.h"
+#include "ibtk/CounterBasedRNG.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+static const uint32_t PHILOX_M0 = 0xD2511F53;
+static const uint32_t PHILOX_M1 = 0xCD9E8D57;
+static const uint32_t PHILOX_W0 = 0x9E3779B9;
+static const uint32_t PHILOX_W1 = 0xBB67AE85;
+static const int PHILOX_ROUNDS = 10;
+
+// Bit layout of the stream identifier stored in the last counter word.
+static const int LEVEL_SHIFT = 27, MAX_LEVELS = 1 << 5;
+static const int FIELD_SHIFT = 16, MAX_FIELDS = 1 << 11;
+static const int COMPONENT_SHIFT = 12, MAX_COMPONENTS = 1 << 4;
+static const int MAX_DEPTH_BLOCKS = 1 << 12;
+
+// Scale factor that maps a 32-bit integer to the midpoint of one of 2^32
+// equally sized subintervals of [0,1), so that neither 0 nor 1 is returned.
+static const double UINT32_TO_UNIT = 2.3283064365386963e-10;
+
+static const double TWO_PI = 6.283185307179586;
+
+inline void
+philox4x32(uint32_t ctr[4], const unsigned int key[2])
+{
+    uint32_t k0 = key[0], k1 = key[1];
+    for (int r = 0; r < PHILOX_ROUNDS; ++r)
+    {
+        if (r > 0)
+        {
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+        const uint64_t p0 = static_cast<uint64_t>(PHILOX_M0) * static_cast<uint64_t>(ctr[0]);
+        const uint64_t p1 = static_cast<uint64_t>(PHILOX_M1) * static_cast<uint64_t>(ctr[2]);
+        const uint32_t hi0 = static_cast<uint32_t>(p0 >> 32), lo0 = static_cast<uint32_t>(p0);
+        const uint32_t hi1 = static_cast<uint32_t>(p1 >> 32), lo1 = static_cast<uint32_t>(p1);
+        ctr[0] = hi1 ^ ctr[1] ^ k0;
+        ctr[1] = lo1;
+        ctr[2] = hi0 ^ ctr[3] ^ k1;
+        ctr[3] = lo0;
+    }
+    return;
+} // philox4x32
+}
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+CounterBasedRNG::genrand(double rn[4], const unsigned int counter[4], const unsigned int key[2])
+{
+    uint32_t ctr[4] = { counter[0], counter[1], counter[2], counter[3] };
+    philox4x32(ctr, key);
+    for (int m = 0; m < 4; ++m)
+    {
+        rn[m] = (static_cast<double>(ctr[m]) + 0.5) * UINT32_TO_UNIT;
+    }
+    return;
+} // genrand
+
+void
+CounterBasedRNG::genrandn(ArrayData<NDIM, double>& data,
+                          const Box<NDIM>& box,
+                          const unsigned int key[2],
+                          const int level_num,
+                          const int field_num,
+                          const int component_num)
+{
+    const int depth = data.getDepth();
+    const int num_depth_blocks = (depth + 3) / 4;
+    if (level_num < 0 || level_num >= MAX_LEVELS || field_num < 0 || field_num >= MAX_FIELDS || component_num < 0 ||
+        component_num >= MAX_COMPONENTS || num_depth_blocks > MAX_DEPTH_BLOCKS)
+    {
+        TBOX_ERROR("CounterBasedRNG::genrandn():\n"
+                   << "  random stream identifier out of range:\n"
+                   << "  level_num = " << level_num << " (max " << MAX_LEVELS - 1 << ")\n"
+                   << "  field_num = " << field_num << " (max " << MAX_FIELDS - 1 << ")\n"
+                   << "  component_num = " << component_num << " (max " << MAX_COMPONENTS - 1 << ")\n"
+                   << "  depth = " << depth << " (max " << 4 * MAX_DEPTH_BLOCKS << ")" << std::endl);
+    }
+    const Box<NDIM> fill_box = box * data.getBox();
+    if (fill_box.empty()) return;
+
+    // Generate the values one row (along the first coordinate direction) at a
+    // time: first evaluate the generator for the entire row, and then apply
+    // the Box-Muller transformation to the entire row, which turns each group
+    // of four uniform values into four normal values.
+    const int nx = fill_box.numberCells(0);
+    std::vector<double> row_vals(4 * nx);
+    Box<NDIM> row_box = fill_box;
+    row_box.upper(0) = row_box.lower(0);
+    for (Box<NDIM>::Iterator b(row_box); b; b++)
+    {
+        Index<NDIM> idx = b();
+        for (int depth_block = 0; depth_block < num_depth_blocks; ++depth_block)
+        {
+            const uint32_t stream_id =
+                (static_cast<uint32_t>(level_num) << LEVEL_SHIFT) | (static_cast<uint32_t>(field_num) << FIELD_SHIFT) |
+                (static_cast<uint32_t>(component_num) << COMPONENT_SHIFT) | static_cast<uint32_t>(depth_block);
+            for (int i = 0; i < nx; ++i)
+            {
+                uint32_t ctr[4] = { static_cast<uint32_t>(fill_box.lower(0) + i),
+                                    (NDIM > 1 ? static_cast<uint32_t>(idx(NDIM > 1 ? 1 : 0)) : 0),
+                                    (NDIM > 2 ? static_cast<uint32_t>(idx(NDIM > 2 ? 2 : 0)) : 0),
+                                    stream_id };
+                philox4x32(ctr, key);
+                for (int m = 0; m < 4; ++m)
+                {
+                    row_vals[4 * i + m] = (static_cast<double>(ctr[m]) + 0.5) * UINT32_TO_UNIT;
+                }
+            }
+            for (int i = 0; i < 2 * nx; ++i)
+            {
+                const double r = sqrt(-2.0 * log(row_vals[2 * i]));
+                const double theta = TWO_PI * row_vals[2 * i + 1];
+                row_vals[2 * i] = r * cos(theta);
+                row_vals[2 * i + 1] = r * sin(theta);
+            }
+            const int n = std::min(4, depth - 4 * depth_block);
+            for (int i = 0; i < nx; ++i)
+            {
+                idx(0) = fill_box.lower(0) + i;
+                for (int m = 0; m < n; ++m)
+                {
+                    data(idx, 4 * depth_block + m) = row_vals[4 * i + m];
+                }
+            }
+        }
+    }
+    return;
+} // genrandn
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,213 @@
+// Filename: GhostAccumulationSchedule.cpp
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <set>
+
+#include "Box.h"
+#include "BoxArray.h"
+#include "BoxGeometry.h"
+#include "BoxOverlap.h"
+#include "BoxTree.h"
+#include "GridGeometry.h"
+#include "IntVector.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
+#include "PatchLevel.h"
+#include "ProcessorMapping.h"
+#include "ibtk/GhostAccumulationSchedule.h"
+#include "ibtk/GhostAccumulationTransaction.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Array.h"
+#include "tbox/Pointer.h"
+#include "tbox/Schedule.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+GhostAccumulationSchedule::GhostAccumulationSchedule(Pointer<PatchLevel<NDIM> > patch_level,
+                                                     const int src_patch_data_idx,
+                                                     const int dst_patch_data_idx)
+    : d_patch_level(patch_level),
+      d_src_patch_data_idx(src_patch_data_idx),
+      d_dst_patch_data_idx(dst_patch_data_idx),
+      d_schedule()
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_patch_level);
+    TBOX_ASSERT(d_src_patch_data_idx != d_dst_patch_data_idx);
+#endif
+    // Only transactions that involve at least one local patch are required.
+    // The candidate neighbors of each local patch are found by querying the box
+    // tree of the level with the grown ghost box of the patch (and its periodic
+    // images).  Pairs of local patches (including each local patch paired with
+    // itself) are visited once, with the local patch acting as the destination.
+    const ProcessorMapping& mapping = d_patch_level->getProcessorMapping();
+    const BoxArray<NDIM>& boxes = d_patch_level->getBoxes();
+    Pointer<BoxTree<NDIM> > box_tree = d_patch_level->getBoxTree();
+    Pointer<PatchDescriptor<NDIM> > patch_descriptor = d_patch_level->getPatchDescriptor();
+    const IntVector<NDIM> ghost_width =
+        IntVector<NDIM>::max(patch_descriptor->getPatchDataFactory(d_src_patch_data_idx)->getGhostCellWidth(),
+                             patch_descriptor->getPatchDataFactory(d_dst_patch_data_idx)->getGhostCellWidth());
+    const IntVector<NDIM> periodic_shift =
+        d_patch_level->getGridGeometry()->getPeriodicShift(d_patch_level->getRatio());
+    const Box<NDIM> shift_box = getPeriodicShiftBox(periodic_shift);
+    for (PatchLevel<NDIM>::Iterator p(d_patch_level); p; p++)
+    {
+        const int local_patch_num = p();
+        const Box<NDIM> test_box =
+            Box<NDIM>::grow(boxes[local_patch_num], ghost_width + ghost_width + IntVector<NDIM>(1));
+        std::set<int> nbr_patch_nums;
+        for (Box<NDIM>::Iterator b(shift_box); b; b++)
+        {
+            Box<NDIM> shifted_test_box = test_box;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                shifted_test_box.shift(d, -b()(d) * periodic_shift(d));
+            }
+            Array<int> indices;
+            box_tree->findOverlapIndices(indices, shifted_test_box);
+            nbr_patch_nums.insert(indices.getPointer(), indices.getPointer() + indices.getSize());
+        }
+        for (std::set<int>::const_iterator it = nbr_patch_nums.begin(); it != nbr_patch_nums.end(); ++it)
+        {
+            const int patch_num = *it;
+            appendTransactions(patch_num, local_patch_num);
+            if (!mapping.isMappingLocal(patch_num))
+            {
+                appendTransactions(local_patch_num, patch_num);
+            }
+        }
+    }
+    return;
+} // GhostAccumulationSchedule
+
+GhostAccumulationSchedule::~GhostAccumulationSchedule()
+{
+    // intentionally blank
+    return;
+} // ~GhostAccumulationSchedule
+
+void
+GhostAccumulationSchedule::communicate()
+{
+    d_schedule.communicate();
+    return;
+} // communicate
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+Box<NDIM>
+GhostAccumulationSchedule::getPeriodicShiftBox(const IntVector<NDIM>& periodic_shift)
+{
+    Box<NDIM> shift_box(IntVector<NDIM>(-1), IntVector<NDIM>(1));
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        if (periodic_shift(d) == 0)
+        {
+            shift_box.lower()(d) = 0;
+            shift_box.upper()(d) = 0;
+        }
+    }
+    return shift_box;
+} // getPeriodicShiftBox
+
+void
+GhostAccumulationSchedule::appendTransactions(const int src_patch_num, const int dst_patch_num)
+{
+    const BoxArray<NDIM>& boxes = d_patch_level->getBoxes();
+    const Box<NDIM>& src_box = boxes[src_patch_num];
+    const Box<NDIM>& dst_box = boxes[dst_patch_num];
+    Pointer<PatchDataFactory<NDIM> > src_pdat_factory =
+        d_patch_level->getPatchDescriptor()->getPatchDataFactory(d_src_patch_data_idx);
+    Pointer<PatchDataFactory<NDIM> > dst_pdat_factory =
+        d_patch_level->getPatchDescriptor()->getPatchDataFactory(d_dst_patch_data_idx);
+    const Box<NDIM> src_mask = Box<NDIM>::grow(src_box, src_pdat_factory->getGhostCellWidth());
+
+    // Quick rejection test: data of any centering associated with the two
+    // ghost boxes can only overlap if the boxes are at most one cell apart.
+    const IntVector<NDIM> periodic_shift =
+        d_patch_level->getGridGeometry()->getPeriodicShift(d_patch_level->getRatio());
+    const Box<NDIM> dst_test_box =
+        Box<NDIM>::grow(dst_box, dst_pdat_factory->getGhostCellWidth() + IntVector<NDIM>(1));
+    const Box<NDIM> shift_box = getPeriodicShiftBox(periodic_shift);
+
+    Pointer<BoxGeometry<NDIM> > src_box_geometry;
+    Pointer<BoxGeometry<NDIM> > dst_box_geometry;
+    for (Box<NDIM>::Iterator b(shift_box); b; b++)
+    {
+        IntVector<NDIM> src_shift;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            src_shift(d) = b()(d) * periodic_shift(d);
+        }
+        Box<NDIM> shifted_src_mask = src_mask;
+        shifted_src_mask.shift(src_shift);
+        if ((shifted_src_mask * dst_test_box).empty()) continue;
+
+        if (!src_box_geometry)
+        {
+            src_box_geometry = src_pdat_factory->getBoxGeometry(src_box);
+            dst_box_geometry = dst_pdat_factory->getBoxGeometry(dst_box);
+        }
+        const bool overwrite_interior = true;
+        Pointer<BoxOverlap<NDIM> > box_overlap =
+            dst_box_geometry->calculateOverlap(*src_box_geometry, src_mask, overwrite_interior, src_shift);
+        if (box_overlap->isOverlapEmpty()) continue;
+
+        const ProcessorMapping& mapping = d_patch_level->getProcessorMapping();
+        d_schedule.appendTransaction(new GhostAccumulationTransaction(mapping.getProcessorAssignment(src_patch_num),
+                                                                      mapping.getProcessorAssignment(dst_patch_num),
+                                                                      d_patch_level,
+                                                                      src_patch_num,
+                                                                      dst_patch_num,
+                                                                      d_src_patch_data_idx,
+                                                                      d_dst_patch_data_idx,
+                                                                      box_overlap));
+    }
+    return;
+} // appendTransactions
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
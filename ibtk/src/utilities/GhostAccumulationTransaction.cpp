@@ -0,0 +1,301 @@
+// Filename: GhostAccumulationTransaction.cpp
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ostream>
+
+#include "ArrayData.h"
+#include "ArrayDataBasicOps.h"
+#include "Box.h"
+#include "BoxList.h"
+#include "BoxOverlap.h"
+#include "CellData.h"
+#include "CellOverlap.h"
+#include "EdgeData.h"
+#include "EdgeOverlap.h"
+#include "IntVector.h"
+#include "NodeData.h"
+#include "NodeOverlap.h"
+#include "Patch.h"
+#include "PatchData.h"
+#include "PatchLevel.h"
+#include "SideData.h"
+#include "SideOverlap.h"
+#include "ibtk/GhostAccumulationTransaction.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/AbstractStream.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+GhostAccumulationTransaction::GhostAccumulationTransaction(const int src_proc,
+                                                           const int dst_proc,
+                                                           Pointer<PatchLevel<NDIM> > patch_level,
+                                                           const int src_patch_num,
+                                                           const int dst_patch_num,
+                                                           const int src_patch_data_idx,
+                                                           const int dst_patch_data_idx,
+                                                           Pointer<BoxOverlap<NDIM> > overlap)
+    : d_src_proc(src_proc),
+      d_dst_proc(dst_proc),
+      d_patch_level(patch_level),
+      d_src_patch_num(src_patch_num),
+      d_dst_patch_num(dst_patch_num),
+      d_src_patch_data_idx(src_patch_data_idx),
+      d_dst_patch_data_idx(dst_patch_data_idx),
+      d_overlap(overlap)
+{
+    // intentionally blank
+    return;
+} // GhostAccumulationTransaction
+
+GhostAccumulationTransaction::~GhostAccumulationTransaction()
+{
+    // intentionally blank
+    return;
+} // ~GhostAccumulationTransaction
+
+bool
+GhostAccumulationTransaction::canEstimateIncomingMessageSize()
+{
+    return true;
+} // canEstimateIncomingMessageSize
+
+int
+GhostAccumulationTransaction::computeIncomingMessageSize()
+{
+    Pointer<Patch<NDIM> > dst_patch = d_patch_level->getPatch(d_dst_patch_num);
+    return dst_patch->getPatchData(d_dst_patch_data_idx)->getDataStreamSize(*d_overlap);
+} // computeIncomingMessageSize
+
+int
+GhostAccumulationTransaction::computeOutgoingMessageSize()
+{
+    Pointer<Patch<NDIM> > src_patch = d_patch_level->getPatch(d_src_patch_num);
+    return src_patch->getPatchData(d_src_patch_data_idx)->getDataStreamSize(*d_overlap);
+} // computeOutgoingMessageSize
+
+int
+GhostAccumulationTransaction::getSourceProcessor()
+{
+    return d_src_proc;
+} // getSourceProcessor
+
+int
+GhostAccumulationTransaction::getDestinationProcessor()
+{
+    return d_dst_proc;
+} // getDestinationProcessor
+
+void
+GhostAccumulationTransaction::packStream(AbstractStream& stream)
+{
+    Pointer<Patch<NDIM> > src_patch = d_patch_level->getPatch(d_src_patch_num);
+    src_patch->getPatchData(d_src_patch_data_idx)->packStream(stream, *d_overlap);
+    return;
+} // packStream
+
+void
+GhostAccumulationTransaction::unpackStream(AbstractStream& stream)
+{
+    Pointer<PatchData<NDIM> > buffer = allocateBuffer();
+    buffer->unpackStream(stream, *d_overlap);
+    accumulateBuffer(buffer);
+    return;
+} // unpackStream
+
+void
+GhostAccumulationTransaction::copyLocalData()
+{
+    Pointer<Patch<NDIM> > src_patch = d_patch_level->getPatch(d_src_patch_num);
+    Pointer<PatchData<NDIM> > buffer = allocateBuffer();
+    buffer->copy(*src_patch->getPatchData(d_src_patch_data_idx), *d_overlap);
+    accumulateBuffer(buffer);
+    return;
+} // copyLocalData
+
+void
+GhostAccumulationTransaction::printClassData(std::ostream& stream) const
+{
+    stream << "GhostAccumulationTransaction:\n"
+           << "  src_proc = " << d_src_proc << ", dst_proc = " << d_dst_proc << "\n"
+           << "  src_patch_num = " << d_src_patch_num << ", dst_patch_num = " << d_dst_patch_num << "\n"
+           << "  src_patch_data_idx = " << d_src_patch_data_idx
+           << ", dst_patch_data_idx = " << d_dst_patch_data_idx << "\n";
+    return;
+} // printClassData
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+Pointer<PatchData<NDIM> >
+GhostAccumulationTransaction::allocateBuffer() const
+{
+    // The buffer only covers the bounding box of the destination region of the
+    // overlap (interpreted as a cell box, which contains the corresponding
+    // node-, side-, and edge-centered indices), not the ghost box of the
+    // destination patch.
+    Pointer<Patch<NDIM> > dst_patch = d_patch_level->getPatch(d_dst_patch_num);
+    Pointer<PatchData<NDIM> > dst_data = dst_patch->getPatchData(d_dst_patch_data_idx);
+    Pointer<CellData<NDIM, double> > cc_data = dst_data;
+    Pointer<NodeData<NDIM, double> > nc_data = dst_data;
+    Pointer<SideData<NDIM, double> > sc_data = dst_data;
+    Pointer<EdgeData<NDIM, double> > ec_data = dst_data;
+    const IntVector<NDIM> no_ghosts(0);
+    if (cc_data)
+    {
+        Pointer<CellOverlap<NDIM> > cc_overlap = d_overlap;
+        const Box<NDIM> buffer_box = cc_overlap->getDestinationBoxList().getBoundingBox();
+        Pointer<CellData<NDIM, double> > cc_buffer =
+            new CellData<NDIM, double>(buffer_box, cc_data->getDepth(), no_ghosts);
+        cc_buffer->fillAll(0.0);
+        return cc_buffer;
+    }
+    else if (nc_data)
+    {
+        Pointer<NodeOverlap<NDIM> > nc_overlap = d_overlap;
+        const Box<NDIM> buffer_box = nc_overlap->getDestinationBoxList().getBoundingBox();
+        Pointer<NodeData<NDIM, double> > nc_buffer =
+            new NodeData<NDIM, double>(buffer_box, nc_data->getDepth(), no_ghosts);
+        nc_buffer->fillAll(0.0);
+        return nc_buffer;
+    }
+    else if (sc_data)
+    {
+        Pointer<SideOverlap<NDIM> > sc_overlap = d_overlap;
+        const IntVector<NDIM>& directions = sc_data->getDirectionVector();
+        BoxList<NDIM> dst_boxes;
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            if (directions(axis)) dst_boxes.unionBoxes(sc_overlap->getDestinationBoxList(axis));
+        }
+        Pointer<SideData<NDIM, double> > sc_buffer =
+            new SideData<NDIM, double>(dst_boxes.getBoundingBox(), sc_data->getDepth(), no_ghosts, directions);
+        sc_buffer->fillAll(0.0);
+        return sc_buffer;
+    }
+    else if (ec_data)
+    {
+        Pointer<EdgeOverlap<NDIM> > ec_overlap = d_overlap;
+        BoxList<NDIM> dst_boxes;
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            dst_boxes.unionBoxes(ec_overlap->getDestinationBoxList(axis));
+        }
+        Pointer<EdgeData<NDIM, double> > ec_buffer =
+            new EdgeData<NDIM, double>(dst_boxes.getBoundingBox(), ec_data->getDepth(), no_ghosts);
+        ec_buffer->fillAll(0.0);
+        return ec_buffer;
+    }
+    TBOX_ERROR("GhostAccumulationTransaction::allocateBuffer():\n"
+               << "  only double-precision cell-, node-, side-, or edge-centered data is "
+                  "presently supported."
+               << std::endl);
+    return NULL;
+} // allocateBuffer
+
+void
+GhostAccumulationTransaction::accumulateBuffer(Pointer<PatchData<NDIM> > buffer)
+{
+    // Only the destination boxes of the overlap are accumulated.
+    Pointer<Patch<NDIM> > dst_patch = d_patch_level->getPatch(d_dst_patch_num);
+    Pointer<PatchData<NDIM> > dst_data = dst_patch->getPatchData(d_dst_patch_data_idx);
+    Pointer<CellData<NDIM, double> > cc_buffer = buffer;
+    Pointer<NodeData<NDIM, double> > nc_buffer = buffer;
+    Pointer<SideData<NDIM, double> > sc_buffer = buffer;
+    Pointer<EdgeData<NDIM, double> > ec_buffer = buffer;
+    if (cc_buffer)
+    {
+        Pointer<CellData<NDIM, double> > cc_data = dst_data;
+        Pointer<CellOverlap<NDIM> > cc_overlap = d_overlap;
+        addBoxes(cc_data->getArrayData(), cc_buffer->getArrayData(), cc_overlap->getDestinationBoxList());
+    }
+    else if (nc_buffer)
+    {
+        Pointer<NodeData<NDIM, double> > nc_data = dst_data;
+        Pointer<NodeOverlap<NDIM> > nc_overlap = d_overlap;
+        addBoxes(nc_data->getArrayData(), nc_buffer->getArrayData(), nc_overlap->getDestinationBoxList());
+    }
+    else if (sc_buffer)
+    {
+        Pointer<SideData<NDIM, double> > sc_data = dst_data;
+        Pointer<SideOverlap<NDIM> > sc_overlap = d_overlap;
+        const IntVector<NDIM>& directions = sc_buffer->getDirectionVector();
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            if (!directions(axis)) continue;
+            addBoxes(sc_data->getArrayData(axis),
+                     sc_buffer->getArrayData(axis),
+                     sc_overlap->getDestinationBoxList(axis));
+        }
+    }
+    else if (ec_buffer)
+    {
+        Pointer<EdgeData<NDIM, double> > ec_data = dst_data;
+        Pointer<EdgeOverlap<NDIM> > ec_overlap = d_overlap;
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            addBoxes(ec_data->getArrayData(axis),
+                     ec_buffer->getArrayData(axis),
+                     ec_overlap->getDestinationBoxList(axis));
+        }
+    }
+    return;
+} // accumulateBuffer
+
+void
+GhostAccumulationTransaction::addBoxes(ArrayData<NDIM, double>& dst_arr,
+                                       const ArrayData<NDIM, double>& buf_arr,
+                                       const BoxList<NDIM>& dst_boxes)
+{
+    ArrayDataBasicOps<NDIM, double> array_ops;
+    for (BoxList<NDIM>::Iterator b(dst_boxes); b; b++)
+    {
+        array_ops.add(dst_arr, dst_arr, buf_arr, b());
+    }
+    return;
+} // addBoxes
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
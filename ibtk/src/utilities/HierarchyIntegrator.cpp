@@ -34,6 +34,7 @@
 
 #include <algorithm>
 #include <deque>
+#include <iomanip>
 #include <limits>
 #include <list>
 #include <map>
@@ -47,27 +48,36 @@
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
 #include "Box.h"
+#include "BoxArray.h"
 #include "CartesianGridGeometry.h"
 #include "CellData.h"
+#include "CellVariable.h"
 #include "CoarsenAlgorithm.h"
 #include "CoarsenOperator.h"
 #include "CoarsenPatchStrategy.h"
 #include "CoarsenSchedule.h"
 #include "ComponentSelector.h"
 #include "EdgeData.h"
+#include "EdgeVariable.h"
 #include "FaceData.h"
+#include "FaceVariable.h"
 #include "GriddingAlgorithm.h"
 #include "IntVector.h"
 #include "NodeData.h"
+#include "NodeVariable.h"
 #include "Patch.h"
 #include "PatchData.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
+#include "ProcessorMapping.h"
 #include "RefineAlgorithm.h"
 #include "RefineOperator.h"
 #include "RefinePatchStrategy.h"
 #include "RefineSchedule.h"
 #include "SideData.h"
+#include "SideVariable.h"
 #include "TagAndInitializeStrategy.h"
 #include "Variable.h"
 #include "VariableContext.h"
@@ -78,7 +88,9 @@
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/RefinePatchStrategySet.h"
+#include "ibtk/TraceRecorder.h"
 #include "ibtk/ibtk_enums.h"
+#include "ibtk/ibtk_utilities.h"
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 #include "tbox/Array.h"
 #include "tbox/Database.h"
@@ -86,6 +98,9 @@
 #include "tbox/PIO.h"
 #include "tbox/Pointer.h"
 #include "tbox/RestartManager.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -98,6 +113,55 @@ namespace
 {
 // Version of HierarchyIntegrator restart file data.
 static const int HIERARCHY_INTEGRATOR_VERSION = 1;
+
+// Timers.
+static Timer* t_advance_hierarchy;
+static Timer* t_regrid_hierarchy;
+static Timer* t_initialize_level_data;
+
+// Returns true when the patch data of the variable are stored in a single array
+// over the patch, so that data on a patch level that is unchanged by
+// regridding can be copied directly from the old level.
+template <class TYPE>
+inline bool
+is_array_data_variable(const Pointer<Variable<NDIM> > var)
+{
+    return !Pointer<CellVariable<NDIM, TYPE> >(var).isNull() || !Pointer<EdgeVariable<NDIM, TYPE> >(var).isNull() ||
+           !Pointer<FaceVariable<NDIM, TYPE> >(var).isNull() || !Pointer<NodeVariable<NDIM, TYPE> >(var).isNull() ||
+           !Pointer<SideVariable<NDIM, TYPE> >(var).isNull();
+} // is_array_data_variable
+
+// Returns the number of bytes required to store the patch data associated with
+// the specified patch data descriptor index on the local patches of the
+// hierarchy, whether or not the data are currently allocated.
+inline double
+get_local_patch_data_bytes(const Pointer<PatchHierarchy<NDIM> > hierarchy, const int data_idx)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<PatchDataFactory<NDIM> > pdat_factory = var_db->getPatchDescriptor()->getPatchDataFactory(data_idx);
+    double local_bytes = 0.0;
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            local_bytes += static_cast<double>(pdat_factory->getSizeOfMemory(patch->getBox()));
+        }
+    }
+    return local_bytes;
+} // get_local_patch_data_bytes
+
+inline double
+get_local_patch_data_bytes(const Pointer<PatchHierarchy<NDIM> > hierarchy, const ComponentSelector& data_idxs)
+{
+    double local_bytes = 0.0;
+    for (int data_idx = 0; data_idx < data_idxs.getSize(); ++data_idx)
+    {
+        if (data_idxs.isSet(data_idx)) local_bytes += get_local_patch_data_bytes(hierarchy, data_idx);
+    }
+    return local_bytes;
+} // get_local_patch_data_bytes
 } // namespace
 
 const std::string HierarchyIntegrator::SYNCH_CURRENT_DATA_ALG = "SYNCH_CURRENT_DATA";
@@ -126,6 +190,11 @@ HierarchyIntegrator::HierarchyIntegrator(const std::string& object_name,
     d_hierarchy_is_initialized = false;
     d_regridding_hierarchy = false;
     d_at_regrid_time_step = false;
+    d_hierarchy_unchanged_by_regrid = false;
+    d_regrid_fill_time_per_cell = 0.0;
+    d_regrid_time_saved = 0.0;
+    d_total_regrid_time_saved = 0.0;
+    d_hierarchy_volume = -1.0;
     d_visit_writer = NULL;
     d_parent_integrator = NULL;
     d_current_num_cycles = -1;
@@ -146,6 +215,9 @@ HierarchyIntegrator::HierarchyIntegrator(const std::string& object_name,
     d_regrid_interval = 1;
     d_regrid_mode = STANDARD;
     d_enable_logging = false;
+    d_enable_memory_report = false;
+    d_deferred_data_peak_local_bytes = 0.0;
+    d_trace_write_interval = 0;
     d_bdry_extrap_type = "LINEAR";
     d_manage_hier_math_ops = true;
     d_tag_buffer.resizeArray(1);
@@ -174,6 +246,15 @@ HierarchyIntegrator::HierarchyIntegrator(const std::string& object_name,
     d_coarsen_algs[SYNCH_CURRENT_DATA_ALG] = new CoarsenAlgorithm<NDIM>();
     d_coarsen_algs[SYNCH_NEW_DATA_ALG] = new CoarsenAlgorithm<NDIM>();
     d_fill_after_regrid_phys_bdry_bc_op = NULL;
+    d_fill_unchanged_level_after_regrid = false;
+
+    // Setup Timers.
+    IBTK_DO_ONCE(t_advance_hierarchy =
+                     TimerManager::getManager()->getTimer("IBTK::HierarchyIntegrator::advanceHierarchy()");
+                 t_regrid_hierarchy =
+                     TimerManager::getManager()->getTimer("IBTK::HierarchyIntegrator::regridHierarchy()");
+                 t_initialize_level_data =
+                     TimerManager::getManager()->getTimer("IBTK::HierarchyIntegrator::initializeLevelData()"););
     return;
 } // HierarchyIntegrator
 
@@ -282,12 +363,15 @@ HierarchyIntegrator::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > hie
         hier_integrators.insert(
             hier_integrators.end(), integrator->d_child_integrators.begin(), integrator->d_child_integrators.end());
     }
+    if (d_enable_memory_report) printPatchDataMemoryReport(plog);
     return;
 } // initializePatchHierarchy
 
 void
 HierarchyIntegrator::advanceHierarchy(double dt)
 {
+    IBTK_TIMER_START(t_advance_hierarchy);
+
     const double dt_min = getMinimumTimeStepSize();
     const double dt_max = getMaximumTimeStepSize();
     if (dt < dt_min || dt > dt_max)
@@ -325,6 +409,9 @@ HierarchyIntegrator::advanceHierarchy(double dt)
         plog << d_object_name << "::advanceHierarchy(): time interval = [" << current_time << "," << new_time
              << "], dt = " << dt << "\n";
 
+    // Tag subsequently traced events with the current time step number.
+    if (!d_parent_integrator) TraceRecorder::getManager()->setTimeStepNumber(d_integrator_step);
+
     // Regrid the patch hierarchy.
     if (atRegridPoint())
     {
@@ -390,6 +477,15 @@ HierarchyIntegrator::advanceHierarchy(double dt)
 
     // Reset the regrid indicator.
     d_at_regrid_time_step = false;
+
+    // Write the traced events.
+    if (!d_parent_integrator && (!d_trace_file_name.empty() || !d_trace_summary_file_name.empty()) &&
+        ((d_trace_write_interval > 0 && d_integrator_step % d_trace_write_interval == 0) || !stepsRemaining()))
+    {
+        writeTraceData();
+    }
+
+    IBTK_TIMER_STOP(t_advance_hierarchy);
     return;
 } // advanceHierarchy
 
@@ -456,30 +552,23 @@ HierarchyIntegrator::resetIntegratorToPreadvanceState()
 void
 HierarchyIntegrator::regridHierarchy()
 {
-    const int coarsest_ln = 0;
+    IBTK_TIMER_START(t_regrid_hierarchy);
 
     bool check_volume_change = !d_parent_integrator && d_hierarchy_is_initialized;
-    const double old_volume = check_volume_change ? d_hier_math_ops->getVolumeOfPhysicalDomain() : 0.0;
-
-    // Regrid the hierarchy.
-    switch (d_regrid_mode)
+    if (check_volume_change && d_hierarchy_volume < 0.0)
     {
-    case STANDARD:
-        d_gridding_alg->regridAllFinerLevels(d_hierarchy, coarsest_ln, d_integrator_time, d_tag_buffer);
-        break;
-    case AGGRESSIVE:
-        for (int k = 0; k < d_gridding_alg->getMaxLevels(); ++k)
-        {
-            d_gridding_alg->regridAllFinerLevels(d_hierarchy, coarsest_ln, d_integrator_time, d_tag_buffer);
-        }
-        break;
-    default:
-        TBOX_ERROR(d_object_name << "::regridHierarchy():\n"
-                                 << "  unrecognized regrid mode: " << enum_to_string<RegridMode>(d_regrid_mode) << "."
-                                 << std::endl);
+        d_hierarchy_volume = d_hier_math_ops->getVolumeOfPhysicalDomain();
     }
+    const double old_volume = check_volume_change ? d_hierarchy_volume : 0.0;
+
+    // Regrid the hierarchy.
+    regridPatchLevels();
 
+    // The domain volume can only change if some level was changed by
+    // regridding.
+    if (d_hierarchy_unchanged_by_regrid) check_volume_change = false;
     const double new_volume = check_volume_change ? d_hier_math_ops->getVolumeOfPhysicalDomain() : 0.0;
+    if (check_volume_change) d_hierarchy_volume = new_volume;
 
     if (check_volume_change && !MathUtilities<double>::equalEps(old_volume, new_volume))
     {
@@ -497,6 +586,11 @@ HierarchyIntegrator::regridHierarchy()
 
     // Synchronize the state data on the patch hierarchy.
     synchronizeHierarchyData(CURRENT_DATA);
+    logRegridSummary();
+    if (d_enable_memory_report) printPatchDataMemoryReport(plog);
+    resetDeferredPatchDataPeak();
+
+    IBTK_TIMER_STOP(t_regrid_hierarchy);
     return;
 } // regridHierarchy
 
@@ -747,12 +841,30 @@ HierarchyIntegrator::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM>
     }
     TBOX_ASSERT(hierarchy->getPatchLevel(level_number));
 #endif
+    // NOTE: Only the top-level integrator times the level initialization so
+    // that the work done by child integrators is accounted for exactly once.
+    const bool time_level_init = !d_parent_integrator && !initial_time && old_level;
+    double level_init_start_time = 0.0;
+    if (time_level_init)
+    {
+        level_init_start_time = t_initialize_level_data->getTotalWallclockTime();
+        IBTK_TIMER_START(t_initialize_level_data);
+    }
+
+    // Determine whether the level is unchanged by regridding.
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    const bool level_unchanged = !initial_time && levelsHaveSameConfiguration(level, old_level);
+    if (static_cast<int>(d_level_unchanged_by_regrid.size()) <= level_number)
+    {
+        d_level_unchanged_by_regrid.resize(level_number + 1, false);
+    }
+    d_level_unchanged_by_regrid[level_number] = level_unchanged;
+
     // Allocate storage needed to initialize the level and fill data from
     // coarser levels in AMR hierarchy, if any.
     //
     // Since time gets set when we allocate data, re-stamp it to current time if
     // we don't need to allocate.
-    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
     if (allocate_data)
     {
         level->allocatePatchData(d_current_data, init_data_time);
@@ -762,10 +874,34 @@ HierarchyIntegrator::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM>
         level->setTime(init_data_time, d_current_data);
     }
 
-    // Fill data from coarser levels in AMR hierarchy.
-    if (!initial_time && (level_number > 0 || old_level))
+    // Fill data from coarser levels in AMR hierarchy.  When the level is
+    // unchanged by regridding, array-based data are instead copied directly
+    // from the old level, and only the remaining data (e.g., index data that
+    // may have been moved to coarser levels prior to regridding) are refilled
+    // from coarser levels.
+    if (level_unchanged)
+    {
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<Patch<NDIM> > old_patch = old_level->getPatch(p());
+            for (int idx = 0; idx < d_copy_after_regrid_idxs.getSize(); ++idx)
+            {
+                if (d_copy_after_regrid_idxs.isSet(idx) && old_patch->checkAllocated(idx))
+                {
+                    patch->getPatchData(idx)->copy(*old_patch->getPatchData(idx));
+                }
+            }
+        }
+    }
+    if (!initial_time && (level_number > 0 || old_level) &&
+        (!level_unchanged || d_fill_unchanged_level_after_regrid))
     {
-        level->allocatePatchData(d_scratch_data, init_data_time);
+        RefineAlgorithm<NDIM>& fill_after_regrid_prolong_alg =
+            level_unchanged ? d_fill_unchanged_level_after_regrid_prolong_alg : d_fill_after_regrid_prolong_alg;
+        ComponentSelector fill_after_regrid_scratch_data = d_scratch_data;
+        fill_after_regrid_scratch_data.setOr(d_fill_after_regrid_bc_idxs);
+        level->allocatePatchData(fill_after_regrid_scratch_data, init_data_time);
         std::vector<RefinePatchStrategy<NDIM>*> fill_after_regrid_prolong_patch_strategies;
         CartExtrapPhysBdryOp fill_after_regrid_extrap_bc_op(d_fill_after_regrid_bc_idxs, d_bdry_extrap_type);
         fill_after_regrid_prolong_patch_strategies.push_back(&fill_after_regrid_extrap_bc_op);
@@ -776,10 +912,10 @@ HierarchyIntegrator::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM>
         RefinePatchStrategySet fill_after_regrid_patch_strategy_set(fill_after_regrid_prolong_patch_strategies.begin(),
                                                                     fill_after_regrid_prolong_patch_strategies.end(),
                                                                     false);
-        d_fill_after_regrid_prolong_alg
+        fill_after_regrid_prolong_alg
             .createSchedule(level, old_level, level_number - 1, hierarchy, &fill_after_regrid_patch_strategy_set)
             ->fillData(init_data_time);
-        level->deallocatePatchData(d_scratch_data);
+        level->deallocatePatchData(fill_after_regrid_scratch_data);
     }
 
     // Initialize level data at the initial time.
@@ -833,6 +969,31 @@ HierarchyIntegrator::initializeLevelData(const Pointer<BasePatchHierarchy<NDIM>
         (*it)->initializeLevelData(
             base_hierarchy, level_number, init_data_time, can_be_refined, initial_time, base_old_level, allocate_data);
     }
+
+    // Update the estimate of the per-cell cost of initializing changed levels
+    // and use it to estimate the time saved for unchanged levels.
+    //
+    // NOTE: These estimates are only available when the level initialization
+    // timer is active.
+    if (time_level_init)
+    {
+        IBTK_TIMER_STOP(t_initialize_level_data);
+        const double elapsed_time = t_initialize_level_data->getTotalWallclockTime() - level_init_start_time;
+        const BoxArray<NDIM>& boxes = level->getBoxes();
+        double num_cells = 0.0;
+        for (int i = 0; i < boxes.getNumberOfBoxes(); ++i)
+        {
+            num_cells += static_cast<double>(boxes[i].size());
+        }
+        if (level_unchanged)
+        {
+            accumulateRegridTimeSaved(std::max(d_regrid_fill_time_per_cell * num_cells - elapsed_time, 0.0));
+        }
+        else if (num_cells > 0.0)
+        {
+            d_regrid_fill_time_per_cell = elapsed_time / num_cells;
+        }
+    }
     return;
 } // initializeLevelData
 
@@ -1089,6 +1250,20 @@ HierarchyIntegrator::registerVariable(int& current_idx,
         d_fill_after_regrid_prolong_alg.registerRefine(current_idx, current_idx, scratch_idx, refine_operator);
     }
 
+    // Data that are not array-based are refilled from coarser levels even on
+    // levels that are unchanged by regridding.
+    if (is_array_data_variable<double>(variable) || is_array_data_variable<float>(variable) ||
+        is_array_data_variable<int>(variable))
+    {
+        d_copy_after_regrid_idxs.setFlag(current_idx);
+    }
+    else if (refine_operator)
+    {
+        d_fill_unchanged_level_after_regrid_prolong_alg.registerRefine(
+            current_idx, current_idx, scratch_idx, refine_operator);
+        d_fill_unchanged_level_after_regrid = true;
+    }
+
     // Setup the SYNCH_CURRENT_DATA and SYNCH_NEW_DATA algorithms, used to
     // synchronize the data on the hierarchy.
     if (coarsen_operator)
@@ -1141,6 +1316,88 @@ HierarchyIntegrator::registerVariable(int& idx,
     return;
 } // registerVariable
 
+void
+HierarchyIntegrator::writeTraceData() const
+{
+    TraceRecorder* trace_recorder = TraceRecorder::getManager();
+    if (!d_trace_file_name.empty()) trace_recorder->writeChromeTrace(d_trace_file_name);
+    if (!d_trace_summary_file_name.empty()) trace_recorder->writeStepSummary(d_trace_summary_file_name);
+    return;
+} // writeTraceData
+
+void
+HierarchyIntegrator::printPatchDataMemoryReport(std::ostream& os) const
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    ComponentSelector data_idxs;
+    data_idxs.setOr(d_current_data);
+    data_idxs.setOr(d_new_data);
+    data_idxs.setOr(d_scratch_data);
+    data_idxs.setOr(d_deferred_data);
+    double total_local_bytes = 0.0;
+    if (SAMRAI_MPI::getRank() == 0)
+    {
+        os << d_object_name << "::printPatchDataMemoryReport():\n";
+    }
+    for (int data_idx = 0; data_idx < data_idxs.getSize(); ++data_idx)
+    {
+        if (!data_idxs.isSet(data_idx)) continue;
+        const double local_bytes = get_local_patch_data_bytes(d_hierarchy, data_idx);
+        total_local_bytes += local_bytes;
+        const double sum_bytes = SAMRAI_MPI::sumReduction(local_bytes);
+        const double max_bytes = SAMRAI_MPI::maxReduction(local_bytes);
+        if (SAMRAI_MPI::getRank() != 0) continue;
+        Pointer<Variable<NDIM> > var;
+        Pointer<VariableContext> ctx;
+        var_db->mapIndexToVariableAndContext(data_idx, var, ctx);
+        const IntVector<NDIM>& ghosts =
+            var_db->getPatchDescriptor()->getPatchDataFactory(data_idx)->getGhostCellWidth();
+        os << "  " << std::setw(4) << data_idx << "  " << (var ? var->getName() : std::string("<unknown>")) << "::"
+           << (ctx ? ctx->getName() : std::string("<unknown>")) << "  ghosts = " << ghosts
+           << (d_deferred_data.isSet(data_idx) ? "  (deferred)" : "") << "\n";
+        os << "        local = " << local_bytes << " bytes, total = " << sum_bytes << " bytes, max = " << max_bytes
+           << " bytes\n";
+    }
+    const double sum_total_bytes = SAMRAI_MPI::sumReduction(total_local_bytes);
+    const double max_total_bytes = SAMRAI_MPI::maxReduction(total_local_bytes);
+
+    // The current, new, and scratch data are allocated for the duration of each
+    // time step.  Deferred data are allocated only while they are in use, so the
+    // peak time step memory is bounded by the time step data plus the largest
+    // amount of deferred data allocated at any one time.  Without deferral, all
+    // of the deferred data would be allocated along with the time step data.
+    ComponentSelector step_data_idxs;
+    step_data_idxs.setOr(d_current_data);
+    step_data_idxs.setOr(d_new_data);
+    step_data_idxs.setOr(d_scratch_data);
+    const double step_local_bytes = get_local_patch_data_bytes(d_hierarchy, step_data_idxs);
+    const double deferred_local_bytes = get_local_patch_data_bytes(d_hierarchy, d_deferred_data);
+    const double max_step_bytes = SAMRAI_MPI::maxReduction(step_local_bytes);
+    const double max_deferred_bytes = SAMRAI_MPI::maxReduction(deferred_local_bytes);
+    const double max_deferred_peak_bytes = SAMRAI_MPI::maxReduction(d_deferred_data_peak_local_bytes);
+    const double max_peak_bytes_without_deferral = SAMRAI_MPI::maxReduction(step_local_bytes + deferred_local_bytes);
+    const double max_peak_bytes_with_deferral =
+        SAMRAI_MPI::maxReduction(step_local_bytes + d_deferred_data_peak_local_bytes);
+    if (SAMRAI_MPI::getRank() == 0)
+    {
+        os << d_object_name << "::printPatchDataMemoryReport(): total = " << sum_total_bytes
+           << " bytes, max per process = " << max_total_bytes << " bytes\n";
+        os << "  max per process: time step data = " << max_step_bytes
+           << " bytes, deferred data = " << max_deferred_bytes
+           << " bytes, deferred data allocated at once since last regrid = " << max_deferred_peak_bytes
+           << " bytes\n";
+        os << "  max per process peak time step memory: without deferral = " << max_peak_bytes_without_deferral
+           << " bytes, with deferral = " << max_peak_bytes_with_deferral << " bytes\n";
+    }
+    for (std::set<HierarchyIntegrator*>::const_iterator it = d_child_integrators.begin();
+         it != d_child_integrators.end();
+         ++it)
+    {
+        (*it)->printPatchDataMemoryReport(os);
+    }
+    return;
+} // printPatchDataMemoryReport
+
 void
 HierarchyIntegrator::putToDatabase(Pointer<Database> db)
 {
@@ -1552,6 +1809,150 @@ HierarchyIntegrator::buildHierarchyMathOps(Pointer<PatchHierarchy<NDIM> > hierar
     return d_hier_math_ops;
 } // buildHierarchyMathOps
 
+void
+HierarchyIntegrator::regridPatchLevels()
+{
+    const int coarsest_ln = 0;
+    int num_passes = 0;
+    switch (d_regrid_mode)
+    {
+    case STANDARD:
+        num_passes = 1;
+        break;
+    case AGGRESSIVE:
+        num_passes = d_gridding_alg->getMaxLevels();
+        break;
+    default:
+        TBOX_ERROR(d_object_name << "::regridPatchLevels():\n"
+                                 << "  unrecognized regrid mode: " << enum_to_string<RegridMode>(d_regrid_mode) << "."
+                                 << std::endl);
+    }
+
+    // Regrid the hierarchy.  A level is treated as unchanged only if it is
+    // unchanged by every regridding pass.
+    const int old_finest_ln = d_hierarchy->getFinestLevelNumber();
+    const int max_levels = std::max(d_gridding_alg->getMaxLevels(), old_finest_ln + 1);
+    std::vector<bool> level_unchanged(max_levels, true);
+    d_regrid_time_saved = 0.0;
+    for (int k = 0; k < num_passes; ++k)
+    {
+        d_level_unchanged_by_regrid.assign(max_levels, false);
+        d_level_unchanged_by_regrid[coarsest_ln] = true;
+        d_gridding_alg->regridAllFinerLevels(d_hierarchy, coarsest_ln, d_integrator_time, d_tag_buffer);
+        for (int ln = 0; ln < max_levels; ++ln)
+        {
+            level_unchanged[ln] = level_unchanged[ln] && d_level_unchanged_by_regrid[ln];
+        }
+    }
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    d_hierarchy_unchanged_by_regrid = (finest_ln == old_finest_ln);
+    for (int ln = 0; ln < max_levels; ++ln)
+    {
+        d_level_unchanged_by_regrid[ln] = level_unchanged[ln] && ln <= finest_ln;
+        if (ln <= finest_ln) d_hierarchy_unchanged_by_regrid = d_hierarchy_unchanged_by_regrid && level_unchanged[ln];
+    }
+    return;
+} // regridPatchLevels
+
+bool
+HierarchyIntegrator::levelUnchangedByRegrid(const int level_number) const
+{
+    return level_number >= 0 && level_number < static_cast<int>(d_level_unchanged_by_regrid.size()) &&
+           d_level_unchanged_by_regrid[level_number];
+} // levelUnchangedByRegrid
+
+bool
+HierarchyIntegrator::hierarchyUnchangedByRegrid() const
+{
+    return d_hierarchy_unchanged_by_regrid;
+} // hierarchyUnchangedByRegrid
+
+bool
+HierarchyIntegrator::levelsHaveSameConfiguration(Pointer<PatchLevel<NDIM> > level, Pointer<PatchLevel<NDIM> > old_level)
+{
+    if (!level || !old_level) return false;
+    if (level->getRatio() != old_level->getRatio()) return false;
+    const BoxArray<NDIM>& boxes = level->getBoxes();
+    const BoxArray<NDIM>& old_boxes = old_level->getBoxes();
+    if (boxes.getNumberOfBoxes() != old_boxes.getNumberOfBoxes()) return false;
+    const ProcessorMapping& proc_mapping = level->getProcessorMapping();
+    const ProcessorMapping& old_proc_mapping = old_level->getProcessorMapping();
+    for (int i = 0; i < boxes.getNumberOfBoxes(); ++i)
+    {
+        if (!(boxes[i] == old_boxes[i])) return false;
+        if (proc_mapping.getProcessorAssignment(i) != old_proc_mapping.getProcessorAssignment(i)) return false;
+    }
+    return true;
+} // levelsHaveSameConfiguration
+
+void
+HierarchyIntegrator::accumulateRegridTimeSaved(const double time_saved)
+{
+    d_regrid_time_saved += time_saved;
+    d_total_regrid_time_saved += time_saved;
+    return;
+} // accumulateRegridTimeSaved
+
+void
+HierarchyIntegrator::logRegridSummary()
+{
+    if (!d_enable_logging) return;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    int num_unchanged_levels = 0;
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        if (levelUnchangedByRegrid(ln)) ++num_unchanged_levels;
+    }
+    plog << d_object_name << "::regridHierarchy(): " << num_unchanged_levels << " of " << finest_ln + 1
+         << " levels unchanged by regridding\n";
+    plog << d_object_name << "::regridHierarchy(): estimated time saved = " << d_regrid_time_saved
+         << " s (total = " << d_total_regrid_time_saved << " s)\n";
+    return;
+} // logRegridSummary
+
+void
+HierarchyIntegrator::deferPatchDataAllocation(const int data_idx)
+{
+    if (d_current_data.isSet(data_idx))
+    {
+        TBOX_ERROR(d_object_name << "::deferPatchDataAllocation():\n"
+                                 << "  current data cannot be deferred: patch data index " << data_idx << "\n");
+    }
+    d_scratch_data.clrFlag(data_idx);
+    d_new_data.clrFlag(data_idx);
+    d_deferred_data.setFlag(data_idx);
+    return;
+} // deferPatchDataAllocation
+
+void
+HierarchyIntegrator::allocateDeferredPatchData(const int data_idx, const double data_time)
+{
+    if (data_idx < 0) return;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_deferred_data.isSet(data_idx));
+#endif
+    allocatePatchData(data_idx, data_time);
+    d_deferred_data_allocated.setFlag(data_idx);
+    if (d_enable_memory_report)
+    {
+        d_deferred_data_peak_local_bytes = std::max(
+            d_deferred_data_peak_local_bytes, get_local_patch_data_bytes(d_hierarchy, d_deferred_data_allocated));
+    }
+    return;
+} // allocateDeferredPatchData
+
+void
+HierarchyIntegrator::deallocateDeferredPatchData(const int data_idx)
+{
+    if (data_idx < 0) return;
+#if !defined(NDEBUG)
+    TBOX_ASSERT(d_deferred_data.isSet(data_idx));
+#endif
+    deallocatePatchData(data_idx);
+    d_deferred_data_allocated.clrFlag(data_idx);
+    return;
+} // deallocateDeferredPatchData
+
 void
 HierarchyIntegrator::setupTagBuffer(Pointer<GriddingAlgorithm<NDIM> > gridding_alg)
 {
@@ -1592,6 +1993,14 @@ HierarchyIntegrator::getFromInput(Pointer<Database> db, bool is_from_restart)
     if (db->keyExists("regrid_interval")) d_regrid_interval = db->getInteger("regrid_interval");
     if (db->keyExists("regrid_mode")) d_regrid_mode = string_to_enum<RegridMode>(db->getString("regrid_mode"));
     if (db->keyExists("enable_logging")) d_enable_logging = db->getBool("enable_logging");
+    if (db->keyExists("enable_memory_report")) d_enable_memory_report = db->getBool("enable_memory_report");
+    if (db->keyExists("trace_file_name")) d_trace_file_name = db->getString("trace_file_name");
+    if (db->keyExists("trace_summary_file_name")) d_trace_summary_file_name = db->getString("trace_summary_file_name");
+    if (db->keyExists("trace_write_interval")) d_trace_write_interval = db->getInteger("trace_write_interval");
+    if (!d_trace_file_name.empty() || !d_trace_summary_file_name.empty())
+    {
+        TraceRecorder::getManager()->setEnabled(true);
+    }
     if (db->keyExists("bdry_extrap_type")) d_bdry_extrap_type = db->getString("bdry_extrap_type");
     if (db->keyExists("tag_buffer")) d_tag_buffer = db->getIntegerArray("tag_buffer");
     return;
@@ -1644,6 +2053,18 @@ HierarchyIntegrator::getFromRestart()
     return;
 } // getFromRestart
 
+void
+HierarchyIntegrator::resetDeferredPatchDataPeak()
+{
+    d_deferred_data_peak_local_bytes = 0.0;
+    for (std::set<HierarchyIntegrator*>::iterator it = d_child_integrators.begin(); it != d_child_integrators.end();
+         ++it)
+    {
+        (*it)->resetDeferredPatchDataPeak();
+    }
+    return;
+} // resetDeferredPatchDataPeak
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBTK
@@ -68,6 +68,7 @@
 #include "ibtk/LEInteractor.h"
 #include "ibtk/LMarker.h"
 #include "ibtk/LMarkerCoarsen.h"
+#include "ibtk/LMarkerPatchArrays.h"
 #include "ibtk/LMarkerRefine.h"
 #include "ibtk/LMarkerSet.h"
 #include "ibtk/LMarkerSetData.h"
@@ -276,10 +277,13 @@ LMarkerUtilities::eulerStep(const int mark_current_idx,
                             const std::string& weighting_fcn,
                             Pointer<PatchHierarchy<NDIM> > hierarchy,
                             const int coarsest_ln_in,
-                            const int finest_ln_in)
+                            const int finest_ln_in,
+                            const bool rebin_new_markers)
 {
     const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
     const int finest_ln = (finest_ln_in == -1 ? hierarchy->getFinestLevelNumber() : finest_ln_in);
+    LMarkerPatchArrays mark_current_arrays, mark_new_arrays;
+    std::vector<double> U_mark_current;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
@@ -295,16 +299,17 @@ LMarkerUtilities::eulerStep(const int mark_current_idx,
             Pointer<LMarkerSetData> mark_current_data = patch->getPatchData(mark_current_idx);
             Pointer<LMarkerSetData> mark_new_data = patch->getPatchData(mark_new_idx);
 
-            const unsigned int num_patch_marks = countMarkersOnPatch(mark_current_data);
+            // Gather the local markers at time n and at time n+1.
+            mark_current_arrays.gather(mark_current_data);
+            mark_new_arrays.gather(mark_new_data);
+            const unsigned int num_patch_marks = mark_current_arrays.getNumberOfMarkers();
 #if !defined(NDEBUG)
-            TBOX_ASSERT(num_patch_marks == countMarkersOnPatch(mark_new_data));
+            TBOX_ASSERT(num_patch_marks == mark_new_arrays.getNumberOfMarkers());
 #endif
-            // Collect the local marker positions at time n.
-            std::vector<double> X_mark_current;
-            collectMarkerPositionsOnPatch(X_mark_current, mark_current_data);
+            const std::vector<double>& X_mark_current = mark_current_arrays.getPositions();
 
             // Compute U_mark(n) = u(X_mark(n),n).
-            std::vector<double> U_mark_current(X_mark_current.size());
+            U_mark_current.resize(X_mark_current.size());
             if (is_cc_data)
                 LEInteractor::interpolate(
                     U_mark_current, NDIM, X_mark_current, NDIM, u_cc_current_data, patch, patch_box, weighting_fcn);
@@ -313,7 +318,7 @@ LMarkerUtilities::eulerStep(const int mark_current_idx,
                     U_mark_current, NDIM, X_mark_current, NDIM, u_sc_current_data, patch, patch_box, weighting_fcn);
 
             // Compute X_mark(n+1) = X_mark(n) + dt*U_mark(n).
-            std::vector<double> X_mark_new(X_mark_current.size());
+            std::vector<double>& X_mark_new = mark_new_arrays.getPositions();
             for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
             {
                 X_mark_new[k] = X_mark_current[k] + dt * U_mark_current[k];
@@ -325,8 +330,12 @@ LMarkerUtilities::eulerStep(const int mark_current_idx,
 
             // Store the local marker velocities at at time n, and the marker
             // positions at time n+1.
-            resetMarkerVelocitiesOnPatch(U_mark_current, mark_current_data);
-            resetMarkerPositionsOnPatch(X_mark_new, mark_new_data);
+            mark_current_arrays.scatterVelocities(U_mark_current);
+            mark_new_arrays.scatterPositions(X_mark_new);
+
+            // Reassign the markers to the cells that contain their positions at
+            // time n+1.
+            if (rebin_new_markers) mark_new_arrays.rebin(mark_new_data, patch);
         }
     }
     return;
@@ -344,6 +353,8 @@ LMarkerUtilities::midpointStep(const int mark_current_idx,
 {
     const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
     const int finest_ln = (finest_ln_in == -1 ? hierarchy->getFinestLevelNumber() : finest_ln_in);
+    LMarkerPatchArrays mark_current_arrays, mark_new_arrays;
+    std::vector<double> X_mark_half, U_mark_half;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
@@ -359,26 +370,26 @@ LMarkerUtilities::midpointStep(const int mark_current_idx,
             Pointer<LMarkerSetData> mark_current_data = patch->getPatchData(mark_current_idx);
             Pointer<LMarkerSetData> mark_new_data = patch->getPatchData(mark_new_idx);
 
-            const unsigned int num_patch_marks = countMarkersOnPatch(mark_current_data);
+            // Gather the local marker positions at time n and predicted marker
+            // positions at time n+1.
+            mark_current_arrays.gather(mark_current_data);
+            mark_new_arrays.gather(mark_new_data);
+            const unsigned int num_patch_marks = mark_current_arrays.getNumberOfMarkers();
 #if !defined(NDEBUG)
-            TBOX_ASSERT(num_patch_marks == countMarkersOnPatch(mark_new_data));
+            TBOX_ASSERT(mark_current_arrays.getMarkerIndices() == mark_new_arrays.getMarkerIndices());
 #endif
-            // Collect the local marker positions at time n and predicted marker
-            // positions at time n+1.
-            std::vector<double> X_mark_current;
-            collectMarkerPositionsOnPatch(X_mark_current, mark_current_data);
-            std::vector<double> X_mark_new;
-            collectMarkerPositionsOnPatch(X_mark_new, mark_new_data);
+            const std::vector<double>& X_mark_current = mark_current_arrays.getPositions();
+            std::vector<double>& X_mark_new = mark_new_arrays.getPositions();
 
             // Set X(n+1/2) = 0.5*(X(n)+X(n+1)).
-            std::vector<double> X_mark_half(NDIM * num_patch_marks);
+            X_mark_half.resize(NDIM * num_patch_marks);
             for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
             {
                 X_mark_half[k] = 0.5 * (X_mark_current[k] + X_mark_new[k]);
             }
 
             // Compute U_mark(n+1/) = u(X_mark(n+1/2),n+1/2).
-            std::vector<double> U_mark_half(X_mark_half.size());
+            U_mark_half.resize(X_mark_half.size());
             if (is_cc_data)
                 LEInteractor::interpolate(
                     U_mark_half, NDIM, X_mark_half, NDIM, u_cc_half_data, patch, patch_box, weighting_fcn);
@@ -397,7 +408,11 @@ LMarkerUtilities::midpointStep(const int mark_current_idx,
             preventMarkerEscape(X_mark_new, hierarchy->getGridGeometry());
 
             // Store the local marker positions at time n+1.
-            resetMarkerPositionsOnPatch(X_mark_new, mark_new_data);
+            mark_new_arrays.scatterPositions(X_mark_new);
+
+            // Reassign the markers to the cells that contain their positions at
+            // time n+1.
+            mark_new_arrays.rebin(mark_new_data, patch);
         }
     }
     return;
@@ -415,6 +430,8 @@ LMarkerUtilities::trapezoidalStep(const int mark_current_idx,
 {
     const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
     const int finest_ln = (finest_ln_in == -1 ? hierarchy->getFinestLevelNumber() : finest_ln_in);
+    LMarkerPatchArrays mark_current_arrays, mark_new_arrays;
+    std::vector<double> U_mark_new;
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
@@ -430,23 +447,20 @@ LMarkerUtilities::trapezoidalStep(const int mark_current_idx,
             Pointer<LMarkerSetData> mark_current_data = patch->getPatchData(mark_current_idx);
             Pointer<LMarkerSetData> mark_new_data = patch->getPatchData(mark_new_idx);
 
-            const unsigned int num_patch_marks = countMarkersOnPatch(mark_current_data);
+            // Gather the local marker positions and velocities at time n and
+            // predicted marker positions at time n+1.
+            mark_current_arrays.gather(mark_current_data, /*gather_velocities*/ true);
+            mark_new_arrays.gather(mark_new_data);
+            const unsigned int num_patch_marks = mark_current_arrays.getNumberOfMarkers();
 #if !defined(NDEBUG)
-            TBOX_ASSERT(num_patch_marks == countMarkersOnPatch(mark_new_data));
+            TBOX_ASSERT(mark_current_arrays.getMarkerIndices() == mark_new_arrays.getMarkerIndices());
 #endif
-            // Collect the local marker positions at time n and predicted marker
-            // positions at time n+1.
-            std::vector<double> X_mark_current;
-            collectMarkerPositionsOnPatch(X_mark_current, mark_current_data);
-            std::vector<double> X_mark_new;
-            collectMarkerPositionsOnPatch(X_mark_new, mark_new_data);
+            const std::vector<double>& X_mark_current = mark_current_arrays.getPositions();
+            const std::vector<double>& U_mark_current = mark_current_arrays.getVelocities();
+            std::vector<double>& X_mark_new = mark_new_arrays.getPositions();
 
-            // Collect the local marker velocities at time n.
-            std::vector<double> U_mark_current;
-            collectMarkerVelocitiesOnPatch(U_mark_current, mark_current_data);
-
-            // Compute U_mark(n+1/) = u(X_mark(n+1/2),n+1/2).
-            std::vector<double> U_mark_new(X_mark_new.size());
+            // Compute U_mark(n+1) = u(X_mark(n+1),n+1).
+            U_mark_new.resize(X_mark_new.size());
             if (is_cc_data)
                 LEInteractor::interpolate(
                     U_mark_new, NDIM, X_mark_new, NDIM, u_cc_new_data, patch, patch_box, weighting_fcn);
@@ -454,17 +468,11 @@ LMarkerUtilities::trapezoidalStep(const int mark_current_idx,
                 LEInteractor::interpolate(
                     U_mark_new, NDIM, X_mark_new, NDIM, u_sc_new_data, patch, patch_box, weighting_fcn);
 
-            // Set U(n+1/2) = 0.5*(U(n)+U(n+1)).
-            std::vector<double> U_mark_half(NDIM * num_patch_marks);
+            // Compute X_mark(n+1) = X_mark(n) + dt*U_mark(n+1/2), with
+            // U_mark(n+1/2) = 0.5*(U_mark(n)+U_mark(n+1)).
             for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
             {
-                U_mark_half[k] = 0.5 * (U_mark_current[k] + U_mark_new[k]);
-            }
-
-            // Compute X_mark(n+1) = X_mark(n) + dt*U_mark(n+1/2).
-            for (unsigned int k = 0; k < NDIM * num_patch_marks; ++k)
-            {
-                X_mark_new[k] = X_mark_current[k] + dt * U_mark_half[k];
+                X_mark_new[k] = X_mark_current[k] + 0.5 * dt * (U_mark_current[k] + U_mark_new[k]);
             }
 
             // Prevent markers from leaving the computational domain through
@@ -473,13 +481,40 @@ LMarkerUtilities::trapezoidalStep(const int mark_current_idx,
 
             // Store the local marker velocities at at time n, and the marker
             // positions at time n+1.
-            resetMarkerVelocitiesOnPatch(U_mark_new, mark_new_data);
-            resetMarkerPositionsOnPatch(X_mark_new, mark_new_data);
+            mark_new_arrays.scatterVelocities(U_mark_new);
+            mark_new_arrays.scatterPositions(X_mark_new);
+
+            // Reassign the markers to the cells that contain their positions at
+            // time n+1.
+            mark_new_arrays.rebin(mark_new_data, patch);
         }
     }
     return;
 } // trapezoidalStep
 
+void
+LMarkerUtilities::rebinMarkers(const int mark_idx,
+                               Pointer<PatchHierarchy<NDIM> > hierarchy,
+                               const int coarsest_ln_in,
+                               const int finest_ln_in)
+{
+    const int coarsest_ln = (coarsest_ln_in == -1 ? 0 : coarsest_ln_in);
+    const int finest_ln = (finest_ln_in == -1 ? hierarchy->getFinestLevelNumber() : finest_ln_in);
+    LMarkerPatchArrays mark_arrays;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<LMarkerSetData> mark_data = patch->getPatchData(mark_idx);
+            mark_arrays.gather(mark_data);
+            mark_arrays.rebin(mark_data, patch);
+        }
+    }
+    return;
+} // rebinMarkers
+
 void
 LMarkerUtilities::collectMarkersOnPatchHierarchy(const int mark_idx, Pointer<PatchHierarchy<NDIM> > hierarchy)
 {
@@ -795,76 +830,6 @@ LMarkerUtilities::countMarkersOnPatch(Pointer<LMarkerSetData> mark_data)
     return num_marks;
 } // countMarkersOnPatch
 
-void
-LMarkerUtilities::collectMarkerPositionsOnPatch(std::vector<double>& X_mark, Pointer<LMarkerSetData> mark_data)
-{
-    X_mark.resize(NDIM * countMarkersOnPatch(mark_data));
-    unsigned int k = 0;
-    for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getBox()); it != mark_data->data_end();
-         ++it, ++k)
-    {
-        const LMarkerSet::value_type& mark = *it;
-        const Point& X = mark->getPosition();
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            X_mark[NDIM * k + d] = X[d];
-        }
-    }
-    return;
-} // collectMarkerPositionsOnPatch
-
-void
-LMarkerUtilities::resetMarkerPositionsOnPatch(const std::vector<double>& X_mark, Pointer<LMarkerSetData> mark_data)
-{
-    unsigned int k = 0;
-    for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getBox()); it != mark_data->data_end();
-         ++it, ++k)
-    {
-        const LMarkerSet::value_type& mark = *it;
-        Point& X = mark->getPosition();
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            X[d] = X_mark[NDIM * k + d];
-        }
-    }
-    return;
-} // resetMarkerPositionsOnPatch
-
-void
-LMarkerUtilities::collectMarkerVelocitiesOnPatch(std::vector<double>& U_mark, Pointer<LMarkerSetData> mark_data)
-{
-    U_mark.resize(NDIM * countMarkersOnPatch(mark_data));
-    unsigned int k = 0;
-    for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getBox()); it != mark_data->data_end();
-         ++it, ++k)
-    {
-        const LMarkerSet::value_type& mark = *it;
-        const Vector& U = mark->getVelocity();
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            U_mark[NDIM * k + d] = U[d];
-        }
-    }
-    return;
-} // collectMarkerVelocitiesOnPatch
-
-void
-LMarkerUtilities::resetMarkerVelocitiesOnPatch(const std::vector<double>& U_mark, Pointer<LMarkerSetData> mark_data)
-{
-    unsigned int k = 0;
-    for (LMarkerSetData::DataIterator it = mark_data->data_begin(mark_data->getBox()); it != mark_data->data_end();
-         ++it, ++k)
-    {
-        const LMarkerSet::value_type& mark = *it;
-        Vector& U = mark->getVelocity();
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            U[d] = U_mark[NDIM * k + d];
-        }
-    }
-    return;
-} // resetMarkerVelocitiesOnPatch
-
 void
 LMarkerUtilities::preventMarkerEscape(std::vector<double>& X_mark, Pointer<CartesianGridGeometry<NDIM> > grid_geom)
 {
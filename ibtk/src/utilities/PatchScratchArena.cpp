@@ -0,0 +1,153 @@
+// Filename: PatchScratchArena.cpp
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <vector>
+
+#include "ibtk/PatchScratchArena.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "tbox/Arena.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+PatchScratchArena::PatchScratchArena() : d_buffer(), d_offset(0), d_high_water_mark(0), d_overflow()
+{
+    // intentionally blank
+    return;
+} // PatchScratchArena
+
+PatchScratchArena::~PatchScratchArena()
+{
+    clear();
+    return;
+} // ~PatchScratchArena
+
+void
+PatchScratchArena::reserve(const size_t bytes)
+{
+    reset();
+    if (bytes > getCapacity())
+    {
+        std::vector<double>(Arena::align(bytes) / sizeof(double) + 1).swap(d_buffer);
+    }
+    return;
+} // reserve
+
+void
+PatchScratchArena::reset()
+{
+    if (!d_overflow.empty())
+    {
+        for (std::vector<void*>::iterator it = d_overflow.begin(); it != d_overflow.end(); ++it)
+        {
+            ::free(*it);
+        }
+        d_overflow.clear();
+        if (d_high_water_mark > getCapacity())
+        {
+            std::vector<double>(Arena::align(d_high_water_mark) / sizeof(double) + 1).swap(d_buffer);
+        }
+    }
+    d_offset = 0;
+    return;
+} // reset
+
+void
+PatchScratchArena::clear()
+{
+    reset();
+    std::vector<double>().swap(d_buffer);
+    return;
+} // clear
+
+size_t
+PatchScratchArena::getCapacity() const
+{
+    return d_buffer.size() * sizeof(double);
+} // getCapacity
+
+size_t
+PatchScratchArena::getHighWaterMark() const
+{
+    return d_high_water_mark;
+} // getHighWaterMark
+
+void*
+PatchScratchArena::alloc(const size_t bytes)
+{
+    const size_t aligned_bytes = Arena::align(bytes);
+    const size_t new_offset = d_offset + aligned_bytes;
+    d_high_water_mark = std::max(d_high_water_mark, new_offset);
+    if (new_offset <= getCapacity())
+    {
+        void* p = reinterpret_cast<char*>(&d_buffer[0]) + d_offset;
+        d_offset = new_offset;
+        return p;
+    }
+    void* p = ::malloc(aligned_bytes);
+    if (!p)
+    {
+        TBOX_ERROR("PatchScratchArena::alloc():\n"
+                   << "  unable to allocate " << aligned_bytes << " bytes\n");
+    }
+    d_overflow.push_back(p);
+    d_offset = new_offset;
+    return p;
+} // alloc
+
+void
+PatchScratchArena::free(void* /*p*/)
+{
+    // intentionally blank
+    return;
+} // free
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
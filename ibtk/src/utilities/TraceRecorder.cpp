@@ -0,0 +1,414 @@
+// Filename: TraceRecorder.cpp
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <stddef.h>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ibtk/TraceRecorder.h"
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+#include "mpi.h"
+#include "tbox/Array.h"
+#include "tbox/Database.h"
+#include "tbox/Pointer.h"
+#include "tbox/SAMRAI_MPI.h"
+#include "tbox/ShutdownRegistry.h"
+#include "tbox/Timer.h"
+#include "tbox/Utilities.h"
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Default number of events retained per process.
+static const unsigned int DEFAULT_BUFFER_SIZE = 262144;
+
+// Default (timer name substring, phase name) rules.
+static const int NUM_DEFAULT_PHASE_RULES = 9;
+static const char* const DEFAULT_PHASE_RULES[NUM_DEFAULT_PHASE_RULES][2] = {
+    { "HierarchyGhostCellInterpolation::fillData", "ghost_fill" },
+    { "spread", "spread" },
+    { "interp", "interp" },
+    { "StaggeredStokes", "stokes_solve" },
+    { "[stokes_solve]", "stokes_solve" },
+    { "regrid", "regrid" },
+    { "writePlotData", "io" },
+    { "putToDatabase", "io" },
+    { "Restart", "io" }
+};
+
+inline std::string
+escape_json_string(const std::string& str)
+{
+    std::string escaped_str;
+    escaped_str.reserve(str.size());
+    for (std::string::const_iterator it = str.begin(); it != str.end(); ++it)
+    {
+        if (*it == '"' || *it == '\\') escaped_str.push_back('\\');
+        escaped_str.push_back(*it);
+    }
+    return escaped_str;
+} // escape_json_string
+}
+
+TraceRecorder* TraceRecorder::s_trace_recorder_instance = NULL;
+bool TraceRecorder::s_registered_callback = false;
+unsigned char TraceRecorder::s_shutdown_priority = 200;
+bool TraceRecorder::s_enabled = false;
+
+TraceRecorder*
+TraceRecorder::getManager()
+{
+    if (!s_trace_recorder_instance)
+    {
+        s_trace_recorder_instance = new TraceRecorder();
+    }
+    if (!s_registered_callback)
+    {
+        ShutdownRegistry::registerShutdownRoutine(freeManager, s_shutdown_priority);
+        s_registered_callback = true;
+    }
+    return s_trace_recorder_instance;
+} // getManager
+
+void
+TraceRecorder::freeManager()
+{
+    s_enabled = false;
+    delete s_trace_recorder_instance;
+    s_trace_recorder_instance = NULL;
+    return;
+} // freeManager
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+TraceRecorder::getFromInput(Pointer<Database> input_db)
+{
+    if (!input_db) return;
+    if (input_db->keyExists("buffer_size")) setBufferSize(input_db->getInteger("buffer_size"));
+    if (input_db->keyExists("phase_rules"))
+    {
+        const Array<std::string> phase_rules = input_db->getStringArray("phase_rules");
+        if (phase_rules.size() % 2 != 0)
+        {
+            TBOX_ERROR("TraceRecorder::getFromInput():\n"
+                       << "  phase_rules must consist of (timer name substring, phase name) pairs"
+                       << std::endl);
+        }
+        for (int k = 0; k < phase_rules.size(); k += 2)
+        {
+            if (phase_rules[k].empty() || phase_rules[k + 1].empty()) continue;
+            registerPhase(phase_rules[k], phase_rules[k + 1]);
+        }
+    }
+    if (input_db->keyExists("enable_tracing")) setEnabled(input_db->getBool("enable_tracing"));
+    return;
+} // getFromInput
+
+void
+TraceRecorder::setEnabled(const bool enabled)
+{
+#if !defined(IBTK_ENABLE_TRACING)
+    if (enabled)
+    {
+        TBOX_WARNING("TraceRecorder::setEnabled():\n"
+                     << "  IBTK was compiled without IBTK_ENABLE_TRACING; timers will not be traced"
+                     << std::endl);
+    }
+#endif
+    s_enabled = enabled;
+    return;
+} // setEnabled
+
+bool
+TraceRecorder::getEnabled() const
+{
+    return s_enabled;
+} // getEnabled
+
+void
+TraceRecorder::setBufferSize(const unsigned int buffer_size)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(buffer_size > 0);
+#endif
+    d_events.resize(buffer_size);
+    clear();
+    return;
+} // setBufferSize
+
+void
+TraceRecorder::setTimeStepNumber(const int time_step_num)
+{
+    d_time_step_num = time_step_num;
+    return;
+} // setTimeStepNumber
+
+void
+TraceRecorder::registerPhase(const std::string& timer_name_substring, const std::string& phase_name)
+{
+    d_phase_rules.push_back(std::make_pair(timer_name_substring, phase_name));
+    if (std::find(d_phase_names.begin(), d_phase_names.end(), phase_name) == d_phase_names.end())
+    {
+        d_phase_names.push_back(phase_name);
+    }
+    return;
+} // registerPhase
+
+void
+TraceRecorder::clear()
+{
+    d_next_event = 0;
+    d_num_events = 0;
+    return;
+} // clear
+
+void
+TraceRecorder::writeChromeTrace(const std::string& file_name) const
+{
+    const int rank = SAMRAI_MPI::getRank();
+    std::ostringstream rank_file_name;
+    rank_file_name << file_name << "." << std::setw(5) << std::setfill('0') << rank;
+    std::ofstream os(rank_file_name.str().c_str());
+    if (!os.good())
+    {
+        TBOX_ERROR("TraceRecorder::writeChromeTrace():\n"
+                   << "  unable to open file " << rank_file_name.str() << std::endl);
+    }
+    os.setf(std::ios_base::fixed);
+    os.precision(3);
+
+    // Match the begin and end events of each timer and output complete
+    // events.  Events whose matching begin or end events are not retained in
+    // the buffer are omitted.
+    std::map<const Timer*, std::vector<const TraceEvent*> > open_events;
+    std::map<const Timer*, int> phase_idxs;
+    bool first_event = true;
+    os << "{\"traceEvents\":[";
+    for (size_t k = 0; k < d_num_events; ++k)
+    {
+        const TraceEvent& event = getEvent(k);
+        std::vector<const TraceEvent*>& timer_open_events = open_events[event.timer];
+        if (event.is_begin)
+        {
+            timer_open_events.push_back(&event);
+            continue;
+        }
+        if (timer_open_events.empty()) continue;
+        const TraceEvent& begin_event = *timer_open_events.back();
+        timer_open_events.pop_back();
+        if (phase_idxs.find(event.timer) == phase_idxs.end()) phase_idxs[event.timer] = getPhaseIndex(event.timer);
+        const int phase_idx = phase_idxs[event.timer];
+        os << (first_event ? "\n" : ",\n") << "{\"name\":\"" << escape_json_string(event.timer->getName())
+           << "\",\"cat\":\"" << (phase_idx >= 0 ? d_phase_names[phase_idx] : std::string("other"))
+           << "\",\"ph\":\"X\",\"ts\":" << 1.0e6 * (begin_event.time - d_start_time)
+           << ",\"dur\":" << 1.0e6 * (event.time - begin_event.time) << ",\"pid\":" << rank
+           << ",\"tid\":0,\"args\":{\"step\":" << begin_event.time_step_num << "}}";
+        first_event = false;
+    }
+    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return;
+} // writeChromeTrace
+
+void
+TraceRecorder::writeStepSummary(const std::string& file_name) const
+{
+    // Accumulate the time spent in each phase of each time step.  The time
+    // spent in a phase is measured from the beginning of the outermost timed
+    // region associated with that phase, so that nested timers are not
+    // counted more than once.
+    const int num_phases = static_cast<int>(d_phase_names.size());
+    std::map<const Timer*, int> phase_idxs;
+    std::vector<int> phase_depth(num_phases, 0), phase_step(num_phases, 0);
+    std::vector<double> phase_start(num_phases, 0.0);
+    std::map<int, std::vector<double> > step_phase_times;
+    for (size_t k = 0; k < d_num_events; ++k)
+    {
+        const TraceEvent& event = getEvent(k);
+        if (phase_idxs.find(event.timer) == phase_idxs.end()) phase_idxs[event.timer] = getPhaseIndex(event.timer);
+        const int phase_idx = phase_idxs[event.timer];
+        if (phase_idx < 0) continue;
+        if (event.is_begin)
+        {
+            if (phase_depth[phase_idx]++ == 0)
+            {
+                phase_start[phase_idx] = event.time;
+                phase_step[phase_idx] = event.time_step_num;
+            }
+        }
+        else if (phase_depth[phase_idx] > 0 && --phase_depth[phase_idx] == 0)
+        {
+            std::vector<double>& phase_times = step_phase_times[phase_step[phase_idx]];
+            phase_times.resize(num_phases, 0.0);
+            phase_times[phase_idx] += event.time - phase_start[phase_idx];
+        }
+    }
+
+    // Determine the range of time steps that are available on all processes.
+    const bool have_steps = !step_phase_times.empty();
+    const int first_step = SAMRAI_MPI::maxReduction(
+        have_steps ? step_phase_times.begin()->first : std::numeric_limits<int>::max());
+    const int last_step = SAMRAI_MPI::minReduction(
+        have_steps ? step_phase_times.rbegin()->first : std::numeric_limits<int>::min());
+    const int num_steps = last_step >= first_step ? last_step - first_step + 1 : 0;
+
+    // Compute statistics across all processes.
+    std::vector<double> min_times(num_steps * num_phases, 0.0), max_times, avg_times;
+    for (int step = first_step; step <= last_step; ++step)
+    {
+        std::map<int, std::vector<double> >::const_iterator it = step_phase_times.find(step);
+        if (it == step_phase_times.end()) continue;
+        std::copy(it->second.begin(), it->second.end(), min_times.begin() + (step - first_step) * num_phases);
+    }
+    max_times = min_times;
+    avg_times = min_times;
+    if (num_steps > 0)
+    {
+        SAMRAI_MPI::minReduction(&min_times[0], num_steps * num_phases);
+        SAMRAI_MPI::maxReduction(&max_times[0], num_steps * num_phases);
+        SAMRAI_MPI::sumReduction(&avg_times[0], num_steps * num_phases);
+    }
+    const int num_procs = SAMRAI_MPI::getNodes();
+    if (SAMRAI_MPI::getRank() != 0) return;
+
+    std::ofstream os(file_name.c_str());
+    if (!os.good())
+    {
+        TBOX_ERROR("TraceRecorder::writeStepSummary():\n"
+                   << "  unable to open file " << file_name << std::endl);
+    }
+    os.setf(std::ios_base::scientific);
+    os.precision(6);
+    os << "step,phase,min_time,max_time,avg_time,imbalance\n";
+    for (int n = 0; n < num_steps; ++n)
+    {
+        for (int phase_idx = 0; phase_idx < num_phases; ++phase_idx)
+        {
+            const int k = n * num_phases + phase_idx;
+            const double avg_time = avg_times[k] / static_cast<double>(num_procs);
+            if (max_times[k] == 0.0) continue;
+            os << first_step + n << "," << d_phase_names[phase_idx] << "," << min_times[k] << "," << max_times[k]
+               << "," << avg_time << "," << max_times[k] / avg_time << "\n";
+        }
+    }
+    return;
+} // writeStepSummary
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+TraceRecorder::TraceRecorder()
+    : d_events(DEFAULT_BUFFER_SIZE),
+      d_next_event(0),
+      d_num_events(0),
+      d_start_time(MPI_Wtime()),
+      d_time_step_num(0),
+      d_phase_rules(),
+      d_phase_names()
+{
+    for (int k = 0; k < NUM_DEFAULT_PHASE_RULES; ++k)
+    {
+        const std::string phase_name = DEFAULT_PHASE_RULES[k][1];
+        if (std::find(d_phase_names.begin(), d_phase_names.end(), phase_name) == d_phase_names.end())
+        {
+            d_phase_names.push_back(phase_name);
+        }
+    }
+    return;
+} // TraceRecorder
+
+TraceRecorder::~TraceRecorder()
+{
+    // intentionally blank
+    return;
+} // ~TraceRecorder
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+TraceRecorder::recordEvent(const Timer* const timer, const bool is_begin)
+{
+    TraceEvent& event = d_events[d_next_event];
+    event.timer = timer;
+    event.time = MPI_Wtime();
+    event.time_step_num = d_time_step_num;
+    event.is_begin = is_begin;
+    if (++d_next_event == d_events.size()) d_next_event = 0;
+    if (d_num_events < d_events.size()) ++d_num_events;
+    return;
+} // recordEvent
+
+int
+TraceRecorder::getPhaseIndex(const Timer* const timer) const
+{
+    const std::string& timer_name = timer->getName();
+    std::string phase_name;
+    for (std::vector<std::pair<std::string, std::string> >::const_iterator it = d_phase_rules.begin();
+         it != d_phase_rules.end() && phase_name.empty();
+         ++it)
+    {
+        if (timer_name.find(it->first) != std::string::npos) phase_name = it->second;
+    }
+    for (int k = 0; k < NUM_DEFAULT_PHASE_RULES && phase_name.empty(); ++k)
+    {
+        if (timer_name.find(DEFAULT_PHASE_RULES[k][0]) != std::string::npos) phase_name = DEFAULT_PHASE_RULES[k][1];
+    }
+    if (phase_name.empty()) return -1;
+    return static_cast<int>(std::find(d_phase_names.begin(), d_phase_names.end(), phase_name) -
+                            d_phase_names.begin());
+} // getPhaseIndex
+
+const TraceRecorder::TraceEvent&
+TraceRecorder::getEvent(const size_t k) const
+{
+    const size_t first_event = d_num_events < d_events.size() ? 0 : d_next_event;
+    return d_events[(first_event + k) % d_events.size()];
+} // getEvent
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -38,6 +38,7 @@
 #include <string>
 #include <vector>
 
+#include "CellDataFactory.h"
 #include "CellVariable.h"
 #include "CoarsenAlgorithm.h"
 #include "FaceVariable.h"
@@ -47,6 +48,7 @@
 #include "RefinePatchStrategy.h"
 #include "ibamr/ConvectiveOperator.h"
 #include "ibamr/ibamr_enums.h"
+#include "ibtk/PatchScratchArena.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
@@ -216,6 +218,11 @@ private:
     int d_Q_scratch_idx;
     SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceVariable<NDIM, double> > d_q_extrap_var, d_q_flux_var;
     int d_q_extrap_idx, d_q_flux_idx;
+
+    // Patch-local temporary data, which are allocated from a reusable arena
+    // that is sized in initializeOperatorState().
+    SAMRAI::tbox::Pointer<IBTK::PatchScratchArena> d_scratch_arena;
+    SAMRAI::tbox::Pointer<SAMRAI::pdat::CellDataFactory<NDIM, double> > d_cell_scratch_factory;
 };
 } // namespace IBAMR
 
@@ -77,6 +77,12 @@ namespace IBAMR
 /*!
  * \brief Class AdvDiffStochasticForcing provides an interface for specifying a
  * stochastic forcing term for cell-centered advection-diffusion solver solver.
+ *
+ * Setting the input database key \p use_counter_based_rng to \p TRUE draws
+ * the random flux components from a counter-based generator keyed on (\p
+ * rng_seed, integrator step, level number, random value number, side axis,
+ * index), so that the generated noise is independent of the parallel
+ * decomposition.
  */
 class AdvDiffStochasticForcing : public IBTK::CartGridFunction
 {
@@ -189,6 +195,12 @@ private:
     int d_num_rand_vals;
     std::vector<SAMRAI::tbox::Array<double> > d_weights;
 
+    /*!
+     * Random number generator configuration.
+     */
+    bool d_use_counter_based_rng;
+    int d_rng_seed;
+
     /*!
      * Boundary condition scalings.
      */
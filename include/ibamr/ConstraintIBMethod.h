@@ -37,6 +37,7 @@
 
 #include <fstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Eigen/Dense"
@@ -53,6 +54,12 @@
 #include "ibtk/PETScKrylovPoissonSolver.h"
 #include "tbox/Pointer.h"
 
+namespace IBTK
+{
+class LMesh;
+class LNode;
+} // namespace IBTK
+
 namespace IBAMR
 {
 /*!
@@ -271,10 +278,11 @@ private:
     void calculateKinematicsVelocity();
 
     /*!
-     * \brief Calculate momentum of kinematics velocity. This is extraneous momentum
-     * that needs to be subtracted from the kinematics velocity.
+     * \brief Calculate momentum of kinematics velocity of all self-translating
+     * structures. This is extraneous momentum that needs to be subtracted from
+     * the kinematics velocity.
      */
-    void calculateMomentumOfKinematicsVelocity(const int position_handle);
+    void calculateMomentumOfKinematicsVelocity();
 
     /*!
      * \brief Calculate volume element associated with material points.
@@ -387,6 +395,24 @@ private:
      */
     void calculateStructureRotationalMomentum();
 
+    /*!
+     * Local Lagrangian nodes of the structures on a single level, grouped by
+     * structure handle (i.e., position in d_ib_kinematics).
+     */
+    struct StructureNodeBucket
+    {
+        SAMRAI::tbox::Pointer<IBTK::LMesh> mesh;
+        std::vector<int> struct_handles;
+        std::vector<std::pair<int, int> > lag_idx_ranges;
+        std::vector<std::vector<IBTK::LNode*> > local_nodes;
+    };
+
+    /*!
+     * \brief Get the local nodes of the structures on a level.  The bucket is
+     * rebuilt only when the Lagrangian mesh of the level has changed.
+     */
+    const StructureNodeBucket& getStructureNodeBucket(int ln);
+
     /*!
      * No of immersed structures.
      */
@@ -397,6 +423,11 @@ private:
      */
     std::vector<SAMRAI::tbox::Pointer<IBAMR::ConstraintIBKinematics> > d_ib_kinematics;
 
+    /*!
+     * Per-level buckets of the local nodes of each structure.
+     */
+    std::vector<StructureNodeBucket> d_struct_node_buckets;
+
     /*!
      * FuRMoRP apply time.
      */
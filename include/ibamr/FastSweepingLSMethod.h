@@ -69,6 +69,26 @@ namespace IBAMR
  * equation \f$ |\nabla Q | = 1 \f$, which produces the signed distance away from an
  * interface.
  *
+ * \note If <tt>use_narrow_band</tt> is set in the input database, the distance
+ * function is only computed within <tt>narrow_band_width</tt> grid cells of the
+ * interface.  Each patch keeps an explicit list of its band cells, and sweeps
+ * visit only these cells and their immediate neighbors, so that the cost of an
+ * iteration is proportional to the size of the band rather than to the size of
+ * the patch.  Convergence is checked only on band cells.  Values outside the
+ * band are left as set by the interface neighborhood locating functions, so
+ * distances to physical boundary walls are only computed within the band.
+ *
+ * \note If <tt>use_patch_scheduling</tt> is set in the input database, each
+ * patch carries a local convergence flag and is swept again only when its
+ * ghost cell values change.  The global termination check reduces the number of
+ * unconverged patches once every <tt>termination_check_interval</tt>
+ * iterations (default 4) instead of computing a hierarchy-wide norm each
+ * iteration, so up to <tt>termination_check_interval - 1</tt> extra iterations
+ * may be carried out after convergence.  This mode reduces the sweeping work and
+ * the number of global reductions only: ghost cell values are still exchanged
+ * for every patch of the hierarchy at each iteration, so the communication
+ * volume of a ghost cell fill is unchanged.
+ *
  * \note The class can also compute distance function from physical domain boundary if
  * specified through input file. In presence of a physical domain wall, the distance function
  * at a grid point is D = min(distance from interface, distance from wall location).
@@ -104,6 +124,8 @@ protected:
     // Algorithm parameters.
     bool d_consider_phys_bdry_wall;
     int d_wall_location_idx[2 * NDIM];
+    bool d_use_patch_scheduling;
+    int d_termination_check_interval;
 
 private:
     /*!
@@ -112,11 +134,46 @@ private:
     void fastSweep(SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops, int dist_idx) const;
 
     /*!
-     * \brief Do one fast sweep over a patch.
+     * \brief Do one fast sweep over the narrow band cells of the hierarchy and
+     * return the L2-norm of the change on narrow band cells.
+     */
+    double fastSweepNarrowBand(SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops,
+                               int dist_idx,
+                               int dist_iter_idx,
+                               int wgt_idx,
+                               std::vector<std::vector<NarrowBand> >& bands,
+                               int& num_band_patches) const;
+
+    /*!
+     * \brief Sweep only those patches that are not locally converged or whose
+     * ghost cell values have changed since they were last swept.  Returns the
+     * number of local patches that changed by more than the absolute tolerance.
+     * If the narrow band is used, only the narrow band cells of each patch are
+     * swept.
+     */
+    int fastSweepScheduled(SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops,
+                           int dist_idx,
+                           int dist_iter_idx,
+                           std::vector<std::vector<bool> >& patch_converged,
+                           std::vector<std::vector<NarrowBand> >& bands,
+                           int& num_swept_patches) const;
+
+    /*!
+     * \brief Check whether the ghost cell values of a patch differ from those
+     * stored when the patch was last swept.
+     */
+    bool ghostDataChanged(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dist_data,
+                          SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dist_iter_data,
+                          const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch) const;
+
+    /*!
+     * \brief Do one fast sweep over a patch, or only over the cells collected
+     * from the narrow band of the patch if \p band is non-NULL.
      */
     void fastSweep(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dist_data,
                    const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-                   const SAMRAI::hier::Box<NDIM>& domain_box) const;
+                   const SAMRAI::hier::Box<NDIM>& domain_box,
+                   const NarrowBand* band = NULL) const;
 
     /*!
      * Read input values from a given database.
@@ -124,6 +124,40 @@ public:
     void initializeHierarchyIntegrator(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                        SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > gridding_alg);
 
+    /*!
+     * Set the number of Lagrangian substeps to take per fluid time step.
+     *
+     * When the number of substeps K is greater than one, the structure is
+     * advanced by K forward Euler substeps of size dt/K per fluid time step.
+     * Prior to the fluid solve, the structure is provisionally advanced using
+     * the current fluid velocity, and the force spread to the Eulerian grid is
+     * the average of the forces evaluated at the start of each substep.  After
+     * the fluid solve, the structure is re-advanced from its current position
+     * using the fluid velocity linearly interpolated in time to the midpoint
+     * of each substep.
+     *
+     * Substepping is intended for structure models whose Lagrangian state has
+     * its own explicit stability limit, such as the penalty masses of
+     * PenaltyIBMethod.  When the natural frequency of the penalty springs
+     * that attach the massive points to the structure is much larger than
+     * that of the coupled fluid-structure system, the fluid time step may be
+     * increased by up to a factor of K relative to the single-step scheme.  For a massless structure that moves with the fluid
+     * (e.g., IBMethod), the time step restriction comes from the elastic force
+     * acting on the fluid, and substepping does not increase the stable time
+     * step size.
+     *
+     * \note Multirate substepping is presently supported only with the
+     * FORWARD_EULER time stepping type and a single cycle per time step, and
+     * requires an IBStrategy that implements initializeLagrangianSubsteps()
+     * and forwardEulerSubstep().
+     */
+    void setNumberOfLagrangianSubsteps(int num_lagrangian_substeps);
+
+    /*!
+     * Get the number of Lagrangian substeps to take per fluid time step.
+     */
+    int getNumberOfLagrangianSubsteps() const;
+
 protected:
     /*!
      * Write out specialized object state to the given database.
@@ -163,6 +197,24 @@ private:
      * members.
      */
     void getFromRestart();
+
+    /*!
+     * Compute the time-averaged Lagrangian force over a sequence of
+     * provisional Lagrangian substeps and spread it to the Eulerian grid.
+     */
+    void spreadMultirateLagrangianForce(double current_time, double new_time);
+
+    /*!
+     * Advance the Lagrangian structure over a sequence of substeps using the
+     * Eulerian velocity interpolated in time between the current and new
+     * times.
+     */
+    void performMultirateLagrangianSubsteps(double current_time, double new_time);
+
+    /*!
+     * The number of Lagrangian substeps to take per fluid time step.
+     */
+    int d_num_lagrangian_substeps;
 };
 } // namespace IBAMR
 
@@ -504,6 +504,14 @@ public:
 
     /*!
      * Write the equation_systems data to a restart file in the specified directory.
+     *
+     * By default, the data are written in libMesh's partition-agnostic format,
+     * which serializes each system through a single stream.  If the input
+     * database sets libmesh_partitioned_restart to TRUE, only the system
+     * definitions are written in that format, and each process writes its
+     * locally owned degrees of freedom to a separate binary file keyed by
+     * node/element id, variable, and component.  Partitioned restart data may
+     * be read using any number of processes, but require a replicated mesh.
      */
     void writeFEDataToRestartFile(const std::string& restart_dump_dirname, unsigned int time_step_number);
 
@@ -665,6 +673,12 @@ protected:
      */
     std::string d_libmesh_restart_file_extension;
 
+    /*
+     * Whether libMesh equation systems data are written to (or were read from)
+     * per-process partitioned restart files.
+     */
+    bool d_libmesh_partitioned_restart, d_libmesh_restart_read_partitioned;
+
 private:
     /*!
      * \brief Default constructor.
@@ -217,6 +217,12 @@ private:
      */
     void outputLogData(std::ostream& os);
 
+    /*!
+     * Sort the web patch and web centroid mappings into per-patch buckets for
+     * the local patches of the hierarchy.
+     */
+    void buildWebPatchBuckets(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy);
+
     /*
      * The object name is used for error reporting purposes.
      */
@@ -279,6 +285,26 @@ private:
     typedef std::multimap<SAMRAI::hier::Index<NDIM>, WebCentroid, IndexFortranOrder> WebCentroidMap;
     std::vector<WebCentroidMap> d_web_centroid_map;
 
+    /*!
+     * \brief Per-patch buckets of the web patches and web centroids that are
+     * assigned to cells of each local patch, indexed by level number and then
+     * by patch number.
+     *
+     * The buckets are rebuilt from the cell index mappings whenever the
+     * hierarchy-dependent data are reinitialized, so that reading the
+     * instrument data only visits the cells that actually hold meter web
+     * points.  Entries within each bucket are stored in cell index order.
+     */
+    struct WebPatchBucket
+    {
+        std::vector<SAMRAI::hier::Index<NDIM> > web_patch_idx;
+        std::vector<WebPatch> web_patch;
+        std::vector<SAMRAI::hier::Index<NDIM> > web_centroid_idx;
+        std::vector<WebCentroid> web_centroid;
+    };
+
+    std::vector<std::vector<WebPatchBucket> > d_web_patch_buckets;
+
     /*
      * The directory where data is to be dumped and the most recent timestep
      * number at which data was dumped.
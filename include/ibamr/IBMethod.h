@@ -65,6 +65,7 @@ namespace IBTK
 {
 class LData;
 class LDataManager;
+class LEOperatorCache;
 } // namespace IBTK
 namespace SAMRAI
 {
@@ -250,6 +251,24 @@ public:
      */
     void backwardEulerStep(double current_time, double new_time);
 
+    /*!
+     * Reset the new positions of the Lagrangian structure to equal the current
+     * positions.
+     */
+    void initializeLagrangianSubsteps(double current_time, double new_time);
+
+    /*!
+     * Advance the new positions of the Lagrangian structure by a forward Euler
+     * substep using the velocity at the new time.
+     *
+     * \note The structure is massless and moves with the interpolated fluid
+     * velocity, so substepping it does not relax the time step restriction
+     * imposed by stiff elastic forces, which act on the fluid.  Subclasses
+     * whose structures have their own inertia (e.g., PenaltyIBMethod) extend
+     * this function to advance that additional state.
+     */
+    void forwardEulerSubstep(double current_time, double new_time, double substep_dt);
+
     /*!
      * Advance the positions of the Lagrangian structure using the midpoint rule.
      */
@@ -669,6 +688,13 @@ private:
     bool d_force_jac_mffd;
     Mat d_force_jac;
     double d_force_jac_data_time;
+
+    /*!
+     * Assembled Lagrangian-Eulerian coupling operators that are reused while
+     * the coupling operators are held fixed.
+     */
+    bool d_use_assembled_coupling_ops;
+    SAMRAI::tbox::Pointer<IBTK::LEOperatorCache> d_le_op_cache;
 };
 } // namespace IBAMR
 
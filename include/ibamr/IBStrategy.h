@@ -228,6 +228,32 @@ public:
      */
     virtual void backwardEulerStep(double current_time, double new_time);
 
+    /*!
+     * Reset the new positions of the Lagrangian structure, and any other
+     * time-dependent Lagrangian state that is advanced by forwardEulerSubstep(),
+     * to equal their current values, in preparation for a sequence of calls to
+     * forwardEulerSubstep().
+     *
+     * A default implementation is provided that emits an unrecoverable
+     * exception.
+     */
+    virtual void initializeLagrangianSubsteps(double current_time, double new_time);
+
+    /*!
+     * Advance the new positions of the Lagrangian structure by a forward Euler
+     * substep of size \a substep_dt, i.e., X(new) := X(new) + substep_dt U(new),
+     * in which U(new) is the most recently interpolated velocity at the new
+     * time.  The positions at the midpoint of the time interval are reset to
+     * be consistent with the updated new positions.  Implementations that
+     * carry additional Lagrangian state, such as the massive points of the
+     * penalty IB method, also advance that state by a substep of size \a
+     * substep_dt.
+     *
+     * A default implementation is provided that emits an unrecoverable
+     * exception.
+     */
+    virtual void forwardEulerSubstep(double current_time, double new_time, double substep_dt);
+
     /*!
      * Advance the positions of the Lagrangian structure using the (explicit)
      * midpoint rule.
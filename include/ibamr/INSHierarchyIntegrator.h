@@ -513,6 +513,12 @@ protected:
 
     /*!
      * Hierarchy operators and solvers and related configuration data.
+     *
+     * The reset level range records the levels that have been changed since
+     * the solvers were last initialized, or is (-1,-1) when no levels have been
+     * changed.  When the coarsest reset level is finer than the coarsest level
+     * of the hierarchy, solvers only need to rebuild data associated with the
+     * reset levels.
      */
     int d_coarsest_reset_ln, d_finest_reset_ln;
 
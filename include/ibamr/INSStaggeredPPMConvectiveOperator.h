@@ -38,13 +38,16 @@
 #include <string>
 #include <vector>
 
+#include "FaceDataFactory.h"
 #include "IntVector.h"
 #include "PatchHierarchy.h"
+#include "SideDataFactory.h"
 #include "SideVariable.h"
 #include "ibamr/ConvectiveOperator.h"
 #include "ibamr/StaggeredStokesPhysicalBoundaryHelper.h"
 #include "ibamr/ibamr_enums.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/PatchScratchArena.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
@@ -202,6 +205,12 @@ private:
     // Scratch data.
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_U_var;
     int d_U_scratch_idx;
+
+    // Patch-local temporary data, which are allocated from a reusable arena
+    // that is sized in initializeOperatorState().
+    SAMRAI::tbox::Pointer<IBTK::PatchScratchArena> d_scratch_arena;
+    SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceDataFactory<NDIM, double> > d_face_scratch_factory;
+    SAMRAI::tbox::Pointer<SAMRAI::pdat::SideDataFactory<NDIM, double> > d_side_scratch_factory;
 };
 } // namespace IBAMR
 
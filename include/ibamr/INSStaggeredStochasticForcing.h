@@ -78,6 +78,15 @@ namespace IBAMR
  * \brief Class INSStaggeredStochasticForcing provides an interface for
  * specifying a stochastic forcing term for a staggered-grid incompressible
  * Navier-Stokes solver.
+ *
+ * By default, the random stress components are drawn from the process-local
+ * Mersenne Twister generator provided by class RNG, so that the generated
+ * noise depends on the number of MPI processes and on the patch layout.
+ * Setting the input database key \p use_counter_based_rng to \p TRUE instead
+ * draws the random values from a counter-based generator keyed on (\p
+ * rng_seed, integrator step, level number, random value number, data centering,
+ * index), which yields bitwise-identical stochastic forcing for any
+ * partitioning of the patch hierarchy.
  */
 class INSStaggeredStochasticForcing : public IBTK::CartGridFunction
 {
@@ -184,6 +193,12 @@ private:
     int d_num_rand_vals;
     std::vector<SAMRAI::tbox::Array<double> > d_weights;
 
+    /*!
+     * Random number generator configuration.
+     */
+    bool d_use_counter_based_rng;
+    int d_rng_seed;
+
     /*!
      * Boundary condition scalings.
      */
@@ -38,6 +38,7 @@
 #include <string>
 #include <vector>
 
+#include "FaceDataFactory.h"
 #include "IntVector.h"
 #include "PatchHierarchy.h"
 #include "SideVariable.h"
@@ -45,6 +46,7 @@
 #include "ibamr/StaggeredStokesPhysicalBoundaryHelper.h"
 #include "ibamr/ibamr_enums.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/PatchScratchArena.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 
@@ -198,6 +200,11 @@ private:
     // Scratch data.
     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > d_U_var;
     int d_U_scratch_idx;
+
+    // Patch-local temporary data, which are allocated from a reusable arena
+    // that is sized in initializeOperatorState().
+    SAMRAI::tbox::Pointer<IBTK::PatchScratchArena> d_scratch_arena;
+    SAMRAI::tbox::Pointer<SAMRAI::pdat::FaceDataFactory<NDIM, double> > d_face_scratch_factory;
 };
 } // namespace IBAMR
 
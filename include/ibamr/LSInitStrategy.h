@@ -38,6 +38,7 @@
 #include <string>
 #include <vector>
 
+#include "Box.h"
 #include "ibamr/ibamr_enums.h"
 #include "tbox/Pointer.h"
 #include "tbox/Serializable.h"
@@ -53,12 +54,19 @@ namespace hier
 template <int DIM>
 class BasePatchLevel;
 template <int DIM>
+class Patch;
+template <int DIM>
 class PatchHierarchy;
 template <int DIM>
 class Variable;
 template <int DIM>
 class BasePatchHierarchy;
 } // namespace hier
+namespace pdat
+{
+template <int DIM, class TYPE>
+class CellData;
+} // namespace pdat
 namespace solv
 {
 template <int DIM>
@@ -126,6 +134,81 @@ public:
     void putToDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
 protected:
+    /*!
+     * \brief Per-patch narrow band data.
+     *
+     * The narrow band of a patch consists of the patch cells that satisfy
+     * \f$ |D| \le w h \f$, where \f$ w \f$ is the narrow band width in grid
+     * cells and \f$ h \f$ is the largest grid spacing of the patch.  Cells are
+     * never removed from the band once they have entered it.  Each pass over
+     * the band updates the band cells together with the neighboring cells that
+     * could enter the band, i.e., the patch cells that are adjacent to a band
+     * cell or to a ghost cell that satisfies the band criterion.  Only the
+     * initialization of the band visits every cell of the patch.
+     *
+     * The cells updated by a pass are stored in Fortran order as NDIM indices
+     * per cell, grouped into rows of cells that differ only in their first
+     * index (row r consists of cells row_ptr[r],...,row_ptr[r+1]-1) and, in 3D,
+     * into planes of rows with the same last index (plane p consists of rows
+     * plane_ptr[p],...,plane_ptr[p+1]-1).
+     */
+    struct NarrowBand
+    {
+        SAMRAI::hier::Box<NDIM> patch_box;
+        double band_width;
+        std::vector<unsigned char> in_band;
+        std::vector<int> band_offsets;
+        std::vector<int> pass_stamp, iteration_stamp;
+        int pass_num, iteration_num;
+        std::vector<int> active_offsets, touched_offsets;
+        std::vector<int> cells, row_ptr, plane_ptr;
+    };
+
+    /*!
+     * \brief Initialize the narrow band of a patch from the current values of
+     * the level set.
+     */
+    void initializeNarrowBand(NarrowBand& band,
+                              SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > D_data,
+                              SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch) const;
+
+    /*!
+     * \brief Begin a new iteration over the narrow band.
+     */
+    void beginNarrowBandIteration(NarrowBand& band) const;
+
+    /*!
+     * \brief Collect the cells to be updated by the next pass over the narrow
+     * band, and store the values of cells that have not yet been updated during
+     * the current iteration in \p D_old_data.
+     *
+     * \return Whether there are any cells to be updated.
+     */
+    bool collectNarrowBandCells(NarrowBand& band,
+                                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > D_data,
+                                SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > D_old_data) const;
+
+    /*!
+     * \brief Add the cells updated by the last pass that now satisfy the band
+     * criterion to the narrow band.
+     *
+     * \return Whether any cells were added to the narrow band.
+     */
+    bool growNarrowBand(NarrowBand& band, SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > D_data) const;
+
+    /*!
+     * \brief Compute the weighted sum of squared differences and the maximum
+     * difference between the new and previous iterates over the cells updated
+     * during the current iteration that lie within the narrow band for either
+     * iterate.  If \p wgt_data is NULL, only the maximum difference is
+     * computed and zero is returned.
+     */
+    double computeNarrowBandDiffSq(const NarrowBand& band,
+                                   SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > D_new_data,
+                                   SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > D_old_data,
+                                   SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > wgt_data,
+                                   double& max_diff) const;
+
     // Book-keeping.
     std::string d_object_name;
     bool d_registered_for_restart;
@@ -138,6 +221,12 @@ protected:
     int d_max_its;
     bool d_enable_logging;
 
+    // Narrow band parameters.  When enabled, only cells within (and adjacent
+    // to) d_narrow_band_width grid cells of the interface are updated, and
+    // convergence is only checked on those cells.
+    bool d_use_narrow_band;
+    double d_narrow_band_width;
+
     // Boundary condition object for level set.
     SAMRAI::solv::RobinBcCoefStrategy<NDIM>* d_bc_coef;
 
@@ -111,6 +111,25 @@ public:
      */
     void forwardEulerStep(double current_time, double new_time);
 
+    /*!
+     * Reset the new positions of the Lagrangian structure and the new positions
+     * and velocities of the massive points to equal their current values.
+     */
+    void initializeLagrangianSubsteps(double current_time, double new_time);
+
+    /*!
+     * Advance the new positions of the Lagrangian structure by a forward Euler
+     * substep using the velocity at the new time, and advance the positions
+     * and velocities of the massive points by a semi-implicit Euler substep.
+     *
+     * The velocities of the massive points are updated using the penalty force
+     * evaluated at the updated structure positions, and the positions of the
+     * massive points are then updated using the new velocities.  This update
+     * is stable for undamped penalty springs provided that substep_dt
+     * sqrt(K/M) < 2.
+     */
+    void forwardEulerSubstep(double current_time, double new_time, double substep_dt);
+
     /*!
      * Advance the positions of the Lagrangian structure using the (explicit)
      * midpoint rule.
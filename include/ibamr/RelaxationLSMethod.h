@@ -70,6 +70,12 @@ namespace IBAMR
  * to the Eikonal equation \f$ |\nabla Q | = 1 \f$. The solution of the Eikonal equation
  * produces the signed distance away from an interface.
  *
+ * \note If <tt>use_narrow_band</tt> is set in the input database, relaxation is
+ * restricted to the cells within <tt>narrow_band_width</tt> grid cells of the
+ * interface and their immediate neighbors.  Each patch keeps an explicit list of
+ * its band cells, so that the cost of an iteration is proportional to the size
+ * of the band rather than to the size of the patch.  Convergence is checked
+ * only on band cells.
  *
  * Reference
  * Min, C., <A HREF="http://www.sciencedirect.com/science/article/pii/S0021999109007189">
@@ -110,12 +116,27 @@ private:
                const int iter) const;
 
     /*!
-     * \brief Do one relaxation step over a patch.
+     * \brief Do one relaxation step over the narrow band cells of the
+     * hierarchy and return the L2-norm of the change on narrow band cells.
+     */
+    double relaxNarrowBand(SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops,
+                           int dist_idx,
+                           int dist_init_idx,
+                           int dist_iter_idx,
+                           int wgt_idx,
+                           const int iter,
+                           std::vector<std::vector<NarrowBand> >& bands,
+                           int& num_band_patches) const;
+
+    /*!
+     * \brief Do one relaxation step over a patch, or only over the cells
+     * collected from the narrow band of the patch if \p band is non-NULL.
      */
     void relax(SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dist_data,
                const SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > dist_init_idx,
                const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
-               const int iter) const;
+               const int iter,
+               const NarrowBand* band = NULL) const;
 
     /*!
      * Read input values from a given database.
@@ -87,6 +87,12 @@ public:
      * \brief Set the PoissonSpecifications object used to specify the
      * coefficients for the momentum equation in the incompressible Stokes
      * operator.
+     *
+     * \note The damping factor must be spatially constant.  A spatially varying
+     * viscosity must be node-centered for NDIM == 2 and edge-centered for NDIM
+     * == 3.
+     *
+     * \see StaggeredStokesOperatorUtilities
      */
     virtual void setVelocityPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& U_problem_coefs);
 
@@ -0,0 +1,185 @@
+// Filename: StaggeredStokesOperatorUtilities.h
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef included_IBAMR_StaggeredStokesOperatorUtilities
+#define included_IBAMR_StaggeredStokesOperatorUtilities
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "tbox/Pointer.h"
+
+namespace IBTK
+{
+class HierarchyMathOps;
+} // namespace IBTK
+namespace SAMRAI
+{
+namespace hier
+{
+template <int DIM>
+class Patch;
+template <int DIM>
+class PatchHierarchy;
+} // namespace hier
+namespace pdat
+{
+template <int DIM, class TYPE>
+class CellData;
+template <int DIM, class TYPE>
+class SideData;
+} // namespace pdat
+namespace solv
+{
+class PoissonSpecifications;
+} // namespace solv
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * \brief Class StaggeredStokesOperatorUtilities provides a matrix-free
+ * implementation of the action of the staggered-grid Stokes operator in which
+ * the momentum and continuity residuals are computed in a single pass over the
+ * velocity and pressure data.
+ *
+ * The operator is
+ *
+ * \f[
+ *   A \left[\begin{array}{c} u \\ p \end{array}\right] =
+ *   \left[\begin{array}{c} (C I + D L) u + \nabla p \\ -\nabla \cdot u \end{array}\right]
+ * \f]
+ *
+ * when the viscosity \f$ D \f$ is spatially constant, and
+ *
+ * \f[
+ *   A \left[\begin{array}{c} u \\ p \end{array}\right] =
+ *   \left[\begin{array}{c} C u + \nabla \cdot D (\nabla u + (\nabla u)^T) + \nabla p \\
+ *   -\nabla \cdot u \end{array}\right]
+ * \f]
+ *
+ * when it is not.  The coefficients are provided by a
+ * SAMRAI::solv::PoissonSpecifications object.  The damping factor \f$ C \f$
+ * must be spatially constant.  A spatially varying viscosity must be
+ * node-centered for NDIM == 2 and edge-centered for NDIM == 3.
+ */
+class StaggeredStokesOperatorUtilities
+{
+public:
+    /*!
+     * \brief Compute [r_U;r_P] := alpha*A*[U;P] + beta*[f_U;f_P] on the
+     * specified range of levels of the patch hierarchy.
+     *
+     * Ghost cell values of U and P must be filled before calling this method.
+     * Data along the coarse-fine interface are synchronized in the same manner
+     * as HierarchyMathOps::grad(), HierarchyMathOps::laplace(), and
+     * HierarchyMathOps::div(): the coarse values of U are replaced by the
+     * restriction of the fine values before the operator is applied, and the
+     * coarse values of r_U are replaced by the restriction of the fine values
+     * afterwards.
+     *
+     * \note The right-hand side data are not accessed when beta is zero, in
+     * which case f_U_idx and f_P_idx may be -1.
+     *
+     * \note hier_math_ops must be configured to act on the same range of
+     * levels.
+     */
+    static void applyOperator(int r_U_idx,
+                              int r_P_idx,
+                              int U_idx,
+                              int P_idx,
+                              const SAMRAI::solv::PoissonSpecifications& U_problem_coefs,
+                              double alpha,
+                              double beta,
+                              int f_U_idx,
+                              int f_P_idx,
+                              SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                              int coarsest_ln,
+                              int finest_ln,
+                              SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops);
+
+    /*!
+     * \brief Compute [r_U;r_P] := alpha*A*[U;P] + beta*[f_U;f_P] on a single
+     * patch.
+     *
+     * U and P must provide at least one layer of ghost cells, as must the
+     * viscosity data when it is spatially varying.
+     *
+     * \note The right-hand side data are not accessed when beta is zero, in
+     * which case f_U_data and f_P_data may be NULL.
+     */
+    static void applyPatchOperator(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > r_U_data,
+                                   SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > r_P_data,
+                                   SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > U_data,
+                                   SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > P_data,
+                                   const SAMRAI::solv::PoissonSpecifications& U_problem_coefs,
+                                   double alpha,
+                                   double beta,
+                                   SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > f_U_data,
+                                   SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > f_P_data,
+                                   SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch);
+
+protected:
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    StaggeredStokesOperatorUtilities();
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    StaggeredStokesOperatorUtilities(const StaggeredStokesOperatorUtilities& from);
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    StaggeredStokesOperatorUtilities& operator=(const StaggeredStokesOperatorUtilities& that);
+};
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBAMR_StaggeredStokesOperatorUtilities
@@ -62,6 +62,11 @@ namespace IBAMR
  * that implements a staggered grid (MAC) projection solver for the
  * incompressible Stokes operator.
  *
+ * Sample parameters for the input database:
+ \verbatim
+ use_persistent_workspace = TRUE  // retain scratch data between solves (default)
+ \endverbatim
+ *
  * \see INSStaggeredHierarchyIntegrator
  */
 class StaggeredStokesProjectionPreconditioner : public StaggeredStokesBlockPreconditioner
@@ -187,6 +192,11 @@ private:
     // Scratch data.
     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_Phi_var, d_F_Phi_var;
     int d_Phi_scratch_idx, d_F_Phi_idx;
+
+    // Whether scratch data are allocated in initializeSolverState() and
+    // retained until deallocateSolverState(), or allocated in each call to
+    // solveSystem().
+    bool d_use_persistent_workspace;
 };
 } // namespace IBAMR
 
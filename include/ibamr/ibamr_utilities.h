@@ -37,6 +37,10 @@
 
 #include "tbox/PIO.h"
 
+#if defined(IBTK_ENABLE_TRACING)
+#include "ibtk/TraceRecorder.h"
+#endif
+
 /////////////////////////////// MACRO DEFINITIONS ////////////////////////////
 
 #define IBAMR_DO_ONCE(task)                                                                                            \
@@ -86,6 +90,27 @@ namespace IBAMR
 static const bool ENABLE_TIMERS = true;
 }
 
+#if defined(IBTK_ENABLE_TRACING)
+#define IBAMR_TIMER_START(timer)                                                                                       \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (IBAMR::ENABLE_TIMERS)                                                                                      \
+        {                                                                                                              \
+            timer->start();                                                                                            \
+            IBTK::TraceRecorder::beginEvent(timer);                                                                    \
+        }                                                                                                              \
+    } while (0);
+
+#define IBAMR_TIMER_STOP(timer)                                                                                        \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (IBAMR::ENABLE_TIMERS)                                                                                      \
+        {                                                                                                              \
+            IBTK::TraceRecorder::endEvent(timer);                                                                      \
+            timer->stop();                                                                                             \
+        }                                                                                                              \
+    } while (0);
+#else
 #define IBAMR_TIMER_START(timer)                                                                                       \
     do                                                                                                                 \
     {                                                                                                                  \
@@ -97,6 +122,7 @@ static const bool ENABLE_TIMERS = true;
     {                                                                                                                  \
         if (IBAMR::ENABLE_TIMERS) timer->stop();                                                                       \
     } while (0);
+#endif
 
 /////////////////////////////// FUNCTION DEFINITIONS /////////////////////////
 
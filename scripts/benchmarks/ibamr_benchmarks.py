@@ -0,0 +1,594 @@
+#!/usr/bin/env python
+#
+# Filename: ibamr_benchmarks.py
+# Created on 19 Oct 2026
+#
+# Copyright (c) 2002-2017, Boyce Griffith
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+#    * Redistributions of source code must retain the above copyright notice,
+#      this list of conditions and the following disclaimer.
+#
+#    * Redistributions in binary form must reproduce the above copyright
+#      notice, this list of conditions and the following disclaimer in the
+#      documentation and/or other materials provided with the distribution.
+#
+#    * Neither the name of The University of North Carolina nor the names of
+#      its contributors may be used to endorse or promote products derived from
+#      this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+
+"""Strong and weak scaling benchmarks built from the IBAMR examples.
+
+The benchmark suite is described by a JSON file (see suite.json in this
+directory).  Each case names an example directory, the executable built in
+the corresponding directory of the build tree, an input file that is used as
+a template, and the parameters that are substituted into the template:
+
+  "parameters"  values of top-level input constants (e.g., N, MAX_LEVELS,
+                DELTA_FUNCTION);
+  "overrides"   values of keys within input databases, specified as
+                "Database.key" or "Database.Subdatabase.key";
+  "replace"     literal (old, new) string replacements, e.g., to select the
+                structure files that match the grid resolution;
+  "required"    files in the example directory that must exist for the
+                generated input to be usable, e.g., the selected structure
+                files; and
+  "weak"        parameters that are scaled for weak scaling runs, along with
+                the exponent used to scale them with the number of processes
+                (typically 1/NDIM) and either the multiple to which they are
+                rounded ("multiple") or "round": "power_of_two" to round them
+                to the nearest power of two.
+
+Values may refer to parameters using Python format syntax, e.g. "{N}".
+
+Every generated input file enables per-step timer output, disables
+visualization, restart, and post-processing output, and limits the number of
+time steps.  Each run is executed in its own work directory, which contains
+symbolic links to the files in the example source directory.  The cumulative
+wallclock times that are written to the log file by SAMRAI's TimerManager
+after each time step are differenced to obtain per-step times, which are
+summarized in a JSON report.
+
+Usage:
+
+  ibamr_benchmarks.py run --build-dir BUILD [--suite suite.json]
+      [--cases ex0,...] [--ranks 1,2,4] [--mode strong|weak]
+      [--mpirun "mpirun -np {ranks}"] [--work-dir DIR] [--output report.json]
+      [--baseline baseline.json] [--tolerance 0.1]
+
+  ibamr_benchmarks.py generate --case NAME [--ranks 4] [--mode weak] [--suite suite.json]
+
+  ibamr_benchmarks.py compare report.json baseline.json [--tolerance 0.1]
+
+When a baseline report is provided, the median step time and the mean time
+spent in each phase of each run are compared to the corresponding values in
+the baseline, and the script exits with a nonzero status if any of them
+increases by more than the specified relative tolerance.
+"""
+
+from __future__ import print_function
+
+import argparse
+import json
+import math
+import os
+import platform
+import re
+import shlex
+import subprocess
+import sys
+import time
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+SOURCE_DIR = os.path.dirname(os.path.dirname(SCRIPT_DIR))
+
+REPORT_VERSION = 1
+
+# Timer used to measure the time required to advance the solution by one time
+# step.
+STEP_TIMER_NAME = "IBTK::HierarchyIntegrator::advanceHierarchy()"
+
+# (timer name substring, phase name) rules used to group timers into phases.
+# These match the default rules of IBTK::TraceRecorder.
+PHASE_RULES = [
+    ("HierarchyGhostCellInterpolation::fillData", "ghost_fill"),
+    ("spread", "spread"),
+    ("interp", "interp"),
+    ("StaggeredStokes", "stokes_solve"),
+    ("[stokes_solve]", "stokes_solve"),
+    ("regrid", "regrid"),
+    ("writePlotData", "io"),
+    ("putToDatabase", "io"),
+    ("Restart", "io"),
+]
+
+# Input settings that are imposed on every benchmark run.
+BENCHMARK_OVERRIDES = {
+    "Main.log_file_name": '"benchmark.log"',
+    "Main.log_all_nodes": "FALSE",
+    "Main.viz_dump_interval": "0",
+    "Main.restart_dump_interval": "0",
+    "Main.data_dump_interval": "0",
+    "Main.postproc_data_dump_interval": "0",
+    "Main.timer_dump_interval": "1",
+    "TimerManager.print_exclusive": "FALSE",
+    "TimerManager.print_total": "TRUE",
+    "TimerManager.print_wall": "TRUE",
+    "TimerManager.print_user": "FALSE",
+    "TimerManager.print_sys": "FALSE",
+    "TimerManager.print_max": "TRUE",
+    "TimerManager.print_percentage": "FALSE",
+    "TimerManager.print_threshold": "0",
+    "TimerManager.timer_list": '"IBAMR::*::*", "IBTK::*::*", "*::*::*"',
+}
+
+
+############################################################################
+# Input file generation.
+############################################################################
+
+def strip_comment(line):
+    """Return the line with any trailing // comment removed, ignoring comment
+    markers that appear within string literals."""
+    in_string = False
+    for k, c in enumerate(line):
+        if c == '"':
+            in_string = not in_string
+        elif not in_string and line.startswith("//", k):
+            return line[:k]
+    return line
+
+
+def find_database(lines, path):
+    """Return the (first, last) line numbers of the body of the database with
+    the given path, in which last is the line containing the closing brace.
+    Returns None if the database does not exist."""
+    first, last = 0, len(lines)
+    for name in path:
+        depth = 0
+        found = None
+        for k in range(first, last):
+            code = strip_comment(lines[k])
+            if depth == 0 and re.match(r"\s*" + re.escape(name) + r"\s*\{", code):
+                found = k
+                break
+            depth += code.count("{") - code.count("}")
+        if found is None:
+            return None
+        depth = 0
+        for k in range(found, last):
+            code = strip_comment(lines[k])
+            depth += code.count("{") - code.count("}")
+            if depth == 0:
+                first, last = found + 1, k
+                break
+        else:
+            raise ValueError("unterminated database: " + name)
+    return first, last
+
+
+def ensure_database(lines, path):
+    """Return the span of the database with the given path, creating the
+    database (and its parents) when necessary."""
+    if not path:
+        return 0, len(lines)
+    span = find_database(lines, path)
+    if span is None:
+        parent = ensure_database(lines, path[:-1])
+        indent = "   " * (len(path) - 1)
+        lines[parent[1]:parent[1]] = [indent + path[-1] + " {", indent + "}"]
+        span = find_database(lines, path)
+    return span
+
+
+def set_key(lines, path, key, value):
+    """Set the value of a key within the database with the given path (or at
+    the top level of the input file when the path is empty).  The key is
+    added to the database, and the database is created, when necessary."""
+    first, last = ensure_database(lines, path)
+    depth = 0
+    pattern = re.compile(r"^(\s*)" + re.escape(key) + r"(\s*)=\s*(.*)$")
+    for k in range(first, last):
+        code = strip_comment(lines[k])
+        if depth == 0:
+            m = pattern.match(code)
+            if m:
+                comment = lines[k][len(code):]
+                new_code = m.group(1) + key + m.group(2) + "= " + value
+                if comment:
+                    new_code = new_code.ljust(len(code)) if len(new_code) < len(code) else new_code + " "
+                lines[k] = new_code + comment
+                return
+        depth += code.count("{") - code.count("}")
+    lines.insert(last, "   " * len(path) + key + " = " + value)
+
+
+def scaled_parameters(case, ranks, mode):
+    """Return the input parameters of a case, scaled for weak scaling runs."""
+    params = dict(case.get("parameters", {}))
+    if mode == "weak":
+        for name, rule in case.get("weak", {}).items():
+            base = float(params[name])
+            value = base * float(ranks) ** float(rule.get("exponent", 1.0))
+            if rule.get("round") == "power_of_two":
+                params[name] = 2 ** max(0, int(math.floor(math.log(value, 2) + 0.5)))
+            elif "round" in rule:
+                raise SystemExit("%s: unknown rounding rule for %s: %s" % (case["name"], name, rule["round"]))
+            else:
+                multiple = int(rule.get("multiple", 1))
+                params[name] = max(multiple, int(round(value / multiple)) * multiple)
+    return params
+
+
+def format_value(value, params):
+    if isinstance(value, bool):
+        return "TRUE" if value else "FALSE"
+    if isinstance(value, str):
+        return value.format(**params)
+    return str(value)
+
+
+def generate_input(case, ranks, mode):
+    """Generate the input file for a benchmark case."""
+    params = scaled_parameters(case, ranks, mode)
+    template = os.path.join(SOURCE_DIR, case["example"], case["input"])
+    with open(template) as f:
+        text = f.read()
+    for old, new in case.get("replace", []):
+        text = text.replace(format_value(old, params), format_value(new, params))
+    missing = [format_value(name, params) for name in case.get("required", [])]
+    missing = [name for name in missing if not os.path.exists(os.path.join(SOURCE_DIR, case["example"], name))]
+    if missing:
+        raise SystemExit("%s (mode = %s, ranks = %d): missing files in %s: %s" % (
+            case["name"], mode, ranks, case["example"], ", ".join(missing)))
+    lines = text.split("\n")
+    for name, value in sorted(params.items()):
+        set_key(lines, [], name, format_value(value, params))
+    overrides = dict(BENCHMARK_OVERRIDES)
+    overrides.update(case.get("overrides", {}))
+    for path, value in sorted(overrides.items()):
+        components = path.split(".")
+        set_key(lines, components[:-1], components[-1], format_value(value, params))
+    header = "// Generated by ibamr_benchmarks.py from %s (mode = %s, ranks = %d)\n" % (
+        os.path.join(case["example"], case["input"]), mode, ranks)
+    return header + "\n".join(lines), params
+
+
+############################################################################
+# Log file parsing.
+############################################################################
+
+NUMBER_RE = re.compile(r"[-+]?(?:\d+\.\d*|\.\d+|\d+)(?:[eE][-+]?\d+)?")
+
+
+def parse_timer_dumps(log_text):
+    """Parse the wallclock timer tables written by TimerManager::print().
+
+    Returns a list of dictionaries (one per dump) mapping each timer name to
+    its maximum cumulative wallclock time over all processes."""
+    dumps = []
+    current = None
+    in_wall_section = False
+    for line in log_text.split("\n"):
+        if "WALLCLOCK" in line.upper():
+            in_wall_section = True
+            current = {}
+            dumps.append(current)
+            continue
+        if "USER TIME" in line.upper() or "SYSTEM TIME" in line.upper():
+            in_wall_section = False
+            continue
+        if not in_wall_section:
+            continue
+        tokens = line.split()
+        if not tokens or "::" not in tokens[0]:
+            continue
+        name = tokens[0]
+        rest = line[line.index(name) + len(name):]
+        rest = re.sub(r"\([^)]*\)", " ", rest)
+        rest = re.sub(r"\[[^\]]*\]", " ", rest)
+        values = [float(v) for v in NUMBER_RE.findall(rest)]
+        if values:
+            current[name] = max(values)
+    return [d for d in dumps if d]
+
+
+def median(values):
+    values = sorted(values)
+    n = len(values)
+    if n == 0:
+        return 0.0
+    return values[n // 2] if n % 2 else 0.5 * (values[n // 2 - 1] + values[n // 2])
+
+
+def phase_of(timer_name):
+    for substring, phase in PHASE_RULES:
+        if substring in timer_name:
+            return phase
+    return None
+
+
+def summarize_run(dumps, skip_steps):
+    """Summarize the per-step timer data of a run."""
+    steps = []
+    for k in range(1, len(dumps)):
+        step = {}
+        for name, value in dumps[k].items():
+            step[name] = max(0.0, value - dumps[k - 1].get(name, 0.0))
+        steps.append(step)
+    steps = steps[skip_steps:] if len(steps) > skip_steps else steps
+    timers = {}
+    names = set()
+    for step in steps:
+        names.update(step.keys())
+    for name in sorted(names):
+        values = [step.get(name, 0.0) for step in steps]
+        timers[name] = {
+            "mean": sum(values) / len(values),
+            "median": median(values),
+            "max": max(values),
+        }
+    # Nested timers are not distinguished in the timer output, so the time
+    # spent in each phase is estimated by the most expensive timer in that
+    # phase.
+    phases = {}
+    for name, stats in timers.items():
+        phase = phase_of(name)
+        if phase and stats["mean"] > phases.get(phase, 0.0):
+            phases[phase] = stats["mean"]
+    step_times = [step.get(STEP_TIMER_NAME, 0.0) for step in steps]
+    return {
+        "num_steps": len(steps),
+        "step_time": {
+            "mean": sum(step_times) / len(step_times) if step_times else 0.0,
+            "median": median(step_times),
+            "min": min(step_times) if step_times else 0.0,
+            "max": max(step_times) if step_times else 0.0,
+        },
+        "phases": phases,
+        "timers": timers,
+    }
+
+
+############################################################################
+# Running benchmarks.
+############################################################################
+
+def run_case(case, ranks, mode, args):
+    input_text, params = generate_input(case, ranks, mode)
+    run_name = "%s.%s.np%d" % (case["name"], mode, ranks)
+    work_dir = os.path.abspath(os.path.join(args.work_dir, run_name))
+    if not os.path.isdir(work_dir):
+        os.makedirs(work_dir)
+    example_dir = os.path.join(SOURCE_DIR, case["example"])
+    for entry in os.listdir(example_dir):
+        link = os.path.join(work_dir, entry)
+        if not os.path.lexists(link):
+            os.symlink(os.path.join(example_dir, entry), link)
+    input_file = os.path.join(work_dir, "input.benchmark")
+    with open(input_file, "w") as f:
+        f.write(input_text)
+    log_file = os.path.join(work_dir, "benchmark.log")
+    if os.path.exists(log_file):
+        os.remove(log_file)
+
+    executable = os.path.join(os.path.abspath(args.build_dir), case["example"], case["executable"])
+    command = shlex.split(args.mpirun.format(ranks=ranks)) + [executable, input_file]
+    print("running %s: %s" % (run_name, " ".join(command)))
+    sys.stdout.flush()
+    start = time.time()
+    with open(os.path.join(work_dir, "benchmark.out"), "w") as out:
+        status = subprocess.call(command, cwd=work_dir, stdout=out, stderr=subprocess.STDOUT)
+    wall_time = time.time() - start
+
+    result = {
+        "case": case["name"],
+        "mode": mode,
+        "ranks": ranks,
+        "parameters": params,
+        "status": status,
+        "wall_time": wall_time,
+    }
+    if status == 0 and os.path.exists(log_file):
+        with open(log_file) as f:
+            result.update(summarize_run(parse_timer_dumps(f.read()), int(case.get("skip_steps", 1))))
+    elif status == 0:
+        result["status"] = "missing log file"
+    return result
+
+
+def add_scaling_efficiency(runs):
+    """Add parallel efficiencies relative to the run with the fewest
+    processes of each case."""
+    groups = {}
+    for run in runs:
+        if run.get("num_steps"):
+            groups.setdefault((run["case"], run["mode"]), []).append(run)
+    for (case, mode), group in groups.items():
+        reference = min(group, key=lambda r: r["ranks"])
+        t_ref = reference["step_time"]["median"]
+        for run in group:
+            t = run["step_time"]["median"]
+            if t <= 0.0:
+                continue
+            if mode == "strong":
+                run["efficiency"] = t_ref * reference["ranks"] / (t * run["ranks"])
+            else:
+                run["efficiency"] = t_ref / t
+
+
+def run_key(run):
+    return "%s/%s/np%d" % (run["case"], run["mode"], run["ranks"])
+
+
+def compare_reports(report, baseline, tolerance, min_time):
+    """Return a list of regressions of the report relative to the baseline."""
+    baseline_runs = dict((run_key(run), run) for run in baseline.get("runs", []))
+    regressions = []
+    for run in report.get("runs", []):
+        ref = baseline_runs.get(run_key(run))
+        if not ref or not run.get("num_steps") or not ref.get("num_steps"):
+            continue
+        metrics = [("step_time", run["step_time"]["median"], ref["step_time"]["median"])]
+        for phase, value in sorted(run.get("phases", {}).items()):
+            if phase in ref.get("phases", {}):
+                metrics.append(("phase:" + phase, value, ref["phases"][phase]))
+        for name, value, ref_value in metrics:
+            if value > (1.0 + tolerance) * ref_value and value - ref_value > min_time:
+                regressions.append({
+                    "run": run_key(run),
+                    "metric": name,
+                    "baseline": ref_value,
+                    "current": value,
+                    "ratio": value / ref_value if ref_value > 0.0 else float("inf"),
+                })
+    return regressions
+
+
+def print_regressions(regressions, tolerance):
+    if not regressions:
+        print("no regressions detected (tolerance = %g)" % tolerance)
+        return
+    print("performance regressions detected (tolerance = %g):" % tolerance)
+    for r in regressions:
+        print("  %-40s %-20s baseline = %.4e s  current = %.4e s  ratio = %.3f"
+              % (r["run"], r["metric"], r["baseline"], r["current"], r["ratio"]))
+
+
+def load_suite(path):
+    with open(path) as f:
+        return json.load(f)
+
+
+def select_cases(suite, names):
+    cases = suite["cases"]
+    if not names:
+        return cases
+    selected = [case for case in cases if case["name"] in names.split(",")]
+    missing = set(names.split(",")) - set(case["name"] for case in selected)
+    if missing:
+        raise SystemExit("unknown benchmark cases: " + ", ".join(sorted(missing)))
+    return selected
+
+
+def git_revision():
+    try:
+        return subprocess.check_output(["git", "rev-parse", "HEAD"], cwd=SOURCE_DIR,
+                                       stderr=subprocess.STDOUT).decode().strip()
+    except (OSError, subprocess.CalledProcessError):
+        return "unknown"
+
+
+def command_run(args):
+    suite = load_suite(args.suite)
+    ranks_list = [int(r) for r in args.ranks.split(",")]
+    modes = ["strong", "weak"] if args.mode == "both" else [args.mode]
+    runs = []
+    for case in select_cases(suite, args.cases):
+        for mode in modes:
+            for ranks in ranks_list:
+                runs.append(run_case(case, ranks, mode, args))
+    add_scaling_efficiency(runs)
+    report = {
+        "version": REPORT_VERSION,
+        "revision": git_revision(),
+        "host": platform.node(),
+        "date": time.strftime("%Y-%m-%dT%H:%M:%S"),
+        "mpirun": args.mpirun,
+        "runs": runs,
+    }
+    status = 0
+    if any(run["status"] != 0 for run in runs):
+        print("some benchmark runs failed; see the benchmark.out files in " + args.work_dir)
+        status = 1
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        report["baseline"] = {"revision": baseline.get("revision"), "tolerance": args.tolerance}
+        report["regressions"] = compare_reports(report, baseline, args.tolerance, args.min_time)
+        print_regressions(report["regressions"], args.tolerance)
+        if report["regressions"]:
+            status = 1
+    with open(args.output, "w") as f:
+        json.dump(report, f, indent=2, sort_keys=True)
+    print("wrote " + args.output)
+    return status
+
+
+def command_generate(args):
+    suite = load_suite(args.suite)
+    case = select_cases(suite, args.case)[0]
+    text, _ = generate_input(case, args.ranks, args.mode)
+    sys.stdout.write(text)
+    return 0
+
+
+def command_compare(args):
+    with open(args.report) as f:
+        report = json.load(f)
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+    regressions = compare_reports(report, baseline, args.tolerance, args.min_time)
+    print_regressions(regressions, args.tolerance)
+    return 1 if regressions else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    subparsers = parser.add_subparsers(dest="command")
+    default_suite = os.path.join(SCRIPT_DIR, "suite.json")
+
+    run = subparsers.add_parser("run", help="run benchmarks and write a JSON report")
+    run.add_argument("--build-dir", required=True, help="top-level IBAMR build directory")
+    run.add_argument("--suite", default=default_suite)
+    run.add_argument("--cases", default="", help="comma-separated list of cases (default: all)")
+    run.add_argument("--ranks", default="1,2,4", help="comma-separated list of process counts")
+    run.add_argument("--mode", default="strong", choices=["strong", "weak", "both"])
+    run.add_argument("--mpirun", default="mpirun -np {ranks}", help="MPI launcher command")
+    run.add_argument("--work-dir", default="benchmark_runs")
+    run.add_argument("--output", default="benchmark_report.json")
+    run.add_argument("--baseline", default="", help="baseline report used to detect regressions")
+    run.add_argument("--tolerance", type=float, default=0.1, help="relative slowdown flagged as a regression")
+    run.add_argument("--min-time", type=float, default=1.0e-3,
+                     help="absolute slowdown (in seconds) below which differences are ignored")
+
+    generate = subparsers.add_parser("generate", help="write a generated input file to stdout")
+    generate.add_argument("--suite", default=default_suite)
+    generate.add_argument("--case", required=True)
+    generate.add_argument("--ranks", type=int, default=1)
+    generate.add_argument("--mode", default="strong", choices=["strong", "weak"])
+
+    compare = subparsers.add_parser("compare", help="compare a report to a baseline report")
+    compare.add_argument("report")
+    compare.add_argument("baseline")
+    compare.add_argument("--tolerance", type=float, default=0.1)
+    compare.add_argument("--min-time", type=float, default=1.0e-3)
+
+    args = parser.parse_args()
+    if args.command == "run":
+        return command_run(args)
+    elif args.command == "generate":
+        return command_generate(args)
+    elif args.command == "compare":
+        return command_compare(args)
+    parser.print_help()
+    return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -49,6 +49,8 @@
 #include "ibtk/CCPoissonPointRelaxationFACOperator.h"
 #include "ibtk/FACPreconditioner.h"
 #include "ibtk/IndexUtilities.h"
+#include "ibtk/LMesh.h"
+#include "ibtk/LNode.h"
 #include "ibtk/LNodeSetData.h"
 #include "ibtk/PETScKrylovLinearSolver.h"
 #include "ibtk/ibtk_utilities.h"
@@ -140,6 +142,34 @@ find_struct_handle_position(itr begin, itr end, const T& value)
     return -1;
 }
 
+// Sum-reduce several per-structure quantities in a single collective.
+inline void
+packed_sum_reduction(const std::vector<std::vector<std::vector<double> >*>& data)
+{
+    std::vector<double> buf;
+    for (unsigned int k = 0; k < data.size(); ++k)
+    {
+        for (unsigned int struct_no = 0; struct_no < data[k]->size(); ++struct_no)
+        {
+            const std::vector<double>& v = (*data[k])[struct_no];
+            buf.insert(buf.end(), v.begin(), v.end());
+        }
+    }
+    if (buf.empty()) return;
+    SAMRAI_MPI::sumReduction(&buf[0], static_cast<int>(buf.size()));
+    std::vector<double>::const_iterator it = buf.begin();
+    for (unsigned int k = 0; k < data.size(); ++k)
+    {
+        for (unsigned int struct_no = 0; struct_no < data[k]->size(); ++struct_no)
+        {
+            std::vector<double>& v = (*data[k])[struct_no];
+            std::copy(it, it + v.size(), v.begin());
+            it += v.size();
+        }
+    }
+    return;
+} // packed_sum_reduction
+
 #if (NDIM == 3)
 // Routine to solve 3X3 equation to get rigid body rotational velocity.
 inline void
@@ -809,8 +839,6 @@ ConstraintIBMethod::getFromRestart()
 void
 ConstraintIBMethod::setInitialLagrangianVelocity()
 {
-    typedef ConstraintIBKinematics::StructureParameters StructureParameters;
-
     const bool from_restart = RestartManager::getManager()->isFromRestart();
     if (!from_restart) calculateCOMandMOIOfStructures();
 
@@ -822,12 +850,13 @@ ConstraintIBMethod::setInitialLagrangianVelocity()
                                                           d_tagged_pt_position[struct_no]);
         d_ib_kinematics[struct_no]->setShape(d_FuRMoRP_current_time,
                                              d_incremented_angle_from_reference_axis[struct_no]);
+    }
 
-        if (!from_restart)
+    if (!from_restart)
+    {
+        calculateMomentumOfKinematicsVelocity();
+        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
         {
-            const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-            if (struct_param.getStructureIsSelfTranslating()) calculateMomentumOfKinematicsVelocity(struct_no);
-
             d_vel_com_def_current[struct_no] = d_vel_com_def_new[struct_no];
             d_omega_com_def_current[struct_no] = d_omega_com_def_new[struct_no];
         }
@@ -871,41 +900,31 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
 
         const boost::multi_array_ref<double, 2>& X_data_current = *ptr_x_lag_data_current->getLocalFormVecArray();
         const boost::multi_array_ref<double, 2>& X_data_new = *ptr_x_lag_data_new->getLocalFormVecArray();
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
+        // Get the local nodes of the structures on this level.
+        const StructureNodeBucket& bucket = getStructureNodeBucket(ln);
 
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (size_t struct_no = 0; struct_no < bucket.struct_handles.size(); ++struct_no)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            const int location_struct_handle = bucket.struct_handles[struct_no];
 
             double X_com_current[NDIM] = { 0.0 }, X_com_new[NDIM] = { 0.0 };
+            const std::vector<LNode*>& local_nodes = bucket.local_nodes[location_struct_handle];
             for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
             {
                 const LNode* const node_idx = *cit;
                 const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
+                const int local_idx = node_idx->getLocalPETScIndex();
+                const double* const X_current = &X_data_current[local_idx][0];
+                const double* const X_new = &X_data_new[local_idx][0];
+                for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X_current = &X_data_current[local_idx][0];
-                    const double* const X_new = &X_data_new[local_idx][0];
-                    for (unsigned int d = 0; d < NDIM; ++d)
-                    {
-                        X_com_current[d] += X_current[d];
-                        X_com_new[d] += X_new[d];
-                    }
-                    if (lag_idx == d_tagged_pt_lag_idx[location_struct_handle])
-                    {
-                        for (unsigned int d = 0; d < NDIM; ++d) tagged_position[location_struct_handle][d] = X_new[d];
-                    }
+                    X_com_current[d] += X_current[d];
+                    X_com_new[d] += X_new[d];
+                }
+                if (lag_idx == d_tagged_pt_lag_idx[location_struct_handle])
+                {
+                    for (unsigned int d = 0; d < NDIM; ++d) tagged_position[location_struct_handle][d] = X_new[d];
                 }
             }
             for (int d = 0; d < NDIM; ++d)
@@ -918,24 +937,22 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         ptr_x_lag_data_new->restoreArrays();
     }
 
+    std::vector<std::vector<std::vector<double> >*> com_data(3);
+    com_data[0] = &d_center_of_mass_current;
+    com_data[1] = &d_center_of_mass_new;
+    com_data[2] = &tagged_position;
+    packed_sum_reduction(com_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         const int total_nodes = struct_param.getTotalNodes();
 
-        SAMRAI_MPI::sumReduction(&d_center_of_mass_current[struct_no][0], NDIM);
-        SAMRAI_MPI::sumReduction(&d_center_of_mass_new[struct_no][0], NDIM);
-
         for (int i = 0; i < 3; ++i)
         {
             d_center_of_mass_current[struct_no][i] /= total_nodes;
             d_center_of_mass_new[struct_no][i] /= total_nodes;
         }
-    }
-
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        SAMRAI_MPI::sumReduction(&tagged_position[struct_no][0], 3);
         d_tagged_pt_position[struct_no] = tagged_position[struct_no];
     }
 
@@ -964,24 +981,17 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
 
         const boost::multi_array_ref<double, 2>& X_data_current = *ptr_x_lag_data_current->getLocalFormVecArray();
         const boost::multi_array_ref<double, 2>& X_data_new = *ptr_x_lag_data_new->getLocalFormVecArray();
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
+        // Get the local nodes of the structures on this level.
+        const StructureNodeBucket& bucket = getStructureNodeBucket(ln);
 
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (size_t struct_no = 0; struct_no < bucket.struct_handles.size(); ++struct_no)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
+            const int location_struct_handle = bucket.struct_handles[struct_no];
+            Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[location_struct_handle];
             const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
             if (!struct_param.getStructureIsSelfRotating()) continue;
 
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
             const std::vector<double>& X_com_current = d_center_of_mass_current[location_struct_handle];
             const std::vector<double>& X_com_new = d_center_of_mass_new[location_struct_handle];
 
@@ -989,47 +999,44 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
             Inertia_current.setZero();
             Inertia_new.setZero();
 
+            const std::vector<LNode*>& local_nodes = bucket.local_nodes[location_struct_handle];
             for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
             {
                 const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X_current = &X_data_current[local_idx][0];
-                    const double* const X_new = &X_data_new[local_idx][0];
+                const int local_idx = node_idx->getLocalPETScIndex();
+                const double* const X_current = &X_data_current[local_idx][0];
+                const double* const X_new = &X_data_new[local_idx][0];
 #if (NDIM == 2)
-                    Inertia_current(0, 0) += std::pow(X_current[1] - X_com_current[1], 2);
-                    Inertia_current(0, 1) += -(X_current[0] - X_com_current[0]) * (X_current[1] - X_com_current[1]);
-                    Inertia_current(1, 1) += std::pow(X_current[0] - X_com_current[0], 2);
-                    Inertia_current(2, 2) +=
-                        std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[1] - X_com_current[1], 2);
-
-                    Inertia_new(0, 0) += std::pow(X_new[1] - X_com_new[1], 2);
-                    Inertia_new(0, 1) += -(X_new[0] - X_com_new[0]) * (X_new[1] - X_com_new[1]);
-                    Inertia_new(1, 1) += std::pow(X_new[0] - X_com_new[0], 2);
-                    Inertia_new(2, 2) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[1] - X_com_new[1], 2);
+                Inertia_current(0, 0) += std::pow(X_current[1] - X_com_current[1], 2);
+                Inertia_current(0, 1) += -(X_current[0] - X_com_current[0]) * (X_current[1] - X_com_current[1]);
+                Inertia_current(1, 1) += std::pow(X_current[0] - X_com_current[0], 2);
+                Inertia_current(2, 2) +=
+                    std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[1] - X_com_current[1], 2);
+
+                Inertia_new(0, 0) += std::pow(X_new[1] - X_com_new[1], 2);
+                Inertia_new(0, 1) += -(X_new[0] - X_com_new[0]) * (X_new[1] - X_com_new[1]);
+                Inertia_new(1, 1) += std::pow(X_new[0] - X_com_new[0], 2);
+                Inertia_new(2, 2) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[1] - X_com_new[1], 2);
 #endif
 
 #if (NDIM == 3)
-                    Inertia_current(0, 0) +=
-                        std::pow(X_current[1] - X_com_current[1], 2) + std::pow(X_current[2] - X_com_current[2], 2);
-                    Inertia_current(0, 1) += -(X_current[0] - X_com_current[0]) * (X_current[1] - X_com_current[1]);
-                    Inertia_current(0, 2) += -(X_current[0] - X_com_current[0]) * (X_current[2] - X_com_current[2]);
-                    Inertia_current(1, 1) +=
-                        std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[2] - X_com_current[2], 2);
-                    Inertia_current(1, 2) += -(X_current[1] - X_com_current[1]) * (X_current[2] - X_com_current[2]);
-                    Inertia_current(2, 2) +=
-                        std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[1] - X_com_current[1], 2);
-
-                    Inertia_new(0, 0) += std::pow(X_new[1] - X_com_new[1], 2) + std::pow(X_new[2] - X_com_new[2], 2);
-                    Inertia_new(0, 1) += -(X_new[0] - X_com_new[0]) * (X_new[1] - X_com_new[1]);
-                    Inertia_new(0, 2) += -(X_new[0] - X_com_new[0]) * (X_new[2] - X_com_new[2]);
-                    Inertia_new(1, 1) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[2] - X_com_new[2], 2);
-                    Inertia_new(1, 2) += -(X_new[1] - X_com_new[1]) * (X_new[2] - X_com_new[2]);
-                    Inertia_new(2, 2) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[1] - X_com_new[1], 2);
+                Inertia_current(0, 0) +=
+                    std::pow(X_current[1] - X_com_current[1], 2) + std::pow(X_current[2] - X_com_current[2], 2);
+                Inertia_current(0, 1) += -(X_current[0] - X_com_current[0]) * (X_current[1] - X_com_current[1]);
+                Inertia_current(0, 2) += -(X_current[0] - X_com_current[0]) * (X_current[2] - X_com_current[2]);
+                Inertia_current(1, 1) +=
+                    std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[2] - X_com_current[2], 2);
+                Inertia_current(1, 2) += -(X_current[1] - X_com_current[1]) * (X_current[2] - X_com_current[2]);
+                Inertia_current(2, 2) +=
+                    std::pow(X_current[0] - X_com_current[0], 2) + std::pow(X_current[1] - X_com_current[1], 2);
+
+                Inertia_new(0, 0) += std::pow(X_new[1] - X_com_new[1], 2) + std::pow(X_new[2] - X_com_new[2], 2);
+                Inertia_new(0, 1) += -(X_new[0] - X_com_new[0]) * (X_new[1] - X_com_new[1]);
+                Inertia_new(0, 2) += -(X_new[0] - X_com_new[0]) * (X_new[2] - X_com_new[2]);
+                Inertia_new(1, 1) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[2] - X_com_new[2], 2);
+                Inertia_new(1, 2) += -(X_new[1] - X_com_new[1]) * (X_new[2] - X_com_new[2]);
+                Inertia_new(2, 2) += std::pow(X_new[0] - X_com_new[0], 2) + std::pow(X_new[1] - X_com_new[1], 2);
 #endif
-                }
             }
             d_moment_of_inertia_current[location_struct_handle] += Inertia_current;
             d_moment_of_inertia_new[location_struct_handle] += Inertia_new;
@@ -1038,13 +1045,28 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         ptr_x_lag_data_new->restoreArrays();
     } // all levels
 
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    // Reduce the inertia tensors of all structures in a single collective.
+    if (d_no_structures > 0)
     {
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-        if (struct_param.getStructureIsSelfRotating())
+        std::vector<double> moi_data(18 * d_no_structures);
+        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
         {
-            SAMRAI_MPI::sumReduction(&d_moment_of_inertia_current[struct_no](0, 0), 9);
-            SAMRAI_MPI::sumReduction(&d_moment_of_inertia_new[struct_no](0, 0), 9);
+            std::copy(&d_moment_of_inertia_current[struct_no](0, 0),
+                      &d_moment_of_inertia_current[struct_no](0, 0) + 9,
+                      &moi_data[18 * struct_no]);
+            std::copy(&d_moment_of_inertia_new[struct_no](0, 0),
+                      &d_moment_of_inertia_new[struct_no](0, 0) + 9,
+                      &moi_data[18 * struct_no + 9]);
+        }
+        SAMRAI_MPI::sumReduction(&moi_data[0], 18 * d_no_structures);
+        for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+        {
+            std::copy(&moi_data[18 * struct_no],
+                      &moi_data[18 * struct_no] + 9,
+                      &d_moment_of_inertia_current[struct_no](0, 0));
+            std::copy(&moi_data[18 * struct_no + 9],
+                      &moi_data[18 * struct_no + 9] + 9,
+                      &d_moment_of_inertia_new[struct_no](0, 0));
         }
     }
 
@@ -1095,13 +1117,10 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
 void
 ConstraintIBMethod::calculateKinematicsVelocity()
 {
-    typedef ConstraintIBKinematics::StructureParameters StructureParameters;
     const double dt = d_FuRMoRP_new_time - d_FuRMoRP_current_time;
     // Theta_new = Theta_old + Omega_old*dt
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
-
         for (int d = 0; d < 3; ++d)
             d_incremented_angle_from_reference_axis[struct_no][d] +=
                 (d_rigid_rot_vel_current[struct_no][d] - d_omega_com_def_current[struct_no][d]) * dt;
@@ -1112,153 +1131,128 @@ ConstraintIBMethod::calculateKinematicsVelocity()
                                                           d_tagged_pt_position[struct_no]);
 
         d_ib_kinematics[struct_no]->setShape(d_FuRMoRP_new_time, d_incremented_angle_from_reference_axis[struct_no]);
-
-        if (struct_param.getStructureIsSelfTranslating()) calculateMomentumOfKinematicsVelocity(struct_no);
     }
+    calculateMomentumOfKinematicsVelocity();
 
     return;
 } // calculateKinematicsVelocity
 
 void
-ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_handle)
+ConstraintIBMethod::calculateMomentumOfKinematicsVelocity()
 {
     typedef ConstraintIBKinematics::StructureParameters StructureParameters;
-    Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[position_handle];
-    const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
-    Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
-    Array<int> calculate_rot_mom = struct_param.getCalculateRotationalMomentum();
-    const int coarsest_ln = struct_param.getCoarsestLevelNumber();
-    const int finest_ln = struct_param.getFinestLevelNumber();
-    const std::vector<std::pair<int, int> >& range = struct_param.getLagIdxRange();
-    const int total_nodes = struct_param.getTotalNodes();
-
-    // Zero out linear momentum of kinematics velocity of the structure.
-    for (int d = 0; d < 3; ++d) d_vel_com_def_new[position_handle][d] = 0.0;
-
-    // Calculate linear momentum
-    for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size(); ++ln, ++itr)
-    {
-#if !defined(NDEBUG)
-        TBOX_ASSERT(d_l_data_manager->levelContainsLagrangianData(ln));
-#endif
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
 
-        std::pair<int, int> lag_idx_range = range[itr];
-        const int offset = lag_idx_range.first;
-        double U_com_def[NDIM] = { 0.0 };
+    // Linear and angular momentum of the kinematics velocity of the structures.
+    std::vector<std::vector<double> > U_com_def(d_no_structures, std::vector<double>(3, 0.0));
+    std::vector<std::vector<double> > R_cross_U_def(d_no_structures, std::vector<double>(3, 0.0));
 
-        // Get LMesh corresponding to the present position of the structures
-        // on this level.
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-        const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
 
-        for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+        // Get LData corresponding to the present position of the structures.
+        Pointer<LData> ptr_x_lag_data;
+        if (MathUtilities<double>::equalEps(d_FuRMoRP_current_time, 0.0))
         {
-            const LNode* const node_idx = *cit;
-            const int lag_idx = node_idx->getLagrangianIndex();
-            if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-            {
-                for (unsigned int d = 0; d < NDIM; ++d)
-                {
-                    U_com_def[d] += def_vel[d][lag_idx - offset];
-                }
-            }
+            ptr_x_lag_data = d_l_data_manager->getLData("X", ln);
         }
-        for (int d = 0; d < NDIM; ++d)
+        else
         {
-            d_vel_com_def_new[position_handle][d] += U_com_def[d];
+            ptr_x_lag_data = d_l_data_X_half_Euler[ln];
         }
-    }
-    SAMRAI_MPI::sumReduction(&d_vel_com_def_new[position_handle][0], NDIM);
+        const boost::multi_array_ref<double, 2>& X_data = *ptr_x_lag_data->getLocalFormVecArray();
 
-    for (int d = 0; d < 3; ++d)
-    {
-        if (calculate_trans_mom[d])
-            d_vel_com_def_new[position_handle][d] /= total_nodes;
-        else
-            d_vel_com_def_new[position_handle][d] = 0.0;
-    }
-
-    // Calculate angular momentum.
-    if (struct_param.getStructureIsSelfRotating())
-    {
-        // Zero out angular momentum of kinematics velocity of the structure.
-        for (int d = 0; d < 3; ++d) d_omega_com_def_new[position_handle][d] = 0.0;
+        // Get the local nodes of the structures on this level.
+        const StructureNodeBucket& bucket = getStructureNodeBucket(ln);
 
-        for (int ln = coarsest_ln, itr = 0; ln <= finest_ln && static_cast<unsigned int>(itr) < range.size();
-             ++ln, ++itr)
+        for (size_t struct_no = 0; struct_no < bucket.struct_handles.size(); ++struct_no)
         {
-#if !defined(NDEBUG)
-            TBOX_ASSERT(d_l_data_manager->levelContainsLagrangianData(ln));
-#endif
-
-            std::pair<int, int> lag_idx_range = range[itr];
+            const int location_struct_handle = bucket.struct_handles[struct_no];
+            const std::pair<int, int>& lag_idx_range = bucket.lag_idx_ranges[location_struct_handle];
             const int offset = lag_idx_range.first;
-            double R_cross_U_def[3] = { 0.0 };
-
-            // Get LData corresponding to the present position of the structures.
-            Pointer<LData> ptr_x_lag_data;
-            if (MathUtilities<double>::equalEps(d_FuRMoRP_current_time, 0.0))
-            {
-                ptr_x_lag_data = d_l_data_manager->getLData("X", ln);
-            }
-            else
-            {
-                ptr_x_lag_data = d_l_data_X_half_Euler[ln];
-            }
+            Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[location_struct_handle];
+            const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
+            if (!struct_param.getStructureIsSelfTranslating()) continue;
 
-            const boost::multi_array_ref<double, 2>& X_data = *ptr_x_lag_data->getLocalFormVecArray();
-            const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-            const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+            const bool struct_is_rotating = struct_param.getStructureIsSelfRotating();
+            const std::vector<double>& X_com = d_center_of_mass_new[location_struct_handle];
             const std::vector<std::vector<double> >& def_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
+            std::vector<double>& U_def = U_com_def[location_struct_handle];
+            std::vector<double>& R_cross_U = R_cross_U_def[location_struct_handle];
 
+            const std::vector<LNode*>& local_nodes = bucket.local_nodes[location_struct_handle];
             for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
             {
                 const LNode* const node_idx = *cit;
                 const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
+                for (unsigned int d = 0; d < NDIM; ++d)
                 {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const X = &X_data[local_idx][0];
-#if (NDIM == 2)
-                    double x = X[0] - d_center_of_mass_new[position_handle][0];
-                    double y = X[1] - d_center_of_mass_new[position_handle][1];
-                    R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
+                    U_def[d] += def_vel[d][lag_idx - offset];
+                }
+                if (!struct_is_rotating) continue;
 
+                const int local_idx = node_idx->getLocalPETScIndex();
+                const double* const X = &X_data[local_idx][0];
+#if (NDIM == 2)
+                double x = X[0] - X_com[0];
+                double y = X[1] - X_com[1];
+                R_cross_U[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
 #endif
 
 #if (NDIM == 3)
-                    double x = X[0] - d_center_of_mass_new[position_handle][0];
-                    double y = X[1] - d_center_of_mass_new[position_handle][1];
-                    double z = X[2] - d_center_of_mass_new[position_handle][2];
+                double x = X[0] - X_com[0];
+                double y = X[1] - X_com[1];
+                double z = X[2] - X_com[2];
 
-                    R_cross_U_def[0] += (y * (def_vel[2][lag_idx - offset]) - z * (def_vel[1][lag_idx - offset]));
+                R_cross_U[0] += (y * (def_vel[2][lag_idx - offset]) - z * (def_vel[1][lag_idx - offset]));
 
-                    R_cross_U_def[1] += (-x * (def_vel[2][lag_idx - offset]) + z * (def_vel[0][lag_idx - offset]));
+                R_cross_U[1] += (-x * (def_vel[2][lag_idx - offset]) + z * (def_vel[0][lag_idx - offset]));
 
-                    R_cross_U_def[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
+                R_cross_U[2] += (x * (def_vel[1][lag_idx - offset]) - y * (def_vel[0][lag_idx - offset]));
 #endif
-                }
-            }
-            for (int d = 0; d < 3; ++d)
-            {
-                d_omega_com_def_new[position_handle][d] += R_cross_U_def[d];
             }
-            ptr_x_lag_data->restoreArrays();
-        } // all levels
-        SAMRAI_MPI::sumReduction(&d_omega_com_def_new[position_handle][0], 3);
+        } // all structs
+        ptr_x_lag_data->restoreArrays();
+    } // all levels
+
+    std::vector<std::vector<std::vector<double> >*> moments(2);
+    moments[0] = &U_com_def;
+    moments[1] = &R_cross_U_def;
+    packed_sum_reduction(moments);
+
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        if (!struct_param.getStructureIsSelfTranslating()) continue;
+
+        // Find linear velocity of deformational velocity.
+        Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
+        const int total_nodes = struct_param.getTotalNodes();
+        for (int d = 0; d < 3; ++d)
+        {
+            if (calculate_trans_mom[d])
+                d_vel_com_def_new[struct_no][d] = U_com_def[struct_no][d] / total_nodes;
+            else
+                d_vel_com_def_new[struct_no][d] = 0.0;
+        }
 
-// Find angular velocity of deformational velocity.
+        if (!struct_param.getStructureIsSelfRotating()) continue;
+
+        // Find angular velocity of deformational velocity.
+        d_omega_com_def_new[struct_no] = R_cross_U_def[struct_no];
 #if (NDIM == 2)
-        d_omega_com_def_new[position_handle][2] /= d_moment_of_inertia_new[position_handle](2, 2);
+        d_omega_com_def_new[struct_no][2] /= d_moment_of_inertia_new[struct_no](2, 2);
 #endif
 
 #if (NDIM == 3)
-        solveSystemOfEqns(d_omega_com_def_new[position_handle], d_moment_of_inertia_new[position_handle]);
+        solveSystemOfEqns(d_omega_com_def_new[struct_no], d_moment_of_inertia_new[struct_no]);
+        Array<int> calculate_rot_mom = struct_param.getCalculateRotationalMomentum();
         for (int d = 0; d < 3; ++d)
-            if (!calculate_rot_mom[d]) d_omega_com_def_new[position_handle][d] = 0.0;
+            if (!calculate_rot_mom[d]) d_omega_com_def_new[struct_no][d] = 0.0;
 #endif
-    } // if struct is rotating
+    }
 
     return;
 } // calculateMomentumOfKinematicsVelocity
@@ -1410,38 +1404,27 @@ ConstraintIBMethod::calculateRigidTranslationalMomentum()
 
         // Get LData corresponding to the present position of the structures.
         const boost::multi_array_ref<double, 2>& U_interp_data = *d_l_data_U_interp[ln]->getLocalFormVecArray();
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
+        // Get the local nodes of the structures on this level.
+        const StructureNodeBucket& bucket = getStructureNodeBucket(ln);
 
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (size_t struct_no = 0; struct_no < bucket.struct_handles.size(); ++struct_no)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
+            const int location_struct_handle = bucket.struct_handles[struct_no];
+            Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[location_struct_handle];
             const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
             if (!struct_param.getStructureIsSelfTranslating()) continue;
 
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-
             double U_rigid[NDIM] = { 0.0 };
+            const std::vector<LNode*>& local_nodes = bucket.local_nodes[location_struct_handle];
             for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
             {
                 const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
+                const int local_idx = node_idx->getLocalPETScIndex();
+                const double* const U = &U_interp_data[local_idx][0];
+                for (int d = 0; d < NDIM; ++d)
                 {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U = &U_interp_data[local_idx][0];
-                    for (int d = 0; d < NDIM; ++d)
-                    {
-                        U_rigid[d] += U[d];
-                    }
+                    U_rigid[d] += U[d];
                 }
             }
             for (int d = 0; d < NDIM; ++d) d_rigid_trans_vel_new[location_struct_handle][d] += U_rigid[d];
@@ -1449,12 +1432,14 @@ ConstraintIBMethod::calculateRigidTranslationalMomentum()
         d_l_data_U_interp[ln]->restoreArrays();
     } // all levels
 
+    std::vector<std::vector<std::vector<double> >*> trans_mom_data(1, &d_rigid_trans_vel_new);
+    packed_sum_reduction(trans_mom_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfTranslating())
         {
-            SAMRAI_MPI::sumReduction(&d_rigid_trans_vel_new[struct_no][0], NDIM);
             Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
             for (int d = 0; d < NDIM; ++d)
             {
@@ -1503,50 +1488,39 @@ ConstraintIBMethod::calculateRigidRotationalMomentum()
         // Get ponter to LData.
         const boost::multi_array_ref<double, 2>& U_interp_data = *d_l_data_U_interp[ln]->getLocalFormVecArray();
         const boost::multi_array_ref<double, 2>& X_data = *d_l_data_X_half_Euler[ln]->getLocalFormVecArray();
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
+        // Get the local nodes of the structures on this level.
+        const StructureNodeBucket& bucket = getStructureNodeBucket(ln);
 
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (size_t struct_no = 0; struct_no < bucket.struct_handles.size(); ++struct_no)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
+            const int location_struct_handle = bucket.struct_handles[struct_no];
+            Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[location_struct_handle];
             const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
             if (!struct_param.getStructureIsSelfRotating()) continue;
 
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
-
             double Omega_rigid[3] = { 0.0 };
+            const std::vector<LNode*>& local_nodes = bucket.local_nodes[location_struct_handle];
             for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
             {
                 const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U = &U_interp_data[local_idx][0];
-                    const double* const X = &X_data[local_idx][0];
+                const int local_idx = node_idx->getLocalPETScIndex();
+                const double* const U = &U_interp_data[local_idx][0];
+                const double* const X = &X_data[local_idx][0];
 #if (NDIM == 2)
-                    const double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    const double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
-                    Omega_rigid[2] += x * U[1] - y * U[0];
+                const double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
+                const double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
+                Omega_rigid[2] += x * U[1] - y * U[0];
 #endif
 
 #if (NDIM == 3)
-                    const double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    const double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
-                    const double z = X[2] - d_center_of_mass_new[location_struct_handle][2];
-                    Omega_rigid[0] += y * U[2] - z * U[1];
-                    Omega_rigid[1] += -x * U[2] + z * U[0];
-                    Omega_rigid[2] += x * U[1] - y * U[0];
+                const double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
+                const double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
+                const double z = X[2] - d_center_of_mass_new[location_struct_handle][2];
+                Omega_rigid[0] += y * U[2] - z * U[1];
+                Omega_rigid[1] += -x * U[2] + z * U[0];
+                Omega_rigid[2] += x * U[1] - y * U[0];
 #endif
-                }
             }
             for (int d = 0; d < 3; ++d) d_rigid_rot_vel_new[location_struct_handle][d] += Omega_rigid[d];
         } // all structs
@@ -1554,12 +1528,14 @@ ConstraintIBMethod::calculateRigidRotationalMomentum()
         d_l_data_X_half_Euler[ln]->restoreArrays();
     } // all levels
 
+    std::vector<std::vector<std::vector<double> >*> rot_mom_data(1, &d_rigid_rot_vel_new);
+    packed_sum_reduction(rot_mom_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfRotating())
         {
-            SAMRAI_MPI::sumReduction(&d_rigid_rot_vel_new[struct_no][0], 3);
 #if (NDIM == 2)
             d_rigid_rot_vel_new[struct_no][2] /= d_moment_of_inertia_new[struct_no](2, 2);
 #endif
@@ -1606,85 +1582,74 @@ ConstraintIBMethod::calculateCurrentLagrangianVelocity()
         boost::multi_array_ref<double, 2>& U_current_data = *d_l_data_U_current[ln]->getLocalFormVecArray();
         const boost::multi_array_ref<double, 2>& X_data = *d_l_data_manager->getLData("X", ln)->getLocalFormVecArray();
 
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        // Get the local nodes of the structures on this level.
+        const StructureNodeBucket& bucket = getStructureNodeBucket(ln);
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (size_t struct_no = 0; struct_no < bucket.struct_handles.size(); ++struct_no)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
+            const int location_struct_handle = bucket.struct_handles[struct_no];
+            const std::pair<int, int>& lag_idx_range = bucket.lag_idx_ranges[location_struct_handle];
             const int offset = lag_idx_range.first;
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[location_struct_handle];
             const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
             const std::vector<std::vector<double> >& current_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
 
+            const std::vector<LNode*>& local_nodes = bucket.local_nodes[location_struct_handle];
             for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
             {
                 const LNode* const node_idx = *cit;
                 const int lag_idx = node_idx->getLagrangianIndex();
+                const int local_idx = node_idx->getLocalPETScIndex();
+                double* const U_current = &U_current_data[local_idx][0];
+                const double* const X = &X_data[local_idx][0];
 
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
+                if (struct_param.getStructureIsSelfTranslating())
                 {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    double* const U_current = &U_current_data[local_idx][0];
-                    const double* const X = &X_data[local_idx][0];
-
-                    if (struct_param.getStructureIsSelfTranslating())
+                    if (struct_param.getStructureIsSelfRotating())
                     {
-                        if (struct_param.getStructureIsSelfRotating())
-                        {
-                            for (int d = 0; d < NDIM; ++d)
-                                R[d] = X[d] - d_center_of_mass_current[location_struct_handle][d];
-
-                            WxR[0] = R[2] * (d_rigid_rot_vel_current[location_struct_handle][1] -
-                                             d_omega_com_def_current[location_struct_handle][1]) -
-                                     R[1] * (d_rigid_rot_vel_current[location_struct_handle][2] -
-                                             d_omega_com_def_current[location_struct_handle][2]);
-
-                            WxR[1] = -R[2] * (d_rigid_rot_vel_current[location_struct_handle][0] -
-                                              d_omega_com_def_current[location_struct_handle][0]) +
-                                     R[0] * (d_rigid_rot_vel_current[location_struct_handle][2] -
-                                             d_omega_com_def_current[location_struct_handle][2]);
-
-                            WxR[2] = R[1] * (d_rigid_rot_vel_current[location_struct_handle][0] -
-                                             d_omega_com_def_current[location_struct_handle][0]) -
-                                     R[0] * (d_rigid_rot_vel_current[location_struct_handle][1] -
-                                             d_omega_com_def_current[location_struct_handle][1]);
-
-                            for (int d = 0; d < NDIM; ++d)
-                            {
-                                U_current[d] = d_rigid_trans_vel_current[location_struct_handle][d] -
-                                               d_vel_com_def_current[location_struct_handle][d] + WxR[d] +
-                                               current_vel[d][lag_idx - offset];
-                            }
-                        } // rotating
-                        else
+                        for (int d = 0; d < NDIM; ++d)
+                            R[d] = X[d] - d_center_of_mass_current[location_struct_handle][d];
+
+                        WxR[0] = R[2] * (d_rigid_rot_vel_current[location_struct_handle][1] -
+                                         d_omega_com_def_current[location_struct_handle][1]) -
+                                 R[1] * (d_rigid_rot_vel_current[location_struct_handle][2] -
+                                         d_omega_com_def_current[location_struct_handle][2]);
+
+                        WxR[1] = -R[2] * (d_rigid_rot_vel_current[location_struct_handle][0] -
+                                          d_omega_com_def_current[location_struct_handle][0]) +
+                                 R[0] * (d_rigid_rot_vel_current[location_struct_handle][2] -
+                                         d_omega_com_def_current[location_struct_handle][2]);
+
+                        WxR[2] = R[1] * (d_rigid_rot_vel_current[location_struct_handle][0] -
+                                         d_omega_com_def_current[location_struct_handle][0]) -
+                                 R[0] * (d_rigid_rot_vel_current[location_struct_handle][1] -
+                                         d_omega_com_def_current[location_struct_handle][1]);
+
+                        for (int d = 0; d < NDIM; ++d)
                         {
-                            for (int d = 0; d < NDIM; ++d)
-                            {
-                                U_current[d] = d_rigid_trans_vel_current[location_struct_handle][d] -
-                                               d_vel_com_def_current[location_struct_handle][d] +
-                                               current_vel[d][lag_idx - offset];
-                            }
-
-                        } // not rotating
-                    }
+                            U_current[d] = d_rigid_trans_vel_current[location_struct_handle][d] -
+                                           d_vel_com_def_current[location_struct_handle][d] + WxR[d] +
+                                           current_vel[d][lag_idx - offset];
+                        }
+                    } // rotating
                     else
                     {
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            U_current[d] = current_vel[d][lag_idx - offset];
+                            U_current[d] = d_rigid_trans_vel_current[location_struct_handle][d] -
+                                           d_vel_com_def_current[location_struct_handle][d] +
+                                           current_vel[d][lag_idx - offset];
                         }
-                    } // imposed momentum
 
-                } // choose a struct
+                    } // not rotating
+                }
+                else
+                {
+                    for (int d = 0; d < NDIM; ++d)
+                    {
+                        U_current[d] = current_vel[d][lag_idx - offset];
+                    }
+                } // imposed momentum
             }     // all nodes on a level
         }         // all structs
         d_l_data_U_current[ln]->restoreArrays();
@@ -1713,88 +1678,78 @@ ConstraintIBMethod::correctVelocityOnLagrangianMesh()
         boost::multi_array_ref<double, 2>& U_new_data = *d_l_data_U_new[ln]->getLocalFormVecArray();
         const boost::multi_array_ref<double, 2>& X_data = *d_l_data_X_half_Euler[ln]->getLocalFormVecArray();
 
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        // Get the local nodes of the structures on this level.
+        const StructureNodeBucket& bucket = getStructureNodeBucket(ln);
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (size_t struct_no = 0; struct_no < bucket.struct_handles.size(); ++struct_no)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
+            const int location_struct_handle = bucket.struct_handles[struct_no];
+            const std::pair<int, int>& lag_idx_range = bucket.lag_idx_ranges[location_struct_handle];
             const int offset = lag_idx_range.first;
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[location_struct_handle];
             const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
             const std::vector<std::vector<double> >& new_vel = ptr_ib_kinematics->getKinematicsVelocity(ln);
 
+            const std::vector<LNode*>& local_nodes = bucket.local_nodes[location_struct_handle];
             for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
             {
                 const LNode* const node_idx = *cit;
                 const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U = &U_interp_data[local_idx][0];
-                    double* const U_corr = &U_corr_data[local_idx][0];
-                    double* const U_new = &U_new_data[local_idx][0];
-                    const double* const X = &X_data[local_idx][0];
+                const int local_idx = node_idx->getLocalPETScIndex();
+                const double* const U = &U_interp_data[local_idx][0];
+                double* const U_corr = &U_corr_data[local_idx][0];
+                double* const U_new = &U_new_data[local_idx][0];
+                const double* const X = &X_data[local_idx][0];
 
-                    if (struct_param.getStructureIsSelfTranslating())
+                if (struct_param.getStructureIsSelfTranslating())
+                {
+                    if (struct_param.getStructureIsSelfRotating())
                     {
-                        if (struct_param.getStructureIsSelfRotating())
-                        {
-                            for (int d = 0; d < NDIM; ++d)
-                                R[d] = X[d] - d_center_of_mass_new[location_struct_handle][d];
-
-                            WxR[0] = R[2] * (d_rigid_rot_vel_new[location_struct_handle][1] -
-                                             d_omega_com_def_new[location_struct_handle][1]) -
-                                     R[1] * (d_rigid_rot_vel_new[location_struct_handle][2] -
-                                             d_omega_com_def_new[location_struct_handle][2]);
-
-                            WxR[1] = -R[2] * (d_rigid_rot_vel_new[location_struct_handle][0] -
-                                              d_omega_com_def_new[location_struct_handle][0]) +
-                                     R[0] * (d_rigid_rot_vel_new[location_struct_handle][2] -
-                                             d_omega_com_def_new[location_struct_handle][2]);
-
-                            WxR[2] = R[1] * (d_rigid_rot_vel_new[location_struct_handle][0] -
-                                             d_omega_com_def_new[location_struct_handle][0]) -
-                                     R[0] * (d_rigid_rot_vel_new[location_struct_handle][1] -
-                                             d_omega_com_def_new[location_struct_handle][1]);
-
-                            for (int d = 0; d < NDIM; ++d)
-                            {
-                                U_new[d] = d_rigid_trans_vel_new[location_struct_handle][d] -
-                                           d_vel_com_def_new[location_struct_handle][d] + WxR[d] +
-                                           new_vel[d][lag_idx - offset];
-                                U_corr[d] = (U_new[d] - U[d]) * d_vol_element[location_struct_handle];
-                            }
-                        } // rotating
-                        else
+                        for (int d = 0; d < NDIM; ++d)
+                            R[d] = X[d] - d_center_of_mass_new[location_struct_handle][d];
+
+                        WxR[0] = R[2] * (d_rigid_rot_vel_new[location_struct_handle][1] -
+                                         d_omega_com_def_new[location_struct_handle][1]) -
+                                 R[1] * (d_rigid_rot_vel_new[location_struct_handle][2] -
+                                         d_omega_com_def_new[location_struct_handle][2]);
+
+                        WxR[1] = -R[2] * (d_rigid_rot_vel_new[location_struct_handle][0] -
+                                          d_omega_com_def_new[location_struct_handle][0]) +
+                                 R[0] * (d_rigid_rot_vel_new[location_struct_handle][2] -
+                                         d_omega_com_def_new[location_struct_handle][2]);
+
+                        WxR[2] = R[1] * (d_rigid_rot_vel_new[location_struct_handle][0] -
+                                         d_omega_com_def_new[location_struct_handle][0]) -
+                                 R[0] * (d_rigid_rot_vel_new[location_struct_handle][1] -
+                                         d_omega_com_def_new[location_struct_handle][1]);
+
+                        for (int d = 0; d < NDIM; ++d)
                         {
-                            for (int d = 0; d < NDIM; ++d)
-                            {
-                                U_new[d] = d_rigid_trans_vel_new[location_struct_handle][d] -
-                                           d_vel_com_def_new[location_struct_handle][d] + new_vel[d][lag_idx - offset];
-                                U_corr[d] = (U_new[d] - U[d]) * d_vol_element[location_struct_handle];
-                            }
-
-                        } // not rotating
-                    }
+                            U_new[d] = d_rigid_trans_vel_new[location_struct_handle][d] -
+                                       d_vel_com_def_new[location_struct_handle][d] + WxR[d] +
+                                       new_vel[d][lag_idx - offset];
+                            U_corr[d] = (U_new[d] - U[d]) * d_vol_element[location_struct_handle];
+                        }
+                    } // rotating
                     else
                     {
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            U_new[d] = new_vel[d][lag_idx - offset];
+                            U_new[d] = d_rigid_trans_vel_new[location_struct_handle][d] -
+                                       d_vel_com_def_new[location_struct_handle][d] + new_vel[d][lag_idx - offset];
                             U_corr[d] = (U_new[d] - U[d]) * d_vol_element[location_struct_handle];
                         }
-                    } // imposed momentum
 
-                } // choose a struct
+                    } // not rotating
+                }
+                else
+                {
+                    for (int d = 0; d < NDIM; ++d)
+                    {
+                        U_new[d] = new_vel[d][lag_idx - offset];
+                        U_corr[d] = (U_new[d] - U[d]) * d_vol_element[location_struct_handle];
+                    }
+                } // imposed momentum
             }     // all nodes on a level
         }         // all structs
         d_l_data_U_interp[ln]->restoreArrays();
@@ -1967,69 +1922,60 @@ ConstraintIBMethod::updateStructurePositionEulerStep()
             *d_l_data_manager->getLData("X", ln)->getLocalFormVecArray();
         const boost::multi_array_ref<double, 2>& U_current_data = *d_l_data_U_current[ln]->getLocalFormVecArray();
 
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
+        // Get the local nodes of the structures on this level.
+        const StructureNodeBucket& bucket = getStructureNodeBucket(ln);
 
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (size_t struct_no = 0; struct_no < bucket.struct_handles.size(); ++struct_no)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
+            const int location_struct_handle = bucket.struct_handles[struct_no];
+            const std::pair<int, int>& lag_idx_range = bucket.lag_idx_ranges[location_struct_handle];
             const int offset = lag_idx_range.first;
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[location_struct_handle];
             const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
             const std::string position_update_method = struct_param.getPositionUpdateMethod();
             const std::vector<std::vector<double> >& current_shape = ptr_ib_kinematics->getShape(ln);
 
+            const std::vector<LNode*>& local_nodes = bucket.local_nodes[location_struct_handle];
             for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
             {
                 const LNode* const node_idx = *cit;
                 const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
+                const int local_idx = node_idx->getLocalPETScIndex();
+                const double* const U_current = &U_current_data[local_idx][0];
+                const double* const X_current = &X_current_data[local_idx][0];
+                double* const X_half = &X_half_Euler_data[local_idx][0];
+                if (position_update_method == "CONSTRAINT_VELOCITY")
                 {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U_current = &U_current_data[local_idx][0];
-                    const double* const X_current = &X_current_data[local_idx][0];
-                    double* const X_half = &X_half_Euler_data[local_idx][0];
-                    if (position_update_method == "CONSTRAINT_VELOCITY")
-                    {
-                        for (int d = 0; d < NDIM; ++d)
-                        {
-                            X_half[d] = X_current[d] + 0.5 * dt * U_current[d];
-                        }
-                    }
-                    else if (position_update_method == "CONSTRAINT_POSITION")
+                    for (int d = 0; d < NDIM; ++d)
                     {
-                        for (int d = 0; d < NDIM; ++d)
-                        {
-                            X_half[d] = d_center_of_mass_current[location_struct_handle][d] +
-                                        current_shape[d][lag_idx - offset] +
-                                        0.5 * dt * (d_rigid_trans_vel_current[location_struct_handle][d]);
-                        }
+                        X_half[d] = X_current[d] + 0.5 * dt * U_current[d];
                     }
-                    else if (position_update_method == "CONSTRAINT_EXPT_POSITION")
+                }
+                else if (position_update_method == "CONSTRAINT_POSITION")
+                {
+                    for (int d = 0; d < NDIM; ++d)
                     {
-                        for (int d = 0; d < NDIM; ++d)
-                        {
-                            X_half[d] = current_shape[d][lag_idx - offset];
-                        }
+                        X_half[d] = d_center_of_mass_current[location_struct_handle][d] +
+                                    current_shape[d][lag_idx - offset] +
+                                    0.5 * dt * (d_rigid_trans_vel_current[location_struct_handle][d]);
                     }
-                    else
+                }
+                else if (position_update_method == "CONSTRAINT_EXPT_POSITION")
+                {
+                    for (int d = 0; d < NDIM; ++d)
                     {
-                        TBOX_ERROR(
-                            "ConstraintIBMethod::updateStructurePositionEulerStep():: Unknown position update method "
-                            "encountered"
-                            << "Supported methods are : CONSTRAINT_VELOCITY, CONSTRAINT_POSITION AND "
-                               "CONSTRAINT_EXPT_POSITION "
-                            << std::endl);
+                        X_half[d] = current_shape[d][lag_idx - offset];
                     }
                 }
+                else
+                {
+                    TBOX_ERROR(
+                        "ConstraintIBMethod::updateStructurePositionEulerStep():: Unknown position update method "
+                        "encountered"
+                        << "Supported methods are : CONSTRAINT_VELOCITY, CONSTRAINT_POSITION AND "
+                           "CONSTRAINT_EXPT_POSITION "
+                        << std::endl);
+                }
             }
         } // all structs
         d_l_data_X_half_Euler[ln]->restoreArrays();
@@ -2071,72 +2017,63 @@ ConstraintIBMethod::updateStructurePositionMidPointStep()
             *d_l_data_manager->getLData("X", ln)->getLocalFormVecArray();
         const boost::multi_array_ref<double, 2>& U_half_data = *d_l_data_U_half[ln]->getLocalFormVecArray();
 
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
+        // Get the local nodes of the structures on this level.
+        const StructureNodeBucket& bucket = getStructureNodeBucket(ln);
 
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (size_t struct_no = 0; struct_no < bucket.struct_handles.size(); ++struct_no)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
+            const int location_struct_handle = bucket.struct_handles[struct_no];
+            const std::pair<int, int>& lag_idx_range = bucket.lag_idx_ranges[location_struct_handle];
             const int offset = lag_idx_range.first;
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            Pointer<ConstraintIBKinematics> ptr_ib_kinematics = d_ib_kinematics[location_struct_handle];
             const StructureParameters& struct_param = ptr_ib_kinematics->getStructureParameters();
             const std::string position_update_method = struct_param.getPositionUpdateMethod();
             const std::vector<std::vector<double> >& new_shape = ptr_ib_kinematics->getShape(ln);
 
+            const std::vector<LNode*>& local_nodes = bucket.local_nodes[location_struct_handle];
             for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
             {
                 const LNode* const node_idx = *cit;
                 const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U_half = &U_half_data[local_idx][0];
-                    const double* const X_current = &X_current_data[local_idx][0];
-                    double* const X_new = &X_new_MidPoint_data[local_idx][0];
+                const int local_idx = node_idx->getLocalPETScIndex();
+                const double* const U_half = &U_half_data[local_idx][0];
+                const double* const X_current = &X_current_data[local_idx][0];
+                double* const X_new = &X_new_MidPoint_data[local_idx][0];
 
-                    if (position_update_method == "CONSTRAINT_VELOCITY")
-                    {
-                        for (int d = 0; d < NDIM; ++d)
-                        {
-                            X_new[d] = X_current[d] + dt * U_half[d];
-                        }
-                    }
-                    else if (position_update_method == "CONSTRAINT_POSITION")
+                if (position_update_method == "CONSTRAINT_VELOCITY")
+                {
+                    for (int d = 0; d < NDIM; ++d)
                     {
-                        for (int d = 0; d < NDIM; ++d)
-                        {
-                            X_new[d] = d_center_of_mass_current[location_struct_handle][d] +
-                                       new_shape[d][lag_idx - offset] +
-                                       dt * 0.5 *
-                                           (d_rigid_trans_vel_current[location_struct_handle][d] +
-                                            d_rigid_trans_vel_new[location_struct_handle][d]);
-                        }
+                        X_new[d] = X_current[d] + dt * U_half[d];
                     }
-                    else if (position_update_method == "CONSTRAINT_EXPT_POSITION")
+                }
+                else if (position_update_method == "CONSTRAINT_POSITION")
+                {
+                    for (int d = 0; d < NDIM; ++d)
                     {
-                        for (int d = 0; d < NDIM; ++d)
-                        {
-                            X_new[d] = new_shape[d][lag_idx - offset];
-                        }
+                        X_new[d] = d_center_of_mass_current[location_struct_handle][d] +
+                                   new_shape[d][lag_idx - offset] +
+                                   dt * 0.5 *
+                                       (d_rigid_trans_vel_current[location_struct_handle][d] +
+                                        d_rigid_trans_vel_new[location_struct_handle][d]);
                     }
-                    else
+                }
+                else if (position_update_method == "CONSTRAINT_EXPT_POSITION")
+                {
+                    for (int d = 0; d < NDIM; ++d)
                     {
-                        TBOX_ERROR(
-                            "ConstraintIBMethod::updateStructurePositionMidPointStep():: Unknown position update "
-                            "method encountered"
-                            << "Supported methods are : CONSTRAINT_VELOCITY, CONSTRAINT_POSITION AND "
-                               "CONSTRAINT_EXPT_POSITION "
-                            << std::endl);
+                        X_new[d] = new_shape[d][lag_idx - offset];
                     }
                 }
+                else
+                {
+                    TBOX_ERROR(
+                        "ConstraintIBMethod::updateStructurePositionMidPointStep():: Unknown position update "
+                        "method encountered"
+                        << "Supported methods are : CONSTRAINT_VELOCITY, CONSTRAINT_POSITION AND "
+                           "CONSTRAINT_EXPT_POSITION "
+                        << std::endl);
+                }
             }
         } // all structs
         d_l_data_X_new_MidPoint[ln]->restoreArrays();
@@ -2305,38 +2242,26 @@ ConstraintIBMethod::calculateDrag()
         const boost::multi_array_ref<double, 2>& U_current_data = *d_l_data_U_current[ln]->getLocalFormVecArray();
         const boost::multi_array_ref<double, 2>& U_correction_data = *d_l_data_U_correction[ln]->getLocalFormVecArray();
 
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
+        // Get the local nodes of the structures on this level.
+        const StructureNodeBucket& bucket = getStructureNodeBucket(ln);
 
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (size_t struct_no = 0; struct_no < bucket.struct_handles.size(); ++struct_no)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            const int location_struct_handle = bucket.struct_handles[struct_no];
 
+            const std::vector<LNode*>& local_nodes = bucket.local_nodes[location_struct_handle];
             for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
             {
                 const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U_new = &U_new_data[local_idx][0];
-                    const double* const U_current = &U_current_data[local_idx][0];
-                    const double* const U_correction = &U_correction_data[local_idx][0];
+                const int local_idx = node_idx->getLocalPETScIndex();
+                const double* const U_new = &U_new_data[local_idx][0];
+                const double* const U_current = &U_current_data[local_idx][0];
+                const double* const U_correction = &U_correction_data[local_idx][0];
 
-                    for (int d = 0; d < NDIM; ++d)
-                    {
-                        inertia_force[location_struct_handle][d] += U_new[d] - U_current[d];
-                        constraint_force[location_struct_handle][d] += U_correction[d];
-                    }
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    inertia_force[location_struct_handle][d] += U_new[d] - U_current[d];
+                    constraint_force[location_struct_handle][d] += U_correction[d];
                 }
             }
         } // all structs
@@ -2345,10 +2270,13 @@ ConstraintIBMethod::calculateDrag()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    std::vector<std::vector<std::vector<double> >*> force_data(2);
+    force_data[0] = &inertia_force;
+    force_data[1] = &constraint_force;
+    packed_sum_reduction(force_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_force[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_force[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_force[struct_no][d] *= (d_rho_fluid / dt) * d_vol_element[struct_no];
@@ -2390,64 +2318,52 @@ ConstraintIBMethod::calculateTorque()
         const boost::multi_array_ref<double, 2>& U_correction_data = *d_l_data_U_correction[ln]->getLocalFormVecArray();
         const boost::multi_array_ref<double, 2>& X_data = *d_X_new_data[ln]->getLocalFormVecArray();
 
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        // Get the local nodes of the structures on this level.
+        const StructureNodeBucket& bucket = getStructureNodeBucket(ln);
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (size_t struct_no = 0; struct_no < bucket.struct_handles.size(); ++struct_no)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            const int location_struct_handle = bucket.struct_handles[struct_no];
 
+            const std::vector<LNode*>& local_nodes = bucket.local_nodes[location_struct_handle];
             for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
             {
                 const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U_new = &U_new_data[local_idx][0];
-                    const double* const U_current = &U_current_data[local_idx][0];
-                    const double* const U_correction = &U_correction_data[local_idx][0];
-                    const double* const X = &X_data[local_idx][0];
+                const int local_idx = node_idx->getLocalPETScIndex();
+                const double* const U_new = &U_new_data[local_idx][0];
+                const double* const U_current = &U_current_data[local_idx][0];
+                const double* const U_correction = &U_correction_data[local_idx][0];
+                const double* const X = &X_data[local_idx][0];
 #if (NDIM == 2)
-                    double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
+                double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
+                double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
 
-                    R_cross_U_inertia[2] = (x * (U_new[1] - U_current[1]) - y * (U_new[0] - U_current[0]));
-                    R_cross_U_constraint[2] = (x * (U_correction[1]) - y * (U_correction[0]));
+                R_cross_U_inertia[2] = (x * (U_new[1] - U_current[1]) - y * (U_new[0] - U_current[0]));
+                R_cross_U_constraint[2] = (x * (U_correction[1]) - y * (U_correction[0]));
 #endif
 
 #if (NDIM == 3)
-                    double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
-                    double z = X[2] - d_center_of_mass_new[location_struct_handle][2];
+                double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
+                double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
+                double z = X[2] - d_center_of_mass_new[location_struct_handle][2];
 
-                    R_cross_U_inertia[0] = (y * (U_new[2] - U_current[2]) - z * (U_new[1] - U_current[1]));
+                R_cross_U_inertia[0] = (y * (U_new[2] - U_current[2]) - z * (U_new[1] - U_current[1]));
 
-                    R_cross_U_inertia[1] = (-x * (U_new[2] - U_current[2]) + z * (U_new[0] - U_current[0]));
+                R_cross_U_inertia[1] = (-x * (U_new[2] - U_current[2]) + z * (U_new[0] - U_current[0]));
 
-                    R_cross_U_inertia[2] = (x * (U_new[1] - U_current[1]) - y * (U_new[0] - U_current[0]));
+                R_cross_U_inertia[2] = (x * (U_new[1] - U_current[1]) - y * (U_new[0] - U_current[0]));
 
-                    R_cross_U_constraint[0] = (y * (U_correction[2]) - z * (U_correction[1]));
+                R_cross_U_constraint[0] = (y * (U_correction[2]) - z * (U_correction[1]));
 
-                    R_cross_U_constraint[1] = (-x * (U_correction[2]) + z * (U_correction[0]));
+                R_cross_U_constraint[1] = (-x * (U_correction[2]) + z * (U_correction[0]));
 
-                    R_cross_U_constraint[2] = (x * (U_correction[1]) - y * (U_correction[0]));
+                R_cross_U_constraint[2] = (x * (U_correction[1]) - y * (U_correction[0]));
 #endif
 
-                    for (int d = 0; d < 3; ++d)
-                    {
-                        inertia_torque[location_struct_handle][d] += R_cross_U_inertia[d];
-                        constraint_torque[location_struct_handle][d] += R_cross_U_constraint[d];
-                    }
+                for (int d = 0; d < 3; ++d)
+                {
+                    inertia_torque[location_struct_handle][d] += R_cross_U_inertia[d];
+                    constraint_torque[location_struct_handle][d] += R_cross_U_constraint[d];
                 }
             }
         } // all structs
@@ -2456,10 +2372,13 @@ ConstraintIBMethod::calculateTorque()
         d_l_data_U_correction[ln]->restoreArrays();
         d_X_new_data[ln]->restoreArrays();
     }
+    std::vector<std::vector<std::vector<double> >*> torque_data(2);
+    torque_data[0] = &inertia_torque;
+    torque_data[1] = &constraint_torque;
+    packed_sum_reduction(torque_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_torque[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_torque[struct_no][0], 3);
         for (int d = 0; d < 3; ++d)
         {
             inertia_torque[struct_no][d] *= (d_rho_fluid / dt) * d_vol_element[struct_no];
@@ -2499,38 +2418,26 @@ ConstraintIBMethod::calculatePower()
         const boost::multi_array_ref<double, 2>& U_current_data = *d_l_data_U_current[ln]->getLocalFormVecArray();
         const boost::multi_array_ref<double, 2>& U_correction_data = *d_l_data_U_correction[ln]->getLocalFormVecArray();
 
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+        // Get the local nodes of the structures on this level.
+        const StructureNodeBucket& bucket = getStructureNodeBucket(ln);
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
-
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (size_t struct_no = 0; struct_no < bucket.struct_handles.size(); ++struct_no)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            const int location_struct_handle = bucket.struct_handles[struct_no];
 
+            const std::vector<LNode*>& local_nodes = bucket.local_nodes[location_struct_handle];
             for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
             {
                 const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U_new = &U_new_data[local_idx][0];
-                    const double* const U_current = &U_current_data[local_idx][0];
-                    const double* const U_correction = &U_correction_data[local_idx][0];
+                const int local_idx = node_idx->getLocalPETScIndex();
+                const double* const U_new = &U_new_data[local_idx][0];
+                const double* const U_current = &U_current_data[local_idx][0];
+                const double* const U_correction = &U_correction_data[local_idx][0];
 
-                    for (int d = 0; d < NDIM; ++d)
-                    {
-                        inertia_power[location_struct_handle][d] += (U_new[d] - U_current[d]) * U_new[d];
-                        constraint_power[location_struct_handle][d] += U_correction[d] * U_new[d];
-                    }
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    inertia_power[location_struct_handle][d] += (U_new[d] - U_current[d]) * U_new[d];
+                    constraint_power[location_struct_handle][d] += U_correction[d] * U_new[d];
                 }
             }
         } // all structs
@@ -2539,10 +2446,13 @@ ConstraintIBMethod::calculatePower()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    std::vector<std::vector<std::vector<double> >*> power_data(2);
+    power_data[0] = &inertia_power;
+    power_data[1] = &constraint_power;
+    packed_sum_reduction(power_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&inertia_power[struct_no][0], 3);
-        SAMRAI_MPI::sumReduction(&constraint_power[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_power[struct_no][d] *= (d_rho_fluid / dt) * d_vol_element[struct_no];
@@ -2575,44 +2485,35 @@ ConstraintIBMethod::calculateStructureMomentum()
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
 
         const boost::multi_array_ref<double, 2>& U_new_data = *d_l_data_U_new[ln]->getLocalFormVecArray();
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
 
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
+        // Get the local nodes of the structures on this level.
+        const StructureNodeBucket& bucket = getStructureNodeBucket(ln);
 
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (size_t struct_no = 0; struct_no < bucket.struct_handles.size(); ++struct_no)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            const int location_struct_handle = bucket.struct_handles[struct_no];
 
+            const std::vector<LNode*>& local_nodes = bucket.local_nodes[location_struct_handle];
             for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
             {
                 const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U_new = &U_new_data[local_idx][0];
+                const int local_idx = node_idx->getLocalPETScIndex();
+                const double* const U_new = &U_new_data[local_idx][0];
 
-                    for (int d = 0; d < NDIM; ++d)
-                    {
-                        d_structure_mom[location_struct_handle][d] += U_new[d];
-                    }
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    d_structure_mom[location_struct_handle][d] += U_new[d];
                 }
             }
         } // all structs
         d_l_data_U_new[ln]->restoreArrays();
     }
 
+    std::vector<std::vector<std::vector<double> >*> mom_data(1, &d_structure_mom);
+    packed_sum_reduction(mom_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&d_structure_mom[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             d_structure_mom[struct_no][d] *= d_rho_fluid * d_vol_element[struct_no];
@@ -2637,62 +2538,52 @@ ConstraintIBMethod::calculateStructureRotationalMomentum()
         const boost::multi_array_ref<double, 2>& U_new_data = *d_l_data_U_new[ln]->getLocalFormVecArray();
         const boost::multi_array_ref<double, 2>& X_data = *d_X_new_data[ln]->getLocalFormVecArray();
 
-        const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
-        const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
-
-        // Get structures on this level.
-        const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
-        const size_t structs_on_this_ln = structIDs.size();
+        // Get the local nodes of the structures on this level.
+        const StructureNodeBucket& bucket = getStructureNodeBucket(ln);
 
-        for (size_t struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        for (size_t struct_no = 0; struct_no < bucket.struct_handles.size(); ++struct_no)
         {
-            std::pair<int, int> lag_idx_range =
-                d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
-            Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
-                *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
-            const int location_struct_handle =
-                find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+            const int location_struct_handle = bucket.struct_handles[struct_no];
 
+            const std::vector<LNode*>& local_nodes = bucket.local_nodes[location_struct_handle];
             for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
             {
                 const LNode* const node_idx = *cit;
-                const int lag_idx = node_idx->getLagrangianIndex();
-                if (lag_idx_range.first <= lag_idx && lag_idx < lag_idx_range.second)
-                {
-                    const int local_idx = node_idx->getLocalPETScIndex();
-                    const double* const U_new = &U_new_data[local_idx][0];
-                    const double* const X = &X_data[local_idx][0];
+                const int local_idx = node_idx->getLocalPETScIndex();
+                const double* const U_new = &U_new_data[local_idx][0];
+                const double* const X = &X_data[local_idx][0];
 #if (NDIM == 2)
-                    double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
-                    R_cross_U[2] = (x * (U_new[1]) - y * (U_new[0]));
+                double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
+                double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
+                R_cross_U[2] = (x * (U_new[1]) - y * (U_new[0]));
 #endif
 
 #if (NDIM == 3)
-                    double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
-                    double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
-                    double z = X[2] - d_center_of_mass_new[location_struct_handle][2];
+                double x = X[0] - d_center_of_mass_new[location_struct_handle][0];
+                double y = X[1] - d_center_of_mass_new[location_struct_handle][1];
+                double z = X[2] - d_center_of_mass_new[location_struct_handle][2];
 
-                    R_cross_U[0] = (y * (U_new[2]) - z * (U_new[1]));
+                R_cross_U[0] = (y * (U_new[2]) - z * (U_new[1]));
 
-                    R_cross_U[1] = (-x * (U_new[2]) + z * (U_new[0]));
+                R_cross_U[1] = (-x * (U_new[2]) + z * (U_new[0]));
 
-                    R_cross_U[2] = (x * (U_new[1]) - y * (U_new[0]));
+                R_cross_U[2] = (x * (U_new[1]) - y * (U_new[0]));
 #endif
 
-                    for (int d = 0; d < 3; ++d)
-                    {
-                        d_structure_rotational_mom[location_struct_handle][d] += R_cross_U[d];
-                    }
+                for (int d = 0; d < 3; ++d)
+                {
+                    d_structure_rotational_mom[location_struct_handle][d] += R_cross_U[d];
                 }
             }
         } // all structs
         d_l_data_U_new[ln]->restoreArrays();
         d_X_new_data[ln]->restoreArrays();
     }
+    std::vector<std::vector<std::vector<double> >*> mom_data(1, &d_structure_rotational_mom);
+    packed_sum_reduction(mom_data);
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        SAMRAI_MPI::sumReduction(&d_structure_rotational_mom[struct_no][0], 3);
         for (int d = 0; d < 3; ++d)
         {
             d_structure_rotational_mom[struct_no][d] *= d_rho_fluid * d_vol_element[struct_no];
@@ -2702,4 +2593,55 @@ ConstraintIBMethod::calculateStructureRotationalMomentum()
     return;
 } // calculateStructureRotationalMomentum
 
+const ConstraintIBMethod::StructureNodeBucket&
+ConstraintIBMethod::getStructureNodeBucket(const int ln)
+{
+    if (static_cast<int>(d_struct_node_buckets.size()) <= ln) d_struct_node_buckets.resize(ln + 1);
+    StructureNodeBucket& bucket = d_struct_node_buckets[ln];
+
+    // The LMesh of a level is replaced whenever Lagrangian data is
+    // redistributed, so the bucket only needs to be rebuilt when it changes.
+    const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
+    if (!bucket.mesh.isNull() && bucket.mesh.getPointer() == mesh.getPointer()) return bucket;
+
+    bucket.mesh = mesh;
+    bucket.struct_handles.clear();
+    bucket.lag_idx_ranges.assign(d_no_structures, std::make_pair(-1, -1));
+    bucket.local_nodes.assign(d_no_structures, std::vector<LNode*>());
+
+    // Sort the index ranges of the structures on this level so that the
+    // structure containing each node can be found by a binary search.
+    const std::vector<int> structIDs = d_l_data_manager->getLagrangianStructureIDs(ln);
+    std::vector<std::pair<int, int> > range_starts;
+    for (size_t struct_no = 0; struct_no < structIDs.size(); ++struct_no)
+    {
+        std::pair<int, int> lag_idx_range =
+            d_l_data_manager->getLagrangianStructureIndexRange(structIDs[struct_no], ln);
+        Pointer<ConstraintIBKinematics> ptr_ib_kinematics =
+            *std::find_if(d_ib_kinematics.begin(), d_ib_kinematics.end(), find_struct_handle(lag_idx_range));
+        const int location_struct_handle =
+            find_struct_handle_position(d_ib_kinematics.begin(), d_ib_kinematics.end(), ptr_ib_kinematics);
+        bucket.struct_handles.push_back(location_struct_handle);
+        bucket.lag_idx_ranges[location_struct_handle] = lag_idx_range;
+        range_starts.push_back(std::make_pair(lag_idx_range.first, location_struct_handle));
+    }
+    std::sort(range_starts.begin(), range_starts.end());
+
+    const std::vector<LNode*>& local_nodes = mesh->getLocalNodes();
+    for (std::vector<LNode*>::const_iterator cit = local_nodes.begin(); cit != local_nodes.end(); ++cit)
+    {
+        LNode* const node_idx = *cit;
+        const int lag_idx = node_idx->getLagrangianIndex();
+        std::vector<std::pair<int, int> >::const_iterator it = std::upper_bound(
+            range_starts.begin(), range_starts.end(), std::make_pair(lag_idx, std::numeric_limits<int>::max()));
+        if (it == range_starts.begin()) continue;
+        const int location_struct_handle = (--it)->second;
+        if (lag_idx < bucket.lag_idx_ranges[location_struct_handle].second)
+        {
+            bucket.local_nodes[location_struct_handle].push_back(node_idx);
+        }
+    }
+    return bucket;
+} // getStructureNodeBucket
+
 } // namespace IBAMR
@@ -101,12 +101,15 @@ IBExplicitHierarchyIntegrator::IBExplicitHierarchyIntegrator(const std::string&
 {
     // Set default configuration options.
     d_use_structure_predictor = true;
+    d_num_lagrangian_substeps = 1;
 
     // Set options from input.
     if (input_db)
     {
         if (input_db->keyExists("use_structure_predictor"))
             d_use_structure_predictor = input_db->getBool("use_structure_predictor");
+        if (input_db->keyExists("num_lagrangian_substeps"))
+            setNumberOfLagrangianSubsteps(input_db->getInteger("num_lagrangian_substeps"));
     }
 
     // Initialize object with data read from the input and restart databases.
@@ -167,6 +170,21 @@ IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double current
     }
     d_ins_hier_integrator->preprocessIntegrateHierarchy(current_time, new_time, ins_num_cycles);
 
+    // Check that multirate Lagrangian substepping is compatible with the
+    // selected time stepping scheme.
+    const bool use_multirate_substeps = d_num_lagrangian_substeps > 1;
+    if (use_multirate_substeps && (d_time_stepping_type != FORWARD_EULER || d_current_num_cycles != 1))
+    {
+        TBOX_ERROR(d_object_name << "::preprocessIntegrateHierarchy():\n"
+                                 << "  multirate Lagrangian substepping requires time stepping type FORWARD_EULER "
+                                    "and a single cycle per time step.\n"
+                                 << "  time stepping type = "
+                                 << enum_to_string<TimeSteppingType>(d_time_stepping_type)
+                                 << ", number of cycles = "
+                                 << d_current_num_cycles
+                                 << ".\n");
+    }
+
     // Compute the Lagrangian forces and spread them to the Eulerian grid.
     switch (d_time_stepping_type)
     {
@@ -203,8 +221,10 @@ IBExplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const double current
     // structure.
     //
     // NOTE: The velocity should already have been interpolated to the
-    // curvilinear mesh and should not need to be re-interpolated.
-    if (d_use_structure_predictor)
+    // curvilinear mesh and should not need to be re-interpolated.  When
+    // multirate substepping is enabled, the prediction is instead computed by
+    // the provisional substeps taken in integrateHierarchy().
+    if (d_use_structure_predictor && !use_multirate_substeps)
     {
         if (d_enable_logging)
             plog << d_object_name << "::preprocessIntegrateHierarchy(): performing Lagrangian forward Euler step\n";
@@ -233,6 +253,8 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
     switch (d_time_stepping_type)
     {
     case FORWARD_EULER:
+        if (d_num_lagrangian_substeps > 1) spreadMultirateLagrangianForce(current_time, new_time);
+        break;
     case BACKWARD_EULER:
         // intentionally blank
         break;
@@ -315,6 +337,9 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
     {
     case FORWARD_EULER:
     case BACKWARD_EULER:
+        // NOTE: With multirate substepping, the velocity is interpolated
+        // separately for each Lagrangian substep.
+        if (d_num_lagrangian_substeps > 1) break;
         d_hier_velocity_data_ops->copyData(d_u_idx, u_new_idx);
         if (d_enable_logging)
             plog << d_object_name << "::integrateHierarchy(): interpolating Eulerian velocity to "
@@ -374,7 +399,14 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
         {
         case FORWARD_EULER:
         case BACKWARD_EULER:
-            d_ib_method_ops->backwardEulerStep(current_time, new_time);
+            if (d_num_lagrangian_substeps > 1)
+            {
+                performMultirateLagrangianSubsteps(current_time, new_time);
+            }
+            else
+            {
+                d_ib_method_ops->backwardEulerStep(current_time, new_time);
+            }
             break;
         case MIDPOINT_RULE:
             if (d_enable_logging)
@@ -526,6 +558,24 @@ IBExplicitHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHierar
     return;
 } // initializeHierarchyIntegrator
 
+void
+IBExplicitHierarchyIntegrator::setNumberOfLagrangianSubsteps(const int num_lagrangian_substeps)
+{
+    if (num_lagrangian_substeps < 1)
+    {
+        TBOX_ERROR(d_object_name << "::setNumberOfLagrangianSubsteps():\n"
+                                 << "  number of Lagrangian substeps must be positive.\n");
+    }
+    d_num_lagrangian_substeps = num_lagrangian_substeps;
+    return;
+} // setNumberOfLagrangianSubsteps
+
+int
+IBExplicitHierarchyIntegrator::getNumberOfLagrangianSubsteps() const
+{
+    return d_num_lagrangian_substeps;
+} // getNumberOfLagrangianSubsteps
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 void
@@ -561,6 +611,75 @@ IBExplicitHierarchyIntegrator::getFromRestart()
     return;
 } // getFromRestart
 
+void
+IBExplicitHierarchyIntegrator::spreadMultirateLagrangianForce(const double current_time, const double new_time)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int u_current_idx = var_db->mapVariableAndContextToIndex(d_ins_hier_integrator->getVelocityVariable(),
+                                                                   d_ins_hier_integrator->getCurrentContext());
+    const int K = d_num_lagrangian_substeps;
+    const double substep_dt = (new_time - current_time) / static_cast<double>(K);
+
+    // NOTE: The force at the current time has already been spread to the
+    // Eulerian grid by preprocessIntegrateHierarchy().  Here, we provisionally
+    // advance the structure using the current fluid velocity and accumulate
+    // the forces evaluated at the start of each of the remaining substeps.
+    if (d_enable_logging)
+        plog << d_object_name << "::integrateHierarchy(): performing " << K
+             << " provisional Lagrangian substeps\n";
+    d_ib_method_ops->initializeLagrangianSubsteps(current_time, new_time);
+    d_hier_velocity_data_ops->copyData(d_u_idx, u_current_idx);
+    for (int k = 1; k < K; ++k)
+    {
+        d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
+        d_u_phys_bdry_op->setHomogeneousBc(false);
+        d_ib_method_ops->interpolateVelocity(d_u_idx,
+                                             getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
+                                             getGhostfillRefineSchedules(d_object_name + "::u"),
+                                             new_time);
+        d_ib_method_ops->forwardEulerSubstep(current_time, new_time, substep_dt);
+        d_ib_method_ops->computeLagrangianForce(new_time);
+        d_u_phys_bdry_op->setPatchDataIndex(d_f_idx);
+        d_u_phys_bdry_op->setHomogeneousBc(true);
+        d_ib_method_ops->spreadForce(
+            d_f_idx, d_u_phys_bdry_op, getProlongRefineSchedules(d_object_name + "::f"), new_time);
+        d_u_phys_bdry_op->setHomogeneousBc(false);
+    }
+    d_hier_velocity_data_ops->scale(d_f_idx, 1.0 / static_cast<double>(K), d_f_idx);
+    return;
+} // spreadMultirateLagrangianForce
+
+void
+IBExplicitHierarchyIntegrator::performMultirateLagrangianSubsteps(const double current_time, const double new_time)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    const int u_current_idx = var_db->mapVariableAndContextToIndex(d_ins_hier_integrator->getVelocityVariable(),
+                                                                   d_ins_hier_integrator->getCurrentContext());
+    const int u_new_idx = var_db->mapVariableAndContextToIndex(d_ins_hier_integrator->getVelocityVariable(),
+                                                               d_ins_hier_integrator->getNewContext());
+    const int K = d_num_lagrangian_substeps;
+    const double substep_dt = (new_time - current_time) / static_cast<double>(K);
+
+    // Advance the structure from its current position, using the Eulerian
+    // velocity linearly interpolated in time to the midpoint of each substep.
+    if (d_enable_logging)
+        plog << d_object_name << "::integrateHierarchy(): performing " << K << " Lagrangian substeps\n";
+    d_ib_method_ops->initializeLagrangianSubsteps(current_time, new_time);
+    for (int k = 0; k < K; ++k)
+    {
+        const double theta = (static_cast<double>(k) + 0.5) / static_cast<double>(K);
+        d_hier_velocity_data_ops->linearSum(d_u_idx, 1.0 - theta, u_current_idx, theta, u_new_idx);
+        d_u_phys_bdry_op->setPatchDataIndex(d_u_idx);
+        d_u_phys_bdry_op->setHomogeneousBc(false);
+        d_ib_method_ops->interpolateVelocity(d_u_idx,
+                                             getCoarsenSchedules(d_object_name + "::u::CONSERVATIVE_COARSEN"),
+                                             getGhostfillRefineSchedules(d_object_name + "::u"),
+                                             new_time);
+        d_ib_method_ops->forwardEulerSubstep(current_time, new_time, substep_dt);
+    }
+    return;
+} // performMultirateLagrangianSubsteps
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
@@ -34,6 +34,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <fstream>
 #include <limits>
 #include <ostream>
 #include <set>
@@ -305,6 +306,279 @@ libmesh_restart_file_name(const std::string& restart_dump_dirname,
                      << std::setfill('0') << std::right << time_step_number << "." << extension;
     return file_name_prefix.str();
 }
+
+// Version of the partitioned libMesh restart data files.
+static const int PARTITIONED_RESTART_VERSION = 1;
+
+std::string
+libmesh_partitioned_restart_file_name(const std::string& restart_dump_dirname,
+                                      unsigned int time_step_number,
+                                      unsigned int part,
+                                      int rank)
+{
+    std::ostringstream file_name_prefix;
+    file_name_prefix << restart_dump_dirname << "/libmesh_data_part_" << part << "." << std::setw(6)
+                     << std::setfill('0') << std::right << time_step_number << ".proc." << std::setw(5)
+                     << std::setfill('0') << std::right << rank;
+    return file_name_prefix.str();
+}
+
+template <class T>
+inline void
+write_binary(std::ofstream& os, const T* data, std::size_t n)
+{
+    if (n) os.write(reinterpret_cast<const char*>(data), n * sizeof(T));
+    return;
+}
+
+template <class T>
+inline void
+read_binary(std::ifstream& is, T* data, std::size_t n)
+{
+    if (n) is.read(reinterpret_cast<char*>(data), n * sizeof(T));
+    return;
+}
+
+inline void
+write_binary_string(std::ofstream& os, const std::string& str)
+{
+    const int len = static_cast<int>(str.size());
+    write_binary(os, &len, 1);
+    write_binary(os, str.data(), str.size());
+    return;
+}
+
+inline std::string
+read_binary_string(std::ifstream& is)
+{
+    int len = 0;
+    read_binary(is, &len, 1);
+    std::vector<char> buf(len);
+    read_binary(is, buf.empty() ? NULL : &buf[0], buf.size());
+    return std::string(buf.begin(), buf.end());
+}
+
+// Collect the locally owned degrees of freedom of the given system, keyed by
+// the partition-independent triplet (DofObject id, variable, component) along
+// with a flag that indicates whether the DofObject is a node or an element.
+void
+collect_local_dof_keys(const System& system,
+                       std::vector<unsigned long long>& key_ids,
+                       std::vector<int>& key_data,
+                       std::vector<dof_id_type>& dof_indices)
+{
+    const MeshBase& mesh = system.get_mesh();
+    const unsigned int sys_num = system.number();
+    const unsigned int n_vars = system.n_vars();
+    const DofMap& dof_map = system.get_dof_map();
+    const dof_id_type first_dof = dof_map.first_dof();
+    const dof_id_type end_dof = dof_map.end_dof();
+    key_ids.clear();
+    key_data.clear();
+    dof_indices.clear();
+    for (int obj_type = 0; obj_type < 2; ++obj_type)
+    {
+        std::vector<const DofObject*> dof_objs;
+        if (obj_type == 0)
+        {
+            for (MeshBase::const_node_iterator it = mesh.local_nodes_begin(); it != mesh.local_nodes_end(); ++it)
+            {
+                dof_objs.push_back(*it);
+            }
+        }
+        else
+        {
+            for (MeshBase::const_element_iterator it = mesh.active_local_elements_begin();
+                 it != mesh.active_local_elements_end();
+                 ++it)
+            {
+                dof_objs.push_back(*it);
+            }
+        }
+        for (std::vector<const DofObject*>::const_iterator it = dof_objs.begin(); it != dof_objs.end(); ++it)
+        {
+            const DofObject* const dof_obj = *it;
+            for (unsigned int var = 0; var < n_vars; ++var)
+            {
+                const unsigned int n_comp = dof_obj->n_comp(sys_num, var);
+                for (unsigned int comp = 0; comp < n_comp; ++comp)
+                {
+                    const dof_id_type dof_index = dof_obj->dof_number(sys_num, var, comp);
+                    if (dof_index < first_dof || dof_index >= end_dof) continue;
+                    key_ids.push_back(dof_obj->id());
+                    key_data.push_back(obj_type);
+                    key_data.push_back(var);
+                    key_data.push_back(comp);
+                    dof_indices.push_back(dof_index);
+                }
+            }
+        }
+    }
+    return;
+}
+
+// Write the locally owned solution and additional vector values of each
+// system to a binary file that is written independently by each process.
+void
+write_partitioned_restart_data(const EquationSystems& equation_systems, const std::string& file_name)
+{
+    std::ofstream os(file_name.c_str(), std::ios::out | std::ios::binary);
+    if (!os.is_open())
+    {
+        TBOX_ERROR("IBFEMethod::writeFEDataToRestartFile(): unable to open file " << file_name << "\n");
+    }
+    const int header[4] = { PARTITIONED_RESTART_VERSION,
+                            SAMRAI_MPI::getNodes(),
+                            SAMRAI_MPI::getRank(),
+                            static_cast<int>(equation_systems.n_systems()) };
+    write_binary(os, header, 4);
+    std::vector<unsigned long long> key_ids;
+    std::vector<int> key_data;
+    std::vector<dof_id_type> dof_indices;
+    std::vector<double> values;
+    for (unsigned int sys_num = 0; sys_num < equation_systems.n_systems(); ++sys_num)
+    {
+        const System& system = equation_systems.get_system(sys_num);
+        collect_local_dof_keys(system, key_ids, key_data, dof_indices);
+        const unsigned long long n_local = key_ids.size();
+        write_binary_string(os, system.name());
+        write_binary(os, &n_local, 1);
+        write_binary(os, key_ids.empty() ? NULL : &key_ids[0], key_ids.size());
+        write_binary(os, key_data.empty() ? NULL : &key_data[0], key_data.size());
+
+        // The solution vector is stored first, followed by any additional
+        // vectors, each identified by name.
+        std::vector<std::pair<std::string, const NumericVector<Number>*> > vecs;
+        vecs.push_back(std::make_pair(std::string(), system.solution.get()));
+        for (System::const_vectors_iterator it = system.vectors_begin(); it != system.vectors_end(); ++it)
+        {
+            vecs.push_back(std::make_pair(it->first, it->second));
+        }
+        const int n_vecs = static_cast<int>(vecs.size());
+        write_binary(os, &n_vecs, 1);
+        values.resize(n_local);
+        for (int k = 0; k < n_vecs; ++k)
+        {
+            write_binary_string(os, vecs[k].first);
+            const NumericVector<Number>& vec = *vecs[k].second;
+            for (unsigned long long i = 0; i < n_local; ++i)
+            {
+                values[i] = vec(dof_indices[i]);
+            }
+            write_binary(os, values.empty() ? NULL : &values[0], values.size());
+        }
+    }
+    if (!os.good())
+    {
+        TBOX_ERROR("IBFEMethod::writeFEDataToRestartFile(): error writing file " << file_name << "\n");
+    }
+    return;
+}
+
+// Read partitioned restart data written by an arbitrary number of processes.
+// Each process reads a subset of the data files and inserts the stored values
+// into the distributed vectors, which are then assembled to redistribute the
+// values to the processes that own them under the current partitioning.
+void
+read_partitioned_restart_data(EquationSystems& equation_systems,
+                              const std::string& restart_read_dirname,
+                              unsigned int restart_restore_number,
+                              unsigned int part)
+{
+    MeshBase& mesh = equation_systems.get_mesh();
+    if (!mesh.is_serial())
+    {
+        TBOX_ERROR("IBFEMethod::initializeFEData(): partitioned restart data requires a replicated mesh\n");
+    }
+
+    // Determine the number of processes that wrote the restart data.
+    int n_files = 0;
+    if (SAMRAI_MPI::getRank() == 0)
+    {
+        const std::string file_name =
+            libmesh_partitioned_restart_file_name(restart_read_dirname, restart_restore_number, part, 0);
+        std::ifstream is(file_name.c_str(), std::ios::in | std::ios::binary);
+        if (!is.is_open())
+        {
+            TBOX_ERROR("IBFEMethod::initializeFEData(): unable to open file " << file_name << "\n");
+        }
+        int header[4];
+        read_binary(is, header, 4);
+        n_files = header[1];
+    }
+    n_files = SAMRAI_MPI::maxReduction(n_files);
+
+    std::vector<unsigned long long> key_ids;
+    std::vector<int> key_data;
+    std::vector<numeric_index_type> dof_indices;
+    std::vector<double> values;
+    for (int file_num = SAMRAI_MPI::getRank(); file_num < n_files; file_num += SAMRAI_MPI::getNodes())
+    {
+        const std::string file_name =
+            libmesh_partitioned_restart_file_name(restart_read_dirname, restart_restore_number, part, file_num);
+        std::ifstream is(file_name.c_str(), std::ios::in | std::ios::binary);
+        if (!is.is_open())
+        {
+            TBOX_ERROR("IBFEMethod::initializeFEData(): unable to open file " << file_name << "\n");
+        }
+        int header[4];
+        read_binary(is, header, 4);
+        if (header[0] != PARTITIONED_RESTART_VERSION || header[1] != n_files || header[2] != file_num)
+        {
+            TBOX_ERROR("IBFEMethod::initializeFEData(): invalid partitioned restart file " << file_name << "\n");
+        }
+        const int n_systems = header[3];
+        for (int s = 0; s < n_systems; ++s)
+        {
+            System& system = equation_systems.get_system(read_binary_string(is));
+            const unsigned int sys_num = system.number();
+            unsigned long long n_local = 0;
+            read_binary(is, &n_local, 1);
+            key_ids.resize(n_local);
+            key_data.resize(3 * n_local);
+            read_binary(is, key_ids.empty() ? NULL : &key_ids[0], key_ids.size());
+            read_binary(is, key_data.empty() ? NULL : &key_data[0], key_data.size());
+            dof_indices.resize(n_local);
+            for (unsigned long long i = 0; i < n_local; ++i)
+            {
+                const dof_id_type id = static_cast<dof_id_type>(key_ids[i]);
+                const DofObject* const dof_obj =
+                    key_data[3 * i] == 0 ? static_cast<const DofObject*>(mesh.node_ptr(id)) :
+                                           static_cast<const DofObject*>(mesh.elem_ptr(id));
+                dof_indices[i] = dof_obj->dof_number(sys_num, key_data[3 * i + 1], key_data[3 * i + 2]);
+            }
+            int n_vecs = 0;
+            read_binary(is, &n_vecs, 1);
+            values.resize(n_local);
+            for (int k = 0; k < n_vecs; ++k)
+            {
+                const std::string vec_name = read_binary_string(is);
+                read_binary(is, values.empty() ? NULL : &values[0], values.size());
+                NumericVector<Number>& vec = vec_name.empty() ? *system.solution : system.get_vector(vec_name);
+                if (!values.empty()) vec.insert(&values[0], dof_indices);
+            }
+        }
+        if (!is.good())
+        {
+            TBOX_ERROR("IBFEMethod::initializeFEData(): error reading file " << file_name << "\n");
+        }
+    }
+
+    // Assemble the vectors.  Because these are collective operations, they
+    // must be performed by every process regardless of the number of data
+    // files that it has read.
+    for (unsigned int sys_num = 0; sys_num < equation_systems.n_systems(); ++sys_num)
+    {
+        System& system = equation_systems.get_system(sys_num);
+        system.solution->close();
+        for (System::vectors_iterator it = system.vectors_begin(); it != system.vectors_end(); ++it)
+        {
+            it->second->close();
+        }
+        system.update();
+    }
+    return;
+}
 }
 
 const std::string IBFEMethod::COORDS_SYSTEM_NAME = "IB coordinates system";
@@ -810,9 +1084,20 @@ IBFEMethod::initializeFEEquationSystems()
             const std::string& file_name = libmesh_restart_file_name(
                 d_libmesh_restart_read_dir, d_libmesh_restart_restore_number, part, d_libmesh_restart_file_extension);
             const XdrMODE xdr_mode = (d_libmesh_restart_file_extension == "xdr" ? DECODE : READ);
-            const int read_mode =
-                EquationSystems::READ_HEADER | EquationSystems::READ_DATA | EquationSystems::READ_ADDITIONAL_DATA;
-            equation_systems->read(file_name, xdr_mode, read_mode, /*partition_agnostic*/ true);
+            if (d_libmesh_restart_read_partitioned)
+            {
+                // Only the system definitions are stored in the serial file;
+                // the data are read from the partitioned data files once the
+                // systems have been distributed.
+                const int read_mode = EquationSystems::READ_HEADER | EquationSystems::READ_ADDITIONAL_DATA;
+                equation_systems->read(file_name, xdr_mode, read_mode, /*partition_agnostic*/ true);
+            }
+            else
+            {
+                const int read_mode =
+                    EquationSystems::READ_HEADER | EquationSystems::READ_DATA | EquationSystems::READ_ADDITIONAL_DATA;
+                equation_systems->read(file_name, xdr_mode, read_mode, /*partition_agnostic*/ true);
+            }
         }
         else
         {
@@ -866,6 +1151,11 @@ IBFEMethod::initializeFEData()
         if (from_restart)
         {
             equation_systems->reinit();
+            if (d_libmesh_restart_read_partitioned)
+            {
+                read_partitioned_restart_data(
+                    *equation_systems, d_libmesh_restart_read_dir, d_libmesh_restart_restore_number, part);
+            }
         }
         else
         {
@@ -1109,6 +1399,7 @@ IBFEMethod::putToDatabase(Pointer<Database> db)
     db->putBool("d_split_tangential_force", d_split_tangential_force);
     db->putBool("d_use_jump_conditions", d_use_jump_conditions);
     db->putBool("d_use_consistent_mass_matrix", d_use_consistent_mass_matrix);
+    db->putBool("d_libmesh_partitioned_restart", d_libmesh_partitioned_restart);
     return;
 } // putToDatabase
 
@@ -1120,8 +1411,21 @@ IBFEMethod::writeFEDataToRestartFile(const std::string& restart_dump_dirname, un
         const std::string& file_name =
             libmesh_restart_file_name(restart_dump_dirname, time_step_number, part, d_libmesh_restart_file_extension);
         const XdrMODE xdr_mode = (d_libmesh_restart_file_extension == "xdr" ? ENCODE : WRITE);
-        const int write_mode = EquationSystems::WRITE_DATA | EquationSystems::WRITE_ADDITIONAL_DATA;
-        d_equation_systems[part]->write(file_name, xdr_mode, write_mode, /*partition_agnostic*/ true);
+        if (d_libmesh_partitioned_restart)
+        {
+            // Write only the system definitions to the serial file, and have
+            // each process write its locally owned data to a separate file.
+            const int write_mode = EquationSystems::WRITE_ADDITIONAL_DATA;
+            d_equation_systems[part]->write(file_name, xdr_mode, write_mode, /*partition_agnostic*/ true);
+            write_partitioned_restart_data(*d_equation_systems[part],
+                                           libmesh_partitioned_restart_file_name(
+                                               restart_dump_dirname, time_step_number, part, SAMRAI_MPI::getRank()));
+        }
+        else
+        {
+            const int write_mode = EquationSystems::WRITE_DATA | EquationSystems::WRITE_ADDITIONAL_DATA;
+            d_equation_systems[part]->write(file_name, xdr_mode, write_mode, /*partition_agnostic*/ true);
+        }
     }
     return;
 }
@@ -2491,6 +2795,8 @@ IBFEMethod::commonConstructor(const std::string& object_name,
     }
     d_libmesh_restart_read_dir = restart_read_dirname;
     d_libmesh_restart_restore_number = restart_restore_number;
+    d_libmesh_partitioned_restart = false;
+    d_libmesh_restart_read_partitioned = false;
 
     // Store the mesh pointers.
     d_meshes = meshes;
@@ -2686,6 +2992,10 @@ IBFEMethod::getFromInput(Pointer<Database> db, bool /*is_from_restart*/)
     {
         d_libmesh_restart_file_extension = "xdr";
     }
+    if (db->isBool("libmesh_partitioned_restart"))
+    {
+        d_libmesh_partitioned_restart = db->getBool("libmesh_partitioned_restart");
+    }
 
     // Other settings.
     if (db->isInteger("min_ghost_cell_width"))
@@ -2730,6 +3040,11 @@ IBFEMethod::getFromRestart()
     d_split_tangential_force = db->getBool("d_split_tangential_force");
     d_use_jump_conditions = db->getBool("d_use_jump_conditions");
     d_use_consistent_mass_matrix = db->getBool("d_use_consistent_mass_matrix");
+    if (db->isBool("d_libmesh_partitioned_restart"))
+    {
+        d_libmesh_restart_read_partitioned = db->getBool("d_libmesh_partitioned_restart");
+        d_libmesh_partitioned_restart = d_libmesh_restart_read_partitioned;
+    }
     return;
 } // getFromRestart
 
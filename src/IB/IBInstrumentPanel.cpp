@@ -318,6 +318,18 @@ build_meter_web(DBfile* dbfile,
 } // build_meter_web
 #endif
 
+inline Point
+cell_center(const Index<NDIM>& i, const Index<NDIM>& patch_lower, const double* const x_lower, const double* const dx)
+{
+    return Point(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
+                 x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
+#if (NDIM == 3)
+                     ,
+                 x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
+#endif
+                     );
+} // cell_center
+
 double
 linear_interp(const Point& X,
               const Index<NDIM>& i_cell,
@@ -530,6 +542,7 @@ IBInstrumentPanel::IBInstrumentPanel(const std::string& object_name, Pointer<Dat
       d_point_pres_values(),
       d_web_patch_map(),
       d_web_centroid_map(),
+      d_web_patch_buckets(),
       d_plot_directory_name(NDIM == 2 ? "viz_inst2d" : "viz_inst3d"),
       d_output_log_file(false),
       d_log_file_name(NDIM == 2 ? "inst2d.log" : "inst3d.log"),
@@ -955,6 +968,9 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
         }
     }
 
+    // Bucket the web patches and web centroids by local patch.
+    buildWebPatchBuckets(hierarchy);
+
     IBAMR_TIMER_STOP(t_initialize_hierarchy_dependent_data);
     return;
 } // initializeHierarchyDependentData
@@ -1004,11 +1020,21 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
     // Compute the local contributions to the flux of U through the flow meter,
     // the average value of P in the flow meter, and the pointwise value of P at
     // the centroid of the meter.
+    //
+    // NOTE: Only the cells that hold web patches or web centroids are visited.
+    // Entries in each bucket are sorted by cell index, so that the cell center
+    // is only recomputed when the cell changes.
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+#if !defined(NDEBUG)
+        TBOX_ASSERT(static_cast<int>(d_web_patch_buckets[ln].size()) == level->getNumberOfPatches());
+#endif
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
+            const WebPatchBucket& bucket = d_web_patch_buckets[ln][p()];
+            if (bucket.web_patch.empty() && bucket.web_centroid.empty()) continue;
+
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             const Box<NDIM>& patch_box = patch->getBox();
             const Index<NDIM>& patch_lower = patch_box.lower();
@@ -1023,92 +1049,84 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
             Pointer<SideData<NDIM, double> > U_sc_data = patch->getPatchData(U_data_idx);
             Pointer<CellData<NDIM, double> > P_cc_data = patch->getPatchData(P_data_idx);
 
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            // Sample the velocity and the pressure at the web patches.
+            const size_t num_web_patches = bucket.web_patch.size();
+            if (num_web_patches > 0 && (U_cc_data || U_sc_data))
             {
-                const Index<NDIM>& i = b();
-                std::pair<WebPatchMap::const_iterator, WebPatchMap::const_iterator> patch_range =
-                    d_web_patch_map[ln].equal_range(i);
-                if (patch_range.first != patch_range.second)
+                Point X_cell = cell_center(bucket.web_patch_idx[0], patch_lower, x_lower, dx);
+                for (size_t k = 0; k < num_web_patches; ++k)
                 {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
-#if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
-#endif
-                                           );
-                    if (U_cc_data)
+                    const Index<NDIM>& i = bucket.web_patch_idx[k];
+                    if (k > 0 && i != bucket.web_patch_idx[k - 1])
                     {
-                        for (WebPatchMap::const_iterator it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U = linear_interp<NDIM>(
-                                X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
+                        X_cell = cell_center(i, patch_lower, x_lower, dx);
                     }
-                    if (U_sc_data)
+                    const WebPatch& web_patch = bucket.web_patch[k];
+                    const Point& X = *(web_patch.X);
+                    const Vector& dA = *(web_patch.dA);
+                    Vector U;
+                    if (U_cc_data)
                     {
-                        for (WebPatchMap::const_iterator it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U =
-                                linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
+                        U = linear_interp<NDIM>(
+                            X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
                     }
-                    if (P_cc_data)
+                    else
                     {
-                        for (WebPatchMap::const_iterator it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_mean_pres_values[meter_num] += P * dA.norm();
-                            A[meter_num] += dA.norm();
-                        }
+                        U = linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
                     }
+                    d_flow_values[web_patch.meter_num] += U.dot(dA);
                 }
-
-                std::pair<WebCentroidMap::const_iterator, WebCentroidMap::const_iterator> centroid_range =
-                    d_web_centroid_map[ln].equal_range(i);
-                if (centroid_range.first != centroid_range.second)
+            }
+            if (num_web_patches > 0 && P_cc_data)
+            {
+                Point X_cell = cell_center(bucket.web_patch_idx[0], patch_lower, x_lower, dx);
+                for (size_t k = 0; k < num_web_patches; ++k)
                 {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
-#if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
-#endif
-                                           );
-                    if (P_cc_data)
+                    const Index<NDIM>& i = bucket.web_patch_idx[k];
+                    if (k > 0 && i != bucket.web_patch_idx[k - 1])
                     {
-                        for (WebCentroidMap::const_iterator it = centroid_range.first; it != centroid_range.second;
-                             ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_point_pres_values[meter_num] = P;
-                        }
+                        X_cell = cell_center(i, patch_lower, x_lower, dx);
                     }
+                    const WebPatch& web_patch = bucket.web_patch[k];
+                    const Point& X = *(web_patch.X);
+                    const double dA_norm = web_patch.dA->norm();
+                    const double P =
+                        linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    d_mean_pres_values[web_patch.meter_num] += P * dA_norm;
+                    A[web_patch.meter_num] += dA_norm;
+                }
+            }
+
+            // Sample the pressure at the web centroids.
+            if (P_cc_data)
+            {
+                for (size_t k = 0; k < bucket.web_centroid.size(); ++k)
+                {
+                    const Index<NDIM>& i = bucket.web_centroid_idx[k];
+                    const Point X_cell = cell_center(i, patch_lower, x_lower, dx);
+                    const WebCentroid& web_centroid = bucket.web_centroid[k];
+                    const Point& X = *(web_centroid.X);
+                    const double P =
+                        linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    d_point_pres_values[web_centroid.meter_num] = P;
                 }
             }
         }
     }
 
-    // Synchronize the values across all processes.
-    SAMRAI_MPI::sumReduction(&d_flow_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&d_mean_pres_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&d_point_pres_values[0], d_num_meters);
-    SAMRAI_MPI::sumReduction(&A[0], d_num_meters);
+    // Synchronize the values across all processes using a single packed
+    // reduction.
+    std::vector<double> meter_values(4 * d_num_meters);
+    std::copy(d_flow_values.begin(), d_flow_values.end(), meter_values.begin());
+    std::copy(d_mean_pres_values.begin(), d_mean_pres_values.end(), meter_values.begin() + d_num_meters);
+    std::copy(d_point_pres_values.begin(), d_point_pres_values.end(), meter_values.begin() + 2 * d_num_meters);
+    std::copy(A.begin(), A.end(), meter_values.begin() + 3 * d_num_meters);
+    SAMRAI_MPI::sumReduction(&meter_values[0], 4 * d_num_meters);
+    std::copy(meter_values.begin(), meter_values.begin() + d_num_meters, d_flow_values.begin());
+    std::copy(meter_values.begin() + d_num_meters, meter_values.begin() + 2 * d_num_meters, d_mean_pres_values.begin());
+    std::copy(
+        meter_values.begin() + 2 * d_num_meters, meter_values.begin() + 3 * d_num_meters, d_point_pres_values.begin());
+    std::copy(meter_values.begin() + 3 * d_num_meters, meter_values.end(), A.begin());
 
     // Normalize the mean pressure.
     for (unsigned int m = 0; m < d_num_meters; ++m)
@@ -1397,6 +1415,50 @@ IBInstrumentPanel::writePlotData(const int timestep_num, const double simulation
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+IBInstrumentPanel::buildWebPatchBuckets(Pointer<PatchHierarchy<NDIM> > hierarchy)
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    d_web_patch_buckets.clear();
+    d_web_patch_buckets.resize(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        d_web_patch_buckets[ln].resize(level->getNumberOfPatches());
+        const WebPatchMap& web_patch_map = d_web_patch_map[ln];
+        const WebCentroidMap& web_centroid_map = d_web_centroid_map[ln];
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            WebPatchBucket& bucket = d_web_patch_buckets[ln][p()];
+
+            // All indices in the patch box lie between the lower and upper
+            // corners of the box in Fortran (lexicographic) order, so only that
+            // range of each mapping needs to be searched.
+            const WebPatchMap::const_iterator patch_begin = web_patch_map.lower_bound(patch_box.lower());
+            const WebPatchMap::const_iterator patch_end = web_patch_map.upper_bound(patch_box.upper());
+            for (WebPatchMap::const_iterator it = patch_begin; it != patch_end; ++it)
+            {
+                if (!patch_box.contains(it->first)) continue;
+                bucket.web_patch_idx.push_back(it->first);
+                bucket.web_patch.push_back(it->second);
+            }
+
+            const WebCentroidMap::const_iterator centroid_begin = web_centroid_map.lower_bound(patch_box.lower());
+            const WebCentroidMap::const_iterator centroid_end = web_centroid_map.upper_bound(patch_box.upper());
+            for (WebCentroidMap::const_iterator it = centroid_begin; it != centroid_end; ++it)
+            {
+                if (!patch_box.contains(it->first)) continue;
+                bucket.web_centroid_idx.push_back(it->first);
+                bucket.web_centroid.push_back(it->second);
+            }
+        }
+    }
+    return;
+} // buildWebPatchBuckets
+
 void
 IBInstrumentPanel::getFromInput(Pointer<Database> db)
 {
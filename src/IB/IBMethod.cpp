@@ -82,6 +82,7 @@
 #include "ibtk/LData.h"
 #include "ibtk/LDataManager.h"
 #include "ibtk/LEInteractor.h"
+#include "ibtk/LEOperatorCache.h"
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LMesh.h"
 #include "ibtk/LNode.h"
@@ -169,6 +170,7 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
     d_ghosts = std::max(LEInteractor::getMinimumGhostWidth(d_interp_kernel_fcn),
                         LEInteractor::getMinimumGhostWidth(d_spread_kernel_fcn));
     d_force_jac_mffd = false;
+    d_use_assembled_coupling_ops = false;
     d_do_log = false;
 
     // Initialize object with data read from the input and restart databases.
@@ -195,6 +197,22 @@ IBMethod::IBMethod(const std::string& object_name, Pointer<Database> input_db, b
                                                 d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
 
+    // Setup the cache of assembled coupling operators.
+    if (d_use_assembled_coupling_ops)
+    {
+        d_le_op_cache =
+            new LEOperatorCache(d_object_name + "::LEOperatorCache", d_interp_kernel_fcn, d_spread_kernel_fcn);
+        if (!d_le_op_cache->isSupported())
+        {
+            pout << "WARNING: " << d_object_name << "::IBMethod():\n"
+                 << "  assembled coupling operators are not supported for kernel functions " << d_interp_kernel_fcn
+                 << " and " << d_spread_kernel_fcn << ";\n"
+                 << "  using standard interpolation and spreading routines.\n";
+            d_use_assembled_coupling_ops = false;
+            d_le_op_cache.setNull();
+        }
+    }
+
     // Create the instrument panel object.
     d_instrument_panel =
         new IBInstrumentPanel(d_object_name + "::IBInstrumentPanel",
@@ -428,6 +446,9 @@ IBMethod::preprocessIntegrateData(double current_time, double new_time, int /*nu
     d_X_new_needs_ghost_fill = true;
     d_X_LE_new_needs_ghost_fill = true;
 
+    // Discard coupling operators assembled for the previous time step.
+    if (d_le_op_cache) d_le_op_cache->clear();
+
     return;
 } // preprocessIntegrateData
 
@@ -440,6 +461,13 @@ IBMethod::postprocessIntegrateData(double current_time, double new_time, int /*n
     const double dt = new_time - current_time;
     const int integrator_step = d_ib_solver->getIntegratorStep();
 
+    if (d_do_log && d_le_op_cache)
+    {
+        plog << d_object_name << "::postprocessIntegrateData(): assembled coupling operators: "
+             << d_le_op_cache->getNumberOfAssemblies() << " patch assemblies, "
+             << d_le_op_cache->getNumberOfReuses() << " reuses\n";
+    }
+
     // Update the instrumentation data.
     updateIBInstrumentationData(integrator_step + 1, new_time);
     if (d_instrument_panel->isInstrumented())
@@ -675,6 +703,7 @@ IBMethod::updateFixedLEOperators()
         IBTK_CHKERRQ(ierr);
     }
     d_X_LE_new_needs_ghost_fill = true;
+    if (d_le_op_cache) d_le_op_cache->clear();
 
     std::vector<Pointer<LData> >* X_LE_half_data;
     bool* X_LE_half_needs_ghost_fill;
@@ -720,7 +749,15 @@ IBMethod::interpolateLinearizedVelocity(const int u_data_idx,
     bool* X_LE_needs_ghost_fill;
     getLinearizedVelocityData(&U_jac_data);
     getLECouplingPositionData(&X_LE_data, &X_LE_needs_ghost_fill, data_time);
-    d_l_data_manager->interp(u_data_idx, *U_jac_data, *X_LE_data, u_synch_scheds, u_ghost_fill_scheds, data_time);
+    if (d_use_fixed_coupling_ops && d_le_op_cache)
+    {
+        d_l_data_manager->interp(
+            u_data_idx, *U_jac_data, *X_LE_data, *d_le_op_cache, u_synch_scheds, u_ghost_fill_scheds, data_time);
+    }
+    else
+    {
+        d_l_data_manager->interp(u_data_idx, *U_jac_data, *X_LE_data, u_synch_scheds, u_ghost_fill_scheds, data_time);
+    }
     resetAnchorPointValues(*U_jac_data,
                            /*coarsest_ln*/ 0,
                            /*finest_ln*/ d_hierarchy->getFinestLevelNumber());
@@ -779,6 +816,47 @@ IBMethod::backwardEulerStep(const double current_time, const double new_time)
     return;
 } // backwardEulerStep
 
+void
+IBMethod::initializeLagrangianSubsteps(const double /*current_time*/, const double /*new_time*/)
+{
+    int ierr;
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        ierr = VecCopy(d_X_current_data[ln]->getVec(), d_X_new_data[ln]->getVec());
+        IBTK_CHKERRQ(ierr);
+    }
+    d_X_new_needs_ghost_fill = true;
+    return;
+} // initializeLagrangianSubsteps
+
+void
+IBMethod::forwardEulerSubstep(const double /*current_time*/, const double new_time, const double substep_dt)
+{
+    int ierr;
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    std::vector<Pointer<LData> >* U_data;
+    getVelocityData(&U_data, new_time);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        ierr = VecAXPY(d_X_new_data[ln]->getVec(), substep_dt, (*U_data)[ln]->getVec());
+        IBTK_CHKERRQ(ierr);
+    }
+    d_X_new_needs_ghost_fill = true;
+
+    std::vector<Pointer<LData> >* X_half_data;
+    bool* X_half_needs_ghost_fill;
+    getPositionData(&X_half_data, &X_half_needs_ghost_fill, d_half_time);
+    reinitMidpointData(d_X_current_data, d_X_new_data, *X_half_data);
+    *X_half_needs_ghost_fill = true;
+
+    return;
+} // forwardEulerSubstep
+
 void
 IBMethod::midpointStep(const double current_time, const double new_time)
 {
@@ -1030,14 +1108,29 @@ IBMethod::spreadLinearizedForce(const int f_data_idx,
     resetAnchorPointValues(*F_jac_data,
                            /*coarsest_ln*/ 0,
                            /*finest_ln*/ d_hierarchy->getFinestLevelNumber());
-    d_l_data_manager->spread(f_data_idx,
-                             *F_jac_data,
-                             *X_LE_data,
-                             f_phys_bdry_op,
-                             f_prolongation_scheds,
-                             data_time,
-                             *F_jac_needs_ghost_fill,
-                             *X_LE_needs_ghost_fill);
+    if (d_use_fixed_coupling_ops && d_le_op_cache)
+    {
+        d_l_data_manager->spread(f_data_idx,
+                                 *F_jac_data,
+                                 *X_LE_data,
+                                 *d_le_op_cache,
+                                 f_phys_bdry_op,
+                                 f_prolongation_scheds,
+                                 data_time,
+                                 *F_jac_needs_ghost_fill,
+                                 *X_LE_needs_ghost_fill);
+    }
+    else
+    {
+        d_l_data_manager->spread(f_data_idx,
+                                 *F_jac_data,
+                                 *X_LE_data,
+                                 f_phys_bdry_op,
+                                 f_prolongation_scheds,
+                                 data_time,
+                                 *F_jac_needs_ghost_fill,
+                                 *X_LE_needs_ghost_fill);
+    }
     *F_jac_needs_ghost_fill = false;
     *X_LE_needs_ghost_fill = false;
     return;
@@ -1533,6 +1626,7 @@ IBMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
                                 Pointer<GriddingAlgorithm<NDIM> > /*gridding_alg*/)
 {
     d_l_data_manager->endDataRedistribution();
+    if (d_le_op_cache) d_le_op_cache->clear();
 
     // Look up the re-distributed Lagrangian position data.
     std::vector<Pointer<LData> > X_data(hierarchy->getFinestLevelNumber() + 1);
@@ -2069,6 +2163,8 @@ IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
     if (db->keyExists("error_if_points_leave_domain"))
         d_error_if_points_leave_domain = db->getBool("error_if_points_leave_domain");
     if (db->keyExists("force_jac_mffd")) d_force_jac_mffd = db->getBool("force_jac_mffd");
+    if (db->keyExists("use_assembled_coupling_ops"))
+        d_use_assembled_coupling_ops = db->getBool("use_assembled_coupling_ops");
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
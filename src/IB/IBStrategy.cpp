@@ -174,6 +174,20 @@ IBStrategy::backwardEulerStep(double /*current_time*/, double /*new_time*/)
     return;
 } // backwardEulerStep
 
+void
+IBStrategy::initializeLagrangianSubsteps(double /*current_time*/, double /*new_time*/)
+{
+    TBOX_ERROR("IBStrategy::initializeLagrangianSubsteps(): unimplemented\n");
+    return;
+} // initializeLagrangianSubsteps
+
+void
+IBStrategy::forwardEulerSubstep(double /*current_time*/, double /*new_time*/, double /*substep_dt*/)
+{
+    TBOX_ERROR("IBStrategy::forwardEulerSubstep(): unimplemented\n");
+    return;
+} // forwardEulerSubstep
+
 bool
 IBStrategy::hasFluidSources() const
 {
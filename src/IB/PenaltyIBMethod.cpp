@@ -203,6 +203,60 @@ PenaltyIBMethod::forwardEulerStep(const double current_time, const double new_ti
     return;
 } // eulerStep
 
+void
+PenaltyIBMethod::initializeLagrangianSubsteps(const double current_time, const double new_time)
+{
+    IBMethod::initializeLagrangianSubsteps(current_time, new_time);
+
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+
+    // Reset Y^{n+1} and V^{n+1} to equal Y^{n} and V^{n}.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        int ierr;
+        ierr = VecCopy(d_Y_current_data[ln]->getVec(), d_Y_new_data[ln]->getVec());
+        IBTK_CHKERRQ(ierr);
+        ierr = VecCopy(d_V_current_data[ln]->getVec(), d_V_new_data[ln]->getVec());
+        IBTK_CHKERRQ(ierr);
+    }
+    return;
+} // initializeLagrangianSubsteps
+
+void
+PenaltyIBMethod::forwardEulerSubstep(const double current_time, const double new_time, const double substep_dt)
+{
+    IBMethod::forwardEulerSubstep(current_time, new_time, substep_dt);
+
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+
+    // Update the values of Y^{n+1} and V^{n+1} using semi-implicit Euler.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        const double* const K = d_K_data[ln]->getLocalFormArray()->data();
+        const double* const M = d_M_data[ln]->getLocalFormArray()->data();
+        const double* const X_new = d_X_new_data[ln]->getLocalFormVecArray()->data();
+        double* const Y_new = d_Y_new_data[ln]->getLocalFormVecArray()->data();
+        double* const V_new = d_V_new_data[ln]->getLocalFormVecArray()->data();
+        const unsigned int n_local = d_X_current_data[ln]->getLocalNodeCount();
+        unsigned int i, d;
+        for (i = 0; i < n_local; ++i)
+        {
+            for (d = 0; d < NDIM; ++d)
+            {
+                V_new[NDIM * i + d] +=
+                    substep_dt *
+                    (-K[i] * (Y_new[NDIM * i + d] - X_new[NDIM * i + d]) / M[i] + d_gravitational_acceleration[d]);
+                Y_new[NDIM * i + d] += substep_dt * V_new[NDIM * i + d];
+            }
+        }
+    }
+    return;
+} // forwardEulerSubstep
+
 void
 PenaltyIBMethod::midpointStep(const double current_time, const double new_time)
 {
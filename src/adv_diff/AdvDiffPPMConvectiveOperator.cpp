@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -70,6 +71,7 @@
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/CartExtrapPhysBdryOp.h"
+#include "ibtk/PatchScratchArena.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 #include "tbox/Timer.h"
@@ -346,7 +348,9 @@ AdvDiffPPMConvectiveOperator::AdvDiffPPMConvectiveOperator(const std::string& ob
       d_q_extrap_var(NULL),
       d_q_flux_var(NULL),
       d_q_extrap_idx(-1),
-      d_q_flux_idx(-1)
+      d_q_flux_idx(-1),
+      d_scratch_arena(new PatchScratchArena()),
+      d_cell_scratch_factory(new CellDataFactory<NDIM, double>(1, IntVector<NDIM>(GADVECTG)))
 {
     if (d_difference_form != ADVECTIVE && d_difference_form != CONSERVATIVE && d_difference_form != SKEW_SYMMETRIC)
     {
@@ -458,6 +462,7 @@ AdvDiffPPMConvectiveOperator::applyConvectiveOperator(const int Q_idx, const int
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            d_scratch_arena->reset();
 
             const Box<NDIM>& patch_box = patch->getBox();
             const IntVector<NDIM>& patch_lower = patch_box.lower();
@@ -479,13 +484,16 @@ AdvDiffPPMConvectiveOperator::applyConvectiveOperator(const int Q_idx, const int
             TBOX_ASSERT(q_extrap_data_gcw.min() == q_extrap_data_gcw.max());
 #endif
             CellData<NDIM, double>& Q0_data = *Q_data;
-            CellData<NDIM, double> Q1_data(patch_box, 1, Q_data_gcw);
+#if !defined(NDEBUG)
+            TBOX_ASSERT(Q_data_gcw == d_cell_scratch_factory->getGhostCellWidth());
+#endif
+            Pointer<CellData<NDIM, double> > Q1_data = d_cell_scratch_factory->allocate(patch_box, d_scratch_arena);
 #if (NDIM == 3)
-            CellData<NDIM, double> Q2_data(patch_box, 1, Q_data_gcw);
+            Pointer<CellData<NDIM, double> > Q2_data = d_cell_scratch_factory->allocate(patch_box, d_scratch_arena);
 #endif
-            CellData<NDIM, double> dQ_data(patch_box, 1, Q_data_gcw);
-            CellData<NDIM, double> Q_L_data(patch_box, 1, Q_data_gcw);
-            CellData<NDIM, double> Q_R_data(patch_box, 1, Q_data_gcw);
+            Pointer<CellData<NDIM, double> > dQ_data = d_cell_scratch_factory->allocate(patch_box, d_scratch_arena);
+            Pointer<CellData<NDIM, double> > Q_L_data = d_cell_scratch_factory->allocate(patch_box, d_scratch_arena);
+            Pointer<CellData<NDIM, double> > Q_R_data = d_cell_scratch_factory->allocate(patch_box, d_scratch_arena);
 
             // Enforce physical boundary conditions at inflow boundaries.
             AdvDiffPhysicalBoundaryUtilities::setPhysicalBoundaryConditions(
@@ -509,10 +517,10 @@ AdvDiffPPMConvectiveOperator::applyConvectiveOperator(const int Q_idx, const int
                     Q_data_gcw(0),
                     Q_data_gcw(1),
                     Q0_data.getPointer(d),
-                    Q1_data.getPointer(),
-                    dQ_data.getPointer(),
-                    Q_L_data.getPointer(),
-                    Q_R_data.getPointer(),
+                    Q1_data->getPointer(),
+                    dQ_data->getPointer(),
+                    Q_L_data->getPointer(),
+                    Q_R_data->getPointer(),
                     u_ADV_data_gcw(0),
                     u_ADV_data_gcw(1),
                     q_extrap_data_gcw(0),
@@ -533,11 +541,11 @@ AdvDiffPPMConvectiveOperator::applyConvectiveOperator(const int Q_idx, const int
                     Q_data_gcw(1),
                     Q_data_gcw(2),
                     Q0_data.getPointer(d),
-                    Q1_data.getPointer(),
-                    Q2_data.getPointer(),
-                    dQ_data.getPointer(),
-                    Q_L_data.getPointer(),
-                    Q_R_data.getPointer(),
+                    Q1_data->getPointer(),
+                    Q2_data->getPointer(),
+                    dQ_data->getPointer(),
+                    Q_L_data->getPointer(),
+                    Q_R_data->getPointer(),
                     u_ADV_data_gcw(0),
                     u_ADV_data_gcw(1),
                     u_ADV_data_gcw(2),
@@ -835,6 +843,22 @@ AdvDiffPPMConvectiveOperator::initializeOperatorState(const SAMRAIVectorReal<NDI
         d_ghostfill_scheds[ln] = d_ghostfill_alg->createSchedule(level, ln - 1, d_hierarchy, d_ghostfill_strategy);
     }
 
+    // Size the scratch arena to hold the temporaries required by the largest
+    // local patch.
+    size_t scratch_bytes = 0;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const size_t patch_bytes =
+                (NDIM == 2 ? 4 : 5) * d_cell_scratch_factory->getSizeOfMemory(patch->getBox());
+            scratch_bytes = std::max(scratch_bytes, patch_bytes);
+        }
+    }
+    d_scratch_arena->reserve(scratch_bytes);
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
@@ -857,6 +881,9 @@ AdvDiffPPMConvectiveOperator::deallocateOperatorState()
     }
     d_ghostfill_scheds.clear();
 
+    // Release the scratch arena.
+    d_scratch_arena->clear();
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
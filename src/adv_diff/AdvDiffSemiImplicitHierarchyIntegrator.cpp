@@ -413,6 +413,16 @@ AdvDiffSemiImplicitHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<Pa
     // Register variables using the default variable registration routine.
     AdvDiffHierarchyIntegrator::registerVariables();
 
+    // The scratch data for the source terms are only required while the
+    // right-hand side of each transported quantity is being assembled.
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    for (std::vector<Pointer<CellVariable<NDIM, double> > >::const_iterator cit = d_F_var.begin(); cit != d_F_var.end();
+         ++cit)
+    {
+        Pointer<CellVariable<NDIM, double> > F_var = *cit;
+        deferPatchDataAllocation(var_db->mapVariableAndContextToIndex(F_var, getScratchContext()));
+    }
+
     // Setup the convective operators.
     for (std::vector<Pointer<CellVariable<NDIM, double> > >::const_iterator cit = d_Q_var.begin(); cit != d_Q_var.end();
          ++cit)
@@ -435,6 +445,7 @@ AdvDiffSemiImplicitHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<Pa
         d_Q_N_map[Q_var] = N_var;
         int N_scratch_idx;
         registerVariable(N_scratch_idx, N_var, cell_ghosts, getScratchContext());
+        deferPatchDataAllocation(N_scratch_idx);
 
         Pointer<CellVariable<NDIM, double> > N_old_var =
             new CellVariable<NDIM, double>(Q_var->getName() + "::N_old", Q_depth);
@@ -679,6 +690,7 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
             const int Q_current_idx = var_db->mapVariableAndContextToIndex(Q_var, getCurrentContext());
             const int Q_scratch_idx = var_db->mapVariableAndContextToIndex(Q_var, getScratchContext());
             const int N_scratch_idx = var_db->mapVariableAndContextToIndex(N_var, getScratchContext());
+            allocateDeferredPatchData(N_scratch_idx, current_time);
             d_hier_cc_data_ops->copyData(Q_scratch_idx, Q_current_idx);
             d_Q_convective_op[Q_var]->setSolutionTime(current_time);
             d_Q_convective_op[Q_var]->applyConvectiveOperator(Q_scratch_idx, N_scratch_idx);
@@ -692,6 +704,7 @@ AdvDiffSemiImplicitHierarchyIntegrator::preprocessIntegrateHierarchy(const doubl
             {
                 d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, -0.5, N_scratch_idx, Q_rhs_scratch_idx);
             }
+            deallocateDeferredPatchData(N_scratch_idx);
         }
 
         // Set the initial guess.
@@ -797,7 +810,13 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
                         });
                 }
             }
+            // The convective term computed at the beginning of the time step
+            // is stored in N_old(n+1), and is used unless it is recomputed
+            // below.
             const int N_scratch_idx = var_db->mapVariableAndContextToIndex(N_var, getScratchContext());
+            const int N_old_new_idx = var_db->mapVariableAndContextToIndex(N_old_var, getNewContext());
+            allocateDeferredPatchData(N_scratch_idx, current_time);
+            d_hier_cc_data_ops->copyData(N_scratch_idx, N_old_new_idx);
             if (cycle_num > 0)
             {
                 if (convective_time_stepping_type == MIDPOINT_RULE)
@@ -842,11 +861,15 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
             }
         }
 
-        // Account for forcing terms.
+        // Account for forcing terms.  The source term is stored in F(n+1) so
+        // that the scratch data can be freed before the linear solve.
         if (d_F_fcn[F_var])
         {
+            allocateDeferredPatchData(F_scratch_idx, half_time);
             d_F_fcn[F_var]->setDataOnPatchHierarchy(F_scratch_idx, F_var, d_hierarchy, half_time);
             d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, 1.0, F_scratch_idx, Q_rhs_scratch_idx);
+            d_hier_cc_data_ops->copyData(F_new_idx, F_scratch_idx);
+            deallocateDeferredPatchData(F_scratch_idx);
         }
 
         // Solve for Q(n+1).
@@ -877,11 +900,11 @@ AdvDiffSemiImplicitHierarchyIntegrator::integrateHierarchy(const double current_
             {
                 d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, +0.5, N_scratch_idx, Q_rhs_scratch_idx);
             }
+            deallocateDeferredPatchData(N_scratch_idx);
         }
         if (d_F_fcn[F_var])
         {
-            d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, -1.0, F_scratch_idx, Q_rhs_scratch_idx);
-            d_hier_cc_data_ops->copyData(F_new_idx, F_scratch_idx);
+            d_hier_cc_data_ops->axpy(Q_rhs_scratch_idx, -1.0, F_new_idx, Q_rhs_scratch_idx);
         }
     }
 
@@ -68,6 +68,7 @@
 #include "ibamr/RNG.h"
 #include "ibamr/ibamr_enums.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "ibtk/CounterBasedRNG.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/PhysicalBoundaryUtilities.h"
 #include "ibtk/SideDataSynchronization.h"
@@ -112,6 +113,8 @@ AdvDiffStochasticForcing::AdvDiffStochasticForcing(const std::string& object_nam
       d_std(std::numeric_limits<double>::quiet_NaN()),
       d_num_rand_vals(0),
       d_weights(),
+      d_use_counter_based_rng(false),
+      d_rng_seed(0),
       d_dirichlet_bc_scaling(sqrt(2.0)),
       d_neumann_bc_scaling(0.0),
       d_context(NULL),
@@ -141,6 +144,9 @@ AdvDiffStochasticForcing::AdvDiffStochasticForcing(const std::string& object_nam
             stream << "weights_" << k;
             key_name = stream.str();
         }
+        if (input_db->keyExists("use_counter_based_rng"))
+            d_use_counter_based_rng = input_db->getBool("use_counter_based_rng");
+        if (input_db->keyExists("rng_seed")) d_rng_seed = input_db->getInteger("rng_seed");
         if (input_db->keyExists("dirichlet_bc_scaling"))
             d_dirichlet_bc_scaling = input_db->getDouble("dirichlet_bc_scaling");
         if (input_db->keyExists("neumann_bc_scaling")) d_neumann_bc_scaling = input_db->getDouble("neumann_bc_scaling");
@@ -274,6 +280,8 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
         // Generate random components.
         if (cycle_num == 0)
         {
+            const unsigned int key[2] = { static_cast<unsigned int>(d_rng_seed),
+                                          static_cast<unsigned int>(d_adv_diff_solver->getIntegratorStep()) };
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
@@ -285,7 +293,15 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                         Pointer<SideData<NDIM, double> > F_sc_data = patch->getPatchData(d_F_sc_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(F_sc_data->getArrayData(d), SideGeometry<NDIM>::toSideBox(F_sc_data->getBox(), d));
+                            const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(F_sc_data->getBox(), d);
+                            if (d_use_counter_based_rng)
+                            {
+                                CounterBasedRNG::genrandn(F_sc_data->getArrayData(d), side_box, key, level_num, k, d);
+                            }
+                            else
+                            {
+                                genrandn(F_sc_data->getArrayData(d), side_box);
+                            }
                         }
                     }
                 }
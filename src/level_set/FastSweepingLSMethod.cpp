@@ -32,7 +32,15 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "ibamr/FastSweepingLSMethod.h"
+#include "Box.h"
+#include "BoxList.h"
+#include "CellData.h"
+#include "CellIndex.h"
 #include "CellVariable.h"
 #include "HierarchyCellDataOpsReal.h"
 #include "IBAMR_config.h"
@@ -42,14 +50,17 @@
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "tbox/RestartManager.h"
+#include "tbox/SAMRAI_MPI.h"
 
 // FORTRAN ROUTINES
 #if (NDIM == 2)
 #define FAST_SWEEP_1ST_ORDER_FC IBAMR_FC_FUNC(fastsweep1storder2d, FASTSWEEP1STORDER2D)
+#define FAST_SWEEP_BAND_1ST_ORDER_FC IBAMR_FC_FUNC(fastsweepband1storder2d, FASTSWEEPBAND1STORDER2D)
 #endif
 
 #if (NDIM == 3)
 #define FAST_SWEEP_1ST_ORDER_FC IBAMR_FC_FUNC(fastsweep1storder3d, FASTSWEEP1STORDER3D)
+#define FAST_SWEEP_BAND_1ST_ORDER_FC IBAMR_FC_FUNC(fastsweepband1storder3d, FASTSWEEPBAND1STORDER3D)
 #endif
 
 extern "C" {
@@ -75,6 +86,36 @@ void FAST_SWEEP_1ST_ORDER_FC(double* U,
                              const double* dx,
                              const int& patch_touches_bdry,
                              const int* touches_wall_loc_idx);
+
+void FAST_SWEEP_BAND_1ST_ORDER_FC(double* U,
+                                  const int& U_gcw,
+                                  const int& ilower0,
+                                  const int& iupper0,
+                                  const int& ilower1,
+                                  const int& iupper1,
+#if (NDIM == 3)
+                                  const int& ilower2,
+                                  const int& iupper2,
+#endif
+                                  const int& dlower0,
+                                  const int& dupper0,
+                                  const int& dlower1,
+                                  const int& dupper1,
+#if (NDIM == 3)
+                                  const int& dlower2,
+                                  const int& dupper2,
+#endif
+                                  const double* dx,
+                                  const int& patch_touches_bdry,
+                                  const int* touches_wall_loc_idx,
+                                  const int* cells,
+                                  const int& ncells,
+#if (NDIM == 3)
+                                  const int* plane_ptr,
+                                  const int& nplanes,
+#endif
+                                  const int* row_ptr,
+                                  const int& nrows);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -83,6 +124,18 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Boxes that cover the ghost cell region (but not the interior) of a patch.
+inline BoxList<NDIM>
+ghost_region_boxes(Pointer<CellData<NDIM, double> > data, const Pointer<Patch<NDIM> > patch)
+{
+    BoxList<NDIM> ghost_boxes(data->getGhostBox());
+    ghost_boxes.removeIntersections(patch->getBox());
+    return ghost_boxes;
+} // ghost_region_boxes
+}
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 FastSweepingLSMethod::FastSweepingLSMethod(const std::string& object_name,
@@ -97,6 +150,8 @@ FastSweepingLSMethod::FastSweepingLSMethod(const std::string& object_name,
     d_enable_logging = false;
     d_consider_phys_bdry_wall = false;
     for (int k = 0; k < 2 * NDIM; ++k) d_wall_location_idx[k] = 0;
+    d_use_patch_scheduling = false;
+    d_termination_check_interval = 4;
 
     if (d_registered_for_restart) getFromRestart();
     if (!db.isNull()) getFromInput(db);
@@ -150,44 +205,132 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
     fill_op->initializeOperatorState(D_transaction, hierarchy);
     HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(hierarchy, coarsest_ln, finest_ln);
 
+    // Per-patch narrow band data.
+    std::vector<std::vector<NarrowBand> > bands(finest_ln + 1);
+    if (d_use_narrow_band)
+    {
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            bands[ln].resize(level->getNumberOfPatches());
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                initializeNarrowBand(bands[ln][p()], patch->getPatchData(D_idx), patch);
+            }
+        }
+    }
+
+    // Per-patch convergence flags used when patches are scheduled individually.
+    std::vector<std::vector<bool> > patch_converged(finest_ln + 1);
+    if (d_use_patch_scheduling)
+    {
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            patch_converged[ln].resize(hierarchy->getPatchLevel(ln)->getNumberOfPatches(), false);
+        }
+    }
+
     // Carry out iterations
     double diff_L2_norm = 1.0e12;
+    bool converged = false;
     int outer_iter = 0;
     const int cc_wgt_idx = hier_math_ops->getCellWeightPatchDescriptorIndex();
 
-    while (diff_L2_norm > d_abs_tol && outer_iter < d_max_its)
+    while (!converged && outer_iter < d_max_its)
     {
-        hier_cc_data_ops.copyData(D_iter_idx, D_idx);
-        fill_op->fillData(time);
+        int num_band_patches = 0;
+        int num_swept_patches = 0;
+        int num_active_patches = 0;
+        bool checked_termination = false;
+        if (d_use_patch_scheduling)
+        {
+            fill_op->fillData(time);
+
+            int local_counts[2] = { 0, 0 };
+            local_counts[0] =
+                fastSweepScheduled(hier_math_ops, D_idx, D_iter_idx, patch_converged, bands, local_counts[1]);
+
+            // NOTE: The termination check only requires the number of patches
+            // that are still changing, so it is deferred to every
+            // d_termination_check_interval iterations (and the final one).
+            // Iterations carried out after all patches have converged are
+            // cheap because no patch is swept, but they still pay for the
+            // ghost cell fill above.
+            checked_termination =
+                (outer_iter + 1) % d_termination_check_interval == 0 || outer_iter + 1 == d_max_its;
+            if (checked_termination)
+            {
+                SAMRAI_MPI::sumReduction(local_counts, 2);
+                num_active_patches = local_counts[0];
+                num_swept_patches = local_counts[1];
+                converged = num_active_patches == 0;
+            }
+        }
+        else if (d_use_narrow_band)
+        {
+            fill_op->fillData(time);
 
-        fastSweep(hier_math_ops, D_idx);
+            diff_L2_norm =
+                fastSweepNarrowBand(hier_math_ops, D_idx, D_iter_idx, cc_wgt_idx, bands, num_band_patches);
+            converged = diff_L2_norm <= d_abs_tol;
+        }
+        else
+        {
+            hier_cc_data_ops.copyData(D_iter_idx, D_idx);
+            fill_op->fillData(time);
 
-        hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_idx);
-        diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
+            fastSweep(hier_math_ops, D_idx);
+
+            hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_idx);
+            diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
+            converged = diff_L2_norm <= d_abs_tol;
+        }
 
         outer_iter += 1;
 
         if (d_enable_logging)
         {
             plog << d_object_name << "::initializeLSData(): After iteration # " << outer_iter << std::endl;
-            plog << d_object_name << "::initializeLSData(): L2-norm between successive iterations = " << diff_L2_norm
-                 << std::endl;
+            if (d_use_patch_scheduling)
+            {
+                if (checked_termination)
+                {
+                    plog << d_object_name << "::initializeLSData(): Number of patches swept = " << num_swept_patches
+                         << std::endl;
+                    plog << d_object_name << "::initializeLSData(): Number of patches not locally converged = "
+                         << num_active_patches << std::endl;
+                }
+            }
+            else
+            {
+                plog << d_object_name << "::initializeLSData(): L2-norm between successive iterations = "
+                     << diff_L2_norm << std::endl;
+            }
+            if (d_use_narrow_band && !d_use_patch_scheduling)
+            {
+                plog << d_object_name << "::initializeLSData(): Number of patches in narrow band = "
+                     << num_band_patches << std::endl;
+            }
         }
 
-        if (diff_L2_norm <= d_abs_tol)
+        if (converged)
         {
             plog << d_object_name << "::initializeLSData(): Fast sweeping algorithm converged for entire domain"
                  << std::endl;
         }
     }
 
-    if (outer_iter >= d_max_its)
+    if (!converged && outer_iter >= d_max_its)
     {
         if (d_enable_logging)
         {
             plog << d_object_name << "::initializeLSData(): Reached maximum allowable outer iterations" << std::endl;
-            plog << d_object_name << "::initializeLSData(): ||distance_new - distance_old||_2 = " << diff_L2_norm
-                 << std::endl;
+            if (!d_use_patch_scheduling)
+            {
+                plog << d_object_name << "::initializeLSData(): ||distance_new - distance_old||_2 = " << diff_L2_norm
+                     << std::endl;
+            }
         }
     }
 
@@ -229,10 +372,157 @@ FastSweepingLSMethod::fastSweep(Pointer<HierarchyMathOps> hier_math_ops, int dis
 
 } // fastSweep
 
+double
+FastSweepingLSMethod::fastSweepNarrowBand(Pointer<HierarchyMathOps> hier_math_ops,
+                                          int dist_idx,
+                                          int dist_iter_idx,
+                                          int wgt_idx,
+                                          std::vector<std::vector<NarrowBand> >& bands,
+                                          int& num_band_patches) const
+{
+    Pointer<PatchHierarchy<NDIM> > hierarchy = hier_math_ops->getPatchHierarchy();
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+
+    // NOTE: sums[0] is the squared difference norm and sums[1] is the number of
+    // patches in the narrow band; both are reduced in a single collective.
+    double sums[2] = { 0.0, 0.0 };
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        const BoxArray<NDIM>& domain_boxes = level->getPhysicalDomain();
+#if !defined(NDEBUG)
+        TBOX_ASSERT(domain_boxes.size() == 1);
+#endif
+
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
+            Pointer<CellData<NDIM, double> > dist_iter_data = patch->getPatchData(dist_iter_idx);
+            Pointer<CellData<NDIM, double> > wgt_data = patch->getPatchData(wgt_idx);
+            NarrowBand& band = bands[ln][p()];
+            beginNarrowBandIteration(band);
+            if (!collectNarrowBandCells(band, dist_data, dist_iter_data)) continue;
+
+            // Sweep the band repeatedly while it grows, so that it is extended
+            // by more than one cell per iteration.
+            do
+            {
+                fastSweep(dist_data, patch, domain_boxes[0], &band);
+            } while (growNarrowBand(band, dist_data) && collectNarrowBandCells(band, dist_data, dist_iter_data));
+
+            double max_diff = 0.0;
+            sums[0] += computeNarrowBandDiffSq(band, dist_data, dist_iter_data, wgt_data, max_diff);
+            sums[1] += 1.0;
+        }
+    }
+    SAMRAI_MPI::sumReduction(sums, 2);
+    num_band_patches = static_cast<int>(sums[1]);
+    return std::sqrt(sums[0]);
+
+} // fastSweepNarrowBand
+
+int
+FastSweepingLSMethod::fastSweepScheduled(Pointer<HierarchyMathOps> hier_math_ops,
+                                         int dist_idx,
+                                         int dist_iter_idx,
+                                         std::vector<std::vector<bool> >& patch_converged,
+                                         std::vector<std::vector<NarrowBand> >& bands,
+                                         int& num_swept_patches) const
+{
+    Pointer<PatchHierarchy<NDIM> > hierarchy = hier_math_ops->getPatchHierarchy();
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+
+    int num_active_patches = 0;
+    num_swept_patches = 0;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        const BoxArray<NDIM>& domain_boxes = level->getPhysicalDomain();
+#if !defined(NDEBUG)
+        TBOX_ASSERT(domain_boxes.size() == 1);
+        TBOX_ASSERT(static_cast<int>(patch_converged[ln].size()) == level->getNumberOfPatches());
+#endif
+
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
+            Pointer<CellData<NDIM, double> > dist_iter_data = patch->getPatchData(dist_iter_idx);
+
+            // A locally converged patch only needs to be swept again if the
+            // ghost values it last saw have since been changed by a neighbor.
+            if (patch_converged[ln][p()] && !ghostDataChanged(dist_data, dist_iter_data, patch)) continue;
+
+            double max_diff = 0.0;
+            if (d_use_narrow_band)
+            {
+                NarrowBand& band = bands[ln][p()];
+                beginNarrowBandIteration(band);
+                if (collectNarrowBandCells(band, dist_data, dist_iter_data))
+                {
+                    do
+                    {
+                        fastSweep(dist_data, patch, domain_boxes[0], &band);
+                    } while (growNarrowBand(band, dist_data) &&
+                             collectNarrowBandCells(band, dist_data, dist_iter_data));
+                    ++num_swept_patches;
+                    computeNarrowBandDiffSq(
+                        band, dist_data, dist_iter_data, Pointer<CellData<NDIM, double> >(NULL), max_diff);
+                }
+
+                // Store the ghost cell values seen by this sweep.
+                BoxList<NDIM> ghost_boxes = ghost_region_boxes(dist_data, patch);
+                for (BoxList<NDIM>::Iterator b(ghost_boxes); b; b++)
+                {
+                    dist_iter_data->getArrayData().copy(dist_data->getArrayData(), b());
+                }
+            }
+            else
+            {
+                dist_iter_data->copy(*dist_data);
+                fastSweep(dist_data, patch, domain_boxes[0]);
+                ++num_swept_patches;
+
+                const Box<NDIM>& patch_box = patch->getBox();
+                for (Box<NDIM>::Iterator it(patch_box); it; it++)
+                {
+                    const CellIndex<NDIM> ci(it());
+                    max_diff = std::max(max_diff, std::abs((*dist_data)(ci) - (*dist_iter_data)(ci)));
+                }
+            }
+            patch_converged[ln][p()] = max_diff <= d_abs_tol;
+            if (!patch_converged[ln][p()]) ++num_active_patches;
+        }
+    }
+    return num_active_patches;
+
+} // fastSweepScheduled
+
+bool
+FastSweepingLSMethod::ghostDataChanged(Pointer<CellData<NDIM, double> > dist_data,
+                                       Pointer<CellData<NDIM, double> > dist_iter_data,
+                                       const Pointer<Patch<NDIM> > patch) const
+{
+    BoxList<NDIM> ghost_boxes = ghost_region_boxes(dist_data, patch);
+    for (BoxList<NDIM>::Iterator b(ghost_boxes); b; b++)
+    {
+        for (Box<NDIM>::Iterator it(b()); it; it++)
+        {
+            const CellIndex<NDIM> ci(it());
+            if (std::abs((*dist_data)(ci) - (*dist_iter_data)(ci)) > d_abs_tol) return true;
+        }
+    }
+    return false;
+} // ghostDataChanged
+
 void
 FastSweepingLSMethod::fastSweep(Pointer<CellData<NDIM, double> > dist_data,
                                 const Pointer<Patch<NDIM> > patch,
-                                const Box<NDIM>& domain_box) const
+                                const Box<NDIM>& domain_box,
+                                const NarrowBand* band) const
 {
     double* const D = dist_data->getPointer(0);
     const int D_ghosts = (dist_data->getGhostCellWidth()).max();
@@ -262,7 +552,39 @@ FastSweepingLSMethod::fastSweep(Pointer<CellData<NDIM, double> > dist_data,
 
     const Box<NDIM>& patch_box = patch->getBox();
     const double* const dx = pgeom->getDx();
-    if (d_ls_order == FIRST_ORDER_LS)
+    if (d_ls_order == FIRST_ORDER_LS && band)
+    {
+        FAST_SWEEP_BAND_1ST_ORDER_FC(D,
+                                     D_ghosts,
+                                     patch_box.lower(0),
+                                     patch_box.upper(0),
+                                     patch_box.lower(1),
+                                     patch_box.upper(1),
+#if (NDIM == 3)
+                                     patch_box.lower(2),
+                                     patch_box.upper(2),
+#endif
+                                     domain_box.lower(0),
+                                     domain_box.upper(0),
+                                     domain_box.lower(1),
+                                     domain_box.upper(1),
+#if (NDIM == 3)
+                                     domain_box.lower(2),
+                                     domain_box.upper(2),
+#endif
+                                     dx,
+                                     patch_touches_bdry,
+                                     touches_wall_loc_idx,
+                                     &band->cells[0],
+                                     static_cast<int>(band->active_offsets.size()),
+#if (NDIM == 3)
+                                     &band->plane_ptr[0],
+                                     static_cast<int>(band->plane_ptr.size()) - 1,
+#endif
+                                     &band->row_ptr[0],
+                                     static_cast<int>(band->row_ptr.size()) - 1);
+    }
+    else if (d_ls_order == FIRST_ORDER_LS)
     {
         FAST_SWEEP_1ST_ORDER_FC(D,
                                 D_ghosts,
@@ -308,6 +630,18 @@ FastSweepingLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_enable_logging = input_db->getBoolWithDefault("enable_logging", d_enable_logging);
 
+    d_use_narrow_band = input_db->getBoolWithDefault("use_narrow_band", d_use_narrow_band);
+    d_narrow_band_width = input_db->getDoubleWithDefault("narrow_band_width", d_narrow_band_width);
+
+    d_use_patch_scheduling = input_db->getBoolWithDefault("use_patch_scheduling", d_use_patch_scheduling);
+    d_termination_check_interval =
+        input_db->getIntegerWithDefault("termination_check_interval", d_termination_check_interval);
+    if (d_termination_check_interval < 1)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                 << "  termination_check_interval must be positive" << std::endl);
+    }
+
     d_consider_phys_bdry_wall = input_db->getBoolWithDefault("physical_bdry_wall", d_consider_phys_bdry_wall);
     Array<int> wall_loc_idices;
     if (input_db->keyExists("physical_bdry_wall_loc_idx"))
@@ -32,6 +32,14 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <algorithm>
+#include <cmath>
+
+#include "Box.h"
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
+#include "CellIndex.h"
+#include "Patch.h"
 #include "ibamr/LSInitStrategy.h"
 #include "ibamr/namespaces.h"
 #include "tbox/RestartManager.h"
@@ -52,6 +60,8 @@ LSInitStrategy::LSInitStrategy(const std::string& object_name, bool register_for
     d_max_its = 100;
     d_abs_tol = 1e-5;
     d_enable_logging = false;
+    d_use_narrow_band = false;
+    d_narrow_band_width = 6.0;
     d_bc_coef = NULL;
 
     if (d_registered_for_restart)
@@ -94,6 +104,228 @@ void LSInitStrategy::putToDatabase(Pointer<Database> /*db*/)
     return;
 } // putToDatabase
 
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+void
+LSInitStrategy::initializeNarrowBand(NarrowBand& band,
+                                     Pointer<CellData<NDIM, double> > D_data,
+                                     Pointer<Patch<NDIM> > patch) const
+{
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    band.patch_box = patch->getBox();
+    band.band_width = d_narrow_band_width * (*std::max_element(dx, dx + NDIM));
+    const int num_cells = band.patch_box.size();
+    band.in_band.assign(num_cells, 0);
+    band.band_offsets.clear();
+    band.pass_stamp.assign(num_cells, 0);
+    band.iteration_stamp.assign(num_cells, 0);
+    band.pass_num = 0;
+    band.iteration_num = 0;
+    band.active_offsets.clear();
+    band.touched_offsets.clear();
+
+    // NOTE: Box iterators visit cells in Fortran order, so that the offset of
+    // each cell is simply its position in the iteration.
+    int offset = 0;
+    for (Box<NDIM>::Iterator it(band.patch_box); it; it++, ++offset)
+    {
+        if (std::abs((*D_data)(CellIndex<NDIM>(it()))) <= band.band_width)
+        {
+            band.in_band[offset] = 1;
+            band.band_offsets.push_back(offset);
+        }
+    }
+    return;
+} // initializeNarrowBand
+
+void
+LSInitStrategy::beginNarrowBandIteration(NarrowBand& band) const
+{
+    ++band.iteration_num;
+    band.touched_offsets.clear();
+    return;
+} // beginNarrowBandIteration
+
+bool
+LSInitStrategy::collectNarrowBandCells(NarrowBand& band,
+                                       Pointer<CellData<NDIM, double> > D_data,
+                                       Pointer<CellData<NDIM, double> > D_old_data) const
+{
+    const Box<NDIM>& patch_box = band.patch_box;
+    int stride[NDIM];
+    stride[0] = 1;
+    for (int d = 1; d < NDIM; ++d) stride[d] = stride[d - 1] * patch_box.numberCells(d - 1);
+
+    ++band.pass_num;
+    band.active_offsets.clear();
+    const int num_band_cells = static_cast<int>(band.band_offsets.size());
+    for (int k = 0; k < num_band_cells; ++k)
+    {
+        const int offset = band.band_offsets[k];
+        band.pass_stamp[offset] = band.pass_num;
+        band.active_offsets.push_back(offset);
+    }
+
+    // Add the neighbors of band cells that are not yet in the band.
+    for (int k = 0; k < num_band_cells; ++k)
+    {
+        const int offset = band.band_offsets[k];
+        int rem = offset;
+        for (int d = NDIM - 1; d >= 0; --d)
+        {
+            const int i_d = rem / stride[d];
+            rem -= i_d * stride[d];
+            if (i_d > 0 && band.pass_stamp[offset - stride[d]] != band.pass_num)
+            {
+                band.pass_stamp[offset - stride[d]] = band.pass_num;
+                band.active_offsets.push_back(offset - stride[d]);
+            }
+            if (i_d < patch_box.numberCells(d) - 1 && band.pass_stamp[offset + stride[d]] != band.pass_num)
+            {
+                band.pass_stamp[offset + stride[d]] = band.pass_num;
+                band.active_offsets.push_back(offset + stride[d]);
+            }
+        }
+    }
+
+    // Add the patch cells that are adjacent to ghost cells in the band.
+    for (int d = 0; d < NDIM; ++d)
+    {
+        for (int side = 0; side <= 1; ++side)
+        {
+            Box<NDIM> side_box = patch_box;
+            if (side == 0)
+            {
+                side_box.upper(d) = patch_box.lower(d);
+            }
+            else
+            {
+                side_box.lower(d) = patch_box.upper(d);
+            }
+            for (Box<NDIM>::Iterator it(side_box); it; it++)
+            {
+                const CellIndex<NDIM> ci(it());
+                CellIndex<NDIM> ci_ghost(ci);
+                ci_ghost(d) += (side == 0 ? -1 : 1);
+                if (std::abs((*D_data)(ci_ghost)) > band.band_width) continue;
+                int offset = 0;
+                for (int e = 0; e < NDIM; ++e) offset += (ci(e) - patch_box.lower(e)) * stride[e];
+                if (band.pass_stamp[offset] == band.pass_num) continue;
+                band.pass_stamp[offset] = band.pass_num;
+                band.active_offsets.push_back(offset);
+            }
+        }
+    }
+    if (band.active_offsets.empty()) return false;
+    std::sort(band.active_offsets.begin(), band.active_offsets.end());
+
+    // Build the index arrays used by the narrow band patch kernels, and store
+    // the values of cells that are updated for the first time during this
+    // iteration.
+    const int num_active_cells = static_cast<int>(band.active_offsets.size());
+    band.cells.resize(NDIM * num_active_cells);
+    band.row_ptr.clear();
+    band.plane_ptr.clear();
+    int prev_row = -1;
+#if (NDIM == 3)
+    int prev_plane = -1;
+#endif
+    for (int k = 0; k < num_active_cells; ++k)
+    {
+        const int offset = band.active_offsets[k];
+        const int row = offset / stride[1];
+        if (row != prev_row)
+        {
+#if (NDIM == 3)
+            const int plane = offset / stride[2];
+            if (plane != prev_plane)
+            {
+                band.plane_ptr.push_back(static_cast<int>(band.row_ptr.size()));
+                prev_plane = plane;
+            }
+#endif
+            band.row_ptr.push_back(k);
+            prev_row = row;
+        }
+        CellIndex<NDIM> ci;
+        int rem = offset;
+        for (int d = NDIM - 1; d >= 0; --d)
+        {
+            const int i_d = rem / stride[d];
+            rem -= i_d * stride[d];
+            ci(d) = patch_box.lower(d) + i_d;
+            band.cells[NDIM * k + d] = ci(d);
+        }
+        if (band.iteration_stamp[offset] != band.iteration_num)
+        {
+            band.iteration_stamp[offset] = band.iteration_num;
+            band.touched_offsets.push_back(offset);
+            (*D_old_data)(ci) = (*D_data)(ci);
+        }
+    }
+    band.row_ptr.push_back(num_active_cells);
+#if (NDIM == 3)
+    band.plane_ptr.push_back(static_cast<int>(band.row_ptr.size()) - 1);
+#endif
+    return true;
+} // collectNarrowBandCells
+
+bool
+LSInitStrategy::growNarrowBand(NarrowBand& band, Pointer<CellData<NDIM, double> > D_data) const
+{
+    bool grown = false;
+    const int num_active_cells = static_cast<int>(band.active_offsets.size());
+    for (int k = 0; k < num_active_cells; ++k)
+    {
+        const int offset = band.active_offsets[k];
+        if (band.in_band[offset]) continue;
+        CellIndex<NDIM> ci;
+        for (int d = 0; d < NDIM; ++d) ci(d) = band.cells[NDIM * k + d];
+        if (std::abs((*D_data)(ci)) <= band.band_width)
+        {
+            band.in_band[offset] = 1;
+            band.band_offsets.push_back(offset);
+            grown = true;
+        }
+    }
+    return grown;
+} // growNarrowBand
+
+double
+LSInitStrategy::computeNarrowBandDiffSq(const NarrowBand& band,
+                                        Pointer<CellData<NDIM, double> > D_new_data,
+                                        Pointer<CellData<NDIM, double> > D_old_data,
+                                        Pointer<CellData<NDIM, double> > wgt_data,
+                                        double& max_diff) const
+{
+    const Box<NDIM>& patch_box = band.patch_box;
+    int stride[NDIM];
+    stride[0] = 1;
+    for (int d = 1; d < NDIM; ++d) stride[d] = stride[d - 1] * patch_box.numberCells(d - 1);
+
+    double diff_sq = 0.0;
+    max_diff = 0.0;
+    const int num_touched_cells = static_cast<int>(band.touched_offsets.size());
+    for (int k = 0; k < num_touched_cells; ++k)
+    {
+        CellIndex<NDIM> ci;
+        int rem = band.touched_offsets[k];
+        for (int d = NDIM - 1; d >= 0; --d)
+        {
+            const int i_d = rem / stride[d];
+            rem -= i_d * stride[d];
+            ci(d) = patch_box.lower(d) + i_d;
+        }
+        const double D_new = (*D_new_data)(ci);
+        const double D_old = (*D_old_data)(ci);
+        if (std::abs(D_new) > band.band_width && std::abs(D_old) > band.band_width) continue;
+        if (wgt_data) diff_sq += (*wgt_data)(ci) * (D_new - D_old) * (D_new - D_old);
+        max_diff = std::max(max_diff, std::abs(D_new - D_old));
+    }
+    return diff_sq;
+} // computeNarrowBandDiffSq
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
@@ -32,6 +32,8 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <cmath>
+
 #include "ibamr/RelaxationLSMethod.h"
 #include "CellVariable.h"
 #include "HierarchyCellDataOpsReal.h"
@@ -41,16 +43,19 @@
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "tbox/RestartManager.h"
+#include "tbox/SAMRAI_MPI.h"
 
 // FORTRAN ROUTINES
 #if (NDIM == 2)
 #define RELAXATION_LS_1ST_ORDER_FC IBAMR_FC_FUNC(relaxationls1storder2d, RELAXATIONLS1STORDER2D)
 #define RELAXATION_LS_3RD_ORDER_FC IBAMR_FC_FUNC(relaxationls3rdorder2d, RELAXATIONLS3RDORDER2D)
+#define RELAXATION_LS_BAND_FC IBAMR_FC_FUNC(relaxationlsband2d, RELAXATIONLSBAND2D)
 #endif
 
 #if (NDIM == 3)
 #define RELAXATION_LS_1ST_ORDER_FC IBAMR_FC_FUNC(relaxationls1storder3d, RELAXATIONLS1STORDER3D)
 #define RELAXATION_LS_3RD_ORDER_FC IBAMR_FC_FUNC(relaxationls3rdorder3d, RELAXATIONLS3RDORDER3D)
+#define RELAXATION_LS_BAND_FC IBAMR_FC_FUNC(relaxationlsband3d, RELAXATIONLSBAND3D)
 #endif
 
 extern "C" {
@@ -83,6 +88,30 @@ void RELAXATION_LS_3RD_ORDER_FC(double* U,
 #endif
                                 const double* dx,
                                 const int& dir);
+
+void RELAXATION_LS_BAND_FC(double* U,
+                           const int& U_gcw,
+                           const double* V,
+                           const int& V_gcw,
+                           const int& ilower0,
+                           const int& iupper0,
+                           const int& ilower1,
+                           const int& iupper1,
+#if (NDIM == 3)
+                           const int& ilower2,
+                           const int& iupper2,
+#endif
+                           const double* dx,
+                           const int& dir,
+                           const int& ls_order,
+                           const int* cells,
+                           const int& ncells,
+#if (NDIM == 3)
+                           const int* plane_ptr,
+                           const int& nplanes,
+#endif
+                           const int* row_ptr,
+                           const int& nrows);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -155,6 +184,22 @@ RelaxationLSMethod::initializeLSData(int D_idx, Pointer<HierarchyMathOps> hier_m
     Pointer<HierarchyGhostCellInterpolation> fill_op = new HierarchyGhostCellInterpolation();
     HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(hierarchy, coarsest_ln, finest_ln);
 
+    // Per-patch narrow band data.
+    std::vector<std::vector<NarrowBand> > bands(finest_ln + 1);
+    if (d_use_narrow_band)
+    {
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            bands[ln].resize(level->getNumberOfPatches());
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                initializeNarrowBand(bands[ln][p()], patch->getPatchData(D_idx), patch);
+            }
+        }
+    }
+
     // Carry out relaxation
     double diff_L2_norm = 1.0e12;
     int outer_iter = 0;
@@ -168,13 +213,25 @@ RelaxationLSMethod::initializeLSData(int D_idx, Pointer<HierarchyMathOps> hier_m
     fill_op->resetTransactionComponent(D_transaction);
     while (diff_L2_norm > d_abs_tol && outer_iter < d_max_its)
     {
-        hier_cc_data_ops.copyData(D_iter_idx, D_idx);
-        fill_op->fillData(time);
-        relax(hier_math_ops, D_idx, D_init_idx, outer_iter);
+        int num_band_patches = 0;
+        if (d_use_narrow_band)
+        {
+            fill_op->fillData(time);
 
-        // Compute error
-        hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_idx);
-        diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
+            // Relax and compute error on the narrow band.
+            diff_L2_norm = relaxNarrowBand(
+                hier_math_ops, D_idx, D_init_idx, D_iter_idx, cc_wgt_idx, outer_iter, bands, num_band_patches);
+        }
+        else
+        {
+            hier_cc_data_ops.copyData(D_iter_idx, D_idx);
+            fill_op->fillData(time);
+            relax(hier_math_ops, D_idx, D_init_idx, outer_iter);
+
+            // Compute error
+            hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_idx);
+            diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
+        }
 
         outer_iter += 1;
 
@@ -183,6 +240,11 @@ RelaxationLSMethod::initializeLSData(int D_idx, Pointer<HierarchyMathOps> hier_m
             plog << d_object_name << "::initializeLSData(): After iteration # " << outer_iter << std::endl;
             plog << d_object_name << "::initializeLSData(): L2-norm between successive iterations = " << diff_L2_norm
                  << std::endl;
+            if (d_use_narrow_band)
+            {
+                plog << d_object_name << "::initializeLSData(): Number of patches in narrow band = "
+                     << num_band_patches << std::endl;
+            }
         }
 
         if (diff_L2_norm <= d_abs_tol && d_enable_logging)
@@ -240,11 +302,61 @@ RelaxationLSMethod::relax(Pointer<HierarchyMathOps> hier_math_ops,
 
 } // relax
 
+double
+RelaxationLSMethod::relaxNarrowBand(Pointer<HierarchyMathOps> hier_math_ops,
+                                    int dist_idx,
+                                    int dist_init_idx,
+                                    int dist_iter_idx,
+                                    int wgt_idx,
+                                    const int iter,
+                                    std::vector<std::vector<NarrowBand> >& bands,
+                                    int& num_band_patches) const
+{
+    Pointer<PatchHierarchy<NDIM> > hierarchy = hier_math_ops->getPatchHierarchy();
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+
+    // NOTE: sums[0] is the squared difference norm and sums[1] is the number of
+    // patches in the narrow band; both are reduced in a single collective.
+    double sums[2] = { 0.0, 0.0 };
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
+            const Pointer<CellData<NDIM, double> > dist_init_data = patch->getPatchData(dist_init_idx);
+            Pointer<CellData<NDIM, double> > dist_iter_data = patch->getPatchData(dist_iter_idx);
+            Pointer<CellData<NDIM, double> > wgt_data = patch->getPatchData(wgt_idx);
+            NarrowBand& band = bands[ln][p()];
+            beginNarrowBandIteration(band);
+            if (!collectNarrowBandCells(band, dist_data, dist_iter_data)) continue;
+
+            // Relax the band repeatedly while it grows, so that it is extended
+            // by more than one cell per iteration.
+            do
+            {
+                relax(dist_data, dist_init_data, patch, iter, &band);
+            } while (growNarrowBand(band, dist_data) && collectNarrowBandCells(band, dist_data, dist_iter_data));
+
+            double max_diff = 0.0;
+            sums[0] += computeNarrowBandDiffSq(band, dist_data, dist_iter_data, wgt_data, max_diff);
+            sums[1] += 1.0;
+        }
+    }
+    SAMRAI_MPI::sumReduction(sums, 2);
+    num_band_patches = static_cast<int>(sums[1]);
+    return std::sqrt(sums[0]);
+
+} // relaxNarrowBand
+
 void
 RelaxationLSMethod::relax(Pointer<CellData<NDIM, double> > dist_data,
                           const Pointer<CellData<NDIM, double> > dist_init_data,
                           const Pointer<Patch<NDIM> > patch,
-                          const int iter) const
+                          const int iter,
+                          const NarrowBand* band) const
 {
     double* const D = dist_data->getPointer(0);
     const double* const P = dist_init_data->getPointer(0);
@@ -274,7 +386,34 @@ RelaxationLSMethod::relax(Pointer<CellData<NDIM, double> > dist_data,
     const int num_dirs = (NDIM < 3) ? 4 : 8;
     const int dir = iter % num_dirs;
 
-    if (d_ls_order == FIRST_ORDER_LS)
+    if (band && (d_ls_order == FIRST_ORDER_LS || d_ls_order == THIRD_ORDER_LS))
+    {
+        const int ls_order = d_ls_order == FIRST_ORDER_LS ? 1 : 3;
+        RELAXATION_LS_BAND_FC(D,
+                              D_ghosts,
+                              P,
+                              P_ghosts,
+                              patch_box.lower(0),
+                              patch_box.upper(0),
+                              patch_box.lower(1),
+                              patch_box.upper(1),
+#if (NDIM == 3)
+                              patch_box.lower(2),
+                              patch_box.upper(2),
+#endif
+                              dx,
+                              dir,
+                              ls_order,
+                              &band->cells[0],
+                              static_cast<int>(band->active_offsets.size()),
+#if (NDIM == 3)
+                              &band->plane_ptr[0],
+                              static_cast<int>(band->plane_ptr.size()) - 1,
+#endif
+                              &band->row_ptr[0],
+                              static_cast<int>(band->row_ptr.size()) - 1);
+    }
+    else if (d_ls_order == FIRST_ORDER_LS)
     {
         RELAXATION_LS_1ST_ORDER_FC(D,
                                    D_ghosts,
@@ -330,6 +469,9 @@ RelaxationLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_enable_logging = input_db->getBoolWithDefault("enable_logging", d_enable_logging);
 
+    d_use_narrow_band = input_db->getBoolWithDefault("use_narrow_band", d_use_narrow_band);
+    d_narrow_band_width = input_db->getDoubleWithDefault("narrow_band_width", d_narrow_band_width);
+
     return;
 } // getFromInput
 
@@ -644,5 +644,177 @@ c     Compute ENO differences with subcell fix
 
       U(i0,i1) = U(i0,i1) - dt*sgn*(H-one)
 
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Carry out first-order accurate fast sweeping algorithm on a list of
+c     cells.  The cells are stored in Fortran order and are grouped into
+c     rows of constant i1, with row r consisting of the cells
+c     row_ptr(r),...,row_ptr(r+1)-1.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine fastsweepband1storder2d(
+     &     U,U_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dlower0,dupper0,
+     &     dlower1,dupper1,
+     &     dx,
+     &     patch_touches_bdry,
+     &     touches_wall_loc_idx,
+     &     cells,ncells,
+     &     row_ptr,nrows)
+c
+      implicit none
+include(TOP_SRCDIR/src/fortran/const.i)dnl
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER dlower0,dupper0
+      INTEGER dlower1,dupper1
+      INTEGER U_gcw
+      INTEGER patch_touches_bdry
+      INTEGER ncells,nrows
+      INTEGER cells(0:NDIM-1,0:ncells-1)
+      INTEGER row_ptr(0:nrows)
+c
+c     Input/Output.
+c
+      REAL U(CELL2d(ilower,iupper,U_gcw))
+      REAL dx(0:NDIM-1)
+      INTEGER touches_wall_loc_idx(0:2*NDIM - 1)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      INTEGER k,r,sweep
+      INTEGER kfirst,klast,rfirst,rlast
+      INTEGER s0(0:3),s1(0:3)
+      data s0 / 1,-1,-1, 1/
+      data s1 / 1, 1,-1,-1/
+
+c     Do the four sweeping directions.
+      do sweep = 0,3
+         if (s1(sweep) .gt. 0) then
+            rfirst = 0
+            rlast = nrows-1
+         else
+            rfirst = nrows-1
+            rlast = 0
+         endif
+         do r = rfirst,rlast,s1(sweep)
+            if (s0(sweep) .gt. 0) then
+               kfirst = row_ptr(r)
+               klast = row_ptr(r+1)-1
+            else
+               kfirst = row_ptr(r+1)-1
+               klast = row_ptr(r)
+            endif
+            do k = kfirst,klast,s0(sweep)
+               i0 = cells(0,k)
+               i1 = cells(1,k)
+               call evalsweep1storder2d(U,U_gcw,
+     &                                  ilower0,iupper0,
+     &                                  ilower1,iupper1,
+     &                                  i0,i1,
+     &                                  dlower0,dupper0,
+     &                                  dlower1,dupper1,
+     &                                  dx,
+     &                                  patch_touches_bdry,
+     &                                  touches_wall_loc_idx)
+            enddo
+         enddo
+      enddo
+
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Carry out first or third order relaxation scheme using Gauss Seidel
+c     updates on a list of cells, which are stored in the same format as
+c     for fastsweepband1storder2d.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine relaxationlsband2d(
+     &     U,U_gcw,
+     &     V,V_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx,
+     &     dir,
+     &     ls_order,
+     &     cells,ncells,
+     &     row_ptr,nrows)
+c
+      implicit none
+include(TOP_SRCDIR/src/fortran/const.i)dnl
+
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER U_gcw,V_gcw
+      INTEGER dir
+      INTEGER ls_order
+      INTEGER ncells,nrows
+      INTEGER cells(0:NDIM-1,0:ncells-1)
+      INTEGER row_ptr(0:nrows)
+
+c
+c     Input/Output.
+c
+      REAL U(CELL2d(ilower,iupper,U_gcw))
+      REAL V(CELL2d(ilower,iupper,V_gcw))
+      REAL dx(0:NDIM-1)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      INTEGER k,r
+      INTEGER kfirst,klast,rfirst,rlast
+      INTEGER s0(0:3),s1(0:3)
+      data s0 / 1,-1, 1,-1/
+      data s1 / 1, 1,-1,-1/
+
+      if (s1(dir) .gt. 0) then
+         rfirst = 0
+         rlast = nrows-1
+      else
+         rfirst = nrows-1
+         rlast = 0
+      endif
+      do r = rfirst,rlast,s1(dir)
+         if (s0(dir) .gt. 0) then
+            kfirst = row_ptr(r)
+            klast = row_ptr(r+1)-1
+         else
+            kfirst = row_ptr(r+1)-1
+            klast = row_ptr(r)
+         endif
+         do k = kfirst,klast,s0(dir)
+            i0 = cells(0,k)
+            i1 = cells(1,k)
+            if (ls_order .eq. 1) then
+               call evalrelax1storder2d(U,U_gcw,V,V_gcw,
+     &                                  ilower0,iupper0,
+     &                                  ilower1,iupper1,
+     &                                  i0,i1,dx)
+            else
+               call evalrelax3rdorder2d(U,U_gcw,V,V_gcw,
+     &                                  ilower0,iupper0,
+     &                                  ilower1,iupper1,
+     &                                  i0,i1,dx)
+            endif
+         enddo
+      enddo
+
       return
       end
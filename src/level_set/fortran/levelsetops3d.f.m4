@@ -987,3 +987,213 @@ c     Compute ENO differences with subcell fix
       end
 
  
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Carry out first-order accurate fast sweeping algorithm on a list of
+c     cells.  The cells are stored in Fortran order and are grouped into
+c     rows of constant (i1,i2), with row r consisting of the cells
+c     row_ptr(r),...,row_ptr(r+1)-1, and the rows are grouped into planes
+c     of constant i2, with plane p consisting of the rows
+c     plane_ptr(p),...,plane_ptr(p+1)-1.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine fastsweepband1storder3d(
+     &     U,U_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     ilower2,iupper2,
+     &     dlower0,dupper0,
+     &     dlower1,dupper1,
+     &     dlower2,dupper2,
+     &     dx,
+     &     patch_touches_bdry,
+     &     touches_wall_loc_idx,
+     &     cells,ncells,
+     &     plane_ptr,nplanes,
+     &     row_ptr,nrows)
+c
+      implicit none
+include(TOP_SRCDIR/src/fortran/const.i)dnl
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER ilower2,iupper2
+      INTEGER dlower0,dupper0
+      INTEGER dlower1,dupper1
+      INTEGER dlower2,dupper2
+      INTEGER U_gcw
+      INTEGER patch_touches_bdry
+      INTEGER ncells,nrows,nplanes
+      INTEGER cells(0:NDIM-1,0:ncells-1)
+      INTEGER row_ptr(0:nrows)
+      INTEGER plane_ptr(0:nplanes)
+c
+c     Input/Output.
+c
+      REAL U(CELL3d(ilower,iupper,U_gcw))
+      REAL dx(0:NDIM-1)
+      INTEGER touches_wall_loc_idx(0:2*NDIM - 1)
+c
+c     Local variables.
+c
+      INTEGER i0,i1,i2
+      INTEGER k,r,p,sweep
+      INTEGER kfirst,klast,rfirst,rlast,pfirst,plast
+      INTEGER s0(0:7),s1(0:7),s2(0:7)
+      data s0 / 1,-1, 1, 1,-1, 1,-1,-1/
+      data s1 / 1, 1,-1, 1,-1,-1, 1,-1/
+      data s2 / 1, 1, 1,-1, 1,-1,-1,-1/
+
+c     Do the eight sweeping directions.
+      do sweep = 0,7
+         if (s2(sweep) .gt. 0) then
+            pfirst = 0
+            plast = nplanes-1
+         else
+            pfirst = nplanes-1
+            plast = 0
+         endif
+         do p = pfirst,plast,s2(sweep)
+            if (s1(sweep) .gt. 0) then
+               rfirst = plane_ptr(p)
+               rlast = plane_ptr(p+1)-1
+            else
+               rfirst = plane_ptr(p+1)-1
+               rlast = plane_ptr(p)
+            endif
+            do r = rfirst,rlast,s1(sweep)
+               if (s0(sweep) .gt. 0) then
+                  kfirst = row_ptr(r)
+                  klast = row_ptr(r+1)-1
+               else
+                  kfirst = row_ptr(r+1)-1
+                  klast = row_ptr(r)
+               endif
+               do k = kfirst,klast,s0(sweep)
+                  i0 = cells(0,k)
+                  i1 = cells(1,k)
+                  i2 = cells(2,k)
+                  call evalsweep1storder3d(U,U_gcw,
+     &                                     ilower0,iupper0,
+     &                                     ilower1,iupper1,
+     &                                     ilower2,iupper2,
+     &                                     i0,i1,i2,
+     &                                     dlower0,dupper0,
+     &                                     dlower1,dupper1,
+     &                                     dlower2,dupper2,
+     &                                     dx,
+     &                                     patch_touches_bdry,
+     &                                     touches_wall_loc_idx)
+               enddo
+            enddo
+         enddo
+      enddo
+
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Carry out first or third order relaxation scheme using Gauss Seidel
+c     updates on a list of cells, which are stored in the same format as
+c     for fastsweepband1storder3d.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine relaxationlsband3d(
+     &     U,U_gcw,
+     &     V,V_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     ilower2,iupper2,
+     &     dx,
+     &     dir,
+     &     ls_order,
+     &     cells,ncells,
+     &     plane_ptr,nplanes,
+     &     row_ptr,nrows)
+c
+      implicit none
+include(TOP_SRCDIR/src/fortran/const.i)dnl
+
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER ilower2,iupper2
+      INTEGER U_gcw,V_gcw
+      INTEGER dir
+      INTEGER ls_order
+      INTEGER ncells,nrows,nplanes
+      INTEGER cells(0:NDIM-1,0:ncells-1)
+      INTEGER row_ptr(0:nrows)
+      INTEGER plane_ptr(0:nplanes)
+
+c
+c     Input/Output.
+c
+      REAL U(CELL3d(ilower,iupper,U_gcw))
+      REAL V(CELL3d(ilower,iupper,V_gcw))
+      REAL dx(0:NDIM-1)
+c
+c     Local variables.
+c
+      INTEGER i0,i1,i2
+      INTEGER k,r,p
+      INTEGER kfirst,klast,rfirst,rlast,pfirst,plast
+      INTEGER s0(0:7),s1(0:7),s2(0:7)
+      data s0 / 1,-1, 1, 1,-1,-1, 1,-1/
+      data s1 / 1, 1,-1, 1,-1, 1,-1,-1/
+      data s2 / 1, 1, 1,-1, 1,-1,-1,-1/
+
+      if (s2(dir) .gt. 0) then
+         pfirst = 0
+         plast = nplanes-1
+      else
+         pfirst = nplanes-1
+         plast = 0
+      endif
+      do p = pfirst,plast,s2(dir)
+         if (s1(dir) .gt. 0) then
+            rfirst = plane_ptr(p)
+            rlast = plane_ptr(p+1)-1
+         else
+            rfirst = plane_ptr(p+1)-1
+            rlast = plane_ptr(p)
+         endif
+         do r = rfirst,rlast,s1(dir)
+            if (s0(dir) .gt. 0) then
+               kfirst = row_ptr(r)
+               klast = row_ptr(r+1)-1
+            else
+               kfirst = row_ptr(r+1)-1
+               klast = row_ptr(r)
+            endif
+            do k = kfirst,klast,s0(dir)
+               i0 = cells(0,k)
+               i1 = cells(1,k)
+               i2 = cells(2,k)
+               if (ls_order .eq. 1) then
+                  call evalrelax1storder3d(U,U_gcw,V,V_gcw,
+     &                                     ilower0,iupper0,
+     &                                     ilower1,iupper1,
+     &                                     ilower2,iupper2,
+     &                                     i0,i1,i2,dx)
+               else
+                  call evalrelax3rdorder3d(U,U_gcw,V,V_gcw,
+     &                                     ilower0,iupper0,
+     &                                     ilower1,iupper1,
+     &                                     ilower2,iupper2,
+     &                                     i0,i1,i2,dx)
+               endif
+            enddo
+         enddo
+      enddo
+
+      return
+      end
@@ -105,6 +105,8 @@
 #include "tbox/PIO.h"
 #include "tbox/Pointer.h"
 #include "tbox/SAMRAI_MPI.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 // FORTRAN ROUTINES
@@ -288,6 +290,9 @@ static const std::string DATA_COARSEN_TYPE = "CUBIC_COARSEN";
 // Whether to enforce consistent interpolated values at Type 2 coarse-fine
 // interface ghost cells.
 static const bool CONSISTENT_TYPE_2_BDRY = false;
+
+// Timers.
+static Timer* t_regrid_hierarchy;
 }
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -432,6 +437,10 @@ INSCollocatedHierarchyIntegrator::INSCollocatedHierarchyIntegrator(const std::st
     d_Grad_Phi_cc_var = new CellVariable<NDIM, double>(d_object_name + "::Grad_Phi_cc", NDIM);
     d_Grad_Phi_fc_var = new FaceVariable<NDIM, double>(d_object_name + "::Grad_Phi_fc");
     d_F_div_var = new CellVariable<NDIM, double>(d_object_name + "::F_div", NDIM);
+
+    // Setup Timers.
+    IBAMR_DO_ONCE(t_regrid_hierarchy = TimerManager::getManager()->getTimer(
+                      "IBAMR::INSCollocatedHierarchyIntegrator::regridHierarchy()"););
     return;
 } // INSCollocatedHierarchyIntegrator
 
@@ -1544,26 +1553,19 @@ INSCollocatedHierarchyIntegrator::postprocessIntegrateHierarchy(const double cur
 void
 INSCollocatedHierarchyIntegrator::regridHierarchy()
 {
-    const int coarsest_ln = 0;
+    IBAMR_TIMER_START(t_regrid_hierarchy);
 
     // Regrid the hierarchy.
-    switch (d_regrid_mode)
+    regridPatchLevels();
+
+    // When no level of the hierarchy was changed by regridding, the velocity
+    // field is unchanged and does not need to be projected.
+    if (hierarchyUnchangedByRegrid())
     {
-    case STANDARD:
-        d_gridding_alg->regridAllFinerLevels(d_hierarchy, coarsest_ln, d_integrator_time, d_tag_buffer);
-        break;
-    case AGGRESSIVE:
-        for (int k = 0; k < d_gridding_alg->getMaxLevels(); ++k)
-        {
-            d_gridding_alg->regridAllFinerLevels(d_hierarchy, coarsest_ln, d_integrator_time, d_tag_buffer);
-        }
-        break;
-    default:
-        TBOX_ERROR(d_object_name << "::regridHierarchy():\n"
-                                 << "  unrecognized regrid mode: "
-                                 << IBTK::enum_to_string<RegridMode>(d_regrid_mode)
-                                 << "."
-                                 << std::endl);
+        synchronizeHierarchyData(CURRENT_DATA);
+        logRegridSummary();
+        IBAMR_TIMER_STOP(t_regrid_hierarchy);
+        return;
     }
 
     // Project the interpolated velocity.
@@ -1571,6 +1573,9 @@ INSCollocatedHierarchyIntegrator::regridHierarchy()
 
     // Synchronize the state data on the patch hierarchy.
     synchronizeHierarchyData(CURRENT_DATA);
+    logRegridSummary();
+
+    IBAMR_TIMER_STOP(t_regrid_hierarchy);
     return;
 } // regridHierarchy
 
@@ -1741,8 +1746,11 @@ INSCollocatedHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
         d_Q_bdry_bc_fill_op->initializeOperatorState(Q_bc_component, d_hierarchy);
     }
 
-    // Indicate that vectors and solvers need to be re-initialized.
-    d_coarsest_reset_ln = coarsest_level;
+    // Indicate that vectors and solvers need to be re-initialized.  Only the
+    // levels that were reset need to be rebuilt by the solvers, unless a
+    // complete reinitialization is already pending.
+    d_coarsest_reset_ln =
+        (d_coarsest_reset_ln == -1 ? coarsest_level : std::min(d_coarsest_reset_ln, coarsest_level));
     d_finest_reset_ln = finest_level;
     d_vectors_need_init = true;
     d_convective_op_needs_init = true;
@@ -2084,6 +2092,11 @@ INSCollocatedHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double c
     // Ensure that solver components are appropriately reinitialized when the
     // time step size changes.
     const bool dt_change = initial_time || !MathUtilities<double>::equalEps(dt, d_dt_previous[0]);
+
+    // Determine whether solvers only need to rebuild data associated with the
+    // levels that were reset by regridding.  Solvers whose operators depend on
+    // the time step size must be completely reinitialized when it changes.
+    const bool reset_levels = d_coarsest_reset_ln > coarsest_ln && d_coarsest_reset_ln <= finest_ln;
     if (dt_change)
     {
         d_velocity_solver_needs_init = true;
@@ -2188,6 +2201,7 @@ INSCollocatedHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double c
                 p_velocity_solver->setInitialGuessNonzero(true);
                 if (has_velocity_nullspace) p_velocity_solver->setNullspace(false, d_U_nul_vecs);
             }
+            if (reset_levels && !dt_change) d_velocity_solver->setResetLevels(d_coarsest_reset_ln, finest_ln);
             d_velocity_solver->initializeSolverState(*d_U_scratch_vec, *d_U_rhs_vec);
             d_velocity_solver_needs_init = false;
         }
@@ -2211,10 +2225,13 @@ INSCollocatedHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double c
                 p_pressure_solver->setInitialGuessNonzero(true);
                 if (has_pressure_nullspace) p_pressure_solver->setNullspace(true);
             }
+            if (reset_levels) d_pressure_solver->setResetLevels(d_coarsest_reset_ln, finest_ln);
             d_pressure_solver->initializeSolverState(*d_Phi_vec, *d_Phi_rhs_vec);
             d_pressure_solver_needs_init = false;
         }
     }
+    d_coarsest_reset_ln = -1;
+    d_finest_reset_ln = -1;
     return;
 } // reinitializeOperatorsAndSolvers
 
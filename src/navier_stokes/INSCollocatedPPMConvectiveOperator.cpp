@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -41,6 +42,7 @@
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
+#include "CellDataFactory.h"
 #include "CellVariable.h"
 #include "CoarsenAlgorithm.h"
 #include "CoarsenOperator.h"
@@ -68,6 +70,7 @@
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/CartExtrapPhysBdryOp.h"
+#include "ibtk/PatchScratchArena.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 #include "tbox/Timer.h"
@@ -342,7 +345,9 @@ INSCollocatedPPMConvectiveOperator::INSCollocatedPPMConvectiveOperator(
       d_u_extrap_var(NULL),
       d_u_flux_var(NULL),
       d_u_extrap_idx(-1),
-      d_u_flux_idx(-1)
+      d_u_flux_idx(-1),
+      d_scratch_arena(new PatchScratchArena()),
+      d_cell_scratch_factory(new CellDataFactory<NDIM, double>(1, IntVector<NDIM>(GADVECTG)))
 {
     if (d_difference_form != ADVECTIVE && d_difference_form != CONSERVATIVE && d_difference_form != SKEW_SYMMETRIC)
     {
@@ -459,6 +464,7 @@ INSCollocatedPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, con
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            d_scratch_arena->reset();
 
             const Box<NDIM>& patch_box = patch->getBox();
             const IntVector<NDIM>& patch_lower = patch_box.lower();
@@ -480,13 +486,16 @@ INSCollocatedPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, con
             TBOX_ASSERT(u_extrap_data_gcw.min() == u_extrap_data_gcw.max());
 #endif
             CellData<NDIM, double>& U0_data = *U_data;
-            CellData<NDIM, double> U1_data(patch_box, 1, U_data_gcw);
+#if !defined(NDEBUG)
+            TBOX_ASSERT(U_data_gcw == d_cell_scratch_factory->getGhostCellWidth());
+#endif
+            Pointer<CellData<NDIM, double> > U1_data = d_cell_scratch_factory->allocate(patch_box, d_scratch_arena);
 #if (NDIM == 3)
-            CellData<NDIM, double> U2_data(patch_box, 1, U_data_gcw);
+            Pointer<CellData<NDIM, double> > U2_data = d_cell_scratch_factory->allocate(patch_box, d_scratch_arena);
 #endif
-            CellData<NDIM, double> dU_data(patch_box, 1, U_data_gcw);
-            CellData<NDIM, double> U_L_data(patch_box, 1, U_data_gcw);
-            CellData<NDIM, double> U_R_data(patch_box, 1, U_data_gcw);
+            Pointer<CellData<NDIM, double> > dU_data = d_cell_scratch_factory->allocate(patch_box, d_scratch_arena);
+            Pointer<CellData<NDIM, double> > U_L_data = d_cell_scratch_factory->allocate(patch_box, d_scratch_arena);
+            Pointer<CellData<NDIM, double> > U_R_data = d_cell_scratch_factory->allocate(patch_box, d_scratch_arena);
 
             // Extrapolate from cell centers to cell faces.
             for (unsigned int axis = 0; axis < NDIM; ++axis)
@@ -500,10 +509,10 @@ INSCollocatedPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, con
                     U_data_gcw(0),
                     U_data_gcw(1),
                     U0_data.getPointer(axis),
-                    U1_data.getPointer(),
-                    dU_data.getPointer(),
-                    U_L_data.getPointer(),
-                    U_R_data.getPointer(),
+                    U1_data->getPointer(),
+                    dU_data->getPointer(),
+                    U_L_data->getPointer(),
+                    U_R_data->getPointer(),
                     u_ADV_data_gcw(0),
                     u_ADV_data_gcw(1),
                     u_extrap_data_gcw(0),
@@ -524,11 +533,11 @@ INSCollocatedPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, con
                     U_data_gcw(1),
                     U_data_gcw(2),
                     U0_data.getPointer(axis),
-                    U1_data.getPointer(),
-                    U2_data.getPointer(),
-                    dU_data.getPointer(),
-                    U_L_data.getPointer(),
-                    U_R_data.getPointer(),
+                    U1_data->getPointer(),
+                    U2_data->getPointer(),
+                    dU_data->getPointer(),
+                    U_L_data->getPointer(),
+                    U_R_data->getPointer(),
                     u_ADV_data_gcw(0),
                     u_ADV_data_gcw(1),
                     u_ADV_data_gcw(2),
@@ -839,6 +848,22 @@ INSCollocatedPPMConvectiveOperator::initializeOperatorState(const SAMRAIVectorRe
         d_ghostfill_scheds[ln] = d_ghostfill_alg->createSchedule(level, ln - 1, d_hierarchy, d_ghostfill_strategy);
     }
 
+    // Size the scratch arena to hold the temporaries required by the largest
+    // local patch.
+    size_t scratch_bytes = 0;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const size_t patch_bytes =
+                (NDIM == 2 ? 4 : 5) * d_cell_scratch_factory->getSizeOfMemory(patch->getBox());
+            scratch_bytes = std::max(scratch_bytes, patch_bytes);
+        }
+    }
+    d_scratch_arena->reserve(scratch_bytes);
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
@@ -861,6 +886,9 @@ INSCollocatedPPMConvectiveOperator::deallocateOperatorState()
     }
     d_ghostfill_scheds.clear();
 
+    // Release the scratch arena.
+    d_scratch_arena->clear();
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
@@ -403,6 +403,7 @@ void
 INSHierarchyIntegrator::setVelocitySubdomainSolverNeedsInit()
 {
     d_velocity_solver_needs_init = true;
+    d_coarsest_reset_ln = 0;
     return;
 }
 
@@ -421,6 +422,7 @@ void
 INSHierarchyIntegrator::setPressureSubdomainSolverNeedsInit()
 {
     d_pressure_solver_needs_init = true;
+    d_coarsest_reset_ln = 0;
     return;
 }
 
@@ -491,6 +493,8 @@ INSHierarchyIntegrator::INSHierarchyIntegrator(const std::string& object_name,
     d_output_EE = false;
     d_velocity_solver = NULL;
     d_pressure_solver = NULL;
+    d_coarsest_reset_ln = -1;
+    d_finest_reset_ln = -1;
 
     // Setup default boundary condition objects that specify homogeneous
     // Dirichlet (solid-wall) boundary conditions for the velocity.
@@ -126,6 +126,8 @@
 #include "tbox/PIO.h"
 #include "tbox/Pointer.h"
 #include "tbox/SAMRAI_MPI.h"
+#include "tbox/Timer.h"
+#include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
 // FORTRAN ROUTINES
@@ -365,6 +367,10 @@ static const std::string DATA_COARSEN_TYPE = "CUBIC_COARSEN";
 // interface ghost cells.
 static const bool CONSISTENT_TYPE_2_BDRY = false;
 
+// Timers.
+static Timer* t_integrate_hierarchy_stokes_solve;
+static Timer* t_regrid_hierarchy;
+
 // Copy data from a side-centered variable to a face-centered variable.
 void
 copy_side_to_face(const int U_fc_idx, const int U_sc_idx, Pointer<PatchHierarchy<NDIM> > hierarchy)
@@ -586,6 +592,12 @@ INSStaggeredHierarchyIntegrator::INSStaggeredHierarchyIntegrator(const std::stri
     d_indicator_var = new SideVariable<NDIM, double>(d_object_name + "::indicator");
     d_F_div_var = new SideVariable<NDIM, double>(d_object_name + "::F_div");
     d_EE_var = new CellVariable<NDIM, double>(d_object_name + "::EE", NDIM * NDIM);
+
+    // Setup Timers.
+    IBAMR_DO_ONCE(t_integrate_hierarchy_stokes_solve = TimerManager::getManager()->getTimer(
+                      "IBAMR::INSStaggeredHierarchyIntegrator::integrateHierarchy()[stokes_solve]");
+                  t_regrid_hierarchy = TimerManager::getManager()->getTimer(
+                      "IBAMR::INSStaggeredHierarchyIntegrator::regridHierarchy()"););
     return;
 } // INSStaggeredHierarchyIntegrator
 
@@ -722,6 +734,7 @@ void
 INSStaggeredHierarchyIntegrator::setStokesSolverNeedsInit()
 {
     d_stokes_solver_needs_init = true;
+    d_coarsest_reset_ln = 0;
     return;
 }
 
@@ -936,16 +949,22 @@ INSStaggeredHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHier
     }
 
 // Register scratch variables that are maintained by the
-// INSStaggeredHierarchyIntegrator.
+// INSStaggeredHierarchyIntegrator.  These data are only allocated while they
+// are in use.
 #if (NDIM == 3)
     registerVariable(d_Omega_Norm_idx, d_Omega_Norm_var, no_ghosts);
+    deferPatchDataAllocation(d_Omega_Norm_idx);
 #endif
     registerVariable(d_U_regrid_idx, d_U_regrid_var, CartSideDoubleDivPreservingRefine::REFINE_OP_STENCIL_WIDTH);
     registerVariable(d_U_src_idx, d_U_src_var, CartSideDoubleDivPreservingRefine::REFINE_OP_STENCIL_WIDTH);
     registerVariable(d_indicator_idx, d_indicator_var, CartSideDoubleDivPreservingRefine::REFINE_OP_STENCIL_WIDTH);
+    deferPatchDataAllocation(d_U_regrid_idx);
+    deferPatchDataAllocation(d_U_src_idx);
+    deferPatchDataAllocation(d_indicator_idx);
     if (d_Q_fcn)
     {
         registerVariable(d_F_div_idx, d_F_div_var, no_ghosts);
+        deferPatchDataAllocation(d_F_div_idx);
     }
     else
     {
@@ -1183,7 +1202,6 @@ INSStaggeredHierarchyIntegrator::preprocessIntegrateHierarchy(const double curre
                                                               /*P_bc_coef*/ NULL);
     d_hier_math_ops->laplace(
         U_rhs_idx, U_rhs_var, U_rhs_problem_coefs, d_U_scratch_idx, d_U_var, d_no_fill_op, current_time);
-    d_hier_sc_data_ops->copyData(d_U_src_idx, d_U_scratch_idx, /*interior_only*/ false);
 
     // Set the initial guess.
     d_hier_sc_data_ops->copyData(d_U_new_idx, d_U_current_idx);
@@ -1323,7 +1341,9 @@ INSStaggeredHierarchyIntegrator::integrateHierarchy(const double current_time,
     setupSolverVectors(d_sol_vec, d_rhs_vec, current_time, new_time, cycle_num);
 
     // Solve for u(n+1), p(n+1/2).
+    IBAMR_TIMER_START(t_integrate_hierarchy_stokes_solve);
     d_stokes_solver->solveSystem(*d_sol_vec, *d_rhs_vec);
+    IBAMR_TIMER_STOP(t_integrate_hierarchy_stokes_solve);
     if (d_enable_logging)
         plog << d_object_name
              << "::integrateHierarchy(): stokes solve number of iterations = " << d_stokes_solver->getNumIterations()
@@ -1433,6 +1453,7 @@ INSStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const double curr
         d_hier_sc_data_ops->copyData(d_U_scratch_idx, d_U_new_idx);
         d_hier_math_ops->curl(d_Omega_idx, d_Omega_var, d_U_scratch_idx, d_U_var, d_U_bdry_bc_fill_op, new_time);
 #if (NDIM == 3)
+        allocateDeferredPatchData(d_Omega_Norm_idx, new_time);
         d_hier_math_ops->pointwiseL2Norm(d_Omega_Norm_idx, d_Omega_Norm_var, d_Omega_idx, d_Omega_var);
 #endif
         const int wgt_cc_idx = d_hier_math_ops->getCellWeightPatchDescriptorIndex();
@@ -1441,6 +1462,7 @@ INSStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const double curr
 #endif
 #if (NDIM == 3)
         d_Omega_max = d_hier_cc_data_ops->max(d_Omega_Norm_idx, wgt_cc_idx);
+        deallocateDeferredPatchData(d_Omega_Norm_idx);
 #endif
     }
 
@@ -1470,7 +1492,7 @@ INSStaggeredHierarchyIntegrator::postprocessIntegrateHierarchy(const double curr
 void
 INSStaggeredHierarchyIntegrator::regridHierarchy()
 {
-    const int coarsest_ln = 0;
+    IBAMR_TIMER_START(t_regrid_hierarchy);
 
     // Determine the divergence of the velocity field before regridding.
     d_hier_math_ops->div(d_Div_U_idx,
@@ -1490,23 +1512,16 @@ INSStaggeredHierarchyIntegrator::regridHierarchy()
     const double Div_U_norm_oo_pre = d_hier_cc_data_ops->maxNorm(d_Div_U_idx, wgt_cc_idx);
 
     // Regrid the hierarchy.
-    switch (d_regrid_mode)
+    regridPatchLevels();
+
+    // When no level of the hierarchy was changed by regridding, the velocity
+    // field is unchanged and there is no need to check its divergence.
+    if (hierarchyUnchangedByRegrid())
     {
-    case STANDARD:
-        d_gridding_alg->regridAllFinerLevels(d_hierarchy, coarsest_ln, d_integrator_time, d_tag_buffer);
-        break;
-    case AGGRESSIVE:
-        for (int k = 0; k < d_gridding_alg->getMaxLevels(); ++k)
-        {
-            d_gridding_alg->regridAllFinerLevels(d_hierarchy, coarsest_ln, d_integrator_time, d_tag_buffer);
-        }
-        break;
-    default:
-        TBOX_ERROR(d_object_name << "::regridHierarchy():\n"
-                                 << "  unrecognized regrid mode: "
-                                 << IBTK::enum_to_string<RegridMode>(d_regrid_mode)
-                                 << "."
-                                 << std::endl);
+        synchronizeHierarchyData(CURRENT_DATA);
+        logRegridSummary();
+        IBAMR_TIMER_STOP(t_regrid_hierarchy);
+        return;
     }
 
     // Determine the divergence of the velocity field after regridding.
@@ -1537,6 +1552,9 @@ INSStaggeredHierarchyIntegrator::regridHierarchy()
 
     // Synchronize the state data on the patch hierarchy.
     synchronizeHierarchyData(CURRENT_DATA);
+    logRegridSummary();
+
+    IBAMR_TIMER_STOP(t_regrid_hierarchy);
     return;
 } // regridHierarchy
 
@@ -1637,6 +1655,7 @@ INSStaggeredHierarchyIntegrator::setupSolverVectors(const Pointer<SAMRAIVectorRe
         d_Q_bdry_bc_fill_op->fillData(half_time);
 
         // Account for momentum loss at sources/sinks.
+        allocateDeferredPatchData(d_F_div_idx, half_time);
         if (!d_creeping_flow)
         {
             d_hier_sc_data_ops->linearSum(d_U_scratch_idx, 0.5, d_U_current_idx, 0.5, d_U_new_idx);
@@ -1737,6 +1756,7 @@ INSStaggeredHierarchyIntegrator::resetSolverVectors(const Pointer<SAMRAIVectorRe
             rhs_vec->getComponentDescriptorIndex(0), -rho, d_F_div_idx, rhs_vec->getComponentDescriptorIndex(0));
         d_hier_cc_data_ops->add(
             rhs_vec->getComponentDescriptorIndex(1), rhs_vec->getComponentDescriptorIndex(1), d_Q_new_idx);
+        deallocateDeferredPatchData(d_F_div_idx);
     }
     return;
 } // resetSolverVectors
@@ -1778,8 +1798,10 @@ INSStaggeredHierarchyIntegrator::initializeLevelDataSpecialized(const Pointer<Ba
 #endif
     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
 
-    // Correct the divergence of the interpolated velocity data.
-    if (!initial_time && level_number > 0)
+    // Correct the divergence of the interpolated velocity data.  Levels that
+    // are unchanged by regridding hold a copy of the old velocity data and do
+    // not require correction.
+    if (!initial_time && level_number > 0 && !levelUnchangedByRegrid(level_number))
     {
         // Allocate scratch data.
         ComponentSelector scratch_data;
@@ -1998,8 +2020,11 @@ INSStaggeredHierarchyIntegrator::resetHierarchyConfigurationSpecialized(
     d_side_synch_op = new SideDataSynchronization();
     d_side_synch_op->initializeOperatorState(synch_transaction, d_hierarchy);
 
-    // Indicate that vectors and solvers need to be re-initialized.
-    d_coarsest_reset_ln = coarsest_level;
+    // Indicate that vectors and solvers need to be re-initialized.  Only the
+    // levels that were reset need to be rebuilt by the solvers, unless a
+    // complete reinitialization is already pending.
+    d_coarsest_reset_ln =
+        (d_coarsest_reset_ln == -1 ? coarsest_level : std::min(d_coarsest_reset_ln, coarsest_level));
     d_finest_reset_ln = finest_level;
     d_vectors_need_init = true;
     d_convective_op_needs_init = true;
@@ -2356,6 +2381,11 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
     // Ensure that solver components are appropriately reinitialized when the
     // time step size changes.
     const bool dt_change = initial_time || !MathUtilities<double>::equalEps(dt, d_dt_previous[0]);
+
+    // Determine whether solvers only need to rebuild data associated with the
+    // levels that were reset by regridding.  Solvers whose operators depend on
+    // the time step size must be completely reinitialized when it changes.
+    const bool reset_levels = d_coarsest_reset_ln > coarsest_ln && d_coarsest_reset_ln <= finest_ln;
     if (dt_change)
     {
         d_velocity_solver_needs_init = true;
@@ -2508,6 +2538,7 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
                 p_velocity_solver->setInitialGuessNonzero(false);
                 if (has_velocity_nullspace) p_velocity_solver->setNullspace(false, d_U_nul_vecs);
             }
+            if (reset_levels && !dt_change) d_velocity_solver->setResetLevels(d_coarsest_reset_ln, finest_ln);
             d_velocity_solver->initializeSolverState(*d_U_scratch_vec, *d_U_rhs_vec);
             d_velocity_solver_needs_init = false;
         }
@@ -2531,6 +2562,7 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
                 p_pressure_solver->setInitialGuessNonzero(false);
                 if (has_pressure_nullspace) p_pressure_solver->setNullspace(true);
             }
+            if (reset_levels) d_pressure_solver->setResetLevels(d_coarsest_reset_ln, finest_ln);
             d_pressure_solver->initializeSolverState(*d_P_scratch_vec, *d_P_rhs_vec);
             d_pressure_solver_needs_init = false;
         }
@@ -2606,9 +2638,12 @@ INSStaggeredHierarchyIntegrator::reinitializeOperatorsAndSolvers(const double cu
             if (has_velocity_nullspace || has_pressure_nullspace)
                 p_stokes_linear_solver->setNullspace(false, d_nul_vecs);
         }
+        if (reset_levels && !dt_change) d_stokes_solver->setResetLevels(d_coarsest_reset_ln, finest_ln);
         d_stokes_solver->initializeSolverState(*d_sol_vec, *d_rhs_vec);
         d_stokes_solver_needs_init = false;
     }
+    d_coarsest_reset_ln = -1;
+    d_finest_reset_ln = -1;
     return;
 } // reinitializeOperatorsAndSolvers
 
@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -40,6 +41,7 @@
 #include "Box.h"
 #include "CartesianPatchGeometry.h"
 #include "FaceData.h"
+#include "FaceDataFactory.h"
 #include "IBAMR_config.h"
 #include "Index.h"
 #include "IntVector.h"
@@ -49,6 +51,7 @@
 #include "PatchLevel.h"
 #include "SAMRAIVectorReal.h"
 #include "SideData.h"
+#include "SideDataFactory.h"
 #include "SideGeometry.h"
 #include "SideVariable.h"
 #include "Variable.h"
@@ -62,6 +65,7 @@
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/PatchScratchArena.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 #include "tbox/Timer.h"
@@ -478,7 +482,10 @@ INSStaggeredPPMConvectiveOperator::INSStaggeredPPMConvectiveOperator(
       d_coarsest_ln(-1),
       d_finest_ln(-1),
       d_U_var(NULL),
-      d_U_scratch_idx(-1)
+      d_U_scratch_idx(-1),
+      d_scratch_arena(new PatchScratchArena()),
+      d_face_scratch_factory(new FaceDataFactory<NDIM, double>(1, IntVector<NDIM>(1), false)),
+      d_side_scratch_factory(new SideDataFactory<NDIM, double>(1, IntVector<NDIM>(GADVECTG), false))
 {
     if (d_difference_form != ADVECTIVE && d_difference_form != CONSERVATIVE && d_difference_form != SKEW_SYMMETRIC)
     {
@@ -575,6 +582,7 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            d_scratch_arena->reset();
 
             const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
             const double* const dx = patch_geom->getDx();
@@ -585,17 +593,31 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
 
             Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(N_idx);
             Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_scratch_idx);
+#if !defined(NDEBUG)
+            TBOX_ASSERT(U_data->getGhostCellWidth() == d_side_scratch_factory->getGhostCellWidth());
+#endif
 
-            const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
             boost::array<Box<NDIM>, NDIM> side_boxes;
             boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_adv_data;
             boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_half_data;
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                U_adv_data[axis] = d_face_scratch_factory->allocate(side_boxes[axis], d_scratch_arena);
+                U_half_data[axis] = d_face_scratch_factory->allocate(side_boxes[axis], d_scratch_arena);
             }
+
+            // NOTE: Each of the side-centered temporaries is only accessed one
+            // component at a time, so they are shared by all axes.
+            Pointer<SideData<NDIM, double> > dU_data = d_side_scratch_factory->allocate(patch_box, d_scratch_arena);
+            Pointer<SideData<NDIM, double> > U_L_data = d_side_scratch_factory->allocate(patch_box, d_scratch_arena);
+            Pointer<SideData<NDIM, double> > U_R_data = d_side_scratch_factory->allocate(patch_box, d_scratch_arena);
+            Pointer<SideData<NDIM, double> > U_scratch1_data =
+                d_side_scratch_factory->allocate(patch_box, d_scratch_arena);
+#if (NDIM == 3)
+            Pointer<SideData<NDIM, double> > U_scratch2_data =
+                d_side_scratch_factory->allocate(patch_box, d_scratch_arena);
+#endif
 #if (NDIM == 2)
             NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
                                           patch_upper(0),
@@ -674,18 +696,6 @@ INSStaggeredPPMConvectiveOperator::applyConvectiveOperator(const int U_idx, cons
 #endif
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
-                Pointer<SideData<NDIM, double> > dU_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_L_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_R_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_scratch1_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-#if (NDIM == 3)
-                Pointer<SideData<NDIM, double> > U_scratch2_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-#endif
 #if (NDIM == 2)
                 GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
                                        side_boxes[axis].upper(0),
@@ -1020,6 +1030,27 @@ INSStaggeredPPMConvectiveOperator::initializeOperatorState(const SAMRAIVectorRea
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_bc_helper->cacheBcCoefData(d_bc_coefs, d_solution_time, d_hierarchy);
 
+    // Size the scratch arena to hold the temporaries required by the largest
+    // local patch.
+    size_t scratch_bytes = 0;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            size_t patch_bytes = (NDIM == 2 ? 4 : 5) * d_side_scratch_factory->getSizeOfMemory(patch_box);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                patch_bytes +=
+                    2 * d_face_scratch_factory->getSizeOfMemory(SideGeometry<NDIM>::toSideBox(patch_box, axis));
+            }
+            scratch_bytes = std::max(scratch_bytes, patch_bytes);
+        }
+    }
+    d_scratch_arena->reserve(scratch_bytes);
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
@@ -1037,6 +1068,9 @@ INSStaggeredPPMConvectiveOperator::deallocateOperatorState()
     d_hier_bdry_fill.setNull();
     d_bc_helper.setNull();
 
+    // Release the scratch arena.
+    d_scratch_arena->clear();
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <cmath>
 #include <ostream>
 #include <string>
@@ -43,6 +44,7 @@
 #include "BoxArray.h"
 #include "CartesianPatchGeometry.h"
 #include "FaceData.h"
+#include "FaceDataFactory.h"
 #include "FaceIndex.h"
 #include "FaceIterator.h"
 #include "GridGeometry.h"
@@ -52,9 +54,12 @@
 #include "MultiblockDataTranslator.h"
 #include "Patch.h"
 #include "PatchHierarchy.h"
+#include "PatchDataFactory.h"
+#include "PatchDescriptor.h"
 #include "PatchLevel.h"
 #include "SAMRAIVectorReal.h"
 #include "SideData.h"
+#include "SideDataFactory.h"
 #include "SideGeometry.h"
 #include "SideIndex.h"
 #include "SideVariable.h"
@@ -69,6 +74,7 @@
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/PatchScratchArena.h"
 #include "ibtk/ibtk_utilities.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
@@ -495,7 +501,11 @@ INSStaggeredStabilizedPPMConvectiveOperator::INSStaggeredStabilizedPPMConvective
       d_coarsest_ln(-1),
       d_finest_ln(-1),
       d_U_var(NULL),
-      d_U_scratch_idx(-1)
+      d_U_scratch_idx(-1),
+      d_scratch_arena(new PatchScratchArena()),
+      d_face_scratch_factory(new FaceDataFactory<NDIM, double>(1, IntVector<NDIM>(1), false)),
+      d_side_scratch_factory(new SideDataFactory<NDIM, double>(1, IntVector<NDIM>(GADVECTG), false)),
+      d_N_scratch_factory(NULL)
 {
     if (d_difference_form != ADVECTIVE && d_difference_form != CONSERVATIVE && d_difference_form != SKEW_SYMMETRIC)
     {
@@ -617,6 +627,7 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            d_scratch_arena->reset();
 
             const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
             const double* const dx = patch_geom->getDx();
@@ -628,11 +639,16 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
             const IntVector<NDIM>& patch_upper = patch_box.upper();
 
             Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(N_idx);
-            Pointer<SideData<NDIM, double> > N_upwind_data =
-                new SideData<NDIM, double>(N_data->getBox(), N_data->getDepth(), N_data->getGhostCellWidth());
+#if !defined(NDEBUG)
+            TBOX_ASSERT(N_data->getDepth() == 1);
+            TBOX_ASSERT(N_data->getGhostCellWidth() == d_N_scratch_factory->getGhostCellWidth());
+#endif
+            Pointer<SideData<NDIM, double> > N_upwind_data = d_N_scratch_factory->allocate(patch_box, d_scratch_arena);
             Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_scratch_idx);
+#if !defined(NDEBUG)
+            TBOX_ASSERT(U_data->getGhostCellWidth() == d_side_scratch_factory->getGhostCellWidth());
+#endif
 
-            const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
             boost::array<Box<NDIM>, NDIM> side_boxes;
             boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_adv_data;
             boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_half_data;
@@ -640,9 +656,9 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_upwind_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                U_adv_data[axis] = d_face_scratch_factory->allocate(side_boxes[axis], d_scratch_arena);
+                U_half_data[axis] = d_face_scratch_factory->allocate(side_boxes[axis], d_scratch_arena);
+                U_half_upwind_data[axis] = d_face_scratch_factory->allocate(side_boxes[axis], d_scratch_arena);
             }
 
 // Interpolate the staggered-grid velocity field onto the faces of
@@ -896,20 +912,20 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
             }
 
             // Compute the xsPPM7 discretization.
-            for (unsigned int axis = 0; axis < NDIM; ++axis)
-            {
-                Pointer<SideData<NDIM, double> > dU_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_L_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_R_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
-                Pointer<SideData<NDIM, double> > U_scratch1_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+            //
+            // NOTE: Each of the side-centered temporaries is only accessed one
+            // component at a time, so they are shared by all axes.
+            Pointer<SideData<NDIM, double> > dU_data = d_side_scratch_factory->allocate(patch_box, d_scratch_arena);
+            Pointer<SideData<NDIM, double> > U_L_data = d_side_scratch_factory->allocate(patch_box, d_scratch_arena);
+            Pointer<SideData<NDIM, double> > U_R_data = d_side_scratch_factory->allocate(patch_box, d_scratch_arena);
+            Pointer<SideData<NDIM, double> > U_scratch1_data =
+                d_side_scratch_factory->allocate(patch_box, d_scratch_arena);
 #if (NDIM == 3)
-                Pointer<SideData<NDIM, double> > U_scratch2_data =
-                    new SideData<NDIM, double>(U_data->getBox(), U_data->getDepth(), U_data->getGhostCellWidth());
+            Pointer<SideData<NDIM, double> > U_scratch2_data =
+                d_side_scratch_factory->allocate(patch_box, d_scratch_arena);
 #endif
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
 #if (NDIM == 2)
                 GODUNOV_EXTRAPOLATE_FC(side_boxes[axis].lower(0),
                                        side_boxes[axis].upper(0),
@@ -1214,7 +1230,7 @@ INSStaggeredStabilizedPPMConvectiveOperator::applyConvectiveOperator(const int U
             if (patch_geom->getTouchesRegularBoundary())
             {
                 Pointer<SideData<NDIM, double> > N_PPM_data =
-                    new SideData<NDIM, double>(N_data->getBox(), N_data->getDepth(), N_data->getGhostCellWidth());
+                    d_N_scratch_factory->allocate(patch_box, d_scratch_arena);
                 N_PPM_data->copy(*N_data);
                 for (unsigned int location_index = 0; location_index < 2 * NDIM; ++location_index)
                 {
@@ -1281,8 +1297,6 @@ INSStaggeredStabilizedPPMConvectiveOperator::initializeOperatorState(const SAMRA
     TBOX_ASSERT(d_hierarchy == out.getPatchHierarchy());
     TBOX_ASSERT(d_coarsest_ln == out.getCoarsestLevelNumber());
     TBOX_ASSERT(d_finest_ln == out.getFinestLevelNumber());
-#else
-    NULL_USE(out);
 #endif
 
     // Setup the interpolation transaction information.
@@ -1305,6 +1319,34 @@ INSStaggeredStabilizedPPMConvectiveOperator::initializeOperatorState(const SAMRA
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_bc_helper->cacheBcCoefData(d_bc_coefs, d_solution_time, d_hierarchy);
 
+    // Setup the patch temporaries that share the layout of the output data.
+    Pointer<PatchDataFactory<NDIM> > N_factory =
+        VariableDatabase<NDIM>::getDatabase()->getPatchDescriptor()->getPatchDataFactory(
+            out.getComponentDescriptorIndex(0));
+    d_N_scratch_factory = new SideDataFactory<NDIM, double>(1, N_factory->getGhostCellWidth(), false);
+
+    // Size the scratch arena to hold the temporaries required by the largest
+    // local patch.
+    size_t scratch_bytes = 0;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            size_t patch_bytes = (NDIM == 2 ? 4 : 5) * d_side_scratch_factory->getSizeOfMemory(patch_box) +
+                                 2 * d_N_scratch_factory->getSizeOfMemory(patch_box);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                patch_bytes +=
+                    3 * d_face_scratch_factory->getSizeOfMemory(SideGeometry<NDIM>::toSideBox(patch_box, axis));
+            }
+            scratch_bytes = std::max(scratch_bytes, patch_bytes);
+        }
+    }
+    d_scratch_arena->reserve(scratch_bytes);
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
@@ -1322,6 +1364,10 @@ INSStaggeredStabilizedPPMConvectiveOperator::deallocateOperatorState()
     d_hier_bdry_fill.setNull();
     d_bc_helper.setNull();
 
+    // Release the scratch arena.
+    d_scratch_arena->clear();
+    d_N_scratch_factory.setNull();
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
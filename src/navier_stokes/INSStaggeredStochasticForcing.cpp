@@ -75,6 +75,7 @@
 #include "ibamr/StokesSpecifications.h"
 #include "ibamr/ibamr_enums.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "ibtk/CounterBasedRNG.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/PhysicalBoundaryUtilities.h"
 #include "tbox/Array.h"
@@ -189,6 +190,8 @@ INSStaggeredStochasticForcing::INSStaggeredStochasticForcing(const std::string&
       d_std(std::numeric_limits<double>::quiet_NaN()),
       d_num_rand_vals(0),
       d_weights(),
+      d_use_counter_based_rng(false),
+      d_rng_seed(0),
       d_velocity_bc_scaling(NDIM == 2 ? 2.0 : 5.0 / 3.0),
       d_traction_bc_scaling(0.0),
       d_context(NULL),
@@ -226,6 +229,9 @@ INSStaggeredStochasticForcing::INSStaggeredStochasticForcing(const std::string&
             stream << "weights_" << k;
             key_name = stream.str();
         }
+        if (input_db->keyExists("use_counter_based_rng"))
+            d_use_counter_based_rng = input_db->getBool("use_counter_based_rng");
+        if (input_db->keyExists("rng_seed")) d_rng_seed = input_db->getInteger("rng_seed");
         if (input_db->keyExists("velocity_bc_scaling"))
             d_velocity_bc_scaling = input_db->getDouble("velocity_bc_scaling");
         if (input_db->keyExists("traction_bc_scaling"))
@@ -308,6 +314,8 @@ INSStaggeredStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
         // Generate random components.
         if (cycle_num == 0)
         {
+            const unsigned int key[2] = { static_cast<unsigned int>(d_rng_seed),
+                                          static_cast<unsigned int>(d_fluid_solver->getIntegratorStep()) };
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
@@ -317,16 +325,41 @@ INSStaggeredStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                     {
                         Pointer<Patch<NDIM> > patch = level->getPatch(p());
                         Pointer<CellData<NDIM, double> > W_cc_data = patch->getPatchData(d_W_cc_idxs[k]);
-                        genrandn(W_cc_data->getArrayData(), W_cc_data->getBox());
+                        if (d_use_counter_based_rng)
+                        {
+                            CounterBasedRNG::genrandn(
+                                W_cc_data->getArrayData(), W_cc_data->getBox(), key, level_num, k, 0);
+                        }
+                        else
+                        {
+                            genrandn(W_cc_data->getArrayData(), W_cc_data->getBox());
+                        }
 #if (NDIM == 2)
                         Pointer<NodeData<NDIM, double> > W_nc_data = patch->getPatchData(d_W_nc_idxs[k]);
-                        genrandn(W_nc_data->getArrayData(), NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox()));
+                        const Box<NDIM> node_box = NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox());
+                        if (d_use_counter_based_rng)
+                        {
+                            CounterBasedRNG::genrandn(W_nc_data->getArrayData(), node_box, key, level_num, k, 1);
+                        }
+                        else
+                        {
+                            genrandn(W_nc_data->getArrayData(), node_box);
+                        }
 #endif
 #if (NDIM == 3)
                         Pointer<EdgeData<NDIM, double> > W_ec_data = patch->getPatchData(d_W_ec_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(W_ec_data->getArrayData(d), EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d));
+                            const Box<NDIM> edge_box = EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d);
+                            if (d_use_counter_based_rng)
+                            {
+                                CounterBasedRNG::genrandn(
+                                    W_ec_data->getArrayData(d), edge_box, key, level_num, k, 1 + d);
+                            }
+                            else
+                            {
+                                genrandn(W_ec_data->getArrayData(d), edge_box);
+                            }
                         }
 #endif
                     }
@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -41,6 +42,7 @@
 #include "Box.h"
 #include "CartesianPatchGeometry.h"
 #include "FaceData.h"
+#include "FaceDataFactory.h"
 #include "FaceIndex.h"
 #include "FaceIterator.h"
 #include "IBAMR_config.h"
@@ -65,6 +67,7 @@
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/PatchScratchArena.h"
 #include "tbox/Database.h"
 #include "tbox/Pointer.h"
 #include "tbox/Timer.h"
@@ -336,7 +339,9 @@ INSStaggeredUpwindConvectiveOperator::INSStaggeredUpwindConvectiveOperator(
       d_coarsest_ln(-1),
       d_finest_ln(-1),
       d_U_var(NULL),
-      d_U_scratch_idx(-1)
+      d_U_scratch_idx(-1),
+      d_scratch_arena(new PatchScratchArena()),
+      d_face_scratch_factory(new FaceDataFactory<NDIM, double>(1, IntVector<NDIM>(1), false))
 {
     if (d_difference_form != ADVECTIVE && d_difference_form != CONSERVATIVE && d_difference_form != SKEW_SYMMETRIC)
     {
@@ -434,6 +439,7 @@ INSStaggeredUpwindConvectiveOperator::applyConvectiveOperator(const int U_idx, c
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            d_scratch_arena->reset();
 
             const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
             const double* const dx = patch_geom->getDx();
@@ -445,15 +451,14 @@ INSStaggeredUpwindConvectiveOperator::applyConvectiveOperator(const int U_idx, c
             Pointer<SideData<NDIM, double> > N_data = patch->getPatchData(N_idx);
             Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(d_U_scratch_idx);
 
-            const IntVector<NDIM> ghosts = IntVector<NDIM>(1);
             boost::array<Box<NDIM>, NDIM> side_boxes;
             boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_adv_data;
             boost::array<Pointer<FaceData<NDIM, double> >, NDIM> U_half_data;
             for (unsigned int axis = 0; axis < NDIM; ++axis)
             {
                 side_boxes[axis] = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-                U_adv_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
-                U_half_data[axis] = new FaceData<NDIM, double>(side_boxes[axis], 1, ghosts);
+                U_adv_data[axis] = d_face_scratch_factory->allocate(side_boxes[axis], d_scratch_arena);
+                U_half_data[axis] = d_face_scratch_factory->allocate(side_boxes[axis], d_scratch_arena);
             }
 #if (NDIM == 2)
             NAVIER_STOKES_INTERP_COMPS_FC(patch_lower(0),
@@ -748,6 +753,27 @@ INSStaggeredUpwindConvectiveOperator::initializeOperatorState(const SAMRAIVector
     d_bc_helper = new StaggeredStokesPhysicalBoundaryHelper();
     d_bc_helper->cacheBcCoefData(d_bc_coefs, d_solution_time, d_hierarchy);
 
+    // Size the scratch arena to hold the temporaries required by the largest
+    // local patch.
+    size_t scratch_bytes = 0;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            size_t patch_bytes = 0;
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                patch_bytes +=
+                    2 * d_face_scratch_factory->getSizeOfMemory(SideGeometry<NDIM>::toSideBox(patch_box, axis));
+            }
+            scratch_bytes = std::max(scratch_bytes, patch_bytes);
+        }
+    }
+    d_scratch_arena->reserve(scratch_bytes);
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_operator_state);
@@ -765,6 +791,9 @@ INSStaggeredUpwindConvectiveOperator::deallocateOperatorState()
     d_hier_bdry_fill.setNull();
     d_bc_helper.setNull();
 
+    // Release the scratch arena.
+    d_scratch_arena->clear();
+
     d_is_initialized = false;
 
     IBAMR_TIMER_STOP(t_deallocate_operator_state);
@@ -64,6 +64,7 @@
 #include "VariableDatabase.h"
 #include "VariableFillPattern.h"
 #include "ibamr/StaggeredStokesFACPreconditionerStrategy.h"
+#include "ibamr/StaggeredStokesOperatorUtilities.h"
 #include "ibamr/StaggeredStokesPhysicalBoundaryHelper.h"
 #include "ibamr/StaggeredStokesSolver.h"
 #include "ibamr/StaggeredStokesSolverManager.h"
@@ -171,6 +172,7 @@ StaggeredStokesFACPreconditionerStrategy::StaggeredStokesFACPreconditionerStrate
       d_U_op_stencil_fill_pattern(),
       d_P_op_stencil_fill_pattern(),
       d_U_synch_fill_pattern(),
+      d_U_P_bc_op(NULL),
       d_U_prolongation_refine_operator(),
       d_P_prolongation_refine_operator(),
       d_prolongation_refine_patch_strategy(),
@@ -586,18 +588,10 @@ StaggeredStokesFACPreconditionerStrategy::computeResidual(SAMRAIVectorReal<NDIM,
     const int U_sol_idx = solution.getComponentDescriptorIndex(0);
     const int U_rhs_idx = rhs.getComponentDescriptorIndex(0);
 
-    const Pointer<SideVariable<NDIM, double> > U_res_sc_var = residual.getComponentVariable(0);
-    const Pointer<SideVariable<NDIM, double> > U_sol_sc_var = solution.getComponentVariable(0);
-    const Pointer<SideVariable<NDIM, double> > U_rhs_sc_var = rhs.getComponentVariable(0);
-
     const int P_res_idx = residual.getComponentDescriptorIndex(1);
     const int P_sol_idx = solution.getComponentDescriptorIndex(1);
     const int P_rhs_idx = rhs.getComponentDescriptorIndex(1);
 
-    const Pointer<CellVariable<NDIM, double> > P_res_cc_var = residual.getComponentVariable(1);
-    const Pointer<CellVariable<NDIM, double> > P_sol_cc_var = solution.getComponentVariable(1);
-    const Pointer<CellVariable<NDIM, double> > P_rhs_cc_var = rhs.getComponentVariable(1);
-
     // Fill ghost-cell values.
     typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
     Pointer<VariableFillPattern<NDIM> > sc_fill_pattern = new SideNoCornersFillPattern(d_gcw, false, false, true);
@@ -656,7 +650,8 @@ StaggeredStokesFACPreconditionerStrategy::computeResidual(SAMRAIVectorReal<NDIM,
     default_U_P_components[1] = default_P_scratch_component;
     d_level_bdry_fill_ops[finest_level_num]->resetTransactionComponents(default_U_P_components);
 
-    // Compute the residual, r = f - A*u.
+    // Compute the residual, r = f - A*u, in a single pass over the solution
+    // and right-hand side data.
     if (!d_level_math_ops[finest_level_num])
     {
         std::ostringstream stream;
@@ -664,36 +659,19 @@ StaggeredStokesFACPreconditionerStrategy::computeResidual(SAMRAIVectorReal<NDIM,
         d_level_math_ops[finest_level_num] =
             new HierarchyMathOps(stream.str(), d_hierarchy, coarsest_level_num, finest_level_num);
     }
-    d_level_math_ops[finest_level_num]->grad(U_res_idx,
-                                             U_res_sc_var,
-                                             /*cf_bdry_synch*/ true,
-                                             1.0,
-                                             P_sol_idx,
-                                             P_sol_cc_var,
-                                             NULL,
-                                             d_new_time);
-    d_level_math_ops[finest_level_num]->laplace(U_res_idx,
-                                                U_res_sc_var,
-                                                d_U_problem_coefs,
-                                                U_sol_idx,
-                                                U_sol_sc_var,
-                                                NULL,
-                                                d_new_time,
-                                                1.0,
-                                                U_res_idx,
-                                                U_res_sc_var);
-    HierarchySideDataOpsReal<NDIM, double> level_sc_data_ops(d_hierarchy, coarsest_level_num, finest_level_num);
-    level_sc_data_ops.axpy(U_res_idx, -1.0, U_res_idx, U_rhs_idx, false);
-    d_level_math_ops[finest_level_num]->div(P_res_idx,
-                                            P_res_cc_var,
-                                            -1.0,
-                                            U_sol_idx,
-                                            U_sol_sc_var,
-                                            NULL,
-                                            d_new_time,
-                                            /*cf_bdry_synch*/ true);
-    HierarchyCellDataOpsReal<NDIM, double> level_cc_data_ops(d_hierarchy, coarsest_level_num, finest_level_num);
-    level_cc_data_ops.axpy(P_res_idx, -1.0, P_res_idx, P_rhs_idx, false);
+    StaggeredStokesOperatorUtilities::applyOperator(U_res_idx,
+                                                    P_res_idx,
+                                                    U_sol_idx,
+                                                    P_sol_idx,
+                                                    d_U_problem_coefs,
+                                                    -1.0,
+                                                    1.0,
+                                                    U_rhs_idx,
+                                                    P_rhs_idx,
+                                                    d_hierarchy,
+                                                    coarsest_level_num,
+                                                    finest_level_num,
+                                                    d_level_math_ops[finest_level_num]);
     return;
 } // computeResidual
 
@@ -727,11 +705,24 @@ StaggeredStokesFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVe
     d_coarsest_ln = solution.getCoarsestLevelNumber();
     d_finest_ln = solution.getFinestLevelNumber();
 
-    // Setup boundary condition handling objects.
-    d_U_bc_op = new CartSideRobinPhysBdryOp(d_side_scratch_idx, d_U_bc_coefs, false);
-    d_P_bc_op = new CartCellRobinPhysBdryOp(d_cell_scratch_idx, d_P_bc_coef, false);
-    d_U_cf_bdry_op = new CartSideDoubleQuadraticCFInterpolation();
-    d_P_cf_bdry_op = new CartCellDoubleQuadraticCFInterpolation();
+    // Setup boundary condition handling objects.  These objects are referenced
+    // by the communication schedules of levels that are not reset, so they are
+    // only recreated when all levels are reset.
+    const bool reset_all_levels = coarsest_reset_ln == d_coarsest_ln || !d_U_P_bc_op;
+    if (reset_all_levels)
+    {
+        d_U_bc_op = new CartSideRobinPhysBdryOp(d_side_scratch_idx, d_U_bc_coefs, false);
+        d_P_bc_op = new CartCellRobinPhysBdryOp(d_cell_scratch_idx, d_P_bc_coef, false);
+        d_U_cf_bdry_op = new CartSideDoubleQuadraticCFInterpolation();
+        d_P_cf_bdry_op = new CartCellDoubleQuadraticCFInterpolation();
+    }
+    else
+    {
+        d_U_bc_op->setPhysicalBcCoefs(d_U_bc_coefs);
+        d_U_bc_op->setHomogeneousBc(false);
+        d_P_bc_op->setPhysicalBcCoef(d_P_bc_coef);
+        d_P_bc_op->setHomogeneousBc(false);
+    }
     d_U_op_stencil_fill_pattern = new SideNoCornersFillPattern(d_gcw, false, false, false);
     d_P_op_stencil_fill_pattern = new CellNoCornersFillPattern(d_gcw, false, false, false);
     d_U_synch_fill_pattern = new SideSynchCopyFillPattern();
@@ -819,13 +810,16 @@ StaggeredStokesFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVe
     // Make space for saving communication schedules.  There is no need to
     // delete the old schedules first because we have deallocated the solver
     // state above.
-    std::vector<RefinePatchStrategy<NDIM>*> prolongation_refine_patch_strategies;
-    prolongation_refine_patch_strategies.push_back(d_U_cf_bdry_op);
-    prolongation_refine_patch_strategies.push_back(d_P_cf_bdry_op);
-    prolongation_refine_patch_strategies.push_back(d_U_bc_op);
-    prolongation_refine_patch_strategies.push_back(d_P_bc_op);
-    d_prolongation_refine_patch_strategy = new RefinePatchStrategySet(
-        prolongation_refine_patch_strategies.begin(), prolongation_refine_patch_strategies.end(), false);
+    if (reset_all_levels)
+    {
+        std::vector<RefinePatchStrategy<NDIM>*> prolongation_refine_patch_strategies;
+        prolongation_refine_patch_strategies.push_back(d_U_cf_bdry_op);
+        prolongation_refine_patch_strategies.push_back(d_P_cf_bdry_op);
+        prolongation_refine_patch_strategies.push_back(d_U_bc_op);
+        prolongation_refine_patch_strategies.push_back(d_P_bc_op);
+        d_prolongation_refine_patch_strategy = new RefinePatchStrategySet(
+            prolongation_refine_patch_strategies.begin(), prolongation_refine_patch_strategies.end(), false);
+    }
 
     d_prolongation_refine_schedules.resize(d_finest_ln + 1);
     d_restriction_coarsen_schedules.resize(d_finest_ln + 1);
@@ -870,12 +864,19 @@ StaggeredStokesFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVe
                                              Pointer<RefineOperator<NDIM> >(),
                                              d_U_synch_fill_pattern);
 
-    std::vector<RefinePatchStrategy<NDIM>*> bc_op_ptrs(2);
-    bc_op_ptrs[0] = d_U_bc_op;
-    bc_op_ptrs[1] = d_P_bc_op;
-    d_U_P_bc_op = new RefinePatchStrategySet(bc_op_ptrs.begin(), bc_op_ptrs.end(), false);
+    if (reset_all_levels)
+    {
+        delete d_U_P_bc_op;
+        std::vector<RefinePatchStrategy<NDIM>*> bc_op_ptrs(2);
+        bc_op_ptrs[0] = d_U_bc_op;
+        bc_op_ptrs[1] = d_P_bc_op;
+        d_U_P_bc_op = new RefinePatchStrategySet(bc_op_ptrs.begin(), bc_op_ptrs.end(), false);
+    }
 
-    for (int dst_ln = d_coarsest_ln + 1; dst_ln <= d_finest_ln; ++dst_ln)
+    // Only the schedules associated with the reset levels, and the schedules
+    // that transfer data between the coarsest reset level and the next coarser
+    // level, need to be recreated.
+    for (int dst_ln = std::max(d_coarsest_ln + 1, coarsest_reset_ln); dst_ln <= finest_reset_ln; ++dst_ln)
     {
         d_prolongation_refine_schedules[dst_ln] =
             d_prolongation_refine_algorithm->createSchedule(d_hierarchy->getPatchLevel(dst_ln),
@@ -883,20 +884,20 @@ StaggeredStokesFACPreconditionerStrategy::initializeOperatorState(const SAMRAIVe
                                                             dst_ln - 1,
                                                             d_hierarchy,
                                                             d_prolongation_refine_patch_strategy.getPointer());
-
-        d_ghostfill_nocoarse_refine_schedules[dst_ln] =
-            d_ghostfill_nocoarse_refine_algorithm->createSchedule(d_hierarchy->getPatchLevel(dst_ln), d_U_P_bc_op);
-
-        d_synch_refine_schedules[dst_ln] = d_synch_refine_algorithm->createSchedule(d_hierarchy->getPatchLevel(dst_ln));
     }
 
-    d_ghostfill_nocoarse_refine_schedules[d_coarsest_ln] =
-        d_ghostfill_nocoarse_refine_algorithm->createSchedule(d_hierarchy->getPatchLevel(d_coarsest_ln), d_U_P_bc_op);
-
-    d_synch_refine_schedules[d_coarsest_ln] =
-        d_synch_refine_algorithm->createSchedule(d_hierarchy->getPatchLevel(d_coarsest_ln));
+    for (int ln = std::max(d_coarsest_ln, coarsest_reset_ln); ln <= finest_reset_ln; ++ln)
+    {
+        d_ghostfill_nocoarse_refine_schedules[ln] =
+            d_ghostfill_nocoarse_refine_algorithm->createSchedule(d_hierarchy->getPatchLevel(ln), d_U_P_bc_op);
+        d_synch_refine_schedules[ln] = d_synch_refine_algorithm->createSchedule(d_hierarchy->getPatchLevel(ln));
+    }
 
-    for (int dst_ln = d_coarsest_ln; dst_ln < d_finest_ln; ++dst_ln)
+    // The restriction schedule from the coarsest reset level to the next
+    // coarser level must also be rebuilt.
+    for (int dst_ln = std::max(d_coarsest_ln, coarsest_reset_ln - 1);
+         dst_ln < std::min(finest_reset_ln + 1, d_finest_ln);
+         ++dst_ln)
     {
         d_restriction_coarsen_schedules[dst_ln] = d_restriction_coarsen_algorithm->createSchedule(
             d_hierarchy->getPatchLevel(dst_ln), d_hierarchy->getPatchLevel(dst_ln + 1));
@@ -975,9 +976,10 @@ StaggeredStokesFACPreconditionerStrategy::deallocateOperatorState()
 
         d_synch_refine_algorithm.setNull();
         d_synch_refine_schedules.resize(0);
-    }
 
-    delete d_U_P_bc_op;
+        delete d_U_P_bc_op;
+        d_U_P_bc_op = NULL;
+    }
 
     // Clear the "reset level" range.
     d_coarsest_reset_ln = -1;
@@ -38,7 +38,6 @@
 #include <string>
 #include <vector>
 
-#include "CellVariable.h"
 #include "IntVector.h"
 #include "LocationIndexRobinBcCoefs.h"
 #include "MultiblockDataTranslator.h"
@@ -46,9 +45,9 @@
 #include "PoissonSpecifications.h"
 #include "RobinBcCoefStrategy.h"
 #include "SAMRAIVectorReal.h"
-#include "SideVariable.h"
 #include "VariableFillPattern.h"
 #include "ibamr/StaggeredStokesOperator.h"
+#include "ibamr/StaggeredStokesOperatorUtilities.h"
 #include "ibamr/StaggeredStokesPhysicalBoundaryHelper.h"
 #include "ibamr/ibamr_utilities.h"
 #include "ibamr/namespaces.h" // IWYU pragma: keep
@@ -209,8 +208,8 @@ StaggeredStokesOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorRe
 {
     IBAMR_TIMER_START(t_apply);
 
-    // Allocate scratch data.
-    d_x->allocateVectorData();
+    // Allocate scratch data (if necessary).
+    if (!d_use_persistent_workspace) d_x->allocateVectorData();
 
     // Get the vector components.
     const int U_idx = x.getComponentDescriptorIndex(0);
@@ -219,11 +218,6 @@ StaggeredStokesOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorRe
     const int A_P_idx = y.getComponentDescriptorIndex(1);
     const int U_scratch_idx = d_x->getComponentDescriptorIndex(0);
 
-    Pointer<SideVariable<NDIM, double> > U_sc_var = x.getComponentVariable(0);
-    Pointer<CellVariable<NDIM, double> > P_cc_var = x.getComponentVariable(1);
-    Pointer<SideVariable<NDIM, double> > A_U_sc_var = y.getComponentVariable(0);
-    Pointer<CellVariable<NDIM, double> > A_P_cc_var = y.getComponentVariable(1);
-
     // Simultaneously fill ghost cell values for all components.
     typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
     std::vector<InterpolationTransactionComponent> transaction_comps(2);
@@ -255,36 +249,26 @@ StaggeredStokesOperator::apply(SAMRAIVectorReal<NDIM, double>& x, SAMRAIVectorRe
     // Compute the action of the operator:
     //
     // A*[U;P] := [A_U;A_P] = [(C*I+D*L)*U + Grad P; -Div U]
-    d_hier_math_ops->grad(A_U_idx,
-                          A_U_sc_var,
-                          /*cf_bdry_synch*/ false,
-                          1.0,
-                          P_idx,
-                          P_cc_var,
-                          d_no_fill,
-                          d_new_time);
-    d_hier_math_ops->laplace(A_U_idx,
-                             A_U_sc_var,
-                             d_U_problem_coefs,
-                             U_scratch_idx,
-                             U_sc_var,
-                             d_no_fill,
-                             d_new_time,
-                             1.0,
-                             A_U_idx,
-                             A_U_sc_var);
-    d_hier_math_ops->div(A_P_idx,
-                         A_P_cc_var,
-                         -1.0,
-                         U_scratch_idx,
-                         U_sc_var,
-                         d_no_fill,
-                         d_new_time,
-                         /*cf_bdry_synch*/ true);
+    //
+    // The momentum and continuity components are computed together in a
+    // single pass over the velocity and pressure data.
+    StaggeredStokesOperatorUtilities::applyOperator(A_U_idx,
+                                                    A_P_idx,
+                                                    U_scratch_idx,
+                                                    P_idx,
+                                                    d_U_problem_coefs,
+                                                    1.0,
+                                                    0.0,
+                                                    -1,
+                                                    -1,
+                                                    x.getPatchHierarchy(),
+                                                    x.getCoarsestLevelNumber(),
+                                                    x.getFinestLevelNumber(),
+                                                    d_hier_math_ops);
     d_bc_helper->copyDataAtDirichletBoundaries(A_U_idx, U_scratch_idx);
 
-    // Deallocate scratch data.
-    d_x->deallocateVectorData();
+    // Deallocate scratch data (if necessary).
+    if (!d_use_persistent_workspace) d_x->deallocateVectorData();
 
     IBAMR_TIMER_STOP(t_apply);
     return;
@@ -303,6 +287,9 @@ StaggeredStokesOperator::initializeOperatorState(const SAMRAIVectorReal<NDIM, do
     d_x = in.cloneVector(in.getName());
     d_b = out.cloneVector(out.getName());
 
+    // Allocate scratch data that is retained between operator applications.
+    if (d_use_persistent_workspace) d_x->allocateVectorData();
+
     // Setup the interpolation transaction information.
     d_U_fill_pattern = new SideNoCornersFillPattern(SIDEG, false, false, true);
     d_P_fill_pattern = new CellNoCornersFillPattern(CELLG, false, false, true);
@@ -372,6 +359,7 @@ StaggeredStokesOperator::deallocateOperatorState()
     // Delete the solution and rhs vectors.
     d_x->resetLevels(d_x->getCoarsestLevelNumber(),
                      std::min(d_x->getFinestLevelNumber(), d_x->getPatchHierarchy()->getFinestLevelNumber()));
+    if (d_use_persistent_workspace) d_x->deallocateVectorData();
     d_x->freeVectorComponents();
 
     d_b->resetLevels(d_b->getCoarsestLevelNumber(),
@@ -0,0 +1,375 @@
+// Filename: StaggeredStokesOperatorUtilities.cpp
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ostream>
+
+#include "Box.h"
+#include "CartesianPatchGeometry.h"
+#include "CellData.h"
+#include "IBAMR_config.h"
+#include "IntVector.h"
+#include "Patch.h"
+#include "PatchData.h"
+#include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "PoissonSpecifications.h"
+#include "SideData.h"
+#include "ibamr/StaggeredStokesOperatorUtilities.h"
+#include "ibamr/namespaces.h" // IWYU pragma: keep
+#include "ibtk/HierarchyMathOps.h"
+#include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
+#if (NDIM == 2)
+#include "NodeData.h"
+#endif
+#if (NDIM == 3)
+#include "EdgeData.h"
+#endif
+
+// FORTRAN ROUTINES
+#if (NDIM == 2)
+#define NAVIER_STOKES_STOKES_APPLY_FC IBAMR_FC_FUNC_(navier_stokes_stokes_apply2d, NAVIER_STOKES_STOKES_APPLY2D)
+#define NAVIER_STOKES_STOKES_VC_APPLY_FC IBAMR_FC_FUNC_(navier_stokes_stokes_vc_apply2d, NAVIER_STOKES_STOKES_VC_APPLY2D)
+#endif
+
+#if (NDIM == 3)
+#define NAVIER_STOKES_STOKES_APPLY_FC IBAMR_FC_FUNC_(navier_stokes_stokes_apply3d, NAVIER_STOKES_STOKES_APPLY3D)
+#define NAVIER_STOKES_STOKES_VC_APPLY_FC IBAMR_FC_FUNC_(navier_stokes_stokes_vc_apply3d, NAVIER_STOKES_STOKES_VC_APPLY3D)
+#endif
+
+extern "C" {
+void NAVIER_STOKES_STOKES_APPLY_FC(const int&,
+                                   const int&,
+                                   const int&,
+                                   const int&,
+#if (NDIM == 3)
+                                   const int&,
+                                   const int&,
+#endif
+                                   const double*,
+                                   const double&,
+                                   const double&,
+                                   const double&,
+                                   const double&,
+                                   const double*,
+                                   const double*,
+#if (NDIM == 3)
+                                   const double*,
+#endif
+                                   const int&,
+                                   const double*,
+                                   const int&,
+                                   const double*,
+                                   const double*,
+#if (NDIM == 3)
+                                   const double*,
+#endif
+                                   const int&,
+                                   const double*,
+                                   const int&,
+                                   double*,
+                                   double*,
+#if (NDIM == 3)
+                                   double*,
+#endif
+                                   const int&,
+                                   double*,
+                                   const int&);
+
+void NAVIER_STOKES_STOKES_VC_APPLY_FC(const int&,
+                                      const int&,
+                                      const int&,
+                                      const int&,
+#if (NDIM == 3)
+                                      const int&,
+                                      const int&,
+#endif
+                                      const double*,
+                                      const double&,
+                                      const double&,
+                                      const double&,
+                                      const double*,
+#if (NDIM == 3)
+                                      const double*,
+                                      const double*,
+#endif
+                                      const int&,
+                                      const double*,
+                                      const double*,
+#if (NDIM == 3)
+                                      const double*,
+#endif
+                                      const int&,
+                                      const double*,
+                                      const int&,
+                                      const double*,
+                                      const double*,
+#if (NDIM == 3)
+                                      const double*,
+#endif
+                                      const int&,
+                                      const double*,
+                                      const int&,
+                                      double*,
+                                      double*,
+#if (NDIM == 3)
+                                      double*,
+#endif
+                                      const int&,
+                                      double*,
+                                      const int&);
+}
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+StaggeredStokesOperatorUtilities::applyOperator(const int r_U_idx,
+                                                const int r_P_idx,
+                                                const int U_idx,
+                                                const int P_idx,
+                                                const PoissonSpecifications& U_problem_coefs,
+                                                const double alpha,
+                                                const double beta,
+                                                const int f_U_idx,
+                                                const int f_P_idx,
+                                                Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                const int coarsest_ln,
+                                                const int finest_ln,
+                                                Pointer<HierarchyMathOps> hier_math_ops)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(hierarchy);
+    TBOX_ASSERT(hier_math_ops);
+    TBOX_ASSERT(beta == 0.0 || (f_U_idx >= 0 && f_P_idx >= 0));
+#endif
+    // Replace the coarse values of U along the coarse-fine interface by the
+    // restriction of the fine values, as is done by HierarchyMathOps::div().
+    hier_math_ops->synchronizeCoarseFineBoundary(U_idx);
+
+    // Compute the momentum and continuity residuals on each patch.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<SideData<NDIM, double> > r_U_data = patch->getPatchData(r_U_idx);
+            Pointer<CellData<NDIM, double> > r_P_data = patch->getPatchData(r_P_idx);
+            Pointer<SideData<NDIM, double> > U_data = patch->getPatchData(U_idx);
+            Pointer<CellData<NDIM, double> > P_data = patch->getPatchData(P_idx);
+            Pointer<SideData<NDIM, double> > f_U_data =
+                (beta != 0.0) ? patch->getPatchData(f_U_idx) : Pointer<PatchData<NDIM> >();
+            Pointer<CellData<NDIM, double> > f_P_data =
+                (beta != 0.0) ? patch->getPatchData(f_P_idx) : Pointer<PatchData<NDIM> >();
+            applyPatchOperator(
+                r_U_data, r_P_data, U_data, P_data, U_problem_coefs, alpha, beta, f_U_data, f_P_data, patch);
+        }
+    }
+
+    // Replace the coarse values of r_U along the coarse-fine interface by the
+    // restriction of the fine values, as is done by
+    // HierarchyMathOps::laplace().
+    hier_math_ops->synchronizeCoarseFineBoundary(r_U_idx);
+    return;
+} // applyOperator
+
+void
+StaggeredStokesOperatorUtilities::applyPatchOperator(Pointer<SideData<NDIM, double> > r_U_data,
+                                                     Pointer<CellData<NDIM, double> > r_P_data,
+                                                     Pointer<SideData<NDIM, double> > U_data,
+                                                     Pointer<CellData<NDIM, double> > P_data,
+                                                     const PoissonSpecifications& U_problem_coefs,
+                                                     const double alpha,
+                                                     const double beta,
+                                                     Pointer<SideData<NDIM, double> > f_U_data,
+                                                     Pointer<CellData<NDIM, double> > f_P_data,
+                                                     Pointer<Patch<NDIM> > patch)
+{
+    if (!U_problem_coefs.cIsZero() && !U_problem_coefs.cIsConstant())
+    {
+        TBOX_ERROR("StaggeredStokesOperatorUtilities::applyPatchOperator():\n"
+                   << "  staggered Stokes operator requires spatially constant damping factor"
+                   << std::endl);
+    }
+    const double C = U_problem_coefs.cIsZero() ? 0.0 : U_problem_coefs.getCConstant();
+
+#if !defined(NDEBUG)
+    TBOX_ASSERT(r_U_data && r_P_data && U_data && P_data);
+    TBOX_ASSERT(beta == 0.0 || (f_U_data && f_P_data));
+    TBOX_ASSERT(U_data->getGhostCellWidth().min() >= 1);
+    TBOX_ASSERT(P_data->getGhostCellWidth().min() >= 1);
+    TBOX_ASSERT(U_data->getDepth() == 1 && P_data->getDepth() == 1);
+    TBOX_ASSERT(r_U_data->getDepth() == 1 && r_P_data->getDepth() == 1);
+    TBOX_ASSERT(r_U_data != U_data);
+#endif
+
+    // The right-hand side data are not accessed by the kernels when beta is
+    // zero, so the residual data are passed in their place.
+    Pointer<SideData<NDIM, double> > f_U = (beta != 0.0) ? f_U_data : r_U_data;
+    Pointer<CellData<NDIM, double> > f_P = (beta != 0.0) ? f_P_data : r_P_data;
+
+    const Box<NDIM>& patch_box = patch->getBox();
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+    const int U_ghosts = (U_data->getGhostCellWidth()).max();
+    const int P_ghosts = (P_data->getGhostCellWidth()).max();
+    const int f_U_ghosts = (f_U->getGhostCellWidth()).max();
+    const int f_P_ghosts = (f_P->getGhostCellWidth()).max();
+    const int r_U_ghosts = (r_U_data->getGhostCellWidth()).max();
+    const int r_P_ghosts = (r_P_data->getGhostCellWidth()).max();
+
+    if (U_problem_coefs.dIsConstant())
+    {
+        const double D = U_problem_coefs.getDConstant();
+        NAVIER_STOKES_STOKES_APPLY_FC(patch_box.lower(0),
+                                      patch_box.upper(0),
+                                      patch_box.lower(1),
+                                      patch_box.upper(1),
+#if (NDIM == 3)
+                                      patch_box.lower(2),
+                                      patch_box.upper(2),
+#endif
+                                      dx,
+                                      C,
+                                      D,
+                                      alpha,
+                                      beta,
+                                      U_data->getPointer(0),
+                                      U_data->getPointer(1),
+#if (NDIM == 3)
+                                      U_data->getPointer(2),
+#endif
+                                      U_ghosts,
+                                      P_data->getPointer(),
+                                      P_ghosts,
+                                      f_U->getPointer(0),
+                                      f_U->getPointer(1),
+#if (NDIM == 3)
+                                      f_U->getPointer(2),
+#endif
+                                      f_U_ghosts,
+                                      f_P->getPointer(),
+                                      f_P_ghosts,
+                                      r_U_data->getPointer(0),
+                                      r_U_data->getPointer(1),
+#if (NDIM == 3)
+                                      r_U_data->getPointer(2),
+#endif
+                                      r_U_ghosts,
+                                      r_P_data->getPointer(),
+                                      r_P_ghosts);
+        return;
+    }
+
+#if (NDIM == 2)
+    Pointer<NodeData<NDIM, double> > D_data = patch->getPatchData(U_problem_coefs.getDPatchDataId());
+#endif
+#if (NDIM == 3)
+    Pointer<EdgeData<NDIM, double> > D_data = patch->getPatchData(U_problem_coefs.getDPatchDataId());
+#endif
+    if (!D_data)
+    {
+        TBOX_ERROR("StaggeredStokesOperatorUtilities::applyPatchOperator():\n"
+                   << "  spatially varying viscosity must be node-centered for NDIM == 2 and edge-centered for "
+                      "NDIM == 3"
+                   << std::endl);
+    }
+#if !defined(NDEBUG)
+    TBOX_ASSERT(D_data->getGhostCellWidth().min() >= 1);
+    TBOX_ASSERT(D_data->getDepth() == 1);
+#endif
+    const int D_ghosts = (D_data->getGhostCellWidth()).max();
+    NAVIER_STOKES_STOKES_VC_APPLY_FC(patch_box.lower(0),
+                                     patch_box.upper(0),
+                                     patch_box.lower(1),
+                                     patch_box.upper(1),
+#if (NDIM == 3)
+                                     patch_box.lower(2),
+                                     patch_box.upper(2),
+#endif
+                                     dx,
+                                     C,
+                                     alpha,
+                                     beta,
+#if (NDIM == 2)
+                                     D_data->getPointer(),
+#endif
+#if (NDIM == 3)
+                                     D_data->getPointer(0),
+                                     D_data->getPointer(1),
+                                     D_data->getPointer(2),
+#endif
+                                     D_ghosts,
+                                     U_data->getPointer(0),
+                                     U_data->getPointer(1),
+#if (NDIM == 3)
+                                     U_data->getPointer(2),
+#endif
+                                     U_ghosts,
+                                     P_data->getPointer(),
+                                     P_ghosts,
+                                     f_U->getPointer(0),
+                                     f_U->getPointer(1),
+#if (NDIM == 3)
+                                     f_U->getPointer(2),
+#endif
+                                     f_U_ghosts,
+                                     f_P->getPointer(),
+                                     f_P_ghosts,
+                                     r_U_data->getPointer(0),
+                                     r_U_data->getPointer(1),
+#if (NDIM == 3)
+                                     r_U_data->getPointer(2),
+#endif
+                                     r_U_ghosts,
+                                     r_P_data->getPointer(),
+                                     r_P_ghosts);
+    return;
+} // applyPatchOperator
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
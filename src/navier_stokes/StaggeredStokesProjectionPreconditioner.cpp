@@ -33,6 +33,7 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include <stddef.h>
+#include <algorithm>
 #include <ostream>
 #include <string>
 
@@ -100,7 +101,7 @@ static Timer* t_deallocate_solver_state;
 
 StaggeredStokesProjectionPreconditioner::StaggeredStokesProjectionPreconditioner(
     const std::string& object_name,
-    Pointer<Database> /*input_db*/,
+    Pointer<Database> input_db,
     const std::string& /*default_options_prefix*/)
     : StaggeredStokesBlockPreconditioner(/*needs_velocity_solver*/ true,
                                          /*needs_pressure_solver*/ true),
@@ -109,7 +110,8 @@ StaggeredStokesProjectionPreconditioner::StaggeredStokesProjectionPreconditioner
       d_Phi_var(NULL),
       d_F_Phi_var(NULL),
       d_Phi_scratch_idx(-1),
-      d_F_Phi_idx(-1)
+      d_F_Phi_idx(-1),
+      d_use_persistent_workspace(true)
 {
     GeneralSolver::init(object_name, /*homogeneous_bc*/ true);
 
@@ -118,6 +120,11 @@ StaggeredStokesProjectionPreconditioner::StaggeredStokesProjectionPreconditioner
     d_initial_guess_nonzero = false;
     d_max_iterations = 1;
 
+    if (input_db && input_db->keyExists("use_persistent_workspace"))
+    {
+        d_use_persistent_workspace = input_db->getBool("use_persistent_workspace");
+    }
+
     // Setup variables.
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     Pointer<VariableContext> context = var_db->getContext(d_object_name + "::CONTEXT");
@@ -223,12 +230,15 @@ StaggeredStokesProjectionPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, doub
     P_vec = new SAMRAIVectorReal<NDIM, double>(d_object_name + "::P", d_hierarchy, d_coarsest_ln, d_finest_ln);
     P_vec->addComponent(P_cc_var, P_idx, d_pressure_wgt_idx, d_pressure_data_ops);
 
-    // Allocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    // Allocate scratch data (if necessary).
+    if (!d_use_persistent_workspace)
     {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->allocatePatchData(d_Phi_scratch_idx);
-        level->allocatePatchData(d_F_Phi_idx);
+        for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(d_Phi_scratch_idx);
+            level->allocatePatchData(d_F_Phi_idx);
+        }
     }
 
     // (1) Solve the velocity sub-problem for an initial approximation to U.
@@ -334,12 +344,15 @@ StaggeredStokesProjectionPreconditioner::solveSystem(SAMRAIVectorReal<NDIM, doub
     // Account for nullspace vectors.
     correctNullspace(U_vec, P_vec);
 
-    // Deallocate scratch data.
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    // Deallocate scratch data (if necessary).
+    if (!d_use_persistent_workspace)
     {
-        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        level->deallocatePatchData(d_Phi_scratch_idx);
-        level->deallocatePatchData(d_F_Phi_idx);
+        for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            level->deallocatePatchData(d_Phi_scratch_idx);
+            level->deallocatePatchData(d_F_Phi_idx);
+        }
     }
 
     // Deallocate the solver (if necessary).
@@ -375,6 +388,17 @@ StaggeredStokesProjectionPreconditioner::initializeSolverState(const SAMRAIVecto
     d_Phi_bdry_fill_op->setHomogeneousBc(true);
     d_Phi_bdry_fill_op->initializeOperatorState(P_scratch_component, d_hierarchy);
 
+    // Allocate scratch data that is retained between solves.
+    if (d_use_persistent_workspace)
+    {
+        for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(d_Phi_scratch_idx);
+            level->allocatePatchData(d_F_Phi_idx);
+        }
+    }
+
     d_is_initialized = true;
 
     IBAMR_TIMER_STOP(t_initialize_solver_state);
@@ -388,6 +412,19 @@ StaggeredStokesProjectionPreconditioner::deallocateSolverState()
 
     IBAMR_TIMER_START(t_deallocate_solver_state);
 
+    // Deallocate scratch data that is retained between solves.  Levels that
+    // have been removed from the hierarchy since initialization are skipped.
+    if (d_use_persistent_workspace)
+    {
+        const int finest_ln = std::min(d_finest_ln, d_hierarchy->getFinestLevelNumber());
+        for (int ln = d_coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+            if (level->checkAllocated(d_Phi_scratch_idx)) level->deallocatePatchData(d_Phi_scratch_idx);
+            if (level->checkAllocated(d_F_Phi_idx)) level->deallocatePatchData(d_F_Phi_idx);
+        }
+    }
+
     // Parent class deallocation.
     StaggeredStokesBlockPreconditioner::deallocateSolverState();
 
@@ -115,7 +115,12 @@ allocate_petsc_krylov_solver(const std::string& object_name,
 {
     Pointer<PETScKrylovStaggeredStokesSolver> krylov_solver =
         new PETScKrylovStaggeredStokesSolver(object_name, input_db, default_options_prefix);
-    krylov_solver->setOperator(new StaggeredStokesOperator(object_name + "::StokesOperator"));
+    Pointer<StaggeredStokesOperator> stokes_op = new StaggeredStokesOperator(object_name + "::StokesOperator");
+    if (input_db && input_db->keyExists("use_persistent_workspace"))
+    {
+        stokes_op->setUsePersistentWorkspace(input_db->getBool("use_persistent_workspace"));
+    }
+    krylov_solver->setOperator(stokes_op);
     return krylov_solver;
 } // allocate_petsc_krylov_solver
 }
@@ -518,4 +518,237 @@ c
       end
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Compute the action of the staggered-grid Stokes operator with
+c     constant coefficients in a single sweep over the patch,
+c
+c       (r0,r1) = alpha*((C*I+D*L)*(u0,u1) + grad p) + beta*(f0,f1)
+c       s       = alpha*(-div (u0,u1)) + beta*g
+c
+c     in which (u0,u1), (f0,f1), and (r0,r1) are side-centered and p, g,
+c     and s are cell-centered.  The right-hand side data (f0,f1) and g
+c     are not accessed when beta is zero.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine navier_stokes_stokes_apply2d(
+     &     ifirst0,ilast0,
+     &     ifirst1,ilast1,
+     &     dx,
+     &     C,D,alpha,beta,
+     &     u0,u1,u_gcw,
+     &     p,p_gcw,
+     &     f0,f1,f_gcw,
+     &     g,g_gcw,
+     &     r0,r1,r_gcw,
+     &     s,s_gcw)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ifirst0,ilast0
+      INTEGER ifirst1,ilast1
+
+      INTEGER u_gcw,p_gcw,f_gcw,g_gcw,r_gcw,s_gcw
+
+      REAL dx(0:NDIM-1)
+      REAL C,D,alpha,beta
+
+      REAL u0(SIDE2d0(ifirst,ilast,u_gcw))
+      REAL u1(SIDE2d1(ifirst,ilast,u_gcw))
+      REAL p(CELL2d(ifirst,ilast,p_gcw))
+      REAL f0(SIDE2d0(ifirst,ilast,f_gcw))
+      REAL f1(SIDE2d1(ifirst,ilast,f_gcw))
+      REAL g(CELL2d(ifirst,ilast,g_gcw))
+c
+c     Input/Output.
+c
+      REAL r0(SIDE2d0(ifirst,ilast,r_gcw))
+      REAL r1(SIDE2d1(ifirst,ilast,r_gcw))
+      REAL s(CELL2d(ifirst,ilast,s_gcw))
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    fac0,fac1,lap0,lap1
+c
+c     Compute the momentum and continuity residuals one row of cells at
+c     a time, so that each row of the velocity and pressure data is
+c     brought into cache only once.
+c
+      fac0 = 1.d0/dx(0)
+      fac1 = 1.d0/dx(1)
+      lap0 = D/(dx(0)*dx(0))
+      lap1 = D/(dx(1)*dx(1))
+
+      do i1 = ifirst1,ilast1+1
+         if (i1 .le. ilast1) then
+            do i0 = ifirst0,ilast0+1
+               r0(i0,i1) = alpha*(
+     &              C*u0(i0,i1) +
+     &              lap0*(u0(i0+1,i1)-2.d0*u0(i0,i1)+u0(i0-1,i1)) +
+     &              lap1*(u0(i0,i1+1)-2.d0*u0(i0,i1)+u0(i0,i1-1)) +
+     &              fac0*(p(i0,i1)-p(i0-1,i1)))
+            enddo
+            do i0 = ifirst0,ilast0
+               s(i0,i1) = -alpha*(
+     &              fac0*(u0(i0+1,i1)-u0(i0,i1)) +
+     &              fac1*(u1(i0,i1+1)-u1(i0,i1)))
+            enddo
+            if (beta .ne. 0.d0) then
+               do i0 = ifirst0,ilast0+1
+                  r0(i0,i1) = r0(i0,i1) + beta*f0(i0,i1)
+               enddo
+               do i0 = ifirst0,ilast0
+                  s(i0,i1) = s(i0,i1) + beta*g(i0,i1)
+               enddo
+            endif
+         endif
+         do i0 = ifirst0,ilast0
+            r1(i0,i1) = alpha*(
+     &           C*u1(i0,i1) +
+     &           lap0*(u1(i0+1,i1)-2.d0*u1(i0,i1)+u1(i0-1,i1)) +
+     &           lap1*(u1(i0,i1+1)-2.d0*u1(i0,i1)+u1(i0,i1-1)) +
+     &           fac1*(p(i0,i1)-p(i0,i1-1)))
+         enddo
+         if (beta .ne. 0.d0) then
+            do i0 = ifirst0,ilast0
+               r1(i0,i1) = r1(i0,i1) + beta*f1(i0,i1)
+            enddo
+         endif
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Compute the action of the staggered-grid Stokes operator with
+c     variable viscosity in a single sweep over the patch,
+c
+c       (r0,r1) = alpha*(C*(u0,u1) + div mu (grad (u0,u1) +
+c                 grad (u0,u1)^T) + grad p) + beta*(f0,f1)
+c       s       = alpha*(-div (u0,u1)) + beta*g
+c
+c     in which the viscosity mu is node-centered.  The discretization
+c     of the viscous term is the same as that of stosvclaplace2d.  The
+c     right-hand side data (f0,f1) and g are not accessed when beta is
+c     zero.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine navier_stokes_stokes_vc_apply2d(
+     &     ifirst0,ilast0,
+     &     ifirst1,ilast1,
+     &     dx,
+     &     C,alpha,beta,
+     &     mu,mu_gcw,
+     &     u0,u1,u_gcw,
+     &     p,p_gcw,
+     &     f0,f1,f_gcw,
+     &     g,g_gcw,
+     &     r0,r1,r_gcw,
+     &     s,s_gcw)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ifirst0,ilast0
+      INTEGER ifirst1,ilast1
+
+      INTEGER mu_gcw,u_gcw,p_gcw,f_gcw,g_gcw,r_gcw,s_gcw
+
+      REAL dx(0:NDIM-1)
+      REAL C,alpha,beta
+
+      REAL mu(NODE2d(ifirst,ilast,mu_gcw))
+      REAL u0(SIDE2d0(ifirst,ilast,u_gcw))
+      REAL u1(SIDE2d1(ifirst,ilast,u_gcw))
+      REAL p(CELL2d(ifirst,ilast,p_gcw))
+      REAL f0(SIDE2d0(ifirst,ilast,f_gcw))
+      REAL f1(SIDE2d1(ifirst,ilast,f_gcw))
+      REAL g(CELL2d(ifirst,ilast,g_gcw))
+c
+c     Input/Output.
+c
+      REAL r0(SIDE2d0(ifirst,ilast,r_gcw))
+      REAL r1(SIDE2d1(ifirst,ilast,r_gcw))
+      REAL s(CELL2d(ifirst,ilast,s_gcw))
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    fac0,fac1
+      REAL    mu_c,mu_l
+c
+c     Compute the momentum and continuity residuals one row of cells at
+c     a time.  Cell-centered viscosities are obtained by averaging the
+c     nodal values.
+c
+      fac0 = 1.d0/dx(0)
+      fac1 = 1.d0/dx(1)
+
+      do i1 = ifirst1,ilast1+1
+         if (i1 .le. ilast1) then
+            do i0 = ifirst0,ilast0+1
+               mu_c = 0.25d0*(mu(i0,i1)+mu(i0+1,i1)+
+     &              mu(i0,i1+1)+mu(i0+1,i1+1))
+               mu_l = 0.25d0*(mu(i0-1,i1)+mu(i0,i1)+
+     &              mu(i0-1,i1+1)+mu(i0,i1+1))
+               r0(i0,i1) = alpha*(
+     &              C*u0(i0,i1) +
+     &              2.d0*fac0*fac0*(
+     &              mu_c*(u0(i0+1,i1)-u0(i0,i1)) -
+     &              mu_l*(u0(i0,i1)-u0(i0-1,i1))) +
+     &              fac1*(
+     &              mu(i0,i1+1)*(fac1*(u0(i0,i1+1)-u0(i0,i1)) +
+     &              fac0*(u1(i0,i1+1)-u1(i0-1,i1+1))) -
+     &              mu(i0,i1)*(fac1*(u0(i0,i1)-u0(i0,i1-1)) +
+     &              fac0*(u1(i0,i1)-u1(i0-1,i1)))) +
+     &              fac0*(p(i0,i1)-p(i0-1,i1)))
+            enddo
+            do i0 = ifirst0,ilast0
+               s(i0,i1) = -alpha*(
+     &              fac0*(u0(i0+1,i1)-u0(i0,i1)) +
+     &              fac1*(u1(i0,i1+1)-u1(i0,i1)))
+            enddo
+            if (beta .ne. 0.d0) then
+               do i0 = ifirst0,ilast0+1
+                  r0(i0,i1) = r0(i0,i1) + beta*f0(i0,i1)
+               enddo
+               do i0 = ifirst0,ilast0
+                  s(i0,i1) = s(i0,i1) + beta*g(i0,i1)
+               enddo
+            endif
+         endif
+         do i0 = ifirst0,ilast0
+            mu_c = 0.25d0*(mu(i0,i1)+mu(i0+1,i1)+
+     &           mu(i0,i1+1)+mu(i0+1,i1+1))
+            mu_l = 0.25d0*(mu(i0,i1-1)+mu(i0+1,i1-1)+
+     &           mu(i0,i1)+mu(i0+1,i1))
+            r1(i0,i1) = alpha*(
+     &           C*u1(i0,i1) +
+     &           2.d0*fac1*fac1*(
+     &           mu_c*(u1(i0,i1+1)-u1(i0,i1)) -
+     &           mu_l*(u1(i0,i1)-u1(i0,i1-1))) +
+     &           fac0*(
+     &           mu(i0+1,i1)*(fac0*(u1(i0+1,i1)-u1(i0,i1)) +
+     &           fac1*(u0(i0+1,i1)-u0(i0+1,i1-1))) -
+     &           mu(i0,i1)*(fac0*(u1(i0,i1)-u1(i0-1,i1)) +
+     &           fac1*(u0(i0,i1)-u0(i0,i1-1)))) +
+     &           fac1*(p(i0,i1)-p(i0,i1-1)))
+         enddo
+         if (beta .ne. 0.d0) then
+            do i0 = ifirst0,ilast0
+               r1(i0,i1) = r1(i0,i1) + beta*f1(i0,i1)
+            enddo
+         endif
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 
@@ -724,3 +724,368 @@ c
       end
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Compute the action of the staggered-grid Stokes operator with
+c     constant coefficients in a single sweep over the patch,
+c
+c       (r0,r1,r2) = alpha*((C*I+D*L)*(u0,u1,u2) + grad p) + beta*(f0,f1,f2)
+c       s          = alpha*(-div (u0,u1,u2)) + beta*g
+c
+c     in which (u0,u1,u2), (f0,f1,f2), and (r0,r1,r2) are side-centered
+c     and p, g, and s are cell-centered.  The right-hand side data
+c     (f0,f1,f2) and g are not accessed when beta is zero.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine navier_stokes_stokes_apply3d(
+     &     ifirst0,ilast0,
+     &     ifirst1,ilast1,
+     &     ifirst2,ilast2,
+     &     dx,
+     &     C,D,alpha,beta,
+     &     u0,u1,u2,u_gcw,
+     &     p,p_gcw,
+     &     f0,f1,f2,f_gcw,
+     &     g,g_gcw,
+     &     r0,r1,r2,r_gcw,
+     &     s,s_gcw)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ifirst0,ilast0
+      INTEGER ifirst1,ilast1
+      INTEGER ifirst2,ilast2
+
+      INTEGER u_gcw,p_gcw,f_gcw,g_gcw,r_gcw,s_gcw
+
+      REAL dx(0:NDIM-1)
+      REAL C,D,alpha,beta
+
+      REAL u0(SIDE3d0(ifirst,ilast,u_gcw))
+      REAL u1(SIDE3d1(ifirst,ilast,u_gcw))
+      REAL u2(SIDE3d2(ifirst,ilast,u_gcw))
+      REAL p(CELL3d(ifirst,ilast,p_gcw))
+      REAL f0(SIDE3d0(ifirst,ilast,f_gcw))
+      REAL f1(SIDE3d1(ifirst,ilast,f_gcw))
+      REAL f2(SIDE3d2(ifirst,ilast,f_gcw))
+      REAL g(CELL3d(ifirst,ilast,g_gcw))
+c
+c     Input/Output.
+c
+      REAL r0(SIDE3d0(ifirst,ilast,r_gcw))
+      REAL r1(SIDE3d1(ifirst,ilast,r_gcw))
+      REAL r2(SIDE3d2(ifirst,ilast,r_gcw))
+      REAL s(CELL3d(ifirst,ilast,s_gcw))
+c
+c     Local variables.
+c
+      INTEGER i0,i1,i2
+      REAL    fac0,fac1,fac2,lap0,lap1,lap2
+c
+c     Compute the momentum and continuity residuals one row of cells at
+c     a time, so that each row of the velocity and pressure data is
+c     brought into cache only once.
+c
+      fac0 = 1.d0/dx(0)
+      fac1 = 1.d0/dx(1)
+      fac2 = 1.d0/dx(2)
+      lap0 = D/(dx(0)*dx(0))
+      lap1 = D/(dx(1)*dx(1))
+      lap2 = D/(dx(2)*dx(2))
+
+      do i2 = ifirst2,ilast2+1
+         do i1 = ifirst1,ilast1+1
+            if ((i1 .le. ilast1) .and. (i2 .le. ilast2)) then
+               do i0 = ifirst0,ilast0+1
+                  r0(i0,i1,i2) = alpha*(
+     &                 C*u0(i0,i1,i2) +
+     &                 lap0*(u0(i0+1,i1,i2)-2.d0*u0(i0,i1,i2)+
+     &                 u0(i0-1,i1,i2)) +
+     &                 lap1*(u0(i0,i1+1,i2)-2.d0*u0(i0,i1,i2)+
+     &                 u0(i0,i1-1,i2)) +
+     &                 lap2*(u0(i0,i1,i2+1)-2.d0*u0(i0,i1,i2)+
+     &                 u0(i0,i1,i2-1)) +
+     &                 fac0*(p(i0,i1,i2)-p(i0-1,i1,i2)))
+               enddo
+               do i0 = ifirst0,ilast0
+                  s(i0,i1,i2) = -alpha*(
+     &                 fac0*(u0(i0+1,i1,i2)-u0(i0,i1,i2)) +
+     &                 fac1*(u1(i0,i1+1,i2)-u1(i0,i1,i2)) +
+     &                 fac2*(u2(i0,i1,i2+1)-u2(i0,i1,i2)))
+               enddo
+               if (beta .ne. 0.d0) then
+                  do i0 = ifirst0,ilast0+1
+                     r0(i0,i1,i2) = r0(i0,i1,i2) + beta*f0(i0,i1,i2)
+                  enddo
+                  do i0 = ifirst0,ilast0
+                     s(i0,i1,i2) = s(i0,i1,i2) + beta*g(i0,i1,i2)
+                  enddo
+               endif
+            endif
+            if (i2 .le. ilast2) then
+               do i0 = ifirst0,ilast0
+                  r1(i0,i1,i2) = alpha*(
+     &                 C*u1(i0,i1,i2) +
+     &                 lap0*(u1(i0+1,i1,i2)-2.d0*u1(i0,i1,i2)+
+     &                 u1(i0-1,i1,i2)) +
+     &                 lap1*(u1(i0,i1+1,i2)-2.d0*u1(i0,i1,i2)+
+     &                 u1(i0,i1-1,i2)) +
+     &                 lap2*(u1(i0,i1,i2+1)-2.d0*u1(i0,i1,i2)+
+     &                 u1(i0,i1,i2-1)) +
+     &                 fac1*(p(i0,i1,i2)-p(i0,i1-1,i2)))
+               enddo
+               if (beta .ne. 0.d0) then
+                  do i0 = ifirst0,ilast0
+                     r1(i0,i1,i2) = r1(i0,i1,i2) + beta*f1(i0,i1,i2)
+                  enddo
+               endif
+            endif
+            if (i1 .le. ilast1) then
+               do i0 = ifirst0,ilast0
+                  r2(i0,i1,i2) = alpha*(
+     &                 C*u2(i0,i1,i2) +
+     &                 lap0*(u2(i0+1,i1,i2)-2.d0*u2(i0,i1,i2)+
+     &                 u2(i0-1,i1,i2)) +
+     &                 lap1*(u2(i0,i1+1,i2)-2.d0*u2(i0,i1,i2)+
+     &                 u2(i0,i1-1,i2)) +
+     &                 lap2*(u2(i0,i1,i2+1)-2.d0*u2(i0,i1,i2)+
+     &                 u2(i0,i1,i2-1)) +
+     &                 fac2*(p(i0,i1,i2)-p(i0,i1,i2-1)))
+               enddo
+               if (beta .ne. 0.d0) then
+                  do i0 = ifirst0,ilast0
+                     r2(i0,i1,i2) = r2(i0,i1,i2) + beta*f2(i0,i1,i2)
+                  enddo
+               endif
+            endif
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Compute the action of the staggered-grid Stokes operator with
+c     variable viscosity in a single sweep over the patch,
+c
+c       (r0,r1,r2) = alpha*(C*(u0,u1,u2) + div mu (grad (u0,u1,u2) +
+c                    grad (u0,u1,u2)^T) + grad p) + beta*(f0,f1,f2)
+c       s          = alpha*(-div (u0,u1,u2)) + beta*g
+c
+c     in which the viscosity (mu0,mu1,mu2) is edge-centered.  The
+c     cell-centered viscosity that multiplies the normal components of
+c     the strain is obtained by averaging the twelve edges of each cell.
+c     The right-hand side data (f0,f1,f2) and g are not accessed when
+c     beta is zero.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine navier_stokes_stokes_vc_apply3d(
+     &     ifirst0,ilast0,
+     &     ifirst1,ilast1,
+     &     ifirst2,ilast2,
+     &     dx,
+     &     C,alpha,beta,
+     &     mu0,mu1,mu2,mu_gcw,
+     &     u0,u1,u2,u_gcw,
+     &     p,p_gcw,
+     &     f0,f1,f2,f_gcw,
+     &     g,g_gcw,
+     &     r0,r1,r2,r_gcw,
+     &     s,s_gcw)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ifirst0,ilast0
+      INTEGER ifirst1,ilast1
+      INTEGER ifirst2,ilast2
+
+      INTEGER mu_gcw,u_gcw,p_gcw,f_gcw,g_gcw,r_gcw,s_gcw
+
+      REAL dx(0:NDIM-1)
+      REAL C,alpha,beta
+
+      REAL mu0(EDGE3d0(ifirst,ilast,mu_gcw))
+      REAL mu1(EDGE3d1(ifirst,ilast,mu_gcw))
+      REAL mu2(EDGE3d2(ifirst,ilast,mu_gcw))
+      REAL u0(SIDE3d0(ifirst,ilast,u_gcw))
+      REAL u1(SIDE3d1(ifirst,ilast,u_gcw))
+      REAL u2(SIDE3d2(ifirst,ilast,u_gcw))
+      REAL p(CELL3d(ifirst,ilast,p_gcw))
+      REAL f0(SIDE3d0(ifirst,ilast,f_gcw))
+      REAL f1(SIDE3d1(ifirst,ilast,f_gcw))
+      REAL f2(SIDE3d2(ifirst,ilast,f_gcw))
+      REAL g(CELL3d(ifirst,ilast,g_gcw))
+c
+c     Input/Output.
+c
+      REAL r0(SIDE3d0(ifirst,ilast,r_gcw))
+      REAL r1(SIDE3d1(ifirst,ilast,r_gcw))
+      REAL r2(SIDE3d2(ifirst,ilast,r_gcw))
+      REAL s(CELL3d(ifirst,ilast,s_gcw))
+c
+c     Local variables.
+c
+      INTEGER i0,i1,i2
+      REAL    fac0,fac1,fac2
+      REAL    mu_c,mu_l
+c
+c     Compute the momentum and continuity residuals one row of cells at
+c     a time.
+c
+      fac0 = 1.d0/dx(0)
+      fac1 = 1.d0/dx(1)
+      fac2 = 1.d0/dx(2)
+
+      do i2 = ifirst2,ilast2+1
+         do i1 = ifirst1,ilast1+1
+            if ((i1 .le. ilast1) .and. (i2 .le. ilast2)) then
+               do i0 = ifirst0,ilast0+1
+                  mu_c = (
+     &                 mu0(i0,i1,i2)+mu0(i0,i1+1,i2)+
+     &                 mu0(i0,i1,i2+1)+mu0(i0,i1+1,i2+1)+
+     &                 mu1(i0,i1,i2)+mu1(i0+1,i1,i2)+
+     &                 mu1(i0,i1,i2+1)+mu1(i0+1,i1,i2+1)+
+     &                 mu2(i0,i1,i2)+mu2(i0+1,i1,i2)+
+     &                 mu2(i0,i1+1,i2)+mu2(i0+1,i1+1,i2))/12.d0
+                  mu_l = (
+     &                 mu0(i0-1,i1,i2)+mu0(i0-1,i1+1,i2)+
+     &                 mu0(i0-1,i1,i2+1)+mu0(i0-1,i1+1,i2+1)+
+     &                 mu1(i0-1,i1,i2)+mu1(i0,i1,i2)+
+     &                 mu1(i0-1,i1,i2+1)+mu1(i0,i1,i2+1)+
+     &                 mu2(i0-1,i1,i2)+mu2(i0,i1,i2)+
+     &                 mu2(i0-1,i1+1,i2)+mu2(i0,i1+1,i2))/12.d0
+                  r0(i0,i1,i2) = alpha*(
+     &                 C*u0(i0,i1,i2) +
+     &                 2.d0*fac0*fac0*(
+     &                 mu_c*(u0(i0+1,i1,i2)-u0(i0,i1,i2)) -
+     &                 mu_l*(u0(i0,i1,i2)-u0(i0-1,i1,i2))) +
+     &                 fac1*(
+     &                 mu2(i0,i1+1,i2)*(
+     &                 fac1*(u0(i0,i1+1,i2)-u0(i0,i1,i2)) +
+     &                 fac0*(u1(i0,i1+1,i2)-u1(i0-1,i1+1,i2))) -
+     &                 mu2(i0,i1,i2)*(
+     &                 fac1*(u0(i0,i1,i2)-u0(i0,i1-1,i2)) +
+     &                 fac0*(u1(i0,i1,i2)-u1(i0-1,i1,i2)))) +
+     &                 fac2*(
+     &                 mu1(i0,i1,i2+1)*(
+     &                 fac2*(u0(i0,i1,i2+1)-u0(i0,i1,i2)) +
+     &                 fac0*(u2(i0,i1,i2+1)-u2(i0-1,i1,i2+1))) -
+     &                 mu1(i0,i1,i2)*(
+     &                 fac2*(u0(i0,i1,i2)-u0(i0,i1,i2-1)) +
+     &                 fac0*(u2(i0,i1,i2)-u2(i0-1,i1,i2)))) +
+     &                 fac0*(p(i0,i1,i2)-p(i0-1,i1,i2)))
+               enddo
+               do i0 = ifirst0,ilast0
+                  s(i0,i1,i2) = -alpha*(
+     &                 fac0*(u0(i0+1,i1,i2)-u0(i0,i1,i2)) +
+     &                 fac1*(u1(i0,i1+1,i2)-u1(i0,i1,i2)) +
+     &                 fac2*(u2(i0,i1,i2+1)-u2(i0,i1,i2)))
+               enddo
+               if (beta .ne. 0.d0) then
+                  do i0 = ifirst0,ilast0+1
+                     r0(i0,i1,i2) = r0(i0,i1,i2) + beta*f0(i0,i1,i2)
+                  enddo
+                  do i0 = ifirst0,ilast0
+                     s(i0,i1,i2) = s(i0,i1,i2) + beta*g(i0,i1,i2)
+                  enddo
+               endif
+            endif
+            if (i2 .le. ilast2) then
+               do i0 = ifirst0,ilast0
+                  mu_c = (
+     &                 mu0(i0,i1,i2)+mu0(i0,i1+1,i2)+
+     &                 mu0(i0,i1,i2+1)+mu0(i0,i1+1,i2+1)+
+     &                 mu1(i0,i1,i2)+mu1(i0+1,i1,i2)+
+     &                 mu1(i0,i1,i2+1)+mu1(i0+1,i1,i2+1)+
+     &                 mu2(i0,i1,i2)+mu2(i0+1,i1,i2)+
+     &                 mu2(i0,i1+1,i2)+mu2(i0+1,i1+1,i2))/12.d0
+                  mu_l = (
+     &                 mu0(i0,i1-1,i2)+mu0(i0,i1,i2)+
+     &                 mu0(i0,i1-1,i2+1)+mu0(i0,i1,i2+1)+
+     &                 mu1(i0,i1-1,i2)+mu1(i0+1,i1-1,i2)+
+     &                 mu1(i0,i1-1,i2+1)+mu1(i0+1,i1-1,i2+1)+
+     &                 mu2(i0,i1-1,i2)+mu2(i0+1,i1-1,i2)+
+     &                 mu2(i0,i1,i2)+mu2(i0+1,i1,i2))/12.d0
+                  r1(i0,i1,i2) = alpha*(
+     &                 C*u1(i0,i1,i2) +
+     &                 2.d0*fac1*fac1*(
+     &                 mu_c*(u1(i0,i1+1,i2)-u1(i0,i1,i2)) -
+     &                 mu_l*(u1(i0,i1,i2)-u1(i0,i1-1,i2))) +
+     &                 fac0*(
+     &                 mu2(i0+1,i1,i2)*(
+     &                 fac0*(u1(i0+1,i1,i2)-u1(i0,i1,i2)) +
+     &                 fac1*(u0(i0+1,i1,i2)-u0(i0+1,i1-1,i2))) -
+     &                 mu2(i0,i1,i2)*(
+     &                 fac0*(u1(i0,i1,i2)-u1(i0-1,i1,i2)) +
+     &                 fac1*(u0(i0,i1,i2)-u0(i0,i1-1,i2)))) +
+     &                 fac2*(
+     &                 mu0(i0,i1,i2+1)*(
+     &                 fac2*(u1(i0,i1,i2+1)-u1(i0,i1,i2)) +
+     &                 fac1*(u2(i0,i1,i2+1)-u2(i0,i1-1,i2+1))) -
+     &                 mu0(i0,i1,i2)*(
+     &                 fac2*(u1(i0,i1,i2)-u1(i0,i1,i2-1)) +
+     &                 fac1*(u2(i0,i1,i2)-u2(i0,i1-1,i2)))) +
+     &                 fac1*(p(i0,i1,i2)-p(i0,i1-1,i2)))
+               enddo
+               if (beta .ne. 0.d0) then
+                  do i0 = ifirst0,ilast0
+                     r1(i0,i1,i2) = r1(i0,i1,i2) + beta*f1(i0,i1,i2)
+                  enddo
+               endif
+            endif
+            if (i1 .le. ilast1) then
+               do i0 = ifirst0,ilast0
+                  mu_c = (
+     &                 mu0(i0,i1,i2)+mu0(i0,i1+1,i2)+
+     &                 mu0(i0,i1,i2+1)+mu0(i0,i1+1,i2+1)+
+     &                 mu1(i0,i1,i2)+mu1(i0+1,i1,i2)+
+     &                 mu1(i0,i1,i2+1)+mu1(i0+1,i1,i2+1)+
+     &                 mu2(i0,i1,i2)+mu2(i0+1,i1,i2)+
+     &                 mu2(i0,i1+1,i2)+mu2(i0+1,i1+1,i2))/12.d0
+                  mu_l = (
+     &                 mu0(i0,i1,i2-1)+mu0(i0,i1+1,i2-1)+
+     &                 mu0(i0,i1,i2)+mu0(i0,i1+1,i2)+
+     &                 mu1(i0,i1,i2-1)+mu1(i0+1,i1,i2-1)+
+     &                 mu1(i0,i1,i2)+mu1(i0+1,i1,i2)+
+     &                 mu2(i0,i1,i2-1)+mu2(i0+1,i1,i2-1)+
+     &                 mu2(i0,i1+1,i2-1)+mu2(i0+1,i1+1,i2-1))/12.d0
+                  r2(i0,i1,i2) = alpha*(
+     &                 C*u2(i0,i1,i2) +
+     &                 2.d0*fac2*fac2*(
+     &                 mu_c*(u2(i0,i1,i2+1)-u2(i0,i1,i2)) -
+     &                 mu_l*(u2(i0,i1,i2)-u2(i0,i1,i2-1))) +
+     &                 fac0*(
+     &                 mu1(i0+1,i1,i2)*(
+     &                 fac0*(u2(i0+1,i1,i2)-u2(i0,i1,i2)) +
+     &                 fac2*(u0(i0+1,i1,i2)-u0(i0+1,i1,i2-1))) -
+     &                 mu1(i0,i1,i2)*(
+     &                 fac0*(u2(i0,i1,i2)-u2(i0-1,i1,i2)) +
+     &                 fac2*(u0(i0,i1,i2)-u0(i0,i1,i2-1)))) +
+     &                 fac1*(
+     &                 mu0(i0,i1+1,i2)*(
+     &                 fac1*(u2(i0,i1+1,i2)-u2(i0,i1,i2)) +
+     &                 fac2*(u1(i0,i1+1,i2)-u1(i0,i1+1,i2-1))) -
+     &                 mu0(i0,i1,i2)*(
+     &                 fac1*(u2(i0,i1,i2)-u2(i0,i1-1,i2)) +
+     &                 fac2*(u1(i0,i1,i2)-u1(i0,i1,i2-1)))) +
+     &                 fac2*(p(i0,i1,i2)-p(i0,i1,i2-1)))
+               enddo
+               if (beta .ne. 0.d0) then
+                  do i0 = ifirst0,ilast0
+                     r2(i0,i1,i2) = r2(i0,i1,i2) + beta*f2(i0,i1,i2)
+                  enddo
+               endif
+            endif
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
@@ -0,0 +1,207 @@
+// Filename: main.cpp
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libraries
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibamr/PenaltyIBMethod.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+
+// Function prototypes
+double compute_max_penalty_displacement(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, LDataManager* l_data_manager);
+
+/*******************************************************************************
+ * This test advances a light penalty mass attached to a massless IB point by  *
+ * a stiff penalty spring, using a fluid time step size that exceeds the       *
+ * explicit stability limit of the penalty spring.  The maximum separation     *
+ * between the massive and massless points is compared to a multiple of the    *
+ * static gravitational deflection of the penalty spring, and the test passes  *
+ * if the computed motion is (or is not) bounded as expected.  The command     *
+ * line is:                                                                    *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    bool passed = false;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        Pointer<Database> main_db = app_initializer->getComponentDatabase("Main");
+        const bool expect_stable = main_db->getBool("expect_stable");
+        const double max_displacement_bound = main_db->getDouble("max_displacement_bound");
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<PenaltyIBMethod> ib_method_ops =
+            new PenaltyIBMethod("PenaltyIBMethod", app_initializer->getComponentDatabase("PenaltyIBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
+            "IBStandardInitializer", app_initializer->getComponentDatabase("IBStandardInitializer"));
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+        Pointer<IBStandardForceGen> ib_force_fcn = new IBStandardForceGen();
+        ib_method_ops->registerIBLagrangianForceFunction(ib_force_fcn);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+        app_initializer.setNull();
+
+        // Print the input database contents to the log file.
+        plog << "Input database:\n";
+        input_db->printClassData(plog);
+
+        // Main time step loop.  The loop is terminated as soon as the motion of
+        // the massive point becomes unbounded.
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        double loop_time = time_integrator->getIntegratorTime();
+        double loop_time_end = time_integrator->getEndTime();
+        double max_displacement = 0.0;
+        bool bounded = true;
+        while (bounded && !MathUtilities<double>::equalEps(loop_time, loop_time_end) &&
+               time_integrator->stepsRemaining())
+        {
+            const double dt = time_integrator->getMaximumTimeStepSize();
+            time_integrator->advanceHierarchy(dt);
+            loop_time += dt;
+
+            const double displacement = compute_max_penalty_displacement(patch_hierarchy, l_data_manager);
+            pout << "time = " << loop_time << ", max |Y - X| = " << displacement << "\n";
+            bounded = displacement <= max_displacement_bound;
+            if (bounded) max_displacement = std::max(max_displacement, displacement);
+        }
+
+        pout << "penalty spring motion is " << (bounded ? "bounded" : "unbounded")
+             << ", max |Y - X| = " << max_displacement << ", bound = " << max_displacement_bound << "\n";
+        passed = bounded == expect_stable;
+        pout << (passed ? "PASSED" : "FAILED") << "\n";
+
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return passed ? 0 : 1;
+} // main
+
+double
+compute_max_penalty_displacement(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, LDataManager* l_data_manager)
+{
+    double max_displacement = 0.0;
+    const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        if (!l_data_manager->levelContainsLagrangianData(ln)) continue;
+        Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+        Pointer<LData> Y_data = l_data_manager->getLData("Y", ln);
+        const double* const X = X_data->getLocalFormVecArray()->data();
+        const double* const Y = Y_data->getLocalFormVecArray()->data();
+        const unsigned int n_local = X_data->getLocalNodeCount();
+        for (unsigned int i = 0; i < n_local; ++i)
+        {
+            double dX = 0.0;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                dX += (Y[NDIM * i + d] - X[NDIM * i + d]) * (Y[NDIM * i + d] - X[NDIM * i + d]);
+            }
+            dX = sqrt(dX);
+
+            // NOTE: NaN values compare false and are treated as unbounded.
+            max_displacement = dX <= max_displacement ? max_displacement : dX;
+        }
+        X_data->restoreArrays();
+        Y_data->restoreArrays();
+    }
+    return SAMRAI_MPI::maxReduction(max_displacement);
+} // compute_max_penalty_displacement
@@ -0,0 +1,209 @@
+// Filename: main.cpp
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <tbox/PIO.h>
+#include <tbox/SAMRAIManager.h>
+#include <tbox/SAMRAI_MPI.h>
+
+// Headers for basic libraries
+#include <math.h>
+#include <stdio.h>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/LTrajectoryWriter.h>
+#include <ibtk/app_namespaces.h>
+
+// Test parameters.
+static const int NUM_STEPS = 40;
+static const int NUM_POINTS_PER_PROC = 200;
+static const double DT = 0.01;
+static const double ERROR_BOUND = 1.0e-6;
+
+// The global index of the k-th point owned by the specified process.  The
+// indices are widely separated so that they span a large range.
+inline int
+point_index(const int rank, const int k)
+{
+    return 1000003 * rank + 17 * k;
+} // point_index
+
+// Whether the point with the specified index is recorded at the specified
+// step.  Points leave and rejoin the set of recorded points.
+inline bool
+point_is_recorded(const int step, const int idx)
+{
+    return ((step * 7 + idx * 13) % 5) != 0;
+} // point_is_recorded
+
+// The exact position (d < NDIM) or velocity (d >= NDIM) of a point.
+inline double
+point_value(const int step, const int idx, const int d)
+{
+    const double t = static_cast<double>(step) * DT;
+    return (d < NDIM ? 10.0 : 1.0) * sin(t * (1.0 + 0.001 * (idx % 1000)) + 0.7 * d + 0.01 * idx);
+} // point_value
+
+// Record steps [step_begin, step_end) of the local points.
+void
+record_steps(const int step_begin, const int step_end)
+{
+    const int rank = SAMRAI_MPI::getRank();
+    LTrajectoryWriter trajectory_writer("LTrajectoryWriter", "trajectory_data", ERROR_BOUND, true, 1000);
+    std::vector<int> idx;
+    std::vector<double> X, U;
+    for (int step = step_begin; step < step_end; ++step)
+    {
+        idx.clear();
+        X.clear();
+        U.clear();
+        // Record the points in reverse order to check that the writer does not
+        // rely on the points being sorted.
+        for (int k = NUM_POINTS_PER_PROC - 1; k >= 0; --k)
+        {
+            const int i = point_index(rank, k);
+            if (!point_is_recorded(step, i)) continue;
+            idx.push_back(i);
+            for (int d = 0; d < NDIM; ++d)
+            {
+                X.push_back(point_value(step, i, d));
+                U.push_back(point_value(step, i, NDIM + d));
+            }
+        }
+        trajectory_writer.recordPointData(idx.empty() ? NULL : &idx[0],
+                                          X.empty() ? NULL : &X[0],
+                                          U.empty() ? NULL : &U[0],
+                                          static_cast<unsigned int>(idx.size()),
+                                          static_cast<double>(step) * DT);
+    }
+    return;
+} // record_steps
+
+/*******************************************************************************
+ * This test writes compressed trajectory data with class LTrajectoryWriter,    *
+ * merges the per-process files, and checks that the decoded data agree with   *
+ * the recorded data to within the specified error bound.                      *
+ *                                                                             *
+ *    executable                                                               *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    int num_failures = 0;
+    {
+        // Record the steps using two writers in succession, so that the second
+        // writer appends to the files written by the first.  Several chunks are
+        // written by each writer.
+        const int num_procs = SAMRAI_MPI::getNodes();
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            for (int rank = 0; rank < num_procs; ++rank)
+            {
+                std::ostringstream file_name;
+                file_name << "trajectory_data/trajectory." << std::setw(5) << std::setfill('0') << rank << ".dat";
+                remove(file_name.str().c_str());
+            }
+        }
+        SAMRAI_MPI::barrier();
+        record_steps(0, NUM_STEPS / 2);
+        record_steps(NUM_STEPS / 2, NUM_STEPS);
+        SAMRAI_MPI::barrier();
+
+        // Merge and check the data.
+        if (SAMRAI_MPI::getRank() == 0)
+        {
+            LTrajectoryWriter::mergeTrajectoryFiles("trajectory_data", num_procs, "trajectory_data/merged.dat");
+            std::ifstream is("trajectory_data/merged.dat");
+            int num_lines = 0, num_expected_lines = 0;
+            double max_error = 0.0;
+            for (int step = 0; step < NUM_STEPS; ++step)
+            {
+                for (int rank = 0; rank < num_procs; ++rank)
+                {
+                    for (int k = 0; k < NUM_POINTS_PER_PROC; ++k)
+                    {
+                        const int i = point_index(rank, k);
+                        if (!point_is_recorded(step, i)) continue;
+                        ++num_expected_lines;
+                        double t;
+                        int idx;
+                        if (!(is >> t >> idx)) break;
+                        ++num_lines;
+                        if (idx != i || fabs(t - static_cast<double>(step) * DT) > 1.0e-12)
+                        {
+                            ++num_failures;
+                            continue;
+                        }
+                        for (int d = 0; d < 2 * NDIM; ++d)
+                        {
+                            double v;
+                            is >> v;
+                            max_error = std::max(max_error, fabs(v - point_value(step, i, d)));
+                        }
+                    }
+                }
+            }
+            std::string extra;
+            if (num_lines != num_expected_lines || (is >> extra)) ++num_failures;
+            // Allow for the rounding of the values printed to the merged file.
+            if (max_error > ERROR_BOUND * (1.0 + 1.0e-6)) ++num_failures;
+            pout << "number of points read:     " << num_lines << " (expected " << num_expected_lines << ")\n";
+            pout << "maximum absolute error:    " << max_error << " (error bound " << ERROR_BOUND << ")\n";
+            pout << (num_failures == 0 ? "PASSED" : "FAILED") << "\n";
+        }
+        num_failures = SAMRAI_MPI::bcast(num_failures, 0);
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return num_failures == 0 ? 0 : 1;
+} // main
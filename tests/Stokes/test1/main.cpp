@@ -0,0 +1,319 @@
+// Filename: main.cpp
+// Created on 19 Oct 2026
+//
+// Copyright (c) 2002-2017, Boyce Griffith
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice,
+//      this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of The University of North Carolina nor the names of
+//      its contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Config files
+#include <IBAMR_config.h>
+#include <IBTK_config.h>
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <ComponentSelector.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchyDataOpsManager.h>
+#include <LoadBalancer.h>
+#include <PoissonSpecifications.h>
+#include <StandardTagAndInitialize.h>
+#include <VariableDatabase.h>
+
+// Headers for basic libraries
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/StaggeredStokesOperatorUtilities.h>
+#include <ibamr/app_namespaces.h>
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyGhostCellInterpolation.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+/*******************************************************************************
+ * This test compares the fused staggered Stokes operator implemented by       *
+ * StaggeredStokesOperatorUtilities::applyOperator() with the composition of   *
+ * HierarchyMathOps::grad(), laplace() or vc_laplace(), and div() that it      *
+ * replaces.  The command line is:                                             *
+ *                                                                             *
+ *    executable <input file name>                                             *
+ *                                                                             *
+ *******************************************************************************/
+int
+main(int argc, char* argv[])
+{
+    // Initialize PETSc, MPI, and SAMRAI.
+    PetscInitialize(&argc, &argv, NULL, NULL);
+    SAMRAI_MPI::setCommunicator(PETSC_COMM_WORLD);
+    SAMRAI_MPI::setCallAbortInSerialInsteadOfExit();
+    SAMRAIManager::startup();
+
+    int num_failures = 0;
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "stokes_operator.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        const double C = input_db->getDouble("C");
+        const double D = input_db->getDouble("D");
+        const double tol = input_db->getDoubleWithDefault("TOL", 1.0e-10);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+        Pointer<SideVariable<NDIM, double> > f_u_var = new SideVariable<NDIM, double>("f_u");
+        Pointer<SideVariable<NDIM, double> > r_u_var = new SideVariable<NDIM, double>("r_u");
+        Pointer<SideVariable<NDIM, double> > r_u_ref_var = new SideVariable<NDIM, double>("r_u_ref");
+        Pointer<SideVariable<NDIM, double> > grad_p_var = new SideVariable<NDIM, double>("grad_p");
+
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+        const int f_u_idx = var_db->registerVariableAndContext(f_u_var, ctx, IntVector<NDIM>(0));
+        const int r_u_idx = var_db->registerVariableAndContext(r_u_var, ctx, IntVector<NDIM>(0));
+        const int r_u_ref_idx = var_db->registerVariableAndContext(r_u_ref_var, ctx, IntVector<NDIM>(0));
+        const int grad_p_idx = var_db->registerVariableAndContext(grad_p_var, ctx, IntVector<NDIM>(0));
+
+        Pointer<CellVariable<NDIM, double> > p_var = new CellVariable<NDIM, double>("p");
+        Pointer<CellVariable<NDIM, double> > f_p_var = new CellVariable<NDIM, double>("f_p");
+        Pointer<CellVariable<NDIM, double> > r_p_var = new CellVariable<NDIM, double>("r_p");
+        Pointer<CellVariable<NDIM, double> > r_p_ref_var = new CellVariable<NDIM, double>("r_p_ref");
+
+        const int p_idx = var_db->registerVariableAndContext(p_var, ctx, IntVector<NDIM>(1));
+        const int f_p_idx = var_db->registerVariableAndContext(f_p_var, ctx, IntVector<NDIM>(0));
+        const int r_p_idx = var_db->registerVariableAndContext(r_p_var, ctx, IntVector<NDIM>(0));
+        const int r_p_ref_idx = var_db->registerVariableAndContext(r_p_ref_var, ctx, IntVector<NDIM>(0));
+
+        Pointer<NodeVariable<NDIM, double> > mu_var = new NodeVariable<NDIM, double>("mu");
+
+        const int mu_idx = var_db->registerVariableAndContext(mu_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int coarsest_ln = 0;
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        pout << "number of levels: " << finest_ln + 1 << "\n";
+
+        // Set the simulation time to be zero.
+        const double data_time = 0.0;
+
+        // Allocate data on each level of the patch hierarchy.
+        ComponentSelector data;
+        data.setFlag(u_idx);
+        data.setFlag(f_u_idx);
+        data.setFlag(r_u_idx);
+        data.setFlag(r_u_ref_idx);
+        data.setFlag(grad_p_idx);
+        data.setFlag(p_idx);
+        data.setFlag(f_p_idx);
+        data.setFlag(r_p_idx);
+        data.setFlag(r_p_ref_idx);
+        data.setFlag(mu_idx);
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            patch_hierarchy->getPatchLevel(ln)->allocatePatchData(data, data_time);
+        }
+
+        // Setup the operands.
+        muParserCartGridFunction u_fcn("u", app_initializer->getComponentDatabase("u"), grid_geometry);
+        muParserCartGridFunction p_fcn("p", app_initializer->getComponentDatabase("p"), grid_geometry);
+        muParserCartGridFunction f_u_fcn("f_u", app_initializer->getComponentDatabase("f_u"), grid_geometry);
+        muParserCartGridFunction f_p_fcn("f_p", app_initializer->getComponentDatabase("f_p"), grid_geometry);
+        muParserCartGridFunction mu_fcn("mu", app_initializer->getComponentDatabase("mu"), grid_geometry);
+
+        u_fcn.setDataOnPatchHierarchy(u_idx, u_var, patch_hierarchy, data_time);
+        p_fcn.setDataOnPatchHierarchy(p_idx, p_var, patch_hierarchy, data_time);
+        f_u_fcn.setDataOnPatchHierarchy(f_u_idx, f_u_var, patch_hierarchy, data_time);
+        f_p_fcn.setDataOnPatchHierarchy(f_p_idx, f_p_var, patch_hierarchy, data_time);
+        mu_fcn.setDataOnPatchHierarchy(mu_idx, mu_var, patch_hierarchy, data_time);
+
+        // Synchronize the coarse-fine interface of the side-centered operands
+        // before filling ghost cells.  The fused operator synchronizes u in
+        // place and synchronizes the complete residual, whereas the composite
+        // operator synchronizes only the Laplacian term, so the two agree
+        // along the coarse-fine interface only when these data are already
+        // synchronized.
+        Pointer<HierarchyMathOps> hier_math_ops =
+            new HierarchyMathOps("hier_math_ops", patch_hierarchy, coarsest_ln, finest_ln);
+        hier_math_ops->synchronizeCoarseFineBoundary(u_idx);
+        hier_math_ops->synchronizeCoarseFineBoundary(f_u_idx);
+
+        // Fill ghost cell values.
+        typedef HierarchyGhostCellInterpolation::InterpolationTransactionComponent InterpolationTransactionComponent;
+        vector<InterpolationTransactionComponent> transactions(3);
+        transactions[0] = InterpolationTransactionComponent(
+            u_idx, "CONSERVATIVE_LINEAR_REFINE", true, "CONSERVATIVE_COARSEN", "LINEAR", false);
+        transactions[1] = InterpolationTransactionComponent(
+            p_idx, "CONSERVATIVE_LINEAR_REFINE", true, "CONSERVATIVE_COARSEN", "LINEAR", false);
+        transactions[2] =
+            InterpolationTransactionComponent(mu_idx, "LINEAR_REFINE", false, "CONSTANT_COARSEN", "LINEAR", false);
+        Pointer<HierarchyGhostCellInterpolation> bdry_fill_op = new HierarchyGhostCellInterpolation();
+        bdry_fill_op->initializeOperatorState(transactions, patch_hierarchy, coarsest_ln, finest_ln);
+        bdry_fill_op->fillData(data_time);
+
+        HierarchyDataOpsManager<NDIM>* hier_data_ops_manager = HierarchyDataOpsManager<NDIM>::getManager();
+        Pointer<HierarchyDataOpsReal<NDIM, double> > hier_sc_data_ops =
+            hier_data_ops_manager->getOperationsDouble(u_var, patch_hierarchy, /*get_unique*/ true);
+        Pointer<HierarchyDataOpsReal<NDIM, double> > hier_cc_data_ops =
+            hier_data_ops_manager->getOperationsDouble(p_var, patch_hierarchy, /*get_unique*/ true);
+
+        // Compare the two implementations for the constant and variable
+        // viscosity forms of the operator, both for the action of the operator
+        // (alpha = 1, beta = 0) and for the residual (alpha = -1, beta = 1).
+        for (int vc = 0; vc < 2; ++vc)
+        {
+            const bool use_vc = (vc == 1);
+            PoissonSpecifications U_problem_coefs("U_problem_coefs");
+            U_problem_coefs.setCConstant(C);
+            if (use_vc)
+            {
+                U_problem_coefs.setDPatchDataId(mu_idx);
+            }
+            else
+            {
+                U_problem_coefs.setDConstant(D);
+            }
+            for (int residual = 0; residual < 2; ++residual)
+            {
+                const double alpha = residual ? -1.0 : 1.0;
+                const double beta = residual ? 1.0 : 0.0;
+
+                // Compute [r_u;r_p] := alpha*A*[u;p] + beta*[f_u;f_p] in a
+                // single pass.
+                StaggeredStokesOperatorUtilities::applyOperator(r_u_idx,
+                                                                r_p_idx,
+                                                                u_idx,
+                                                                p_idx,
+                                                                U_problem_coefs,
+                                                                alpha,
+                                                                beta,
+                                                                f_u_idx,
+                                                                f_p_idx,
+                                                                patch_hierarchy,
+                                                                coarsest_ln,
+                                                                finest_ln,
+                                                                hier_math_ops);
+
+                // Compute the same quantity one term at a time.
+                hier_math_ops->grad(
+                    grad_p_idx, grad_p_var, /*cf_bdry_synch*/ false, 1.0, p_idx, p_var, NULL, data_time);
+                if (use_vc)
+                {
+                    hier_math_ops->vc_laplace(r_u_ref_idx,
+                                              r_u_ref_var,
+                                              1.0,
+                                              C,
+                                              mu_idx,
+                                              mu_var,
+                                              u_idx,
+                                              u_var,
+                                              NULL,
+                                              data_time,
+                                              1.0,
+                                              grad_p_idx,
+                                              grad_p_var);
+                }
+                else
+                {
+                    hier_math_ops->laplace(r_u_ref_idx,
+                                           r_u_ref_var,
+                                           U_problem_coefs,
+                                           u_idx,
+                                           u_var,
+                                           NULL,
+                                           data_time,
+                                           1.0,
+                                           grad_p_idx,
+                                           grad_p_var);
+                }
+                hier_math_ops->div(
+                    r_p_ref_idx, r_p_ref_var, -1.0, u_idx, u_var, NULL, data_time, /*cf_bdry_synch*/ true);
+                hier_sc_data_ops->linearSum(r_u_ref_idx, alpha, r_u_ref_idx, beta, f_u_idx);
+                hier_cc_data_ops->linearSum(r_p_ref_idx, alpha, r_p_ref_idx, beta, f_p_idx);
+
+                // Compare the results on all levels, including the parts of the
+                // coarser levels that are covered by finer levels.
+                const double r_u_norm = hier_sc_data_ops->maxNorm(r_u_ref_idx);
+                const double r_p_norm = hier_cc_data_ops->maxNorm(r_p_ref_idx);
+                hier_sc_data_ops->subtract(r_u_ref_idx, r_u_ref_idx, r_u_idx);
+                hier_cc_data_ops->subtract(r_p_ref_idx, r_p_ref_idx, r_p_idx);
+                const double e_u = hier_sc_data_ops->maxNorm(r_u_ref_idx) / std::max(1.0, r_u_norm);
+                const double e_p = hier_cc_data_ops->maxNorm(r_p_ref_idx) / std::max(1.0, r_p_norm);
+                const bool passed = e_u <= tol && e_p <= tol;
+                if (!passed) ++num_failures;
+                pout << (use_vc ? "variable" : "constant") << " viscosity, " << (residual ? "residual:" : "apply:   ")
+                     << " |e_u|_oo = " << e_u << ", |e_p|_oo = " << e_p << (passed ? "" : "  FAILED") << "\n";
+            }
+        }
+        pout << (num_failures == 0 ? "PASSED" : "FAILED") << "\n";
+
+        // Deallocate data.
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            patch_hierarchy->getPatchLevel(ln)->deallocatePatchData(data);
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+
+    SAMRAIManager::shutdown();
+    PetscFinalize();
+    return num_failures == 0 ? 0 : 1;
+} // main